@@ -51,6 +51,7 @@ extern "C" {
   marpaWrapper_EXPORT short                        marpaWrapperRecognizer_contextGetb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int i, marpaWrapperRecognizerContext_t *contextp);
   marpaWrapper_EXPORT short                        marpaWrapperRecognizer_currentEarlemeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int *ip);
   marpaWrapper_EXPORT short                        marpaWrapperRecognizer_earlemeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int i, int *ip);
+  marpaWrapper_EXPORT short                        marpaWrapperRecognizer_earleySetSizeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int i, int *ip);
   marpaWrapper_EXPORT short                        marpaWrapperRecognizer_furthestEarlemeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int *ip);
   marpaWrapper_EXPORT void                         marpaWrapperRecognizer_freev(marpaWrapperRecognizer_t *marpaWrapperRecognizerp);
 #ifdef __cplusplus
@@ -35,6 +35,7 @@ extern "C" {
 								    marpaWrapperValueRuleCallback_t    ruleCallbackp,
 								    marpaWrapperValueSymbolCallback_t  symbolCallbackp,
 								    marpaWrapperValueNullingCallback_t nullingCallbackp);
+  marpaWrapper_EXPORT short                marpaWrapperValue_skipb(marpaWrapperValue_t *marpaWrapperValuep);
   marpaWrapper_EXPORT short                marpaWrapperValue_value_startb(marpaWrapperValue_t *marpaWrapperValuep, int *startip);
   marpaWrapper_EXPORT short                marpaWrapperValue_value_lengthb(marpaWrapperValue_t *marpaWrapperValuep, int *lengthip);
   marpaWrapper_EXPORT void                 marpaWrapperValue_freev(marpaWrapperValue_t *marpaWrapperValuep);
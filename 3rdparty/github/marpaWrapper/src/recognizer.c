@@ -851,6 +851,53 @@ short marpaWrapperRecognizer_earlemeb(marpaWrapperRecognizer_t *marpaWrapperReco
   return 0;
 }
 
+/****************************************************************************/
+short marpaWrapperRecognizer_earleySetSizeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int i, int *ip)
+/****************************************************************************/
+{
+  MARPAWRAPPER_FUNCS(marpaWrapperRecognizer_earleySetSizeb)
+  int                    reali = i;
+  Marpa_Earley_Set_ID    marpaLatestEarleySetIdi;
+  int                    sizei;
+
+#ifndef NDEBUG
+  if (MARPAWRAPPER_UNLIKELY(marpaWrapperRecognizerp == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+#endif
+
+  /* This function always succeed as per doc */
+  MARPAWRAPPER_TRACEF(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), funcs, "marpa_r_latest_earley_set(%p)", marpaWrapperRecognizerp->marpaRecognizerp);
+  marpaLatestEarleySetIdi = marpa_r_latest_earley_set(marpaWrapperRecognizerp->marpaRecognizerp);
+  if (reali < 0) {
+    reali += (marpaLatestEarleySetIdi + 1);
+  }
+  if (MARPAWRAPPER_UNLIKELY((reali < 0) || (reali > marpaLatestEarleySetIdi))) {
+    MARPAWRAPPER_ERRORF(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), "i must be in range [%d-%d]", (int) (-(marpaLatestEarleySetIdi+1)), (int) marpaLatestEarleySetIdi);
+    errno = EINVAL;
+    goto err;
+  }
+
+  MARPAWRAPPER_TRACEF(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), funcs, "_marpa_r_earley_set_size(%p, %d)", marpaWrapperRecognizerp->marpaRecognizerp, reali);
+  sizei = _marpa_r_earley_set_size(marpaWrapperRecognizerp->marpaRecognizerp, (Marpa_Earley_Set_ID) reali);
+  if (MARPAWRAPPER_UNLIKELY(sizei < 0)) {
+    MARPAWRAPPER_MARPA_G_ERROR(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), marpaWrapperRecognizerp->marpaWrapperGrammarp->marpaGrammarp);
+    goto err;
+  }
+
+  if (ip != NULL) {
+    *ip = sizei;
+  }
+
+  MARPAWRAPPER_TRACE(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), funcs, "return 1");
+  return 1;
+
+ err:
+  MARPAWRAPPER_TRACE(MARPAWRAPPERRECOGNIZER_GENERICLOGGERP(marpaWrapperRecognizerp), funcs, "return 0");
+  return 0;
+}
+
 /****************************************************************************/
 short marpaWrapperRecognizer_furthestEarlemeb(marpaWrapperRecognizer_t *marpaWrapperRecognizerp, int *ip)
 /****************************************************************************/
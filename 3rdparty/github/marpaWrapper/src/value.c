@@ -352,6 +352,51 @@ short marpaWrapperValue_valueb(marpaWrapperValue_t               *marpaWrapperVa
   return -1;
 }
 
+/****************************************************************************/
+short marpaWrapperValue_skipb(marpaWrapperValue_t *marpaWrapperValuep)
+/****************************************************************************/
+{
+  MARPAWRAPPER_FUNCS(marpaWrapperValue_skipb)
+  int tnexti;
+  int nParsesi;
+
+#ifndef NDEBUG
+  if (MARPAWRAPPER_UNLIKELY(marpaWrapperValuep == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+#endif
+
+  /* Same iteration as marpaWrapperValue_valueb(), without creating a value */
+  MARPAWRAPPER_TRACEF(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "marpa_t_next(%p)", marpaWrapperValuep->marpaTreep);
+  tnexti = marpa_t_next(marpaWrapperValuep->marpaTreep);
+  if (MARPAWRAPPER_UNLIKELY(tnexti < -1)) {
+    MARPAWRAPPER_MARPA_G_ERROR(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), marpaWrapperValuep->marpaWrapperRecognizerp->marpaWrapperGrammarp->marpaGrammarp);
+    goto err;
+  } else if (tnexti == -1) {
+    MARPAWRAPPER_TRACE(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "Tree iterator exhausted");
+    goto done;
+  }
+
+  MARPAWRAPPER_TRACEF(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "marpa_t_parse_count(%p)", marpaWrapperValuep->marpaTreep);
+  nParsesi = marpa_t_parse_count(marpaWrapperValuep->marpaTreep);
+  if ((marpaWrapperValuep->marpaWrapperValueOption.maxParsesi > 0) && (nParsesi > marpaWrapperValuep->marpaWrapperValueOption.maxParsesi)) {
+    MARPAWRAPPER_TRACEF(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "Maximum number of parse trees is reached: %d", marpaWrapperValuep->marpaWrapperValueOption.maxParsesi);
+    goto done;
+  }
+
+  MARPAWRAPPER_TRACE(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "return 1");
+  return 1;
+
+ done:
+  MARPAWRAPPER_TRACE(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "return 0");
+  return 0;
+
+ err:
+  MARPAWRAPPER_TRACE(MARPAWRAPPERVALUE_GENERICLOGGERP(marpaWrapperValuep), funcs, "return -1");
+  return -1;
+}
+
 /****************************************************************************/
 short marpaWrapperValue_value_startb(marpaWrapperValue_t *marpaWrapperValuep, int *startip)
 /****************************************************************************/
@@ -76,6 +76,7 @@ int main() {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     exit(1);
@@ -113,6 +114,7 @@ int main() {
   marpaESLIFRecognizerOption.buftriggerperci   = 50; /* Recommended value */
   marpaESLIFRecognizerOption.bufaddperci       = 50; /* Recommended value */
   marpaESLIFRecognizerOption.ifActionResolverp = NULL; /* symbol if-action resolver */
+  marpaESLIFRecognizerOption.maxMemoryl        = 0; /* No memory limit */
   marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   if (marpaESLIFRecognizerp == NULL) {
     exit(1);
@@ -104,6 +104,7 @@ int main() {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -129,6 +130,7 @@ int main() {
   marpaESLIFRecognizerOption.buftriggerperci           = 50; /* Recommended value */
   marpaESLIFRecognizerOption.bufaddperci               = 50; /* Recommended value */
   marpaESLIFRecognizerOption.ifActionResolverp         = NULL; /* symbol if-action resolver */
+  marpaESLIFRecognizerOption.maxMemoryl                = 0; /* No memory limit */
   marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   if (marpaESLIFRecognizerp == NULL) {
     exit(1);
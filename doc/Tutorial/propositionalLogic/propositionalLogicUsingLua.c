@@ -166,6 +166,7 @@ int main() {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -190,6 +191,7 @@ int main() {
   marpaESLIFRecognizerOption.bufsizl           = 0;  /* Recommended value */
   marpaESLIFRecognizerOption.buftriggerperci   = 50; /* Recommended value */
   marpaESLIFRecognizerOption.bufaddperci       = 50; /* Recommended value */
+  marpaESLIFRecognizerOption.maxMemoryl        = 0; /* No memory limit */
   marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   if (marpaESLIFRecognizerp == NULL) {
     exit(1);
@@ -197,6 +197,7 @@ typedef struct marpaESLIFRecognizerOption {
   marpaESLIFRecognizerRegexActionResolver_t      regexActionResolverp; /* Will return the function doing the wanted regex callout action */
   marpaESLIFRecognizerGeneratorActionResolver_t  generatorActionResolverp; /* Will return the function doing the wanted symbol generation action */
   marpaESLIFRecognizerImport_t                   importerp;           /* If end-user want to import a marpaESLIFValueResult */
+  size_t                                         maxMemoryl;          /* Maximum number of bytes used by the recognizer, its sub-recognizers and valuations. Default: 0, i.e. no limit */
 } marpaESLIFRecognizerOption_t;
 
 typedef enum marpaESLIFEventType {
@@ -378,6 +379,43 @@ typedef struct marpaESLIFValueOption {
   int                                   maxParsesi;            /* Default: 0 */
 } marpaESLIFValueOption_t;
 
+/* Walk valuation: the parse tree is streamed to a single callback, bottom-up, without value stack */
+typedef enum marpaESLIFValueWalkType {
+  MARPAESLIF_VALUE_WALK_LEXEME = 0, /* A lexeme was consumed */
+  MARPAESLIF_VALUE_WALK_NULLED,     /* A nulled symbol */
+  MARPAESLIF_VALUE_WALK_RULE        /* A rule whose nbChildreni children were the latest completed nodes */
+} marpaESLIFValueWalkType_t;
+
+typedef struct marpaESLIFValueWalk {
+  marpaESLIFValueWalkType_t  type;
+  int                        symboli;     /* Lexeme or nulled symbol Id, LHS Id for a rule */
+  int                        rulei;       /* Rule Id, -1 unless type is MARPAESLIF_VALUE_WALK_RULE */
+  int                        nbChildreni; /* Number of RHS nodes, 0 unless type is MARPAESLIF_VALUE_WALK_RULE */
+  int                        starti;      /* Start Earley Set Id */
+  int                        lengthi;     /* Number of Earley Set Ids, 0 for a nulled symbol */
+  marpaESLIFValueResult_t   *lexemep;     /* Shallow pointer to the lexeme value, NULL unless type is MARPAESLIF_VALUE_WALK_LEXEME */
+} marpaESLIFValueWalk_t;
+
+typedef short (*marpaESLIFValueWalkCallback_t)(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp);
+
+/* Flat AST: a single buffer made of a marpaESLIFValueFlatAst_t header, nbNodel nodes in preorder, and an optional string pool */
+typedef struct marpaESLIFValueFlatAstNode {
+  marpaESLIFValueWalkType_t  type;
+  int                        idi;         /* Rule Id if type is MARPAESLIF_VALUE_WALK_RULE, symbol Id otherwise */
+  int                        nbChildreni; /* Number of children */
+  int                        starti;      /* Start Earley Set Id */
+  int                        lengthi;     /* Number of Earley Set Ids */
+  size_t                     sizel;       /* Number of nodes in this subtree, itself included: next sibling is at this node + sizel */
+  size_t                     poolOffsetl; /* Lexeme bytes offset in the string pool */
+  size_t                     poolLengthl; /* Lexeme bytes length in the string pool, 0 if none */
+} marpaESLIFValueFlatAstNode_t;
+
+typedef struct marpaESLIFValueFlatAst {
+  size_t                     nbNodel;     /* Number of nodes following this header */
+  size_t                     poolOffsetl; /* String pool offset from the start of the buffer */
+  size_t                     poolLengthl; /* String pool length, 0 if none */
+} marpaESLIFValueFlatAst_t;
+
 typedef struct marpaESLIFRecognizerProgress {
   int earleySetIdi;
   int earleySetOrigIdi;
@@ -546,6 +584,11 @@ typedef struct marpaESLIFSymbolProperty {
 /*           marpaESLIF tries hard to use a non-floating number, calls the proposal in any other case.     */
 typedef short (*marpaESLIFJSONProposalAction_t)(void *userDatavp, char *strings, size_t stringl, marpaESLIFValueResult_t *marpaESLIFValueResultp, short confidenceb);
 
+/* When set, the value callback is called on every value completed at depth valueDepthl, the top-level value being at depth 0.  */
+/* keyp is the object key when the value is an object member, NULL otherwise. Key and value are freed when the callback returns */
+/* and are not stored in their container, so that memory does not grow with the number of such values.                         */
+typedef short (*marpaESLIFJSONDecodeValueCallback_t)(void *userDatavp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t *valuep);
+
 typedef struct marpaESLIFJSONDecodeOption {
   short                                        disallowDupkeysb;                /* Do not allow duplicate key in an object */
   size_t                                       maxDepthl;                       /* Maximum depth - 0 if no maximum */
@@ -555,10 +598,39 @@ typedef struct marpaESLIFJSONDecodeOption {
   marpaESLIFJSONProposalAction_t               positiveNanActionp;              /* +Nan action */
   marpaESLIFJSONProposalAction_t               negativeNanActionp;              /* -Nan action */
   marpaESLIFJSONProposalAction_t               numberActionp;                   /* Number action */
+  marpaESLIFJSONDecodeValueCallback_t          valueCallbackp;                  /* Value callback - NULL if none */
+  size_t                                       valueDepthl;                     /* Depth of the values given to the value callback */
+  short                                        multipleb;                       /* Input is a sequence of documents, e.g. NDJSON */
+  char                                       **pathsp;                          /* JSON Pointer-like paths of the values to keep, "*" matches any key or index */
+  size_t                                       pathl;                           /* Number of paths - 0 to keep everything */
 } marpaESLIFJSONDecodeOption_t;
 
+/* Direct JSON encoder: output is given to the writer in chunks, or returned as a single buffer if there is no writer. */
+typedef short (*marpaESLIFJSONEncodeWriter_t)(void *userDatavp, char *bytep, size_t bytel);
+
+typedef struct marpaESLIFJSONEncodeOption {
+  short                                        strictb;                         /* Strict JSON: +/-Infinity and NaN are encoded as null */
+  marpaESLIFJSONEncodeWriter_t                 writerp;                         /* Writer - NULL for a single buffer */
+  void                                        *userDatavp;                      /* Given to the writer and to representation callbacks */
+  size_t                                       chunkl;                          /* Chunk size - 0 for the default */
+} marpaESLIFJSONEncodeOption_t;
+
+/* Allocator: memory allocated by ESLIF code goes through it, the bundled libraries keep using the C library */
+typedef void *(*marpaESLIFAllocatorMalloc_t)(void *userDatavp, size_t sizel);
+typedef void *(*marpaESLIFAllocatorRealloc_t)(void *userDatavp, void *p, size_t sizel); /* Like realloc(), p is never NULL */ 
+typedef void  (*marpaESLIFAllocatorFree_t)(void *userDatavp, void *p);                /* p is never NULL */
+
+typedef struct marpaESLIFAllocator {
+  void                         *userDatavp;  /* Given to all the functions */
+  marpaESLIFAllocatorMalloc_t   mallocp;     /* Mandatory */
+  marpaESLIFAllocatorRealloc_t  reallocp;    /* Mandatory */
+  marpaESLIFAllocatorFree_t     freep;       /* Mandatory */
+} marpaESLIFAllocator_t;
+
+/* Zero it before setting its members: members added later default to zero */
 typedef struct marpaESLIFOption {
-  genericLogger_t *genericLoggerp;  /* Logger. Default: NULL */
+  genericLogger_t       *genericLoggerp;  /* Logger. Default: NULL */
+  marpaESLIFAllocator_t *allocatorp;      /* Allocator. Default: NULL, i.e. the C library */
 } marpaESLIFOption_t;
 
 typedef struct marpaESLIFGrammarOption {
@@ -568,9 +640,49 @@ typedef struct marpaESLIFGrammarOption {
   size_t  encodingl;           /* Length of encoding itself. Default: 0 */
 } marpaESLIFGrammarOption_t;
 
+typedef struct marpaESLIFGrammarGeneratorCacheStats {
+  size_t entriesl;   /* Number of cached generated grammars */
+  size_t bytesl;     /* Total length in bytes of the generated strings they come from */
+  size_t hitl;       /* Number of lookups that found a cached grammar */
+  size_t missl;      /* Number of lookups that did not */
+  size_t evictionl;  /* Number of evicted grammars */
+} marpaESLIFGrammarGeneratorCacheStats_t;
+
+typedef struct marpaESLIFRegexCacheStats {
+  size_t entriesl;   /* Number of cached compiled regexes */
+  size_t hitl;       /* Number of lookups that restored a compiled regex */
+  size_t missl;      /* Number of lookups that did not */
+} marpaESLIFRegexCacheStats_t;
+
+/* Memory accounted to a top-level recognizer */
+typedef struct marpaESLIFRecognizerMemoryStats {
+  size_t currentl;   /* Number of bytes in use */
+  size_t peakl;      /* Highest number of bytes in use */
+  size_t limitl;     /* maxMemoryl recognizer option, 0 for no limit */
+} marpaESLIFRecognizerMemoryStats_t;
+
+/* Error recovery: a record that failed, and where parsing resumed */
+typedef struct marpaESLIFRecoveryError {
+  size_t startl;     /* Offset of the start of the failed record */
+  size_t offsetl;    /* Offset where the failure was detected */
+  size_t endl;       /* Offset where parsing resumes, i.e. after the synchronisation terminal */
+  size_t linel;      /* Line number at the failure, 0 unless newline counting is on */
+  size_t columnl;    /* Column number at the failure, 0 unless newline counting is on */
+} marpaESLIFRecoveryError_t;
+
+typedef short (*marpaESLIFRecoveryErrorCallback_t)(void *userDatavp, marpaESLIFRecoveryError_t *marpaESLIFRecoveryErrorp);
+
+typedef struct marpaESLIFRecoveryOption {
+  marpaESLIFSymbol_t                **syncSymbolpp;   /* Synchronisation terminals */
+  size_t                              syncSymboll;    /* Number of synchronisation terminals */
+  size_t                              maxErrorl;      /* Maximum number of errors, 0 for no limit */
+  marpaESLIFRecoveryErrorCallback_t   errorCallbackp; /* Called with recognizer option's userDatavp on every error. Default: NULL */
+} marpaESLIFRecoveryOption_t;
+
 /* Opaque types */
 typedef struct marpaESLIF        marpaESLIF_t;
 typedef struct marpaESLIFGrammar marpaESLIFGrammar_t;
+typedef struct marpaESLIFValueResultTableIndex marpaESLIFValueResultTableIndex_t;
 
 /* Ask the host system to import a marpaESLIFValueResult in the symbol namespace */
 typedef short (*marpaESLIFSymbolImport_t)(marpaESLIFSymbol_t *marpaESLIFSymbolp, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
@@ -594,6 +706,14 @@ extern "C" {
   /* restricted to not special numbers, i.e. /[+-]?(?:[0-9]+)(?:\\.[0-9]+)?(?:[eE][+-]?[0-9]+)?/.                          */
   /* This does NOT handle Infinity nor Nans, see the specific functions later that check on the explicit value.            */
   marpaESLIF_EXPORT short                         marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size_t sizel, marpaESLIFValueResult_t *marpaESLIFValueResultp, short *confidencebp);
+  /* Compiled regex cache, keyed by PCRE2 version, compile options and pattern. It is disabled by default. */
+  /* When enabled, grammar creation must not happen concurrently on the same marpaESLIF_t.               */
+  /* The export is persistent until the next export or until ESLIF is freed, and is valid only for the   */
+  /* same platform and PCRE2 version: it can be saved to disk and imported by another process.            */
+  marpaESLIF_EXPORT short                         marpaESLIF_regex_cacheb(marpaESLIF_t *marpaESLIFp, short enableb);
+  marpaESLIF_EXPORT short                         marpaESLIF_regex_cache_exportb(marpaESLIF_t *marpaESLIFp, char **bytespp, size_t *bytelp);
+  marpaESLIF_EXPORT short                         marpaESLIF_regex_cache_importb(marpaESLIF_t *marpaESLIFp, char *bytes, size_t bytel);
+  marpaESLIF_EXPORT short                         marpaESLIF_regex_cache_statsb(marpaESLIF_t *marpaESLIFp, marpaESLIFRegexCacheStats_t *statsp);
 
   marpaESLIF_EXPORT marpaESLIFGrammar_t          *marpaESLIFGrammar_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammarOption_t *marpaESLIFGrammarOptionp);
   marpaESLIF_EXPORT marpaESLIF_t                 *marpaESLIFGrammar_eslifp(marpaESLIFGrammar_t *marpaESLIFGrammarp);
@@ -617,6 +737,8 @@ extern "C" {
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_symbolarray_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int **symbolipp, size_t *symbollp, int leveli, marpaESLIFString_t *descp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp, int leveli, marpaESLIFString_t *descp);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_symbolid_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, char *names, int *symbolip);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_symbolid_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, char *names, int *symbolip, int leveli, marpaESLIFString_t *descp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_symboldisplayform_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, char **symboldisplaysp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_symboldisplayform_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, char **symboldisplaysp, int leveli, marpaESLIFString_t *descp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_ruleshowform_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int rulei, char **ruleshowsp);
@@ -626,6 +748,10 @@ extern "C" {
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_grammarshowscriptb(marpaESLIFGrammar_t *marpaESLIFGrammarp, char **grammarscriptsp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_parseb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp, short *exhaustedbp);
   marpaESLIF_EXPORT short                         marpaESLIFGrammar_parse_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp, short *exhaustedbp, int leveli, marpaESLIFString_t *descp);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp, marpaESLIFRecoveryOption_t *marpaESLIFRecoveryOptionp, size_t *errorlp);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_value_stack_cacheb(marpaESLIFGrammar_t *marpaESLIFGrammarp, short enableb);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_generator_cache_limitb(marpaESLIFGrammar_t *marpaESLIFGrammarp, size_t maxEntriesl, size_t maxBytesl);
+  marpaESLIF_EXPORT short                         marpaESLIFGrammar_generator_cache_statsb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFGrammarGeneratorCacheStats_t *statsp);
   marpaESLIF_EXPORT void                          marpaESLIFGrammar_freev(marpaESLIFGrammar_t *marpaESLIFGrammarp);
 
   marpaESLIF_EXPORT marpaESLIFRecognizer_t       *marpaESLIFRecognizer_newp(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp);
@@ -643,24 +769,32 @@ extern "C" {
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_alternative_completeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t lengthl);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFAlternative_t *marpaESLIFAlternativep, size_t lengthl);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, short *matchbp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_try_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, short *matchbp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_discardb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *discardlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_discard_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short *matchbp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nNamelp, char ***namesArraypp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nSymbollp, int *symbolArrayip, size_t symbolArrayAllocl, size_t *generationlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **pausesp, size_t *pauselp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_last_pause_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **pausesp, size_t *pauselp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **trysp, size_t *trylp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_name_last_try_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **trysp, size_t *trylp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_discard_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **trysp, size_t *trylp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_discard_lastb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **lastsp, size_t *lastlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_isEofb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short *eofbp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_isStartCompleteb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short *completebp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *symbols, marpaESLIFEventType_t eventSeti, short onoffb);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_event_onoff_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, marpaESLIFEventType_t eventSeti, short onoffb);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_event_maskb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFEventType_t eventSeti, marpaESLIFEventType_t *previousEventSetip);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_eventb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *eventArraylp, marpaESLIFEvent_t **eventArraypp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_progressLogb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int starti, int endi, genericLoggerLevel_t logleveli);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_progressb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int starti, int endi, size_t *progresslp, marpaESLIFRecognizerProgress_t **progresspp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_inputb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **inputsp, size_t *inputlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_errorb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_locationb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *linelp, size_t *columnlp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFRecognizerMemoryStats_t *statsp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **inputsp, size_t *inputlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **offsetpp, size_t *lengthlp);
+  marpaESLIF_EXPORT short                         marpaESLIFRecognizer_last_completed_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **offsetpp, size_t *lengthlp);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_hook_discardb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short discardOnOffb);
   marpaESLIF_EXPORT short                         marpaESLIFRecognizer_hook_discard_switchb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
   /* TAKE CARE: trying to match an external to an existing recognizer will use, in case of a match, the RECOGNIZER's import configuration, not the external symbol */
@@ -671,8 +805,12 @@ extern "C" {
   marpaESLIF_EXPORT marpaESLIFRecognizer_t       *marpaESLIFValue_recognizerp(marpaESLIFValue_t *marpaESLIFValuep);
   marpaESLIF_EXPORT marpaESLIFValueOption_t      *marpaESLIFValue_optionp(marpaESLIFValue_t *marpaESLIFValuep);
   marpaESLIF_EXPORT short                         marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep);
+  marpaESLIF_EXPORT short                         marpaESLIFValue_partitionb(marpaESLIFValue_t *marpaESLIFValuep, int parti, int nparti);
+  marpaESLIF_EXPORT short                         marpaESLIFValue_action_cacheb(marpaESLIFValue_t *marpaESLIFValuep, short enableb);
   marpaESLIF_EXPORT short                         marpaESLIFValue_value_startb(marpaESLIFValue_t *marpaESLIFValuep, int *startip);
   marpaESLIF_EXPORT short                         marpaESLIFValue_value_lengthb(marpaESLIFValue_t *marpaESLIFValuep, int *lengthip);
+  marpaESLIF_EXPORT short                         marpaESLIFValue_walkb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalkCallback_t walkCallbackp);
+  marpaESLIF_EXPORT short                         marpaESLIFValue_flatastb(marpaESLIFValue_t *marpaESLIFValuep, short poolb);
   marpaESLIF_EXPORT short                         marpaESLIFValue_contextb(marpaESLIFValue_t *marpaESLIFValuep, char **symbolsp, int *symbolip, char **rulesp, int *ruleip);
   marpaESLIF_EXPORT void                          marpaESLIFValue_freev(marpaESLIFValue_t *marpaESLIFValuep);
 
@@ -728,6 +866,9 @@ extern "C" {
   marpaESLIF_EXPORT marpaESLIFGrammar_t          *marpaESLIFJSON_decode_newp(marpaESLIF_t *marpaESLIFp, short strictb);
   /* For decoding, a marpaESLIFValueOption_t* argument is required. Only the importer callback and its context will be used */
   marpaESLIF_EXPORT short                         marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaESLIFJSONDecodeOption_t *marpaESLIFJSONDecodeOptionp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp);
+  /* Encodes marpaESLIFValueResultp without a grammar. marpaESLIFValueResultp is never freed. When there is no writer, *bytespp is */
+  /* an ASCII NUL terminated buffer that the caller will have to free(), the NUL byte is not counted in *bytelp. */
+  marpaESLIF_EXPORT short                         marpaESLIFJSON_encode_streamb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, marpaESLIFJSONEncodeOption_t *marpaESLIFJSONEncodeOptionp, char **bytespp, size_t *bytelp);
 
   /* ------------------------------------- */
   /* Value result helpers                  */
@@ -738,6 +879,13 @@ extern "C" {
   /* Not all systems represent correctly +/-Nan, *confidencebp will be a true value if marpaESLIF is sure */
   marpaESLIF_EXPORT short                         marpaESLIFValueResult_is_positive_nanb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short *confidencebp);
   marpaESLIF_EXPORT short                         marpaESLIFValueResult_is_negative_nanb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short *confidencebp);
+  /* CBOR serialization. Encoded bytes and the decoded tree are both a single area to free with free(). */
+  marpaESLIF_EXPORT short                         marpaESLIFValueResult_cbor_encodeb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **bytespp, size_t *bytelp);
+  marpaESLIF_EXPORT short                         marpaESLIFValueResult_cbor_decodeb(marpaESLIF_t *marpaESLIFp, char *bytes, size_t bytel, marpaESLIFValueResult_t **marpaESLIFValueResultpp);
+  /* Hash index on the keys of a TABLE. The table must not be modified while the index is in use. */
+  marpaESLIF_EXPORT marpaESLIFValueResultTableIndex_t *marpaESLIFValueResult_table_index_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+  marpaESLIF_EXPORT short                         marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t **valuepp);
+  marpaESLIF_EXPORT void                          marpaESLIFValueResult_table_index_freev(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp);
 
   /* ------------------------------------- */
   /* Floating point method helpers         */
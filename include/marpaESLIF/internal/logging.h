@@ -133,7 +133,7 @@
             } else {                                                    \
               MARPAESLIF_ERROR(_marpaESLIFp, _marpaESLIF_stringGenerator.s); \
             }                                                           \
-            free(_marpaESLIF_stringGenerator.s);                        \
+            MARPAESLIF_FREE(_marpaESLIFp, _marpaESLIF_stringGenerator.s);       \
             _marpaESLIF_stringGenerator.s = NULL;                       \
             _marpaESLIF_stringGenerator.okb = 0;                        \
           }                                                             \
@@ -8,16 +8,19 @@
  * --------------------------------------------------------------------------------
  */
 #define GENERICSTACK_CUSTOM marpaESLIFValueResult_t
-#include <genericStack.h>
-
 /*
- * Prior to genericHash inclusion, we define our hash size - a subject number
- * --------------------------------------------------------------------------
+ * ... and a small inline storage: an item is a marpaESLIFValueResult_t, and the default of
+ * 128 items made every embedded stack weigh 12 KB. Sub-recognizers almost never go beyond
+ * 8 lexemes or alternatives, larger stacks move to the heap.
  */
-#ifndef MARPAESLIF_HASH_SIZE
-#define MARPAESLIF_HASH_SIZE 8 /* General default hash size */
+#ifndef GENERICSTACK_DEFAULT_LENGTH
+#define GENERICSTACK_DEFAULT_LENGTH 8
+#endif
+#include <genericStack.h>
+
+#ifndef MARPAESLIF_HASH_SLOTL
+#define MARPAESLIF_HASH_SLOTL 8 /* Initial number of slots of an internal hash - must be a power of two */
 #endif
-#include <genericHash.h>
 
 #include <marpaWrapper.h>                               /* Marpa engine */
 #include <genericLogger.h>                              /* Generic logger */
@@ -34,9 +37,35 @@
 #define INTERNAL_CHARACTERCLASSMODIFIERS_PATTERN "[eijmnsxDJUuaNubcA]+$"
 #define INTERNAL_REGEXMODIFIERS_PATTERN "[eijmnsxDJUuaNubcA]*$"
 
+/* Regex cache export header */
+/* ------------------------- */
+#define MARPAESLIF_REGEXCACHE_MAGICS "ESLIFRC\0"
+#define MARPAESLIF_REGEXCACHE_MAGICL 8
+
+/* Leading part of a PCRE2 serialized area: pcre2_serialize_decode() reads it without */
+/* knowing the area length. This mirrors pcre2_serialized_data, the character tables */
+/* and the first members of pcre2_real_code, that are private to PCRE2.              */
+#define MARPAESLIF_PCRE2_SERIALIZED_HEADERL (4 * sizeof(uint32_t))
+#define MARPAESLIF_PCRE2_TABLESL            1088
+#define MARPAESLIF_PCRE2_CODE_MAGIC         0x50435245UL /* 'PCRE' */
+typedef struct marpaESLIF_pcre2CodeHeader {
+  void          *(*mallocp)(size_t, void *);
+  void           (*freep)(void *, void *);
+  void           *memory_datap;
+  const uint8_t  *tablesp;
+  void           *executable_jitp;
+  uint8_t         start_bitmap[32];
+  size_t          blocksizel;       /* Size of the compiled pattern, header included */
+  uint32_t        magic_numberi;
+} marpaESLIF_pcre2CodeHeader_t;
+
 /* Forward definitions */
 /* ------------------- */
+typedef struct  marpaESLIF_hash                  marpaESLIF_hash_t;
+typedef struct  marpaESLIF_hashSlot              marpaESLIF_hashSlot_t;
+typedef struct  marpaESLIF_lexemeGrammarEntry    marpaESLIF_lexemeGrammarEntry_t;
 typedef struct  marpaESLIF_regex                 marpaESLIF_regex_t;
+typedef struct  marpaESLIF_regexcache            marpaESLIF_regexcache_t;
 typedef         marpaESLIFString_t               marpaESLIF_string_t;
 typedef enum    marpaESLIF_symbol_type           marpaESLIF_symbol_type_t;
 typedef enum    marpaESLIF_terminal_type         marpaESLIF_terminal_type_t;
@@ -55,6 +84,7 @@ typedef         marpaESLIFAction_t               marpaESLIF_action_t;
 typedef         marpaESLIFActionType_t           marpaESLIF_action_type_t;
 typedef struct  marpaESLIF_stream                marpaESLIF_stream_t;
 typedef struct  marpaESLIF_stringGenerator       marpaESLIF_stringGenerator_t;
+typedef struct  marpaESLIF_flatast               marpaESLIF_flatast_t;
 typedef struct  marpaESLIF_lua_functioncall      marpaESLIF_lua_functioncall_t;
 typedef struct  marpaESLIF_lua_functiondecl      marpaESLIF_lua_functiondecl_t;
 typedef enum    marpaESLIF_json_type             marpaESLIF_json_type_t;
@@ -137,6 +167,29 @@ enum marpaESLIF_terminal_type {
   MARPAESLIF_TERMINAL_TYPE__EMPTY    /* :empty */
 };
 
+/* Internal hash, with open addressing and linear probing. Keys are never NULL. */
+typedef unsigned long (*marpaESLIF_hashFunction_t)(void *userDatavp, void *keyp);
+typedef short         (*marpaESLIF_hashCmpFunction_t)(void *userDatavp, void *key1p, void *key2p);
+typedef void          (*marpaESLIF_hashFreeFunction_t)(marpaESLIF_t *marpaESLIFp, void *p);
+
+struct marpaESLIF_hashSlot {
+  void                          *keyp;             /* NULL when the slot is free */
+  void                          *valp;
+  unsigned long                  hashl;            /* Hash of the key */
+};
+
+struct marpaESLIF_hash {
+  marpaESLIF_t                  *marpaESLIFp;      /* Owner, gives the allocator */
+  void                          *userDatavp;       /* Given to the hash and compare functions */
+  marpaESLIF_hashFunction_t      hashFunctionp;    /* Mandatory */
+  marpaESLIF_hashCmpFunction_t   cmpFunctionp;     /* NULL means that keys are compared by address */
+  marpaESLIF_hashFreeFunction_t  keyFreeFunctionp; /* Optional */
+  marpaESLIF_hashFreeFunction_t  valFreeFunctionp; /* Optional */
+  marpaESLIF_hashSlot_t         *slotp;            /* Slots, allocated on the first insertion */
+  size_t                         slotl;            /* Number of slots, always a power of two */
+  size_t                         usedl;            /* Number of used slots */
+};
+
 /* Regex modifiers - we take JPCRE2 matching semantics, c.f. https://neurobin.org/projects/softwares/libs/jpcre2/ */
 struct marpaESLIF_regex_option_map {
   char                       modifierc;
@@ -197,6 +250,15 @@ struct marpaESLIF_regex {
   short                  characterClassb; /* Origin is a character class */
 };
 
+/* A compiled regex cache entry. The key is made of PCRE2 version, compile options and pattern, */
+/* the value is the output of pcre2_serialize_encode(), copied to a malloc()ed area.            */
+struct marpaESLIF_regexcache {
+  char                  *keys;         /* Cache key */
+  size_t                 keyl;         /* Cache key length */
+  uint8_t               *serializedp;  /* Serialized compiled pattern */
+  size_t                 serializedl;  /* Serialized compiled pattern length */
+};
+
 struct marpaESLIF_terminal {
   char                          *utf8s;               /* Original UTF-8 input to _marpaESLIF_terminal_newp() */
   size_t                         utf8l;               /* Original UTF-8 input length to _marpaESLIF_terminal_newp() */
@@ -212,6 +274,7 @@ struct marpaESLIF_terminal {
   char                          *substitutionPatterns;
   size_t                         substitutionPatternl;
   marpaESLIF_uint32_t            substitutionPatterni;
+  size_t                         substitutionRefl;    /* Upper bound of the number of references in substitutionPatterns */
   marpaESLIF_terminal_type_t     type;                /* Original type. Used for description. When origin is STRING we know that patterns if ASCII safe */
   marpaESLIF_regex_t             regex;               /* Regex version */
   short                          memcmpb;             /* Flag saying that memcmp is possible */
@@ -223,6 +286,10 @@ struct marpaESLIF_terminal {
   short                          willfailasciib[256]; /* For string and character class ASCII terminals, pre-computation of expected failure for the 256 ASCII bytes */
   short                          utf2failureb;        /* True if the willfailb array is filled */
   short                          willfailutfb[256];   /* For string and character class UTF-8 terminals, pre-computation of expected failure for the first 256 characters (matches ASCII for the first 128 codepoints) */
+  short                          firstcodeunitb;      /* True if any regex match starts with one of firstcodeunits */
+  unsigned char                  firstcodeunits[2];   /* PCRE2_INFO_FIRSTCODEUNIT and its other case */
+  short                          requiredcodeunitb;   /* True if any regex match contains one of requiredcodeunits */
+  unsigned char                  requiredcodeunits[2]; /* PCRE2_INFO_LASTCODEUNIT and its other case */
 };
 
 /* Matcher return values */
@@ -396,6 +463,8 @@ struct marpaESLIF_grammar {
   char                  *fallbackEncodings;                  /* Fallback encoding is reader returns NULL and tconv fails to detect encoding */
   short                  fastDiscardb;                       /* True when :discard can be done in the context of the current recognizer */
   marpaESLIF_symbol_t  **allSymbolsArraypp;                  /* For fast access to symbols, they are all flatened here */
+  marpaESLIF_hash_t      _symbolNameHash;                    /* Index of symbols by name - filled by grammar validation */
+  marpaESLIF_hash_t     *symbolNameHashp;                    /* Pointer to index of symbols by name, NULL until grammar validation */
   marpaESLIF_rule_t    **allRulesArraypp;                    /* For fast access to rules, they are all flatened here */
   int                   *expectedTerminalIdArrayp;           /* Total list of expected symbol ids sorted by priority */
   marpaESLIF_symbol_t  **expectedTerminalArraypp;            /* Total list of expected terminals sorted by priority */
@@ -421,6 +490,9 @@ struct marpaESLIF {
   marpaESLIFGrammar_t        *marpaESLIFGrammarLuapp[2];   /* C.f. MARPAESLIFGRAMMARLUA_FOR_PARLIST and MARPAESLIFGRAMMARLUA_FOR_EXPLIST */
   marpaESLIFGrammar_t        *marpaESLIFGrammarp;          /* ESLIF has its own grammar -; */
   marpaESLIFOption_t          marpaESLIFOption;
+  marpaESLIFAllocator_t       _allocator;                  /* Copy of the allocator option */
+  marpaESLIFAllocator_t      *allocatorp;                  /* Pointer to it, NULL when it is the C library */
+  pcre2_general_context      *pcre2GeneralContextp;        /* PCRE2 context for the allocator, NULL when it is the C library */
   marpaESLIF_terminal_t      *anycharp;                    /* internal regex for match any character */
   marpaESLIF_terminal_t      *newlinep;                    /* Internal regex for match newline */
   marpaESLIFSymbol_t         *newlineSymbolp;              /* Internal symbol for match newline */
@@ -462,6 +534,14 @@ struct marpaESLIF {
   marpaESLIF_symbol_t        *jsonStringpp[_MARPAESLIF_JSON_TYPE_LAST];
   marpaESLIF_symbol_t        *jsonConstantOrNumberpp[_MARPAESLIF_JSON_TYPE_LAST];
   marpaESLIFGrammar_Lshare_t  Lshare;                  /* A Lua instance, used by all sub-grammars of ESLIF */
+  genericStack_t              _regexCacheStack;        /* Compiled regex cache entries */
+  genericStack_t             *regexCacheStackp;        /* Pointer to compiled regex cache entries, NULL when cache is disabled */
+  marpaESLIF_hash_t           _regexCacheHash;         /* Compiled regex cache index */
+  marpaESLIF_hash_t          *regexCacheHashp;         /* Pointer to compiled regex cache index, NULL when cache is disabled */
+  char                       *regexCacheExportp;       /* Last output of marpaESLIF_regex_cache_exportb() */
+  size_t                      regexCacheExportl;       /* Its length */
+  size_t                      regexCacheHitl;          /* Number of lookups that restored a compiled regex */
+  size_t                      regexCacheMissl;         /* Number of lookups that did not */
 };
 
 struct marpaESLIFGrammar {
@@ -484,8 +564,17 @@ struct marpaESLIFGrammar {
   short                      hasEolPseudoTerminalb; /* Any :eol terminal in the grammar ? */
   short                      hasSolPseudoTerminalb; /* Any :sol terminal in the grammar ? */
   short                      hasEmptyPseudoTerminalb; /* Any :empty terminal in the grammar ? */
-  genericHash_t              _lexemeGrammarHash; /* Cache of string <=> lexeme grammars */
-  genericHash_t             *lexemeGrammarHashp;
+  marpaESLIF_hash_t          _lexemeGrammarHash; /* Cache of string <=> lexeme grammars */
+  marpaESLIF_hash_t         *lexemeGrammarHashp;
+  marpaESLIF_lexemeGrammarEntry_t *lexemeGrammarHeadp; /* Most recently used entry of the cache */
+  marpaESLIF_lexemeGrammarEntry_t *lexemeGrammarTailp; /* Least recently used entry of the cache */
+  size_t                     lexemeGrammarBytesl;       /* Total length of the cached generated strings */
+  size_t                     lexemeGrammarMaxEntriesl;  /* Maximum number of entries, 0 for no limit */
+  size_t                     lexemeGrammarMaxBytesl;    /* Maximum total length, 0 for no limit */
+  size_t                     lexemeGrammarHitl;         /* Number of lookups that found a cached grammar */
+  size_t                     lexemeGrammarMissl;        /* Number of lookups that did not */
+  size_t                     lexemeGrammarEvictionl;    /* Number of evicted grammars */
+  size_t                     recognizerl;               /* Number of live recognizers on this grammar, reusable ones included */
   short                      hasLookaheadMetab;  /* Any lookahead meta in the grammar ? */
   /* For JSON grammars : the symbols that depend on strictness */
   marpaESLIF_symbol_t       *jsonStringp; /* Shallow pointer */
@@ -500,6 +589,19 @@ struct marpaESLIFGrammar {
   marpaESLIFGrammar_Lshare_t *Lsharep;
 
   marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammar_bootstrapp;
+
+  /* Value stack buffer kept from the last freed value, c.f. marpaESLIFGrammar_value_stack_cacheb() */
+  short                      valueStackCacheb;
+  genericStackItem_t        *valueStackItemsp;    /* Cached value stack storage: it is genericStack's, i.e. from the C library */
+  int                        valueStackItemsi;   /* Number of items in valueStackItemsp */
+};
+
+/* An entry of the cache of generated grammars: the hash value, linked in LRU order */
+struct marpaESLIF_lexemeGrammarEntry {
+  marpaESLIF_string_t             *utf8p;              /* Generated string, also the hash key */
+  marpaESLIFGrammar_t             *marpaESLIFGrammarp; /* Generated grammar */
+  marpaESLIF_lexemeGrammarEntry_t *prevp;              /* More recently used entry */
+  marpaESLIF_lexemeGrammarEntry_t *nextp;              /* Less recently used entry */
 };
 
 struct marpaESLIF_meta {
@@ -522,6 +624,14 @@ struct marpaESLIF_meta {
   int                            eventSeti;                       /* Remember eventSeti */
 };
 
+/* Hash index on the keys of a table: keys are the indices of the pairs plus one */
+struct marpaESLIFValueResultTableIndex {
+  marpaESLIF_t                          *marpaESLIFp;
+  marpaESLIFValueResult_t               *marpaESLIFValueResultp; /* Shallow pointer to the table: pairs are always read from it */
+  marpaESLIFValueResult_t               *probep;                 /* Key being looked up, that is not in the table */
+  marpaESLIF_hash_t                      hash;
+};
+
 struct marpaESLIF_stringGenerator {
   marpaESLIF_t *marpaESLIFp;
   char         *s;      /* Pointer */
@@ -530,6 +640,18 @@ struct marpaESLIF_stringGenerator {
   size_t        allocl; /* Allocated size */
 };
 
+/* Flat AST under construction: nodes are collected in postorder */
+struct marpaESLIF_flatast {
+  marpaESLIF_t                 *marpaESLIFp;
+  marpaESLIFValueFlatAstNode_t *nodep;      /* Nodes, in postorder */
+  size_t                        nodel;      /* Used number of nodes */
+  size_t                        nodeallocl; /* Allocated number of nodes */
+  char                         *pools;      /* String pool */
+  size_t                        pooll;      /* Used size */
+  size_t                        poolallocl; /* Allocated size */
+  short                         poolb;      /* Lexeme bytes are copied to the string pool */
+};
+
 struct marpaESLIFValue {
   marpaESLIF_t                *marpaESLIFp;
   marpaESLIFGrammar_Lshare_t  *Lsharep;                       /* Shallow pointer to parent structure's Lsharep - can never be NULL */
@@ -552,6 +674,16 @@ struct marpaESLIFValue {
   size_t                       luaprecompiledl;    /* Lua script source precompiled length in byte */
   short                        hideSeparatorb;     /* Hook for internal ::row and ::table actions to process more efficiently hide-separator adverb */
   short                        isLexemeb;          /* Special mode for true lexemes: caller did not mind about valuation, just the number of bytes consumed up to completion */
+  marpaESLIFValueWalkCallback_t walkCallbackp;     /* Not NULL only during a walk */
+  void                        *walkUserDatavp;     /* Walk callback context */
+  int                          parti;              /* Parse trees valuated are those with treei % nparti == parti */
+  int                          nparti;             /* Number of partitions, 1 by default */
+  int                          treei;              /* Indice of the next parse tree */
+  marpaESLIFValueRuleCallback_t   *ruleCallbackpp;     /* Resolved rule actions, indexed by rule id. Allocated at the first resolver call when actionCacheb is set */
+  marpaESLIFValueRuleCallback_t   *nullableCallbackpp; /* Resolved nullable actions, indexed by symbol id. Allocated at the first resolver call when actionCacheb is set */
+  marpaESLIFValueSymbolCallback_t *symbolCallbackpp;   /* Resolved symbol actions, indexed by symbol id. Allocated at the first resolver call when actionCacheb is set */
+  short                            actionCacheb;       /* Resolved actions are remembered in the arrays above */
+  size_t                           memoryl;            /* Bytes charged to the top-level recognizer while a valuation is running */
 };
 
 struct marpaESLIF_stream {
@@ -574,9 +706,15 @@ struct marpaESLIF_stream {
   char                  *encodings;            /* Current encoding. Always != NULL when charconvb is true. Always NULL when charconvb is false. */
   tconv_t                tconvp;               /* current converter. Always != NULL when charconvb is true. Always NULL when charconvb is false. */
   short                  bomdoneb;             /* In char mode, flag indicating if BOM was processed successfully (BOM existence or not) */
+  short                  utf8passthroughb;     /* In char mode, flag indicating that input is UTF-8: it is validated in place and never goes through tconvp */
+  char                  *convertedbufs;        /* Reusable output buffer of character conversion */
+  size_t                 convertedbufallocl;   /* Allocated length of this buffer */
   unsigned int           peeki;                /* Number of peeked sharing */
   size_t                 linel;                /* Line number */
   size_t                 columnl;              /* Column number */
+  size_t                 uncountedl;           /* Number of bytes just before inputs that are not yet accounted in linel and columnl */
+  short                  crb;                  /* Last accounted newline is a \r: a \n that follows it is the same newline */
+  short                  readErrorb;           /* A read failed: what follows in the stream cannot be trusted */
 };
 
 struct marpaESLIFRecognizer {
@@ -614,6 +752,8 @@ struct marpaESLIFRecognizer {
   size_t                       parentDeltal;   /* Parent original delta - used to recover parent current pointer at our free */
   size_t                       parentLinel;    /* Parent original linel - used to recover parent line number our free */
   size_t                       parentColumnl;  /* Parent original columnl - used to recover parent column number our free */
+  size_t                       parentUncountedl; /* Parent original uncountedl - used to recover parent location our free */
+  short                        parentCrb;      /* Parent original crb - used to recover parent location our free */
   /* Current recognizer states */
   short                        scanb;          /* Prevent resume before a call to scan */
   short                        noEventb;       /* No event mode */
@@ -631,15 +771,17 @@ struct marpaESLIFRecognizer {
   genericStack_t              *set2InputStackp;                  /* Pointer to mapping latest Earley Set to absolute input offset and length */
   char                       **namesArrayp;         /* Persistent buffer of last call to marpaESLIFRecognizer_name_expectedb */
   size_t                       namesArrayAllocl;    /* Current allocated size -; */
+  size_t                       expectedGenerationl; /* Incremented every time the set of expected terminals may have changed */
   short                       *discardEventStatebp; /* Discard current event states for the CURRENT grammar (marpaESLIFRecognizerp->marpaESLIFGrammarp->grammarp) */
   short                       *beforeEventStatebp;  /* Lexeme before current event states for the CURRENT grammar */
   short                       *afterEventStatebp;   /* Lexeme after current event states for the CURRENT grammar */
   marpaESLIF_symbol_data_t   **lastPausepp;         /* Lexeme last pause for the CURRENT grammar */
   marpaESLIF_symbol_data_t   **lastTrypp;           /* Lexeme or :discard last try for the CURRENT grammar */
   short                        discardOnOffb;       /* Discard is on or off ? */
+  int                          eventMaski;          /* Subscribed event types, bit mask of marpaESLIFEventType_t */
   short                        pristineb;           /* 1: pristine, i.e. can be reused, 0: have at least one thing that happened at the raw grammar level, modulo the eventual initial events */
-  genericHash_t                _marpaESLIFRecognizerHash; /* Cache of recognizers ready for re-use - shared with all children (lexeme mode) */
-  genericHash_t               *marpaESLIFRecognizerHashp;
+  marpaESLIF_hash_t            _marpaESLIFRecognizerHash; /* Cache of recognizers ready for re-use - shared with all children (lexeme mode) */
+  marpaESLIF_hash_t           *marpaESLIFRecognizerHashp;
   marpaESLIF_stream_t          _marpaESLIF_stream;  /* A stream is always owned by one recognizer */
   marpaESLIF_stream_t         *marpaESLIF_streamp;  /* ... But the stream pointer can be shared with others */
   size_t                       previousMaxMatchedl;       /* Always computed */
@@ -676,12 +818,10 @@ struct marpaESLIFRecognizer {
   char                        *actions;        /* Shallow pointer to action "name", depends on action type */
   marpaESLIF_action_t         *actionp;        /* Shallow pointer to action */
 
-  /* For _marpaESLIFRecognizer_set_internalp_deepb */
-  genericStack_t               _marpaESLIFValueResultWorkStack;
+  /* For _marpaESLIFRecognizer_set_internalp_deepb: most recognizers never need them, they are */
+  /* created together on first use and marpaESLIFValueResultWorkStackp holds the allocation.  */
   genericStack_t              *marpaESLIFValueResultWorkStackp;
-  genericStack_t               _marpaESLIFValueResultStackOrig;
   genericStack_t              *marpaESLIFValueResultStackOrigp;
-  genericStack_t               _marpaESLIFValueResultStackNew;
   genericStack_t              *marpaESLIFValueResultStackNewp;
 
   /* When doing regex callback, only the "offset_vector" part is variable, all other */
@@ -699,6 +839,10 @@ struct marpaESLIFRecognizer {
   size_t                          progressallocl;
   marpaESLIFRecognizerProgress_t *progressp;
 
+  /* Scratch area for regex substitutions, sized from the terminal's upper bound and grown on demand */
+  PCRE2_UCHAR                    *substitutionBufferp;
+  size_t                          substitutionBufferl; /* Allocated number of code units */
+
   char                           *luaprecompiledp;    /* Lua script source precompiled */
   size_t                          luaprecompiledl;    /* Lua script source precompiled length in byte */
   marpaESLIFAction_t             *getContextActionp;  /* Getting the context is a common function that is stored at recognizer level */
@@ -712,6 +856,15 @@ struct marpaESLIFRecognizer {
 
   /* Proxy generic logger */
   genericLogger_t                *genericLoggerp;
+
+  /* Memory accounting: every recognizer charges what it owns to its top-level recognizer */
+  size_t                          memoryl;            /* Bytes owned by this recognizer, as last charged */
+  size_t                          memoryTreel;        /* Top-level recognizer only: bytes charged by the whole tree, valuations included */
+  size_t                          memoryPeakl;        /* Top-level recognizer only: highest value of memoryTreel */
+  size_t                          lexemeBytesl;       /* Bytes of the values owned by the lexeme stack */
+  size_t                          earleyItemsl;       /* Top-level recognizer only: number of Earley items in the completed Earley sets */
+  marpaESLIFRecognizer_t         *marpaESLIFRecognizerMemoryp; /* Top-level recognizer only: recognizer holding the limit, the shared one when created with newFromp */
+  short                           memoryLimitb;       /* Set on the recognizer holding the limit when the limit is reached */
 };
 
 struct marpaESLIF_symbol_data {
@@ -754,7 +907,8 @@ struct marpaESLIF_cloneContext {
 /* Definition of the default option structures */
 /* ------------------------------------------- */
 marpaESLIFOption_t marpaESLIFOption_default_template = {
-  NULL               /* genericLoggerp */
+  NULL,              /* genericLoggerp */
+  NULL               /* allocatorp */
 };
 
 marpaESLIFGrammarOption_t marpaESLIFGrammarOption_default_template = {
@@ -778,7 +932,8 @@ marpaESLIFRecognizerOption_t marpaESLIFRecognizerOption_default_template = {
   NULL,              /* eventActionResolverp */
   NULL,              /* regexActionResolverp */
   NULL,              /* generatorActionResolverp */
-  NULL               /* importerp */
+  NULL,              /* importerp */
+  0                  /* maxMemoryl */
 };
 
 marpaESLIFSymbolOption_t marpaESLIFSymbolOption_default_template = {
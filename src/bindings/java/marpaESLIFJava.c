@@ -1579,6 +1579,7 @@ JNIEXPORT void JNICALL Java_org_parser_marpa_ESLIF_jniNew(JNIEnv *envp, jobject
   /* Create and save marpaESLIFp */
   /* --------------------------- */
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     RAISEEXCEPTIONF(envp, "marpaESLIF_newp failure, %s", strerror(errno));
@@ -2340,6 +2341,7 @@ JNIEXPORT jboolean JNICALL Java_org_parser_marpa_ESLIFGrammar_jniParse(JNIEnv *e
   marpaESLIFRecognizerOption.regexActionResolverp      = marpaESLIFRecognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp  = marpaESLIFRecognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                 = marpaESLIFJava_recognizerImportb;
+  marpaESLIFRecognizerOption.maxMemoryl                = 0;
 
   if (! marpaESLIFJava_valueContextInitb(envp, eslifValueInterfacep, eslifGrammarp, &marpaESLIFJavaValueContext)) {
     goto err;
@@ -2904,6 +2906,7 @@ JNIEXPORT void JNICALL Java_org_parser_marpa_ESLIFRecognizer_jniNew(JNIEnv *envp
   marpaESLIFRecognizerOption.regexActionResolverp      = marpaESLIFRecognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp  = marpaESLIFRecognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                 = marpaESLIFJava_recognizerImportb;
+  marpaESLIFRecognizerOption.maxMemoryl                = 0;
 
   if (shallow == JNI_FALSE) {
     marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
@@ -7527,6 +7530,11 @@ JNIEXPORT jobject JNICALL Java_org_parser_marpa_ESLIFJSONDecoder_jniDecode(JNIEn
   marpaESLIFJSONDecodeOption.positiveNanActionp      = NULL;         /* Because java always supports NaN in float */
   marpaESLIFJSONDecodeOption.negativeNanActionp      = NULL;         /* Because java always supports NaN in float */
   marpaESLIFJSONDecodeOption.numberActionp           = marpaESLIFJava_JSONDecodeNumberActionb;
+  marpaESLIFJSONDecodeOption.valueCallbackp          = NULL;
+  marpaESLIFJSONDecodeOption.valueDepthl             = 0;
+  marpaESLIFJSONDecodeOption.multipleb               = 0;
+  marpaESLIFJSONDecodeOption.pathsp                  = NULL;
+  marpaESLIFJSONDecodeOption.pathl                   = 0;
 
   marpaESLIFRecognizerOption.userDatavp                = &marpaESLIFJavaRecognizerContext;
   marpaESLIFRecognizerOption.readerCallbackp           = readerCallbackb;
@@ -7554,6 +7562,7 @@ JNIEXPORT jobject JNICALL Java_org_parser_marpa_ESLIFJSONDecoder_jniDecode(JNIEn
   marpaESLIFRecognizerOption.regexActionResolverp      = marpaESLIFRecognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp  = marpaESLIFRecognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                 = marpaESLIFJava_recognizerImportb;
+  marpaESLIFRecognizerOption.maxMemoryl                = 0;
 
   /* Value interface is unmanaged: ESLIF does all the job */
   if (! marpaESLIFJava_valueContextInitb(envp, NULL /* eslifValueInterfacep */, eslifJSONDecoderp /* eslifGrammarp */, &marpaESLIFJavaValueContext)) {
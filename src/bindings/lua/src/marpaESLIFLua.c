@@ -1566,6 +1566,7 @@ static int marpaESLIFLua_marpaESLIF_newi(lua_State *L)
     if (! marpaESLIFLua_contextInitb(L, marpaESLIFLuaContextp, 0 /* unmanagedb */)) goto err;
 
     marpaESLIFOption.genericLoggerp    = genericLoggerp;
+    marpaESLIFOption.allocatorp        = NULL;
     marpaESLIFLuaContextp->marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
     if (marpaESLIFLuaContextp->marpaESLIFp == NULL) {
       MARPAESLIFLUA_UNREF(L, logger_r); /* No effect if it is LUA_NOREF */
@@ -3883,6 +3884,7 @@ static int  marpaESLIFLua_marpaESLIFGrammar_parsei(lua_State *L)
   marpaESLIFRecognizerOption.regexActionResolverp     = marpaESLIFLua_recognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp = marpaESLIFLua_recognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                = marpaESLIFLua_recognizerImporterb;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   marpaESLIFValueOption.userDatavp             = &marpaESLIFLuaValueContext;
   marpaESLIFValueOption.ruleActionResolverp    = marpaESLIFLua_valueRuleActionResolver;
@@ -4913,6 +4915,7 @@ static int marpaESLIFLua_marpaESLIFRecognizer_newi(lua_State *L)
   marpaESLIFRecognizerOption.regexActionResolverp     = marpaESLIFLua_recognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp = marpaESLIFLua_recognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                = marpaESLIFLua_recognizerImporterb;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   marpaESLIFLuaRecognizerContextp->marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFLuaGrammarContextp->marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   marpaESLIFLuaRecognizerContextp->managedb = 1;
@@ -10245,6 +10248,11 @@ static int marpaESLIFLuaJSONDecoder_decodei(lua_State *L)
   marpaESLIFJSONDecodeOption.positiveNanActionp              = NULL;
   marpaESLIFJSONDecodeOption.negativeNanActionp              = NULL;
   marpaESLIFJSONDecodeOption.numberActionp                   = NULL;
+  marpaESLIFJSONDecodeOption.valueCallbackp                  = NULL;
+  marpaESLIFJSONDecodeOption.valueDepthl                     = 0;
+  marpaESLIFJSONDecodeOption.multipleb                       = 0;
+  marpaESLIFJSONDecodeOption.pathsp                          = NULL;
+  marpaESLIFJSONDecodeOption.pathl                           = 0;
 
   marpaESLIFLuaJsonDecoderReaderContext.values    = valueheaps;
   marpaESLIFLuaJsonDecoderReaderContext.valuel    = valuel;
@@ -10265,6 +10273,7 @@ static int marpaESLIFLuaJSONDecoder_decodei(lua_State *L)
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
   marpaESLIFRecognizerOption.importerp                = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   marpaESLIFValueOption.userDatavp = &marpaESLIFLuaValueContext;
   marpaESLIFValueOption.importerp  = marpaESLIFLua_valueImporterb;
@@ -3384,6 +3384,7 @@ CODE:
   /* marpaESLIF */
   /* ---------- */
   marpaESLIFOption.genericLoggerp = MarpaX_ESLIFp->genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   MarpaX_ESLIFp->marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (MARPAESLIF_UNLIKELY(MarpaX_ESLIFp->marpaESLIFp == NULL)) {
     int save_errno = errno;
@@ -3620,6 +3621,11 @@ CODE:
   marpaESLIFJSONDecodeOption.positiveNanActionp              = marpaESLIFPerl_JSONDecodePositiveNanAction;
   marpaESLIFJSONDecodeOption.negativeNanActionp              = marpaESLIFPerl_JSONDecodeNegativeNanAction;
   marpaESLIFJSONDecodeOption.numberActionp                   = marpaESLIFPerl_JSONDecodeNumberAction;
+  marpaESLIFJSONDecodeOption.valueCallbackp                  = NULL;
+  marpaESLIFJSONDecodeOption.valueDepthl                     = 0;
+  marpaESLIFJSONDecodeOption.multipleb                       = 0;
+  marpaESLIFJSONDecodeOption.pathsp                          = NULL;
+  marpaESLIFJSONDecodeOption.pathl                           = 0;
 
   marpaESLIFRecognizerOption.userDatavp               = &marpaESLIFRecognizerContext;
   marpaESLIFRecognizerOption.readerCallbackp          = marpaESLIFPerl_readerCallbackb;
@@ -3635,6 +3641,7 @@ CODE:
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
   marpaESLIFRecognizerOption.importerp                = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
   
   marpaESLIFValueOption.userDatavp             = &marpaESLIFValueContext;
   marpaESLIFValueOption.importerp              = marpaESLIFPerl_valueImportb;
@@ -4518,6 +4525,7 @@ marpaESLIFRecognizerOption.disableThresholdb          = marpaESLIFPerl_call_meth
   marpaESLIFRecognizerOption.regexActionResolverp     = marpaESLIFPerl_recognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp = marpaESLIFPerl_recognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                = marpaESLIFPerl_recognizerImportb;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
   
   marpaESLIFValueOption.userDatavp             = &marpaESLIFValueContext;
   marpaESLIFValueOption.ruleActionResolverp    = marpaESLIFPerl_valueRuleActionResolver;
@@ -4869,6 +4877,7 @@ CODE:
   marpaESLIFRecognizerOption.regexActionResolverp     = marpaESLIFPerl_recognizerRegexActionResolver;
   marpaESLIFRecognizerOption.generatorActionResolverp = marpaESLIFPerl_recognizerGeneratorActionResolver;
   marpaESLIFRecognizerOption.importerp                = marpaESLIFPerl_recognizerImportb;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   MarpaX_ESLIF_Recognizerp->marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(MarpaX_ESLIF_Grammarp->marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   if (MARPAESLIF_UNLIKELY(MarpaX_ESLIF_Recognizerp->marpaESLIFRecognizerp == NULL)) {
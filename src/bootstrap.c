@@ -15,26 +15,26 @@ static const char *LUA_ACTION_PREFIX = "::lua->";
 /* This file contain the definition of all bootstrap actions, i.e. the ESLIF grammar itself */
 /* This is an example of how to use the API */
 
-static inline void _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIF_bootstrap_rhs_primary_t *rhsPrimaryp);
-static inline void _marpaESLIF_bootstrap_lhs_freev(marpaESLIF_bootstrap_lhs_t *lhsp);
-static inline void _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIF_bootstrap_start_symbol_t *startSymbolp);
-static inline void _marpaESLIF_bootstrap_lua_function_freev(marpaESLIF_bootstrap_lua_function_t *luaFunctionp);
-static inline void _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIF_bootstrap_rhs_alternative_t *rhsAlternativep);
-static inline void _marpaESLIF_bootstrap_symbol_and_reference_freev(marpaESLIF_bootstrap_symbol_and_reference_t *symbolAndReferencep);
-static inline void _marpaESLIF_bootstrap_utf_string_freev(marpaESLIF_bootstrap_utf_string_t *stringp, short onStackb);
+static inline void _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_rhs_primary_t *rhsPrimaryp);
+static inline void _marpaESLIF_bootstrap_lhs_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_lhs_t *lhsp);
+static inline void _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_start_symbol_t *startSymbolp);
+static inline void _marpaESLIF_bootstrap_lua_function_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_lua_function_t *luaFunctionp);
+static inline void _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_rhs_alternative_t *rhsAlternativep);
+static inline void _marpaESLIF_bootstrap_symbol_and_reference_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_symbol_and_reference_t *symbolAndReferencep);
+static inline void _marpaESLIF_bootstrap_utf_string_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_utf_string_t *stringp, short onStackb);
 static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_utf_string_newp(marpaESLIF_t *marpaESLIFp);
-static inline void _marpaESLIF_bootstrap_rhs_freev(genericStack_t *rhsAlternativeStackp);
-static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_bootstrap_adverb_list_item_t *adverbListItemp);
-static inline void _marpaESLIF_bootstrap_adverb_list_items_freev(genericStack_t *adverbListItemStackp);
-static inline void _marpaESLIF_bootstrap_alternative_freev(marpaESLIF_bootstrap_alternative_t *alternativep);
-static inline void _marpaESLIF_bootstrap_alternatives_freev(genericStack_t *alternativeStackp);
-static inline void _marpaESLIF_bootstrap_priorities_freev(genericStack_t *alternativesStackp);
-static inline void _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIF_bootstrap_single_symbol_t *singleSymbolp);
-static inline void _marpaESLIF_bootstrap_symbol_freev(marpaESLIF_bootstrap_symbol_t *symbolp);
-static inline void _marpaESLIF_bootstrap_terminal_freev(marpaESLIF_bootstrap_terminal_t *terminalp);
-static inline void _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIF_bootstrap_grammar_reference_t *grammarReferencep);
-static inline void _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIF_bootstrap_event_initialization_t *eventInitializationp);
-static        void _marpaESLIF_bootstrap_freeDefaultActionv(void *userDatavNotUsedp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline void _marpaESLIF_bootstrap_rhs_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *rhsAlternativeStackp);
+static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_adverb_list_item_t *adverbListItemp);
+static inline void _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *adverbListItemStackp);
+static inline void _marpaESLIF_bootstrap_alternative_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_alternative_t *alternativep);
+static inline void _marpaESLIF_bootstrap_alternatives_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *alternativeStackp);
+static inline void _marpaESLIF_bootstrap_priorities_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *alternativesStackp);
+static inline void _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_single_symbol_t *singleSymbolp);
+static inline void _marpaESLIF_bootstrap_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_symbol_t *symbolp);
+static inline void _marpaESLIF_bootstrap_terminal_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_terminal_t *terminalp);
+static inline void _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_grammar_reference_t *grammarReferencep);
+static inline void _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_event_initialization_t *eventInitializationp);
+static        void _marpaESLIF_bootstrap_freeDefaultActionv(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_unquote_string_literalp(marpaESLIFValue_t *marpaESLIFValuep, void *bytep, size_t bytel, short allowEmptyStringb);
 
 static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_bootstrap_check_grammarBootstrapp(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarBootstrapp, int leveli, marpaESLIF_bootstrap_utf_string_t *stringp);
@@ -289,7 +289,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
     }                                                                   \
                                                                         \
     /* Encoding is always allocated */                                  \
-    free(_marpaESLIFValueResult.u.s.encodingasciis);                    \
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, _marpaESLIFValueResult.u.s.encodingasciis); \
                                                                         \
     _p        = (char *) _marpaESLIFValueResult.u.s.p;                  \
     _shallowb = _marpaESLIFValueResult.u.s.shallowb;                    \
@@ -388,7 +388,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
     _marpaESLIFValueResult.representationp    = NULL;                   \
     _marpaESLIFValueResult.u.p.p              = _p;                     \
     _marpaESLIFValueResult.u.p.freeCallbackp  = _marpaESLIF_bootstrap_freeDefaultActionv; \
-    _marpaESLIFValueResult.u.p.freeUserDatavp = NULL;                   \
+    _marpaESLIFValueResult.u.p.freeUserDatavp = marpaESLIFValuep->marpaESLIFp; \
     _marpaESLIFValueResult.u.p.shallowb       = 0;                      \
                                                                         \
     if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_stack_setb(marpaESLIFValuep, indicei, &_marpaESLIFValueResult))) { \
@@ -405,7 +405,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
     _marpaESLIFValueResult.representationp    = NULL;                   \
     _marpaESLIFValueResult.u.a.p              = _p;                     \
     _marpaESLIFValueResult.u.a.freeCallbackp  = _marpaESLIF_bootstrap_freeDefaultActionv; \
-    _marpaESLIFValueResult.u.a.freeUserDatavp = NULL;                   \
+    _marpaESLIFValueResult.u.a.freeUserDatavp = marpaESLIFValuep->marpaESLIFp; \
     _marpaESLIFValueResult.u.a.shallowb       = 0;                      \
     _marpaESLIFValueResult.u.a.sizel          = _l;                     \
                                                                         \
@@ -535,139 +535,139 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
   } while (0)
 
 /*****************************************************************************/
-static inline void  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIF_bootstrap_rhs_primary_t *rhsPrimaryp)
+static inline void  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_rhs_primary_t *rhsPrimaryp)
 /*****************************************************************************/
 {
   if (rhsPrimaryp != NULL) {
-    _marpaESLIF_lua_functioncall_freev(rhsPrimaryp->callp);
+    _marpaESLIF_lua_functioncall_freev(marpaESLIFp, rhsPrimaryp->callp);
     switch (rhsPrimaryp->type) {
     case MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_SINGLE_SYMBOL:
-      _marpaESLIF_bootstrap_single_symbol_freev(rhsPrimaryp->u.singleSymbolp);
+      _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIFp, rhsPrimaryp->u.singleSymbolp);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_SYMBOL_AND_REFERENCE:
-      _marpaESLIF_bootstrap_symbol_and_reference_freev(rhsPrimaryp->u.symbolAndReferencep);
+      _marpaESLIF_bootstrap_symbol_and_reference_freev(marpaESLIFp, rhsPrimaryp->u.symbolAndReferencep);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_GENERATOR_ACTION:
-      _marpaESLIF_action_freev(rhsPrimaryp->u.generatorActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, rhsPrimaryp->u.generatorActionp);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_NAME:
-      _marpaESLIF_bootstrap_utf_string_freev(&(rhsPrimaryp->u.name), 1 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, &(rhsPrimaryp->u.name), 1 /* onStackb */);
       break;
     default:
       break;
     }
-    free(rhsPrimaryp);
+    MARPAESLIF_FREE(marpaESLIFp, rhsPrimaryp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_lhs_freev(marpaESLIF_bootstrap_lhs_t *bootstrapLhsp)
+static inline void _marpaESLIF_bootstrap_lhs_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_lhs_t *bootstrapLhsp)
 /*****************************************************************************/
 {
   if (bootstrapLhsp != NULL) {
     if (bootstrapLhsp->symbols != NULL) {
-      free(bootstrapLhsp->symbols);
+      MARPAESLIF_FREE(marpaESLIFp, bootstrapLhsp->symbols);
     }
-    _marpaESLIF_lua_functiondecl_freev(bootstrapLhsp->declp);
-    free(bootstrapLhsp);
+    _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, bootstrapLhsp->declp);
+    MARPAESLIF_FREE(marpaESLIFp, bootstrapLhsp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIF_bootstrap_start_symbol_t *startSymbolp)
+static inline void _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_start_symbol_t *startSymbolp)
 /*****************************************************************************/
 {
   if (startSymbolp != NULL) {
     if (startSymbolp->symbols != NULL) {
-      free(startSymbolp->symbols);
+      MARPAESLIF_FREE(marpaESLIFp, startSymbolp->symbols);
     }
-    _marpaESLIF_lua_functioncall_freev(startSymbolp->callp);
-    free(startSymbolp);
+    _marpaESLIF_lua_functioncall_freev(marpaESLIFp, startSymbolp->callp);
+    MARPAESLIF_FREE(marpaESLIFp, startSymbolp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_lua_function_freev(marpaESLIF_bootstrap_lua_function_t *luaFunctionp)
+static inline void _marpaESLIF_bootstrap_lua_function_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_lua_function_t *luaFunctionp)
 /*****************************************************************************/
 {
   if (luaFunctionp != NULL) {
     if (luaFunctionp->luas != NULL) {
-      free(luaFunctionp->luas);
+      MARPAESLIF_FREE(marpaESLIFp, luaFunctionp->luas);
     }
     if (luaFunctionp->actions != NULL) {
-      free(luaFunctionp->actions);
+      MARPAESLIF_FREE(marpaESLIFp, luaFunctionp->actions);
     }
     if (luaFunctionp->luacstripp != NULL) {
-      free(luaFunctionp->luacstripp);
+      MARPAESLIF_FREE(marpaESLIFp, luaFunctionp->luacstripp);
     }
-    free(luaFunctionp);
+    MARPAESLIF_FREE(marpaESLIFp, luaFunctionp);
   }
 }
 
 /*****************************************************************************/
-static inline void  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIF_bootstrap_rhs_alternative_t *rhsAlternativep)
+static inline void  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_rhs_alternative_t *rhsAlternativep)
 /*****************************************************************************/
 {
   if (rhsAlternativep != NULL) {
     switch (rhsAlternativep->type) {
     case MARPAESLIF_BOOTSTRAP_RHS_ALTERNATIVE_TYPE_RHS_PRIMARY:
-      _marpaESLIF_bootstrap_rhs_primary_freev(rhsAlternativep->u.rhsPrimaryp);
+      _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, rhsAlternativep->u.rhsPrimaryp);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_ALTERNATIVE_TYPE_PRIORITIES:
-      _marpaESLIF_bootstrap_priorities_freev(rhsAlternativep->u.priorities.alternativesStackp);
+      _marpaESLIF_bootstrap_priorities_freev(marpaESLIFp, rhsAlternativep->u.priorities.alternativesStackp);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_ALTERNATIVE_TYPE_EXCEPTION:
-      _marpaESLIF_bootstrap_rhs_primary_freev(rhsAlternativep->u.exception.rhsPrimaryp);
-      _marpaESLIF_bootstrap_rhs_primary_freev(rhsAlternativep->u.exception.rhsPrimaryExceptionp);
-      _marpaESLIF_bootstrap_adverb_list_items_freev(rhsAlternativep->u.exception.adverbListItemStackp);
+      _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, rhsAlternativep->u.exception.rhsPrimaryp);
+      _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, rhsAlternativep->u.exception.rhsPrimaryExceptionp);
+      _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFp, rhsAlternativep->u.exception.adverbListItemStackp);
       break;
     case MARPAESLIF_BOOTSTRAP_RHS_ALTERNATIVE_TYPE_QUANTIFIED:
-      _marpaESLIF_bootstrap_rhs_primary_freev(rhsAlternativep->u.quantified.rhsPrimaryp);
-      _marpaESLIF_bootstrap_adverb_list_items_freev(rhsAlternativep->u.quantified.adverbListItemStackp);
+      _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, rhsAlternativep->u.quantified.rhsPrimaryp);
+      _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFp, rhsAlternativep->u.quantified.adverbListItemStackp);
       break;
     default:
       break;
     }
-    free(rhsAlternativep);
+    MARPAESLIF_FREE(marpaESLIFp, rhsAlternativep);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_symbol_and_reference_freev(marpaESLIF_bootstrap_symbol_and_reference_t *symbolAndReferencep)
+static inline void _marpaESLIF_bootstrap_symbol_and_reference_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_symbol_and_reference_t *symbolAndReferencep)
 /*****************************************************************************/
 {
   if (symbolAndReferencep != NULL) {
-    _marpaESLIF_bootstrap_symbol_freev(symbolAndReferencep->symbolp);
-    _marpaESLIF_bootstrap_grammar_reference_freev(symbolAndReferencep->grammarReferencep);
-    free(symbolAndReferencep);
+    _marpaESLIF_bootstrap_symbol_freev(marpaESLIFp, symbolAndReferencep->symbolp);
+    _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFp, symbolAndReferencep->grammarReferencep);
+    MARPAESLIF_FREE(marpaESLIFp, symbolAndReferencep);
   }
 }
 
 /*****************************************************************************/
-static inline void  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIF_bootstrap_utf_string_t *stringp, short onStackb)
+static inline void  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_utf_string_t *stringp, short onStackb)
 /*****************************************************************************/
 {
   if (stringp != NULL) {
     if (stringp->substitutionBytep != NULL) {
-      free(stringp->substitutionBytep);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->substitutionBytep);
     }
     if (stringp->substitutionModifiers != NULL) {
-      free(stringp->substitutionModifiers);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->substitutionModifiers);
     }
     if (stringp->bytep != NULL) {
-      free(stringp->bytep);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->bytep);
     }
     if (stringp->modifiers != NULL) {
-      free(stringp->modifiers);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->modifiers);
     }
     if (! onStackb) {
-      free(stringp);
+      MARPAESLIF_FREE(marpaESLIFp, stringp);
     }
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_rhs_freev(genericStack_t *rhsAlternativeStackp)
+static inline void _marpaESLIF_bootstrap_rhs_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *rhsAlternativeStackp)
 /*****************************************************************************/
 {
   int i;
@@ -675,7 +675,7 @@ static inline void _marpaESLIF_bootstrap_rhs_freev(genericStack_t *rhsAlternativ
   if (rhsAlternativeStackp != NULL) {
     for (i = 0; i < GENERICSTACK_USED(rhsAlternativeStackp); i++) {
       if (GENERICSTACK_IS_PTR(rhsAlternativeStackp, i)) {
-        _marpaESLIF_bootstrap_rhs_alternative_freev((marpaESLIF_bootstrap_rhs_alternative_t *) GENERICSTACK_GET_PTR(rhsAlternativeStackp, i));
+        _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFp, (marpaESLIF_bootstrap_rhs_alternative_t *) GENERICSTACK_GET_PTR(rhsAlternativeStackp, i));
       }
     }
     GENERICSTACK_FREE(rhsAlternativeStackp);
@@ -683,7 +683,7 @@ static inline void _marpaESLIF_bootstrap_rhs_freev(genericStack_t *rhsAlternativ
 }
 
 /*****************************************************************************/
-static inline void  _marpaESLIF_bootstrap_adverb_list_items_freev(genericStack_t *adverbListItemStackp)
+static inline void  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *adverbListItemStackp)
 /*****************************************************************************/
 {
   int i;
@@ -691,7 +691,7 @@ static inline void  _marpaESLIF_bootstrap_adverb_list_items_freev(genericStack_t
   if (adverbListItemStackp != NULL) {
     for (i = 0; i < GENERICSTACK_USED(adverbListItemStackp); i++) {
       if (GENERICSTACK_IS_PTR(adverbListItemStackp, i)) {
-        _marpaESLIF_bootstrap_adverb_list_item_freev((marpaESLIF_bootstrap_adverb_list_item_t *) GENERICSTACK_GET_PTR(adverbListItemStackp, i));
+        _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIFp, (marpaESLIF_bootstrap_adverb_list_item_t *) GENERICSTACK_GET_PTR(adverbListItemStackp, i));
       }
     }
     GENERICSTACK_FREE(adverbListItemStackp);
@@ -699,18 +699,18 @@ static inline void  _marpaESLIF_bootstrap_adverb_list_items_freev(genericStack_t
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_alternative_freev(marpaESLIF_bootstrap_alternative_t *alternativep)
+static inline void _marpaESLIF_bootstrap_alternative_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_alternative_t *alternativep)
 /*****************************************************************************/
 {
   if (alternativep != NULL) {
-    _marpaESLIF_bootstrap_rhs_freev(alternativep->rhsAlternativeStackp);
-    _marpaESLIF_bootstrap_adverb_list_items_freev(alternativep->adverbListItemStackp);
-    free(alternativep);
+    _marpaESLIF_bootstrap_rhs_freev(marpaESLIFp, alternativep->rhsAlternativeStackp);
+    _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFp, alternativep->adverbListItemStackp);
+    MARPAESLIF_FREE(marpaESLIFp, alternativep);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_alternatives_freev(genericStack_t *alternativeStackp)
+static inline void _marpaESLIF_bootstrap_alternatives_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *alternativeStackp)
 /*****************************************************************************/
 {
   int i;
@@ -718,7 +718,7 @@ static inline void _marpaESLIF_bootstrap_alternatives_freev(genericStack_t *alte
   if (alternativeStackp != NULL) {
     for (i = 0; i < GENERICSTACK_USED(alternativeStackp); i++) {
       if (GENERICSTACK_IS_PTR(alternativeStackp, i)) {
-        _marpaESLIF_bootstrap_alternative_freev((marpaESLIF_bootstrap_alternative_t *) GENERICSTACK_GET_PTR(alternativeStackp, i));
+        _marpaESLIF_bootstrap_alternative_freev(marpaESLIFp, (marpaESLIF_bootstrap_alternative_t *) GENERICSTACK_GET_PTR(alternativeStackp, i));
       }
     }
     GENERICSTACK_FREE(alternativeStackp);
@@ -726,7 +726,7 @@ static inline void _marpaESLIF_bootstrap_alternatives_freev(genericStack_t *alte
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_priorities_freev(genericStack_t *alternativesStackp)
+static inline void _marpaESLIF_bootstrap_priorities_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *alternativesStackp)
 /*****************************************************************************/
 {
   int i;
@@ -734,7 +734,7 @@ static inline void _marpaESLIF_bootstrap_priorities_freev(genericStack_t *altern
   if (alternativesStackp != NULL) {
     for (i = 0; i < GENERICSTACK_USED(alternativesStackp); i++) {
       if (GENERICSTACK_IS_PTR(alternativesStackp, i)) {
-        _marpaESLIF_bootstrap_alternatives_freev((genericStack_t *) GENERICSTACK_GET_PTR(alternativesStackp, i));
+        _marpaESLIF_bootstrap_alternatives_freev(marpaESLIFp, (genericStack_t *) GENERICSTACK_GET_PTR(alternativesStackp, i));
       }
     }
     GENERICSTACK_FREE(alternativesStackp);
@@ -742,50 +742,50 @@ static inline void _marpaESLIF_bootstrap_priorities_freev(genericStack_t *altern
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIF_bootstrap_single_symbol_t *singleSymbolp)
+static inline void _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_single_symbol_t *singleSymbolp)
 /*****************************************************************************/
 {
   if (singleSymbolp != NULL) {
     switch (singleSymbolp->type) {
     case MARPAESLIF_BOOTSTRAP_SINGLE_SYMBOL_TYPE_SYMBOL:
-      _marpaESLIF_bootstrap_symbol_freev(singleSymbolp->u.symbolp);
+      _marpaESLIF_bootstrap_symbol_freev(marpaESLIFp, singleSymbolp->u.symbolp);
       break;
     case MARPAESLIF_BOOTSTRAP_SINGLE_SYMBOL_TYPE_TERMINAL:
-      _marpaESLIF_bootstrap_terminal_freev(singleSymbolp->u.terminalp);
+      _marpaESLIF_bootstrap_terminal_freev(marpaESLIFp, singleSymbolp->u.terminalp);
       break;
     default:
       break;
     }
-    free(singleSymbolp);
+    MARPAESLIF_FREE(marpaESLIFp, singleSymbolp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_symbol_freev(marpaESLIF_bootstrap_symbol_t *symbolp)
+static inline void _marpaESLIF_bootstrap_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_symbol_t *symbolp)
 /*****************************************************************************/
 {
   if (symbolp != NULL) {
     if (symbolp->symbols != NULL) {
-      free(symbolp->symbols);
+      MARPAESLIF_FREE(marpaESLIFp, symbolp->symbols);
     }
-    free(symbolp);
+    MARPAESLIF_FREE(marpaESLIFp, symbolp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_terminal_freev(marpaESLIF_bootstrap_terminal_t *terminalp)
+static inline void _marpaESLIF_bootstrap_terminal_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_terminal_t *terminalp)
 /*****************************************************************************/
 {
   if (terminalp != NULL) {
     switch (terminalp->type) {
     case MARPAESLIF_BOOTSTRAP_TERMINAL_TYPE_CHARACTER_CLASS:
-      _marpaESLIF_bootstrap_utf_string_freev(terminalp->u.characterClassp, 0 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, terminalp->u.characterClassp, 0 /* onStackb */);
       break;
     case MARPAESLIF_BOOTSTRAP_TERMINAL_TYPE_REGULAR_EXPRESSION:
-      _marpaESLIF_bootstrap_utf_string_freev(terminalp->u.regularExpressionp, 0 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, terminalp->u.regularExpressionp, 0 /* onStackb */);
       break;
     case MARPAESLIF_BOOTSTRAP_TERMINAL_TYPE_QUOTED_STRING:
-      _marpaESLIF_bootstrap_utf_string_freev(terminalp->u.stringp, 0 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, terminalp->u.stringp, 0 /* onStackb */);
       break;
     case MARPAESLIF_BOOTSTRAP_TERMINAL_TYPE__EOF:
       /* No op - here for clarity */
@@ -802,35 +802,35 @@ static inline void _marpaESLIF_bootstrap_terminal_freev(marpaESLIF_bootstrap_ter
     default:
       break;
     }
-    free(terminalp);
+    MARPAESLIF_FREE(marpaESLIFp, terminalp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIF_bootstrap_grammar_reference_t *grammarReferencep)
+static inline void _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_grammar_reference_t *grammarReferencep)
 /*****************************************************************************/
 {
   if (grammarReferencep != NULL) {
     switch (grammarReferencep->type) {
     case MARPAESLIF_BOOTSTRAP_GRAMMAR_REFERENCE_TYPE_STRING:
-      _marpaESLIF_bootstrap_utf_string_freev(grammarReferencep->u.quotedStringp, 0 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, grammarReferencep->u.quotedStringp, 0 /* onStackb */);
       break;
     default:
       break;
     }
-    free(grammarReferencep);
+    MARPAESLIF_FREE(marpaESLIFp, grammarReferencep);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIF_bootstrap_event_initialization_t *eventInitializationp)
+static inline void _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_event_initialization_t *eventInitializationp)
 /*****************************************************************************/
 {
   if (eventInitializationp != NULL) {
     if (eventInitializationp->eventNames != NULL) {
-      free(eventInitializationp->eventNames);
+      MARPAESLIF_FREE(marpaESLIFp, eventInitializationp->eventNames);
     }
-    free(eventInitializationp);
+    MARPAESLIF_FREE(marpaESLIFp, eventInitializationp);
   }
 }
 
@@ -886,7 +886,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_bootstrap_check_gramma
     }
     GENERICSTACK_SET_PTR(marpaESLIFGrammarBootstrapp->grammarBootstrapStackp, grammarBootstrapp, leveli);
     if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFGrammarBootstrapp->grammarBootstrapStackp))) {
-      _marpaESLIF_grammar_bootstrap_freev(grammarBootstrapp);
+      _marpaESLIF_grammar_bootstrap_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp);
       goto err;
     }
   }
@@ -1003,8 +1003,8 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_bootstrap_check_meta_by_namep(mar
   goto done;
 
  err:
-  _marpaESLIF_meta_freev(metap);
-  _marpaESLIF_symbol_freev(symbolp);
+  _marpaESLIF_meta_freev(marpaESLIFValuep->marpaESLIFp, metap);
+  _marpaESLIF_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
   symbolp = NULL;
 
  done:
@@ -1115,8 +1115,8 @@ static inline short _marpaESLIF_bootstrap_search_terminal_by_descriptionb(marpaE
   rcb = 0;
 
  done:
-  _marpaESLIF_terminal_freev(terminalp);
-  _marpaESLIF_terminal_freev(substitutionTerminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFValuep->marpaESLIFp, substitutionTerminalp);
   return rcb;
 }
 
@@ -1281,9 +1281,13 @@ static inline marpaESLIF_symbol_t  *_marpaESLIF_bootstrap_check_terminal_by_type
       }
 
       /* Replace description */
-      _marpaESLIF_string_freev(symbolp->u.terminalp->descp, 0 /* onStackb */);
+      _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, symbolp->u.terminalp->descp, 0 /* onStackb */);
       symbolp->descp = symbolp->u.terminalp->descp = descp;
       descp = NULL; /* descp is now in symbolp->u.terminalp */
+
+      /* Its patterns are now in symbolp->u.terminalp */
+      _marpaESLIF_terminal_freev(marpaESLIFValuep->marpaESLIFp, substitutionTerminalp);
+      substitutionTerminalp = NULL;
     }
 
     GENERICSTACK_SET_PTR(grammarBootstrapp->symbolStackp, symbolp, symbolp->idi);
@@ -1296,10 +1300,10 @@ static inline marpaESLIF_symbol_t  *_marpaESLIF_bootstrap_check_terminal_by_type
   goto done;
   
  err:
-  _marpaESLIF_terminal_freev(terminalp);
-  _marpaESLIF_terminal_freev(substitutionTerminalp);
-  _marpaESLIF_symbol_freev(symbolp);
-  _marpaESLIF_string_freev(descp, 0 /* onStackb */);
+  _marpaESLIF_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFValuep->marpaESLIFp, substitutionTerminalp);
+  _marpaESLIF_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, descp, 0 /* onStackb */);
   symbolp = NULL;
 
  done:
@@ -1744,7 +1748,7 @@ static inline marpaESLIF_symbol_t  *_marpaESLIF_bootstrap_check_rhsAlternativep(
   symbolp = NULL;
 
  done:
-  _marpaESLIF_rule_freev(rulep);
+  _marpaESLIF_rule_freev(marpaESLIFValuep->marpaESLIFp, rulep);
   return symbolp;
 }
 
@@ -1820,19 +1824,19 @@ static inline marpaESLIF_symbol_t  *_marpaESLIF_bootstrap_check_rhsPrimaryp(marp
 
       /* Create the symbol in the current grammar */
       singleSymbol.type = MARPAESLIF_BOOTSTRAP_SINGLE_SYMBOL_TYPE_NA;
-      singleSymbol.u.symbolp = (marpaESLIF_bootstrap_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_symbol_t));
+      singleSymbol.u.symbolp = (marpaESLIF_bootstrap_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_symbol_t));
       if (MARPAESLIF_UNLIKELY(singleSymbol.u.symbolp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
       singleSymbol.type = MARPAESLIF_BOOTSTRAP_SINGLE_SYMBOL_TYPE_SYMBOL;
-      singleSymbol.u.symbolp->symbols = strdup(rhsPrimaryp->u.symbolAndReferencep->symbolp->symbols);
+      singleSymbol.u.symbolp->symbols = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp->u.symbolAndReferencep->symbolp->symbols);
       if (singleSymbol.u.symbolp->symbols == NULL) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
       symbolp = _marpaESLIF_bootstrap_check_singleSymbolp(marpaESLIFValuep, marpaESLIFGrammarBootstrapp, grammarBootstrapp, &singleSymbol, 1 /* createb */, forcecreateb, 0 /* lhsb */, NULL, 1 /* rhsb */, rhsPrimaryp->callp);
-      _marpaESLIF_bootstrap_symbol_freev(singleSymbol.u.symbolp);
+      _marpaESLIF_bootstrap_symbol_freev(marpaESLIFValuep->marpaESLIFp, singleSymbol.u.symbolp);
       if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
         goto err;
       }
@@ -1881,8 +1885,8 @@ static inline marpaESLIF_symbol_t  *_marpaESLIF_bootstrap_check_rhsPrimaryp(marp
   symbolp = NULL;
 
  done:
-  _marpaESLIF_action_freev(generatorActionp);
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, generatorActionp);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
   return symbolp;
 }
 
@@ -2167,13 +2171,13 @@ static inline short _marpaESLIF_bootstrap_unpack_adverbListItemStackb(marpaESLIF
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_bootstrap_adverb_list_item_t *adverbListItemp)
+static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_bootstrap_adverb_list_item_t *adverbListItemp)
 /*****************************************************************************/
 {
   if (adverbListItemp != NULL) {
     switch (adverbListItemp->type) {
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_ACTION:
-      _marpaESLIF_action_freev(adverbListItemp->u.actionp);
+      _marpaESLIF_action_freev(marpaESLIFp, adverbListItemp->u.actionp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_LEFT_ASSOCIATION:
       break;
@@ -2182,7 +2186,7 @@ static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_boots
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_GROUP_ASSOCIATION:
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_SEPARATOR:
-      _marpaESLIF_bootstrap_rhs_primary_freev(adverbListItemp->u.separatorRhsPrimaryp);
+      _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, adverbListItemp->u.separatorRhsPrimaryp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_PROPER:
       break;
@@ -2203,55 +2207,57 @@ static inline void _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIF_boots
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_DISCARD_IS_FALLBACK:
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_NAMING:
-      _marpaESLIF_bootstrap_utf_string_freev(adverbListItemp->u.namingp, 0 /* onStackb */);
+      _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, adverbListItemp->u.namingp, 0 /* onStackb */);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_SYMBOLACTION:
-      _marpaESLIF_action_freev(adverbListItemp->u.symbolactionp);
+      _marpaESLIF_action_freev(marpaESLIFp, adverbListItemp->u.symbolactionp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_EVENT_INITIALIZATION:
-      _marpaESLIF_bootstrap_event_initialization_freev(adverbListItemp->u.eventInitializationp);
+      _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFp, adverbListItemp->u.eventInitializationp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_IFACTION:
-      _marpaESLIF_action_freev(adverbListItemp->u.ifactionp);
+      _marpaESLIF_action_freev(marpaESLIFp, adverbListItemp->u.ifactionp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_REGEXACTION:
-      _marpaESLIF_action_freev(adverbListItemp->u.regexactionp);
+      _marpaESLIF_action_freev(marpaESLIFp, adverbListItemp->u.regexactionp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_EVENTACTION:
-      _marpaESLIF_action_freev(adverbListItemp->u.eventactionp);
+      _marpaESLIF_action_freev(marpaESLIFp, adverbListItemp->u.eventactionp);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_DEFAULTENCODING:
-      free(adverbListItemp->u.defaultEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, adverbListItemp->u.defaultEncodings);
       break;
     case MARPAESLIF_BOOTSTRAP_ADVERB_LIST_ITEM_TYPE_FALLBACKENCODING:
-      free(adverbListItemp->u.fallbackEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, adverbListItemp->u.fallbackEncodings);
       break;
     default:
       break;
     }
-    free(adverbListItemp);
+    MARPAESLIF_FREE(marpaESLIFp, adverbListItemp);
   }
 }
 
 /*****************************************************************************/
-static void _marpaESLIF_bootstrap_freeDefaultActionv(void *userDatavNotUsedp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+static void _marpaESLIF_bootstrap_freeDefaultActionv(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
 /*****************************************************************************/
 {
+  marpaESLIF_t *marpaESLIFp = (marpaESLIF_t *) userDatavp;
+
   if      (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_OP_DECLARE                      ) { }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SYMBOL_NAME                     ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS_PRIMARY                     ) { _marpaESLIF_bootstrap_rhs_primary_freev((marpaESLIF_bootstrap_rhs_primary_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTIONCALL                ) { _marpaESLIF_lua_functioncall_freev((marpaESLIF_lua_functioncall_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTIONDECL                ) { _marpaESLIF_lua_functiondecl_freev((marpaESLIF_lua_functiondecl_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS_ALTERNATIVE                 ) { _marpaESLIF_bootstrap_rhs_alternative_freev((marpaESLIF_bootstrap_rhs_alternative_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS                             ) { _marpaESLIF_bootstrap_rhs_freev((genericStack_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LHS                             ) { _marpaESLIF_bootstrap_lhs_freev((marpaESLIF_bootstrap_lhs_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_START_SYMBOL                    ) { _marpaESLIF_bootstrap_start_symbol_freev((marpaESLIF_bootstrap_start_symbol_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_SYMBOL                      ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_ACTION              ) { free(marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SYMBOL_NAME                     ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS_PRIMARY                     ) { _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, (marpaESLIF_bootstrap_rhs_primary_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTIONCALL                ) { _marpaESLIF_lua_functioncall_freev(marpaESLIFp, (marpaESLIF_lua_functioncall_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTIONDECL                ) { _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, (marpaESLIF_lua_functiondecl_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS_ALTERNATIVE                 ) { _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFp, (marpaESLIF_bootstrap_rhs_alternative_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_RHS                             ) { _marpaESLIF_bootstrap_rhs_freev(marpaESLIFp, (genericStack_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LHS                             ) { _marpaESLIF_bootstrap_lhs_freev(marpaESLIFp, (marpaESLIF_bootstrap_lhs_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_START_SYMBOL                    ) { _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIFp, (marpaESLIF_bootstrap_start_symbol_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_SYMBOL                      ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_ACTION              ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_LEFT_ASSOCIATION    ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_RIGHT_ASSOCIATION   ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_GROUP_ASSOCIATION   ) { }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_SEPARATOR           ) { _marpaESLIF_bootstrap_rhs_primary_freev((marpaESLIF_bootstrap_rhs_primary_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_SEPARATOR           ) { _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFp, (marpaESLIF_bootstrap_rhs_primary_t *) marpaESLIFValueResultp->u.p.p); }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_PROPER              ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_VERBOSE             ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_HIDESEPARATOR       ) { }
@@ -2261,32 +2267,32 @@ static void _marpaESLIF_bootstrap_freeDefaultActionv(void *userDatavNotUsedp, ma
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_PAUSE               ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_LATM                ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_DISCARD_IS_FALLBACK ) { }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_NAMING              ) { _marpaESLIF_bootstrap_utf_string_freev((marpaESLIF_bootstrap_utf_string_t *) marpaESLIFValueResultp->u.p.p, 0 /* onStackb */); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_SYMBOLACTION        ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_EVENT_INITIALIZATION) { _marpaESLIF_bootstrap_event_initialization_freev((marpaESLIF_bootstrap_event_initialization_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_IFACTION            ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_REGEXACTION         ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_EVENTACTION         ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_DEFAULTENCODING     ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_FALLBACKENCODING    ) { free(marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_LIST_ITEMS               ) { _marpaESLIF_bootstrap_adverb_list_items_freev((genericStack_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVE                     ) { _marpaESLIF_bootstrap_alternative_freev((marpaESLIF_bootstrap_alternative_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVES                    ) { _marpaESLIF_bootstrap_alternatives_freev((genericStack_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_PRIORITIES                      ) { _marpaESLIF_bootstrap_priorities_freev((genericStack_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SINGLE_SYMBOL                   ) { _marpaESLIF_bootstrap_single_symbol_freev((marpaESLIF_bootstrap_single_symbol_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SYMBOL                          ) { _marpaESLIF_bootstrap_symbol_freev((marpaESLIF_bootstrap_symbol_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_TERMINAL                        ) { _marpaESLIF_bootstrap_terminal_freev((marpaESLIF_bootstrap_terminal_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_GRAMMAR_REFERENCE               ) { _marpaESLIF_bootstrap_grammar_reference_freev((marpaESLIF_bootstrap_grammar_reference_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_NAMING              ) { _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, (marpaESLIF_bootstrap_utf_string_t *) marpaESLIFValueResultp->u.p.p, 0 /* onStackb */); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_SYMBOLACTION        ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_EVENT_INITIALIZATION) { _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFp, (marpaESLIF_bootstrap_event_initialization_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_IFACTION            ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_REGEXACTION         ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_EVENTACTION         ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_DEFAULTENCODING     ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_ITEM_FALLBACKENCODING    ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ADVERB_LIST_ITEMS               ) { _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFp, (genericStack_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVE                     ) { _marpaESLIF_bootstrap_alternative_freev(marpaESLIFp, (marpaESLIF_bootstrap_alternative_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVES                    ) { _marpaESLIF_bootstrap_alternatives_freev(marpaESLIFp, (genericStack_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_PRIORITIES                      ) { _marpaESLIF_bootstrap_priorities_freev(marpaESLIFp, (genericStack_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SINGLE_SYMBOL                   ) { _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIFp, (marpaESLIF_bootstrap_single_symbol_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_SYMBOL                          ) { _marpaESLIF_bootstrap_symbol_freev(marpaESLIFp, (marpaESLIF_bootstrap_symbol_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_TERMINAL                        ) { _marpaESLIF_bootstrap_terminal_freev(marpaESLIFp, (marpaESLIF_bootstrap_terminal_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_GRAMMAR_REFERENCE               ) { _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFp, (marpaESLIF_bootstrap_grammar_reference_t *) marpaESLIFValueResultp->u.p.p); }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_INACESSIBLE_TREATMENT           ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ON_OR_OFF                       ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_QUANTIFIER                      ) { }
   else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_EVENT_INITIALIZER               ) { }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_EVENT_INITIALIZATION            ) { _marpaESLIF_bootstrap_event_initialization_freev((marpaESLIF_bootstrap_event_initialization_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVE_NAME                ) { free(marpaESLIFValueResultp->u.a.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ARRAY                           ) { free(marpaESLIFValueResultp->u.a.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_STRING                          ) { _marpaESLIF_string_freev((marpaESLIF_string_t *) marpaESLIFValueResultp->u.p.p, 0 /* onStackb */); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTION                    ) { _marpaESLIF_bootstrap_lua_function_freev((marpaESLIF_bootstrap_lua_function_t *) marpaESLIFValueResultp->u.p.p); }
-  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ACTION                          ) { _marpaESLIF_action_freev((marpaESLIF_action_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_EVENT_INITIALIZATION            ) { _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFp, (marpaESLIF_bootstrap_event_initialization_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ALTERNATIVE_NAME                ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.a.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ARRAY                           ) { MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.a.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_STRING                          ) { _marpaESLIF_string_freev(marpaESLIFp, (marpaESLIF_string_t *) marpaESLIFValueResultp->u.p.p, 0 /* onStackb */); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_LUA_FUNCTION                    ) { _marpaESLIF_bootstrap_lua_function_freev(marpaESLIFp, (marpaESLIF_bootstrap_lua_function_t *) marpaESLIFValueResultp->u.p.p); }
+  else if (marpaESLIFValueResultp->contextp == MARPAESLIF_BOOTSTRAP_STACK_TYPE_ACTION                          ) { _marpaESLIF_action_freev(marpaESLIFp, (marpaESLIF_action_t *) marpaESLIFValueResultp->u.p.p); }
   else                                                                                   { }
 }
 
@@ -2348,7 +2354,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_unquote_s
   }
 
   rcp->bytel               = rc.bytel;
-  rcp->bytep               = (char *) malloc(rc.bytel + 1); /* NUL byte */
+  rcp->bytep               = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, rc.bytel + 1); /* NUL byte */
   if (MARPAESLIF_UNLIKELY(rcp->bytep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -2360,7 +2366,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_unquote_s
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_utf_string_freev(rcp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, rcp, 0 /* onStackb */);
   rcp = NULL;
 
  done:
@@ -2519,7 +2525,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbol_name_1b(void *userDatavp, ma
     MARPAESLIF_ERROR(marpaESLIFValuep->marpaESLIFp, "Null bare name");
     goto err;
   }
-  barenames = (char *) malloc(asciil + 1);
+  barenames = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, asciil + 1);
   if (MARPAESLIF_UNLIKELY(barenames == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -2533,7 +2539,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbol_name_1b(void *userDatavp, ma
   goto done;
  err:
   if (barenames != NULL) {
-    free(barenames);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, barenames);
   }
   rcb = 0;
  done:
@@ -2569,7 +2575,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbol_name_2b(void *userDatavp, ma
     goto err;
   }
   /* We just remove the '<' and '>' around... */
-  bracketednames = (char *) malloc(asciil - 2 + 1);
+  bracketednames = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, asciil - 2 + 1);
   if (MARPAESLIF_UNLIKELY(bracketednames == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -2583,7 +2589,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbol_name_2b(void *userDatavp, ma
   goto done;
  err:
   if (bracketednames != NULL) {
-    free(bracketednames);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, bracketednames);
   }
   rcb = 0;
  done:
@@ -2714,11 +2720,11 @@ static short _marpaESLIF_bootstrap_G1_action_rhsb(void *userDatavp, marpaESLIFVa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_freev(rhsAlternativeStackp);
+  _marpaESLIF_bootstrap_rhs_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativeStackp);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep); /* This is NULL tolerant */
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep); /* This is NULL tolerant */
   return rcb;
 }
 
@@ -2774,7 +2780,7 @@ static short _marpaESLIF_bootstrap_G1_action_adverb_list_itemsb(void *userDatavp
 
       MARPAESLIF_BOOTSTRAP_GET_CONTEXT(marpaESLIFValuep, i, contextp);
 
-      adverbListItemp = (marpaESLIF_bootstrap_adverb_list_item_t *) malloc(sizeof(marpaESLIF_bootstrap_adverb_list_item_t));
+      adverbListItemp = (marpaESLIF_bootstrap_adverb_list_item_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_adverb_list_item_t));
       if (MARPAESLIF_UNLIKELY(adverbListItemp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -2946,22 +2952,22 @@ static short _marpaESLIF_bootstrap_G1_action_adverb_list_itemsb(void *userDatavp
   goto done;
 
  err:
-  _marpaESLIF_action_freev(actionp);
-  _marpaESLIF_action_freev(symbolactionp);
-  _marpaESLIF_action_freev(ifactionp);
-  _marpaESLIF_action_freev(regexactionp);
-  _marpaESLIF_action_freev(eventactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, actionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, symbolactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, ifactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, regexactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, eventactionp);
   if (defaultEncodings != NULL) {
-    free(defaultEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, defaultEncodings);
   }
   if (fallbackEncodings != NULL) {
-    free(fallbackEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, fallbackEncodings);
   }
-  _marpaESLIF_bootstrap_event_initialization_freev(eventInitializationp);
-  _marpaESLIF_bootstrap_utf_string_freev(namingp, 0 /* onStackb */);
-  _marpaESLIF_bootstrap_rhs_primary_freev(separatorRhsPrimaryp);
-  _marpaESLIF_bootstrap_adverb_list_item_freev(adverbListItemp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFValuep->marpaESLIFp, eventInitializationp);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, namingp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, separatorRhsPrimaryp);
+  _marpaESLIF_bootstrap_adverb_list_item_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   rcb = 0;
 
  done:
@@ -2998,7 +3004,7 @@ static short _marpaESLIF_bootstrap_G1_action_action_2b(void *userDatavp, marpaES
     goto err;
   }
 
-  actionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+  actionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
   if (MARPAESLIF_UNLIKELY(actionp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3013,11 +3019,11 @@ static short _marpaESLIF_bootstrap_G1_action_action_2b(void *userDatavp, marpaES
   goto done;
 
  err:
-  _marpaESLIF_action_freev(actionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, actionp);
   rcb = 0;
 
  done:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -3051,7 +3057,7 @@ static short _marpaESLIF_bootstrap_G1_action_action_3b(void *userDatavp, marpaES
     goto err;
   }
 
-  actionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+  actionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
   if (MARPAESLIF_UNLIKELY(actionp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3066,12 +3072,12 @@ static short _marpaESLIF_bootstrap_G1_action_action_3b(void *userDatavp, marpaES
   goto done;
 
  err:
-  _marpaESLIF_action_freev(actionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, actionp);
   rcb = 0;
 
  done:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
-  _marpaESLIF_bootstrap_utf_string_freev(quotedStringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, quotedStringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -3115,7 +3121,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literalb(void *userDatavp, m
   if (charl <= 0) {
     stringp = _marpaESLIF_string_newp(marpaESLIFValuep->marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, NULL, 0); /* Will produce empty string */
   } else {
-    charp = (char *) malloc(charl + 1);
+    charp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, charl + 1);
     if (MARPAESLIF_UNLIKELY(charp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -3145,6 +3151,8 @@ static short _marpaESLIF_bootstrap_G1_action_string_literalb(void *userDatavp, m
                                        NULL, /* byteleftsp */
                                        NULL, /* byteleftlp */
                                        NULL, /* byteleftalloclp */
+                                       NULL, /* outbufsp */
+                                       NULL, /* outbufalloclp */
                                        0, /* tconvsilentb */
                                        NULL, /* defaultEncodings */
                                        NULL /* fallbackEncodings */);
@@ -3164,15 +3172,15 @@ static short _marpaESLIF_bootstrap_G1_action_string_literalb(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
   rcb = 0;
 
  done:
   if (converteds != NULL) {
-    free(converteds);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, converteds);
   }
   if (charp != NULL) {
-    free(charp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, charp);
   }
   return rcb;
 }
@@ -3246,7 +3254,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_2b(void *user
     goto err;
   }
 
-  charp = (char *) malloc(charl + 1);
+  charp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, charl + 1);
   if (MARPAESLIF_UNLIKELY(charp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3260,7 +3268,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_2b(void *user
 
  err:
   if (charp != NULL) {
-    free(charp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, charp);
   }
   rcb = 0;
 
@@ -3299,7 +3307,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_3b(void *user
   c <<= 4;
   MARPAESLIF_BOOTSTRAP_DST_OR_VALCHAR(marpaESLIFValuep, c, *p);
   
-  charp = (char *) malloc(charl + 1);
+  charp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, charl + 1);
   if (MARPAESLIF_UNLIKELY(charp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3313,7 +3321,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_3b(void *user
 
  err:
   if (charp != NULL) {
-    free(charp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, charp);
   }
   rcb = 0;
 
@@ -3363,7 +3371,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_4b(void *user
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "Failed to determine UTF-8 byte size of 0x%ld", (unsigned long) uint32);
     goto err;
   }
-  charp = (char *) malloc(charl + 1);
+  charp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, charl + 1);
   if (MARPAESLIF_UNLIKELY(charp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3377,7 +3385,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_4b(void *user
 
  err:
   if (charp != NULL) {
-    free(charp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, charp);
   }
   rcb = 0;
 
@@ -3435,7 +3443,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_5b(void *user
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "Failed to determine UTF-8 byte size of 0x%ld", (unsigned long) uint32);
     goto err;
   }
-  charp = (char *) malloc(charl + 1);
+  charp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, charl + 1);
   if (MARPAESLIF_UNLIKELY(charp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3449,7 +3457,7 @@ static short _marpaESLIF_bootstrap_G1_action_string_literal_inside_5b(void *user
 
  err:
   if (charp != NULL) {
-    free(charp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, charp);
   }
   rcb = 0;
 
@@ -3488,7 +3496,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbolaction_2b(void *userDatavp, m
     goto err;
   }
 
-  symbolactionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+  symbolactionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
   if (MARPAESLIF_UNLIKELY(symbolactionp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3503,11 +3511,11 @@ static short _marpaESLIF_bootstrap_G1_action_symbolaction_2b(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_action_freev(symbolactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, symbolactionp);
   rcb = 0;
 
  done:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -3541,7 +3549,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbolaction_3b(void *userDatavp, m
     goto err;
   }
 
-  symbolactionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+  symbolactionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
   if (MARPAESLIF_UNLIKELY(symbolactionp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3556,12 +3564,12 @@ static short _marpaESLIF_bootstrap_G1_action_symbolaction_3b(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_action_freev(symbolactionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, symbolactionp);
   rcb = 0;
 
  done:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
-  _marpaESLIF_bootstrap_utf_string_freev(quotedStringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, quotedStringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -3592,7 +3600,7 @@ static short _marpaESLIF_bootstrap_G1_action_separator_specificationb(void *user
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
@@ -3679,7 +3687,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_alternative_1b(void *userDatavp
   }
 
   /* Make that an rhs alternative structure */
-  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
+  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
   if (MARPAESLIF_UNLIKELY(rhsAlternativep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3694,11 +3702,11 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_alternative_1b(void *userDatavp
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep);
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   return rcb;
 }
 
@@ -3774,7 +3782,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_1b(void *u
   }
 
   /* Make that an rhs primary structure */
-  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_primary_t));
+  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_primary_t));
   if (MARPAESLIF_UNLIKELY(rhsPrimaryp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3790,12 +3798,12 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_1b(void *u
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
   if (singleSymbolp != NULL) {
-    _marpaESLIF_bootstrap_single_symbol_freev(singleSymbolp);
+    _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIFValuep->marpaESLIFp, singleSymbolp);
   }
   return rcb;
 }
@@ -3832,7 +3840,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_2b(void *u
   }
 
   /* Make that an rhs primary structure */
-  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_primary_t));
+  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_primary_t));
   if (MARPAESLIF_UNLIKELY(rhsPrimaryp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3841,7 +3849,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_2b(void *u
   rhsPrimaryp->callp            = NULL;
   rhsPrimaryp->type             = MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_NA;
 
-  rhsPrimaryp->u.symbolAndReferencep = (marpaESLIF_bootstrap_symbol_and_reference_t *) malloc(sizeof(marpaESLIF_bootstrap_symbol_and_reference_t));
+  rhsPrimaryp->u.symbolAndReferencep = (marpaESLIF_bootstrap_symbol_and_reference_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_symbol_and_reference_t));
   if (MARPAESLIF_UNLIKELY(rhsPrimaryp->u.symbolAndReferencep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3858,12 +3866,12 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_2b(void *u
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_symbol_freev(symbolp);
-  _marpaESLIF_bootstrap_grammar_reference_freev(grammarReferencep);
+  _marpaESLIF_bootstrap_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
+  _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFValuep->marpaESLIFp, grammarReferencep);
   return rcb;
 }
 
@@ -3892,7 +3900,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_3b(void *u
   }
 
   /* Make that an rhs primary structure */
-  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_primary_t));
+  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_primary_t));
   if (MARPAESLIF_UNLIKELY(rhsPrimaryp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3907,7 +3915,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_3b(void *u
   rhsPrimaryp->u.name.bytel                 = 0;
   rhsPrimaryp->u.name.modifiers             = NULL;
 
-  rhsPrimaryp->u.name.bytep = (char *) malloc(bytel + 1);
+  rhsPrimaryp->u.name.bytep = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, bytel + 1);
   if (rhsPrimaryp->u.name.bytep == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -3924,7 +3932,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_no_parameter_3b(void *u
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
@@ -3969,11 +3977,11 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_2b(void *userDatavp, ma
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFValuep->marpaESLIFp, callp);
   return rcb;
 }
 
@@ -4008,7 +4016,7 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_3b(void *userDatavp, ma
   }
 
   /* Make that an rhs primary structure */
-  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_primary_t));
+  rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_primary_t));
   if (MARPAESLIF_UNLIKELY(rhsPrimaryp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -4026,12 +4034,12 @@ static short _marpaESLIF_bootstrap_G1_action_rhs_primary_3b(void *userDatavp, ma
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
   rcb = 0;
 
  done:
-  _marpaESLIF_action_freev(generatorActionp);
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, generatorActionp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFValuep->marpaESLIFp, callp);
   return rcb;
 }
 
@@ -4064,7 +4072,7 @@ static short _marpaESLIF_bootstrap_G1_action_alternativeb(void *userDatavp, marp
     }
   }
 
-  alternativep = (marpaESLIF_bootstrap_alternative_t *) malloc(sizeof(marpaESLIF_bootstrap_alternative_t));
+  alternativep = (marpaESLIF_bootstrap_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_alternative_t));
   if (MARPAESLIF_UNLIKELY(alternativep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -4083,12 +4091,12 @@ static short _marpaESLIF_bootstrap_G1_action_alternativeb(void *userDatavp, marp
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_alternative_freev(alternativep);
+  _marpaESLIF_bootstrap_alternative_freev(marpaESLIFValuep->marpaESLIFp, alternativep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
-  _marpaESLIF_bootstrap_rhs_freev(rhsAlternativeStackp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
+  _marpaESLIF_bootstrap_rhs_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativeStackp);
   return rcb;
 }
 
@@ -4124,8 +4132,8 @@ static short _marpaESLIF_bootstrap_G1_action_alternativesb(void *userDatavp, mar
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_alternative_freev(alternativep);
-  _marpaESLIF_bootstrap_alternatives_freev(alternativeStackp);
+  _marpaESLIF_bootstrap_alternative_freev(marpaESLIFValuep->marpaESLIFp, alternativep);
+  _marpaESLIF_bootstrap_alternatives_freev(marpaESLIFValuep->marpaESLIFp, alternativeStackp);
   rcb = 0;
 
  done:
@@ -4164,8 +4172,8 @@ static short _marpaESLIF_bootstrap_G1_action_prioritiesb(void *userDatavp, marpa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_alternatives_freev(alternativeStackp);
-  _marpaESLIF_bootstrap_priorities_freev(alternativesStackp);
+  _marpaESLIF_bootstrap_alternatives_freev(marpaESLIFValuep->marpaESLIFp, alternativeStackp);
+  _marpaESLIF_bootstrap_priorities_freev(marpaESLIFValuep->marpaESLIFp, alternativesStackp);
   rcb = 0;
 
  done:
@@ -4239,7 +4247,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
 
   /* Create a top-version of the LHS, using symbols not allowed from the external */
   /* Per-def lhsp is a meta symbol */
-  topasciis = (char *) malloc(strlen(lhsp->u.metap->asciinames) + 3 /* "[0]" */ + 1 /* NUL byte */);
+  topasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, strlen(lhsp->u.metap->asciinames) + 3 /* "[0]" */ + 1 /* NUL byte */);
   if (MARPAESLIF_UNLIKELY(topasciis == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -4311,9 +4319,9 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
   for (priorityi = 1; priorityi <= priorityCounti-1; priorityi++) {
     sprintf(tmps, "%d", priorityi - 1);
     if (currentasciis != NULL) {
-      free(currentasciis);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, currentasciis);
     }
-    currentasciis = (char *) malloc(strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
+    currentasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
     if (MARPAESLIF_UNLIKELY(currentasciis == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -4329,9 +4337,9 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
 
     sprintf(tmps, "%d", priorityi);
     if (nextasciis != NULL) {
-      free(nextasciis);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, nextasciis);
     }
-    nextasciis = (char *) malloc(strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
+    nextasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
     if (MARPAESLIF_UNLIKELY(nextasciis == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -4395,9 +4403,9 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
     /* Will an "int" ever have more than 1022 digits ? */
     sprintf(tmps, "%d", priorityi);
     if (currentasciis != NULL) {
-      free(currentasciis);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, currentasciis);
     }
-    currentasciis = (char *) malloc(strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
+    currentasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
     if (MARPAESLIF_UNLIKELY(currentasciis == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -4421,9 +4429,9 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
     }
     sprintf(tmps, "%d", nextPriorityi);
     if (nextasciis != NULL) {
-      free(nextasciis);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, nextasciis);
     }
-    nextasciis = (char *) malloc(strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
+    nextasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, strlen(lhsp->u.metap->asciinames) + 1 /* [ */ + strlen(tmps) + 1 /* ] */ + 1 /* NUL */);
     if (MARPAESLIF_UNLIKELY(nextasciis == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -4454,13 +4462,13 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
       /* Look for arity */
       arityi = 0;
       if (arityip != NULL) {
-        free(arityip);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, arityip);
       }
       rhsAlternativeStackp = alternativep->rhsAlternativeStackp;
       adverbListItemStackp = alternativep->adverbListItemStackp;
       /* As per the grammar, it is not possible that rhsAlternativeStackp is empty */
       nrhsi = GENERICSTACK_USED(rhsAlternativeStackp);
-      arityip = (int *) malloc(nrhsi * sizeof(int));
+      arityip = (int *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, nrhsi * sizeof(int));
       if (MARPAESLIF_UNLIKELY(arityip == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -4546,27 +4554,27 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
           }
 #endif
           rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) GENERICSTACK_GET_PTR(rhsAlternativeStackp, rhsi);
-          _marpaESLIF_bootstrap_rhs_alternative_freev(prioritizedRhsAlternativep);
-          prioritizedRhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *)  malloc(sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
+          _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, prioritizedRhsAlternativep);
+          prioritizedRhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *)  MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
           if (MARPAESLIF_UNLIKELY(prioritizedRhsAlternativep == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
           }
           prioritizedRhsAlternativep->type          = MARPAESLIF_BOOTSTRAP_RHS_ALTERNATIVE_TYPE_RHS_PRIMARY;
-          prioritizedRhsAlternativep->u.rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_primary_t));
+          prioritizedRhsAlternativep->u.rhsPrimaryp = (marpaESLIF_bootstrap_rhs_primary_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_primary_t));
           if (MARPAESLIF_UNLIKELY(prioritizedRhsAlternativep->u.rhsPrimaryp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
           }
           prioritizedRhsAlternativep->u.rhsPrimaryp->callp             = NULL;
           prioritizedRhsAlternativep->u.rhsPrimaryp->type              = MARPAESLIF_BOOTSTRAP_RHS_PRIMARY_TYPE_SINGLE_SYMBOL;
-          prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp   = (marpaESLIF_bootstrap_single_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_single_symbol_t));
+          prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp   = (marpaESLIF_bootstrap_single_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_single_symbol_t));
           if (MARPAESLIF_UNLIKELY(prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
           }
           prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->type      = MARPAESLIF_BOOTSTRAP_SINGLE_SYMBOL_TYPE_SYMBOL;
-          prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp = (marpaESLIF_bootstrap_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_symbol_t));
+          prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp = (marpaESLIF_bootstrap_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_symbol_t));
           if (MARPAESLIF_UNLIKELY(prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
@@ -4579,7 +4587,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
               goto err;
             }
             prioritizedRhsAlternativep->u.rhsPrimaryp->callp->luaexplistcb = 1; /* Declaration can always be inlined */
-            prioritizedRhsAlternativep->u.rhsPrimaryp->callp->luaexplists  = strdup(declp->luaparlists);
+            prioritizedRhsAlternativep->u.rhsPrimaryp->callp->luaexplists  = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, declp->luaparlists);
             if (prioritizedRhsAlternativep->u.rhsPrimaryp->callp->luaexplists == NULL) {
               MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
               goto err;
@@ -4587,11 +4595,11 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
           }
 
           if (left_associationb) {
-            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = (arityixi == 0)            ? strdup(currentasciis) : strdup(nextasciis);
+            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = (arityixi == 0)            ? MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, currentasciis) : MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, nextasciis);
           } else if (right_associationb) {
-            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = (arityixi == (arityi - 1)) ? strdup(currentasciis) : strdup(nextasciis);
+            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = (arityixi == (arityi - 1)) ? MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, currentasciis) : MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, nextasciis);
           } else if (group_associationb) {
-            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = strdup(topasciis);
+            prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, topasciis);
           } else {
             /* Should never happen */
             MARPAESLIF_ERROR(marpaESLIFValuep->marpaESLIFp, "No association !?");
@@ -4612,7 +4620,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
           MARPAESLIF_TRACEF(marpaESLIFValuep->marpaESLIFp, funcs, "alternativesStackp[%d] alternativeStackp[%d] ... LHS is %s, RHS[%d] is now %s", alternativesi, alternativei, currentasciis, rhsi, prioritizedRhsAlternativep->u.rhsPrimaryp->u.singleSymbolp->u.symbolp->symbols);
           prioritizedRhsAlternativep = NULL; /* prioritizedRhsAlternativep is in rhsAlternativeStackp */
           /* We can forget the old one */
-          _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep);
+          _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep);
         }
       }
 
@@ -4640,18 +4648,18 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_loosen_ruleb(marpaE
 
  done:
   if (arityip != NULL) {
-    free(arityip);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, arityip);
   }
   if (currentasciis != NULL) {
-    free(currentasciis);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, currentasciis);
   }
   if (nextasciis != NULL) {
-    free(nextasciis);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, nextasciis);
   }
   if (topasciis != NULL) {
-    free(topasciis);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, topasciis);
   }
-  _marpaESLIF_bootstrap_rhs_alternative_freev(prioritizedRhsAlternativep);
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, prioritizedRhsAlternativep);
   GENERICSTACK_FREE(flatAlternativesStackp);
   GENERICSTACK_FREE(flatAlternativeStackp);
   return rcb;
@@ -4726,7 +4734,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
 
       nrhsi = GENERICSTACK_USED(rhsAlternativeStackp);
       if (nrhsi > 0) {
-        rhsip = (int *) malloc(nrhsi * sizeof(int));
+        rhsip = (int *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, nrhsi * sizeof(int));
         if (MARPAESLIF_UNLIKELY(rhsip == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4735,7 +4743,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
           rhsip[rhsAlternativei] = -1;
         }
 
-        callpp = (marpaESLIF_lua_functioncall_t **) malloc(nrhsi * sizeof(marpaESLIF_lua_functioncall_t *));
+        callpp = (marpaESLIF_lua_functioncall_t **) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, nrhsi * sizeof(marpaESLIF_lua_functioncall_t *));
         if (callpp == NULL) {
           MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4744,7 +4752,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
           callpp[rhsAlternativei] = NULL;
         }
 
-        rhsp = (marpaESLIF_symbol_t **) malloc(nrhsi * sizeof(marpaESLIF_symbol_t *));
+        rhsp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, nrhsi * sizeof(marpaESLIF_symbol_t *));
         if (MARPAESLIF_UNLIKELY(rhsp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4753,7 +4761,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
           rhsp[rhsAlternativei] = NULL;
         }
 
-        skipbp = (short *) malloc(nrhsi * sizeof(short));
+        skipbp = (short *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, nrhsi * sizeof(short));
         if (MARPAESLIF_UNLIKELY(skipbp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4884,19 +4892,19 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
         goto err;
       }
       if (rhsip != NULL) {
-        free(rhsip);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, rhsip);
         rhsip = NULL;
       }
       if (callpp != NULL) {
-        free(callpp);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, callpp);
         callpp = NULL;
       }
       if (rhsp != NULL) {
-        free(rhsp);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, rhsp);
         rhsp = NULL;
       }
       if (skipbp != NULL) {
-        free(skipbp);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, skipbp);
         skipbp = NULL;
       }
       GENERICSTACK_SET_PTR(grammarBootstrapp->ruleStackp, rulep, rulep->idi);
@@ -4917,18 +4925,18 @@ static inline short _marpaESLIF_bootstrap_G1_action_priority_flat_ruleb(marpaESL
 
  done:
   if (rhsip != NULL) {
-    free(rhsip);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, rhsip);
   }
   if (callpp != NULL) {
-    free(callpp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, callpp);
   }
   if (rhsp != NULL) {
-    free(rhsp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, rhsp);
   }
   if (skipbp != NULL) {
-    free(skipbp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, skipbp);
   }
-  _marpaESLIF_rule_freev(rulep);
+  _marpaESLIF_rule_freev(marpaESLIFValuep->marpaESLIFp, rulep);
   return rcb;
 }
 
@@ -4983,8 +4991,8 @@ static short _marpaESLIF_bootstrap_G1_action_priority_ruleb(void *userDatavp, ma
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
-  _marpaESLIF_bootstrap_priorities_freev(alternativesStackp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
+  _marpaESLIF_bootstrap_priorities_freev(marpaESLIFValuep->marpaESLIFp, alternativesStackp);
   return rcb;
 }
 
@@ -5010,7 +5018,7 @@ static short _marpaESLIF_bootstrap_G1_action_single_symbol_1b(void *userDatavp,
     goto err;
   }
 
-  singleSymbolp = (marpaESLIF_bootstrap_single_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_single_symbol_t));
+  singleSymbolp = (marpaESLIF_bootstrap_single_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_single_symbol_t));
   if (MARPAESLIF_UNLIKELY(singleSymbolp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5025,11 +5033,11 @@ static short _marpaESLIF_bootstrap_G1_action_single_symbol_1b(void *userDatavp,
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_single_symbol_freev(singleSymbolp);
+  _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIFValuep->marpaESLIFp, singleSymbolp);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_symbol_freev(symbolp);
+  _marpaESLIF_bootstrap_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
   return rcb;
 }
 
@@ -5055,7 +5063,7 @@ static short _marpaESLIF_bootstrap_G1_action_single_symbol_2b(void *userDatavp,
     goto err;
   }
 
-  singleSymbolp = (marpaESLIF_bootstrap_single_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_single_symbol_t));
+  singleSymbolp = (marpaESLIF_bootstrap_single_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_single_symbol_t));
   if (MARPAESLIF_UNLIKELY(singleSymbolp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5070,11 +5078,11 @@ static short _marpaESLIF_bootstrap_G1_action_single_symbol_2b(void *userDatavp,
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_single_symbol_freev(singleSymbolp);
+  _marpaESLIF_bootstrap_single_symbol_freev(marpaESLIFValuep->marpaESLIFp, singleSymbolp);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
   return rcb;
 }
 
@@ -5097,7 +5105,7 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_1b(void *userDatavp, marpa
 
   MARPAESLIF_BOOTSTRAP_GET_ARRAY(marpaESLIFValuep, arg0i, bytep, bytel);
 
-  terminalp = (marpaESLIF_bootstrap_terminal_t *) malloc(sizeof(marpaESLIF_bootstrap_terminal_t));
+  terminalp = (marpaESLIF_bootstrap_terminal_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_terminal_t));
   if (MARPAESLIF_UNLIKELY(terminalp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5115,7 +5123,7 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_1b(void *userDatavp, marpa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
   rcb = 0;
 
  done:
@@ -5152,7 +5160,7 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_2b(void *userDatavp, marpa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
   rcb = 0;
 
  done:
@@ -5194,7 +5202,7 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_3b(void *userDatavp, marpa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
   rcb = 0;
 
  done:
@@ -5268,7 +5276,7 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_8b(void *userDatavp, marpa
   substitutionTerminalp->u.stringp->bytep     = NULL;
   substitutionTerminalp->u.stringp->bytel     = 0;
   substitutionTerminalp->u.stringp->modifiers = NULL;
-  _marpaESLIF_bootstrap_terminal_freev(substitutionTerminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, substitutionTerminalp);
   substitutionTerminalp = NULL;
 
   MARPAESLIF_BOOTSTRAP_SET_PTR(marpaESLIFValuep, resulti, MARPAESLIF_BOOTSTRAP_STACK_TYPE_TERMINAL, regexTerminalp);
@@ -5277,8 +5285,8 @@ static short _marpaESLIF_bootstrap_G1_action_terminal_8b(void *userDatavp, marpa
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(regexTerminalp);
-  _marpaESLIF_bootstrap_terminal_freev(substitutionTerminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, regexTerminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, substitutionTerminalp);
   rcb = 0;
 
  done:
@@ -5292,7 +5300,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_terminal_pseudob(void *userD
   marpaESLIF_bootstrap_terminal_t  *terminalp   = NULL;
   short                             rcb;
 
-  terminalp = (marpaESLIF_bootstrap_terminal_t *) malloc(sizeof(marpaESLIF_bootstrap_terminal_t));
+  terminalp = (marpaESLIF_bootstrap_terminal_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_terminal_t));
   if (MARPAESLIF_UNLIKELY(terminalp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5305,7 +5313,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_terminal_pseudob(void *userD
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
   rcb = 0;
 
  done:
@@ -5331,7 +5339,7 @@ static short _marpaESLIF_bootstrap_G1_action_symbolb(void *userDatavp, marpaESLI
   /* symbols is an ASCII string that we pushed to a PTR that we own */
   MARPAESLIF_BOOTSTRAP_GETANDFORGET_PTR(marpaESLIFValuep, arg0i, symbols);
 
-  symbolp = (marpaESLIF_bootstrap_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_symbol_t));
+  symbolp = (marpaESLIF_bootstrap_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_symbol_t));
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5345,12 +5353,12 @@ static short _marpaESLIF_bootstrap_G1_action_symbolb(void *userDatavp, marpaESLI
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_symbol_freev(symbolp);
+  _marpaESLIF_bootstrap_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
   rcb = 0;
 
  done:
   if (symbols != NULL) {
-    free(symbols);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, symbols);
   }
  return rcb;
 }
@@ -5378,7 +5386,7 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_1b(void *userData
     goto err;
   }
 
-  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) malloc(sizeof(marpaESLIF_bootstrap_grammar_reference_t));
+  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_grammar_reference_t));
   if (MARPAESLIF_UNLIKELY(grammarReferencep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5393,11 +5401,11 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_1b(void *userData
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_grammar_reference_freev(grammarReferencep);
+  _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFValuep->marpaESLIFp, grammarReferencep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_utf_string_freev(quotedStringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, quotedStringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -5423,7 +5431,7 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_2b(void *userData
     goto err;
   }
 
-  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) malloc(sizeof(marpaESLIF_bootstrap_grammar_reference_t));
+  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_grammar_reference_t));
   if (MARPAESLIF_UNLIKELY(grammarReferencep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5437,7 +5445,7 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_2b(void *userData
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_grammar_reference_freev(grammarReferencep);
+  _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFValuep->marpaESLIFp, grammarReferencep);
   rcb = 0;
 
  done:
@@ -5466,7 +5474,7 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_3b(void *userData
     goto err;
   }
 
-  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) malloc(sizeof(marpaESLIF_bootstrap_grammar_reference_t));
+  grammarReferencep = (marpaESLIF_bootstrap_grammar_reference_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_grammar_reference_t));
   if (MARPAESLIF_UNLIKELY(grammarReferencep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5480,7 +5488,7 @@ static short _marpaESLIF_bootstrap_G1_action_grammar_reference_3b(void *userData
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_grammar_reference_freev(grammarReferencep);
+  _marpaESLIF_bootstrap_grammar_reference_freev(marpaESLIFValuep->marpaESLIFp, grammarReferencep);
   rcb = 0;
 
  done:
@@ -5846,9 +5854,9 @@ static short _marpaESLIF_bootstrap_G1_action_quantified_ruleb(void *userDatavp,
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -5956,7 +5964,7 @@ static short _marpaESLIF_bootstrap_G1_action_start_ruleb(void *userDatavp, marpa
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_start_symbol_freev(startSymbolp);
+  _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIFValuep->marpaESLIFp, startSymbolp);
   return rcb;
 }
 
@@ -5987,7 +5995,7 @@ static short _marpaESLIF_bootstrap_G1_action_desc_ruleb(void *userDatavp, marpaE
     goto err;
   }
 
-  _marpaESLIF_string_freev(grammarBootstrapp->descp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->descp, 0 /* onStackb */);
   /* Why hardcoded to UTF-8 ? Because a quote string is implemented as a regexp in unicode mode. */
   /* Therefore it is guaranteed that the match was done on UTF-8 bytes; regardless of the encoding */
   /* of the original input. */
@@ -6007,7 +6015,7 @@ static short _marpaESLIF_bootstrap_G1_action_desc_ruleb(void *userDatavp, marpaE
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_utf_string_freev(quotedStringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, quotedStringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -6136,9 +6144,9 @@ static short _marpaESLIF_bootstrap_G1_action_empty_ruleb(void *userDatavp, marpa
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
-  _marpaESLIF_rule_freev(rulep);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
+  _marpaESLIF_rule_freev(marpaESLIFValuep->marpaESLIFp, rulep);
   return rcb;
 }
 
@@ -6223,7 +6231,7 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
   grammarBootstrapp->nbupdatei++;
 
   /* Overwrite grammar default settings */
-  _marpaESLIF_action_freev(grammarBootstrapp->defaultRuleActionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->defaultRuleActionp);
   grammarBootstrapp->defaultRuleActionp = NULL;
   if (actionp != NULL) {
     grammarBootstrapp->defaultRuleActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, actionp);
@@ -6235,7 +6243,7 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
   grammarBootstrapp->latmb              = latmb;
   grammarBootstrapp->discardIsFallbackb = discardIsFallbackb;
 
-  _marpaESLIF_action_freev(grammarBootstrapp->defaultSymbolActionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->defaultSymbolActionp);
   grammarBootstrapp->defaultSymbolActionp = NULL;
   if (symbolactionp != NULL) {
     grammarBootstrapp->defaultSymbolActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, symbolactionp);
@@ -6244,7 +6252,7 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
     }
   }
 
-  _marpaESLIF_action_freev(grammarBootstrapp->defaultEventActionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->defaultEventActionp);
   grammarBootstrapp->defaultEventActionp = NULL;
   if (eventactionp != NULL) {
     grammarBootstrapp->defaultEventActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, eventactionp);
@@ -6253,7 +6261,7 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
     }
   }
 
-  _marpaESLIF_action_freev(grammarBootstrapp->defaultRegexActionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->defaultRegexActionp);
   grammarBootstrapp->defaultRegexActionp = NULL;
   if (regexactionp != NULL) {
     grammarBootstrapp->defaultRegexActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, regexactionp);
@@ -6263,10 +6271,10 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
   }
 
   if (grammarBootstrapp->defaultEncodings != NULL) {
-    free(grammarBootstrapp->defaultEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->defaultEncodings);
   }
   if (defaultEncodings != NULL) {
-    grammarBootstrapp->defaultEncodings = strdup(defaultEncodings);
+    grammarBootstrapp->defaultEncodings = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, defaultEncodings);
     if (MARPAESLIF_UNLIKELY(grammarBootstrapp->defaultEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -6274,10 +6282,10 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
   }
 
   if (grammarBootstrapp->fallbackEncodings != NULL) {
-    free(grammarBootstrapp->fallbackEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, grammarBootstrapp->fallbackEncodings);
   }
   if (fallbackEncodings != NULL) {
-    grammarBootstrapp->fallbackEncodings = strdup(fallbackEncodings);
+    grammarBootstrapp->fallbackEncodings = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, fallbackEncodings);
     if (MARPAESLIF_UNLIKELY(grammarBootstrapp->fallbackEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -6293,7 +6301,7 @@ static short _marpaESLIF_bootstrap_G1_action_default_ruleb(void *userDatavp, mar
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -6768,12 +6776,12 @@ static short _marpaESLIF_bootstrap_G1_action_event_initializationb(void *userDat
   MARPAESLIF_BOOTSTRAP_GET_SHORT(marpaESLIFValuep, argni, eventInitializerb);
 
   /* Make that an rhs primary structure */
-  eventInitializationp = (marpaESLIF_bootstrap_event_initialization_t *) malloc(sizeof(marpaESLIF_bootstrap_event_initialization_t));
+  eventInitializationp = (marpaESLIF_bootstrap_event_initialization_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_event_initialization_t));
   if (MARPAESLIF_UNLIKELY(eventInitializationp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
-  eventInitializationp->eventNames  = strdup(eventNames);
+  eventInitializationp->eventNames  = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, eventNames);
   if (MARPAESLIF_UNLIKELY(eventInitializationp->eventNames == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -6786,7 +6794,7 @@ static short _marpaESLIF_bootstrap_G1_action_event_initializationb(void *userDat
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_event_initialization_freev(eventInitializationp);
+  _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFValuep->marpaESLIFp, eventInitializationp);
   rcb = 0;
 
  done:
@@ -6820,7 +6828,7 @@ static short _marpaESLIF_bootstrap_G1_action_event_specificationb(void *userData
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_event_initialization_freev(eventInitializationp);
+  _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFValuep->marpaESLIFp, eventInitializationp);
   rcb = 0;
 
  done:
@@ -7021,14 +7029,14 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
       /* symbolp->descp is then != symbolp->u.terminalp->descp (that is the default) */
       if (symbolp->descp != symbolp->u.terminalp->descp) {
         /* This was already overwriten */
-        _marpaESLIF_string_freev(symbolp->descp, 0 /* onStackp */);
+        _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, symbolp->descp, 0 /* onStackp */);
       }
       break;
     case MARPAESLIF_SYMBOL_TYPE_META:
       /* symbolp->descp is then != symbolp->u.metap->descp (that is the default) */
       if (symbolp->descp != symbolp->u.metap->descp) {
         /* This was already overwriten */
-        _marpaESLIF_string_freev(symbolp->descp, 0 /* onStackp */);
+        _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, symbolp->descp, 0 /* onStackp */);
       }
       break;
     default:
@@ -7047,7 +7055,7 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
   }
 
   if (symbolactionp != NULL) {
-    _marpaESLIF_action_freev(symbolp->symbolActionp);
+    _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, symbolp->symbolActionp);
     symbolp->symbolActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, symbolactionp);
     if (MARPAESLIF_UNLIKELY(symbolp->symbolActionp == NULL)) {
       goto err;
@@ -7055,7 +7063,7 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
   }
 
   if (ifactionp != NULL) {
-    _marpaESLIF_action_freev(symbolp->ifActionp);
+    _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, symbolp->ifActionp);
     symbolp->ifActionp = _marpaESLIF_action_clonep(marpaESLIFValuep->marpaESLIFp, ifactionp);
     if (MARPAESLIF_UNLIKELY(symbolp->ifActionp == NULL)) {
       goto err;
@@ -7071,9 +7079,9 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
     switch (pausei) {
     case MARPAESLIF_BOOTSTRAP_PAUSE_TYPE_BEFORE:
       if (symbolp->eventBefores != NULL) {
-        free(symbolp->eventBefores);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, symbolp->eventBefores);
       }
-      symbolp->eventBefores = strdup(eventInitializationp->eventNames);
+      symbolp->eventBefores = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, eventInitializationp->eventNames);
       if (MARPAESLIF_UNLIKELY(symbolp->eventBefores == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -7093,9 +7101,9 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
       break;
     case MARPAESLIF_BOOTSTRAP_PAUSE_TYPE_AFTER:
       if (symbolp->eventAfters != NULL) {
-        free(symbolp->eventAfters);
+        MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, symbolp->eventAfters);
       }
-      symbolp->eventAfters = strdup(eventInitializationp->eventNames);
+      symbolp->eventAfters = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, eventInitializationp->eventNames);
       if (MARPAESLIF_UNLIKELY(symbolp->eventAfters == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -7141,10 +7149,10 @@ static short __marpaESLIF_bootstrap_G1_action_symbol_ruleb(void *userDatavp, mar
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_terminal_freev(terminalp);
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, terminalp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
+  _marpaESLIF_string_freev(marpaESLIFValuep->marpaESLIFp, stringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -7282,9 +7290,9 @@ static short _marpaESLIF_bootstrap_G1_action_discard_ruleb(void *userDatavp, mar
     }
     /* Take care, we set the discard event on the RULE - not on the symbol */
     if (rulep->discardEvents != NULL) {
-      free(rulep->discardEvents);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, rulep->discardEvents);
     }
-    rulep->discardEvents = strdup(eventInitializationp->eventNames);
+    rulep->discardEvents = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, eventInitializationp->eventNames);
     if (MARPAESLIF_UNLIKELY(rulep->discardEvents == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -7312,8 +7320,8 @@ static short _marpaESLIF_bootstrap_G1_action_discard_ruleb(void *userDatavp, mar
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -7407,9 +7415,9 @@ static inline short _marpaESLIF_bootstrap_G1_action_event_declarationb(void *use
   }
   
   if (*eventsp != NULL) {
-    free(*eventsp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, *eventsp);
   }
-  *eventsp = strdup(eventInitializationp->eventNames);
+  *eventsp = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, eventInitializationp->eventNames);
   if (MARPAESLIF_UNLIKELY(*eventsp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -7427,7 +7435,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_event_declarationb(void *use
     break;
   }
 
-  _marpaESLIF_lua_functiondecl_freev(lhsp->eventDeclp);
+  _marpaESLIF_lua_functiondecl_freev(marpaESLIFValuep->marpaESLIFp, lhsp->eventDeclp);
   lhsp->eventDeclp = NULL;
   if (bootstrapLhsp->declp != NULL) {
     lhsp->eventDeclp = _marpaESLIF_lua_functiondecl_clonep(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp->declp);
@@ -7449,8 +7457,8 @@ static inline short _marpaESLIF_bootstrap_G1_action_event_declarationb(void *use
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_event_initialization_freev(eventInitializationp);
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
+  _marpaESLIF_bootstrap_event_initialization_freev(marpaESLIFValuep->marpaESLIFp, eventInitializationp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
   return rcb;
 }
 
@@ -7528,7 +7536,7 @@ static short _marpaESLIF_bootstrap_G1_action_alternative_name_2b(void *userDatav
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_utf_string_freev(quotedStringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, quotedStringp, 0 /* onStackb */);
   return rcb;
 }
 
@@ -7563,7 +7571,7 @@ static short _marpaESLIF_bootstrap_G1_action_namingb(void *userDatavp, marpaESLI
 
   /* Duplicate bytep */
   namingp->bytel               = bytel;
-  namingp->bytep     = malloc(bytel + 1);
+  namingp->bytep     = MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, bytel + 1);
   if (MARPAESLIF_UNLIKELY(namingp->bytep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -7577,7 +7585,7 @@ static short _marpaESLIF_bootstrap_G1_action_namingb(void *userDatavp, marpaESLI
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_utf_string_freev(namingp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFValuep->marpaESLIFp, namingp, 0 /* onStackb */);
   rcb = 0;
 
  done:
@@ -7731,10 +7739,10 @@ static short _marpaESLIF_bootstrap_G1_action_exception_statementb(void *userData
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryExceptionp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryExceptionp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -7803,7 +7811,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_regex_to_
 #endif
     /* We want to maintain marpaESLIFValueResult lifetime, so need to unshallow the result of the INTERNAL method _marpaESLIFRecognizer_terminal_matcherb() if necessary */
     if (marpaESLIFValueResult.u.a.shallowb) {
-      modifiers = (char *) malloc(marpaESLIFValueResult.u.a.sizel + 1);
+      modifiers = (char *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFValueResult.u.a.sizel + 1);
       if (MARPAESLIF_UNLIKELY(modifiers == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -7842,7 +7850,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_regex_to_
     MARPAESLIF_ERROR(marpaESLIFp, "Empty regex");
     goto err;
   }
-  newbytep = malloc(newbytel);
+  newbytep = MARPAESLIF_MALLOC(marpaESLIFp, newbytel);
   if (MARPAESLIF_UNLIKELY(newbytep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -7857,15 +7865,15 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_regex_to_
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_utf_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, stringp, 0 /* onStackb */);
   stringp = NULL;
 
  done:
   if (newbytep != NULL) {
-    free(newbytep);
+    MARPAESLIF_FREE(marpaESLIFp, newbytep);
   }
   if (modifiers != NULL) {
-    free(modifiers);
+    MARPAESLIF_FREE(marpaESLIFp, modifiers);
   }
   marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
  return stringp;
@@ -7893,7 +7901,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_character
   }
 
   /* Duplicate bytep in any case */
-  tmps = (char *) malloc(bytel + 1);
+  tmps = (char *) MARPAESLIF_MALLOC(marpaESLIFp, bytel + 1);
   if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -7948,7 +7956,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_character
 #endif
     /* We want to maintain marpaESLIFValueResult lifetime, so need to unshallow the result of the INTERNAL method _marpaESLIFRecognizer_terminal_matcherb() if necessary */
     if (marpaESLIFValueResult.u.a.shallowb) {
-      modifiers = (char *) malloc(marpaESLIFValueResult.u.a.sizel + 1);
+      modifiers = (char *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFValueResult.u.a.sizel + 1);
       if (MARPAESLIF_UNLIKELY(modifiers == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -7983,15 +7991,15 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_character
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_utf_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_bootstrap_utf_string_freev(marpaESLIFp, stringp, 0 /* onStackb */);
   stringp = NULL;
 
  done:
   if (dupp != NULL) {
-    free(dupp);
+    MARPAESLIF_FREE(marpaESLIFp, dupp);
   }
   if (modifiers != NULL) {
-    free(modifiers);
+    MARPAESLIF_FREE(marpaESLIFp, modifiers);
   }
   marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
  return stringp;
@@ -8043,7 +8051,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_prioritiesb(
     goto err;
   }
 
-  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
+  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
   if (MARPAESLIF_UNLIKELY(rhsAlternativep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8060,11 +8068,11 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_prioritiesb(
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep);
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_priorities_freev(alternativesStackp);
+  _marpaESLIF_bootstrap_priorities_freev(marpaESLIFValuep->marpaESLIFp, alternativesStackp);
   return rcb;
 }
 
@@ -8249,7 +8257,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_exceptionb(v
     }
   }
 
-  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
+  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
   if (MARPAESLIF_UNLIKELY(rhsAlternativep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8271,13 +8279,13 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_exceptionb(v
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep);
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryExceptionp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryExceptionp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -8309,7 +8317,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_quantifiedb(
     }
   }
 
-  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) malloc(sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
+  rhsAlternativep = (marpaESLIF_bootstrap_rhs_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_rhs_alternative_t));
   if (MARPAESLIF_UNLIKELY(rhsAlternativep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8330,12 +8338,12 @@ static inline short _marpaESLIF_bootstrap_G1_action_rhs_alternative_quantifiedb(
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_rhs_alternative_freev(rhsAlternativep);
+  _marpaESLIF_bootstrap_rhs_alternative_freev(marpaESLIFValuep->marpaESLIFp, rhsAlternativep);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_rhs_primary_freev(rhsPrimaryp);
-  _marpaESLIF_bootstrap_adverb_list_items_freev(adverbListItemStackp);
+  _marpaESLIF_bootstrap_rhs_primary_freev(marpaESLIFValuep->marpaESLIFp, rhsPrimaryp);
+  _marpaESLIF_bootstrap_adverb_list_items_freev(marpaESLIFValuep->marpaESLIFp, adverbListItemStackp);
   return rcb;
 }
 
@@ -8372,7 +8380,7 @@ static short _marpaESLIF_bootstrap_G1_action_luascript_statementb(void *userData
 
     if (marpaESLIFGrammarBootstrapp->luabytep == NULL) {
       /* First time: duplicate luabytep */
-      marpaESLIFGrammarBootstrapp->luabytep = (char *) malloc(luabytel + 1);
+      marpaESLIFGrammarBootstrapp->luabytep = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, luabytel + 1);
       if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarBootstrapp->luabytep == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -8389,7 +8397,7 @@ static short _marpaESLIF_bootstrap_G1_action_luascript_statementb(void *userData
         MARPAESLIF_ERROR(marpaESLIFValuep->marpaESLIFp, "size_t turnaround detected");
         goto err;
       }
-      tmps = (char *) realloc(marpaESLIFGrammarBootstrapp->luabytep, tmpl + 1); /* Hiden NUL byte */
+      tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFGrammarBootstrapp->luabytep, tmpl + 1); /* Hiden NUL byte */
       if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -8471,7 +8479,7 @@ static short _marpaESLIF_bootstrap_G1_action_defaultencodingb(void *userDatavp,
   }
   /* Unshallow it if necessary */
   if (shallowb) {
-    tmps = strdup(defaultEncodings);
+    tmps = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, defaultEncodings);
     if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -8489,7 +8497,7 @@ static short _marpaESLIF_bootstrap_G1_action_defaultencodingb(void *userDatavp,
  err:
   if ((! shallowb) && (defaultEncodings != NULL)) {
     /* This is not possible in theory */
-    free(defaultEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, defaultEncodings);
   }
   rcb = 0;
 
@@ -8523,7 +8531,7 @@ static short _marpaESLIF_bootstrap_G1_action_fallbackencodingb(void *userDatavp,
   }
   /* Unshallow it if necessary */
   if (shallowb) {
-    tmps = strdup(fallbackEncodings);
+    tmps = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, fallbackEncodings);
     if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -8541,7 +8549,7 @@ static short _marpaESLIF_bootstrap_G1_action_fallbackencodingb(void *userDatavp,
  err:
   if ((! shallowb) && (fallbackEncodings != NULL)) {
     /* This is not possible in theory */
-    free(fallbackEncodings);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, fallbackEncodings);
   }
   rcb = 0;
 
@@ -8583,7 +8591,7 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functionb(void *userDatavp, mar
 
   lual = arg0l;
   lual += luaFuncbodyAfterLparenl;
-  luas = (char *) malloc(lual + 1);
+  luas = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, lual + 1);
   if (luas == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8599,7 +8607,7 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functionb(void *userDatavp, mar
   actionl  = strlen(_marpaESLIF_bootstrap_lua_return_function_lparens); /* "return function(" */
   actionl += luaFuncbodyAfterLparenl;
 
-  actions = (char *) malloc(actionl + 1);
+  actions = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, actionl + 1);
   if (MARPAESLIF_UNLIKELY(actions == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8617,7 +8625,7 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functionb(void *userDatavp, mar
     goto err;
   }
 
-  bootstrapLuaFunctionp = (marpaESLIF_bootstrap_lua_function_t *) malloc(sizeof(marpaESLIF_bootstrap_lua_function_t));
+  bootstrapLuaFunctionp = (marpaESLIF_bootstrap_lua_function_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_lua_function_t));
   if (bootstrapLuaFunctionp == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8645,12 +8653,12 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functionb(void *userDatavp, mar
 
  done:
   if (luas != NULL) {
-    free(luas);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, luas);
   }
   if (actions != NULL) {
-    free(actions);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, actions);
   }
-  _marpaESLIF_bootstrap_lua_function_freev(bootstrapLuaFunctionp);
+  _marpaESLIF_bootstrap_lua_function_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLuaFunctionp);
   return rcb;
 }
 
@@ -8695,14 +8703,14 @@ static inline short _marpaESLIF_bootstrap_G1_action_genericb(void *userDatavp, m
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%: No lua identifier after %s", contexts, LUA_ACTION_PREFIX);
         goto err;
       }
-      actions = strdup(tmps);
+      actions = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, tmps);
       if (MARPAESLIF_UNLIKELY(actions == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s: strdup failure, %s", contexts, strerror(errno));
         goto err;
       }
       luab = 1;
     } else {
-      actions = strdup(names);
+      actions = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, names);
       if (MARPAESLIF_UNLIKELY(actions == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s: strdup failure, %s", contexts, strerror(errno));
         goto err;
@@ -8710,7 +8718,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_genericb(void *userDatavp, m
       luab = 0;
     }
 
-    actionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    actionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(actionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -8732,7 +8740,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_genericb(void *userDatavp, m
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s: Indice %d returned NULL", contexts, argni);
       goto err;
     }
-    actionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    actionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(actionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -8748,7 +8756,7 @@ static inline short _marpaESLIF_bootstrap_G1_action_genericb(void *userDatavp, m
     actionp->u.luaFunction.luacstripp = bootstrapLuaFunctionp->luacstripp;
     actionp->u.luaFunction.luacstripl = bootstrapLuaFunctionp->luacstripl;
 
-    free(bootstrapLuaFunctionp);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, bootstrapLuaFunctionp);
     bootstrapLuaFunctionp = NULL; /* actions is now in actionp */
     break;
 
@@ -8763,14 +8771,14 @@ static inline short _marpaESLIF_bootstrap_G1_action_genericb(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_action_freev(actionp);
+  _marpaESLIF_action_freev(marpaESLIFValuep->marpaESLIFp, actionp);
   rcb = 0;
 
  done:
   if (actions != NULL) {
-    free(actions);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, actions);
   }
-  _marpaESLIF_bootstrap_lua_function_freev(bootstrapLuaFunctionp);
+  _marpaESLIF_bootstrap_lua_function_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLuaFunctionp);
   return rcb;
 }
 
@@ -8806,7 +8814,7 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functioncallb(void *userDatavp,
 
   luaexplistl = 1; /* '(' */
   luaexplistl += luaArgsAfterLparenl;
-  luaexplists = (char *) malloc(luaexplistl + 1);
+  luaexplists = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, luaexplistl + 1);
   if (luaexplists == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8866,9 +8874,9 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functioncallb(void *userDatavp,
 
  done:
   if (luaexplists != NULL) {
-    free(luaexplists);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, luaexplists);
   }
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFValuep->marpaESLIFp, callp);
   return rcb;
 }
 
@@ -8896,7 +8904,7 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functiondeclb(void *userDatavp,
 
   luaparlistl = 1; /* '(' */
   luaparlistl += luaOptionalParlistAfterLparenl;
-  luaparlists = (char *) malloc(luaparlistl + 1);
+  luaparlists = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, luaparlistl + 1);
   if (luaparlists == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8956,9 +8964,9 @@ static short _marpaESLIF_bootstrap_G1_action_lua_functiondeclb(void *userDatavp,
 
  done:
   if (luaparlists != NULL) {
-    free(luaparlists);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, luaparlists);
   }
-  _marpaESLIF_lua_functiondecl_freev(declp);
+  _marpaESLIF_lua_functiondecl_freev(marpaESLIFValuep->marpaESLIFp, declp);
 
   return rcb;
 }
@@ -8986,7 +8994,7 @@ static short _marpaESLIF_bootstrap_G1_action_lhs_1b(void *userDatavp, marpaESLIF
   }
 
   /* Make that an lhs structure */
-  bootstrapLhsp = (marpaESLIF_bootstrap_lhs_t *) malloc(sizeof(marpaESLIF_bootstrap_lhs_t));
+  bootstrapLhsp = (marpaESLIF_bootstrap_lhs_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_lhs_t));
   if (MARPAESLIF_UNLIKELY(bootstrapLhsp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -8994,7 +9002,7 @@ static short _marpaESLIF_bootstrap_G1_action_lhs_1b(void *userDatavp, marpaESLIF
   bootstrapLhsp->symbols = NULL;
   bootstrapLhsp->declp   = NULL;
 
-  bootstrapLhsp->symbols = strdup(symbols);
+  bootstrapLhsp->symbols = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, symbols);
   if (bootstrapLhsp->symbols == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -9006,12 +9014,12 @@ static short _marpaESLIF_bootstrap_G1_action_lhs_1b(void *userDatavp, marpaESLIF
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_lhs_freev(bootstrapLhsp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, bootstrapLhsp);
   rcb = 0;
 
  done:
   if (symbols != NULL) {
-    free(symbols);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, symbols);
   }
   return rcb;
 }
@@ -9054,11 +9062,11 @@ static short _marpaESLIF_bootstrap_G1_action_lhs_2b(void *userDatavp, marpaESLIF
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_lhs_freev(lhsp);
+  _marpaESLIF_bootstrap_lhs_freev(marpaESLIFValuep->marpaESLIFp, lhsp);
   rcb = 0;
 
  done:
-  _marpaESLIF_lua_functiondecl_freev(declp);
+  _marpaESLIF_lua_functiondecl_freev(marpaESLIFValuep->marpaESLIFp, declp);
   return rcb;
 }
 
@@ -9085,7 +9093,7 @@ static short _marpaESLIF_bootstrap_G1_action_start_symbol_1b(void *userDatavp, m
   }
 
   /* Make that a start symbol structure */
-  startSymbolp = (marpaESLIF_bootstrap_start_symbol_t *) malloc(sizeof(marpaESLIF_bootstrap_start_symbol_t));
+  startSymbolp = (marpaESLIF_bootstrap_start_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_start_symbol_t));
   if (MARPAESLIF_UNLIKELY(startSymbolp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9093,7 +9101,7 @@ static short _marpaESLIF_bootstrap_G1_action_start_symbol_1b(void *userDatavp, m
   startSymbolp->symbols          = NULL;
   startSymbolp->callp = NULL;
 
-  startSymbolp->symbols = strdup(symbolp->symbols);
+  startSymbolp->symbols = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, symbolp->symbols);
   if (startSymbolp->symbols == NULL) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -9105,11 +9113,11 @@ static short _marpaESLIF_bootstrap_G1_action_start_symbol_1b(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_start_symbol_freev(startSymbolp);
+  _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIFValuep->marpaESLIFp, startSymbolp);
   rcb = 0;
 
  done:
-  _marpaESLIF_bootstrap_symbol_freev(symbolp);
+  _marpaESLIF_bootstrap_symbol_freev(marpaESLIFValuep->marpaESLIFp, symbolp);
   return rcb;
 }
 
@@ -9151,11 +9159,11 @@ static short _marpaESLIF_bootstrap_G1_action_start_symbol_2b(void *userDatavp, m
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_start_symbol_freev(startSymbolp);
+  _marpaESLIF_bootstrap_start_symbol_freev(marpaESLIFValuep->marpaESLIFp, startSymbolp);
   rcb = 0;
 
  done:
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFValuep->marpaESLIFp, callp);
   return rcb;
 }
 
@@ -9257,7 +9265,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_quotedstrin
   size_t                            matchedLengthl;
 
   /* Duplicate bytep */
-  tmps = (char *) malloc(bytel + 1);
+  tmps = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, bytel + 1);
   if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9304,7 +9312,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_quotedstrin
 #endif
     /* We want to maintain marpaESLIFValueResult lifetime, so need to unshallow the result of the INTERNAL method _marpaESLIFRecognizer_terminal_matcherb() if necessary */
     if (marpaESLIFValueResult.u.a.shallowb) {
-      modifiers = (char *) malloc(marpaESLIFValueResult.u.a.sizel + 1);
+      modifiers = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.a.sizel + 1);
       if (MARPAESLIF_UNLIKELY(modifiers == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -9325,7 +9333,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_quotedstrin
   /* have been done on a buffer always pre-converted to UTF-8, regardless of the original encoding of the input. */
 
   /* Make that a single symbol structure */
-  rcp = (marpaESLIF_bootstrap_terminal_t *) malloc(sizeof(marpaESLIF_bootstrap_terminal_t));
+  rcp = (marpaESLIF_bootstrap_terminal_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_terminal_t));
   if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9349,12 +9357,12 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_quotedstrin
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(rcp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFRecognizerp->marpaESLIFp, rcp);
   rcp = NULL;
 
  done:
   if (modifiers != NULL) {
-    free(modifiers);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, modifiers);
   }
   marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
   return rcp;
@@ -9366,7 +9374,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
 {
   marpaESLIF_bootstrap_terminal_t *rcp;
 
-  rcp = (marpaESLIF_bootstrap_terminal_t *) malloc(sizeof(marpaESLIF_bootstrap_terminal_t));
+  rcp = (marpaESLIF_bootstrap_terminal_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIF_bootstrap_terminal_t));
   if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9381,7 +9389,7 @@ static inline marpaESLIF_bootstrap_terminal_t *_marpaESLIF_bootstrap_regex_to_te
   goto done;
 
  err:
-  _marpaESLIF_bootstrap_terminal_freev(rcp);
+  _marpaESLIF_bootstrap_terminal_freev(marpaESLIFValuep->marpaESLIFp, rcp);
   rcp = NULL;
 
  done:
@@ -9394,7 +9402,7 @@ static inline marpaESLIF_bootstrap_utf_string_t *_marpaESLIF_bootstrap_utf_strin
 {
   marpaESLIF_bootstrap_utf_string_t *rcp;
 
-  rcp = (marpaESLIF_bootstrap_utf_string_t *) malloc(sizeof(marpaESLIF_bootstrap_utf_string_t));
+  rcp = (marpaESLIF_bootstrap_utf_string_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_bootstrap_utf_string_t));
   if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
   } else {
@@ -0,0 +1,1066 @@
+/* CBOR (RFC 8949) serialization of marpaESLIFValueResult_t trees */
+
+#undef  FILENAMES
+#define FILENAMES "cbor.c" /* For logging */
+
+#define MARPAESLIF_CBOR_MAJOR_UINT   0
+#define MARPAESLIF_CBOR_MAJOR_NINT   1
+#define MARPAESLIF_CBOR_MAJOR_BYTES  2
+#define MARPAESLIF_CBOR_MAJOR_TEXT   3
+#define MARPAESLIF_CBOR_MAJOR_ARRAY  4
+#define MARPAESLIF_CBOR_MAJOR_MAP    5
+#define MARPAESLIF_CBOR_MAJOR_TAG    6
+#define MARPAESLIF_CBOR_MAJOR_SIMPLE 7
+
+#define MARPAESLIF_CBOR_SIMPLE_FALSE  20
+#define MARPAESLIF_CBOR_SIMPLE_TRUE   21
+#define MARPAESLIF_CBOR_SIMPLE_NULL   22
+#define MARPAESLIF_CBOR_SIMPLE_UNDEF  23
+#define MARPAESLIF_CBOR_SIMPLE_HALF   25
+#define MARPAESLIF_CBOR_SIMPLE_FLOAT  26
+#define MARPAESLIF_CBOR_SIMPLE_DOUBLE 27
+
+#define MARPAESLIF_CBOR_TAG_POSBIGNUM 2
+#define MARPAESLIF_CBOR_TAG_NEGBIGNUM 3
+#define MARPAESLIF_CBOR_TAG_BIGFLOAT  5
+#define MARPAESLIF_CBOR_TAG_OBJECT    27 /* Serialised language-independent object: [typename, args...] */
+
+/* Types that have no native CBOR representation are tagged objects */
+#define MARPAESLIF_CBOR_TYPENAME_STRING          "marpaESLIF:string"
+#define MARPAESLIF_CBOR_TYPENAME_OFFSETANDLENGTH "marpaESLIF:offsetAndLength"
+
+/* Widest native integer */
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+#  define MARPAESLIF_CBOR_INTEGER_T MARPAESLIF_LONG_LONG
+#  define MARPAESLIF_CBOR_INTEGER_MAX MARPAESLIF_LLONG_MAX
+#else
+#  define MARPAESLIF_CBOR_INTEGER_T long
+#  define MARPAESLIF_CBOR_INTEGER_MAX LONG_MAX
+#endif
+
+/* Every decoded string points to this encoding, stored once at the beginning of the bytes area */
+#define MARPAESLIF_CBOR_UTF8 "UTF-8"
+
+typedef struct marpaESLIF_cbor_frame  marpaESLIF_cbor_frame_t;
+typedef struct marpaESLIF_cbor_decode marpaESLIF_cbor_decode_t;
+
+struct marpaESLIF_cbor_frame {
+  marpaESLIFValueResult_t *containerp; /* ROW or TABLE being filled */
+  size_t                   nextl;      /* Next item */
+  size_t                   countl;     /* Number of items, i.e. twice the number of pairs for a TABLE */
+};
+
+/* Decoding is done in two passes over the input: the first validates it and */
+/* computes the size of the single area holding the whole tree, the second   */
+/* fills this area. Inner values are all shallow.                            */
+struct marpaESLIF_cbor_decode {
+  marpaESLIF_t            *marpaESLIFp;
+  unsigned char           *p;           /* Current position in input */
+  unsigned char           *endp;        /* End of input */
+  short                    fillb;       /* False during the first pass */
+  size_t                   resultl;     /* Size of the values area */
+  size_t                   bytel;       /* Size of the bytes area */
+  char                    *resultp;     /* Next free position in the values area */
+  char                    *bytep;       /* Next free position in the bytes area */
+  char                    *utf8s;       /* Shared encoding name */
+  marpaESLIFValueResult_t  scratch;     /* Destination of all values during the first pass */
+  marpaESLIF_cbor_frame_t *framep;      /* Pending containers */
+  size_t                   framel;      /* Number of pending containers */
+  size_t                   frameallocl; /* Allocated number of containers */
+};
+
+static inline short _marpaESLIF_cbor_fixedb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, int aii, marpaESLIF_uint64_t ul, size_t argumentl);
+static inline short _marpaESLIF_cbor_headb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, marpaESLIF_uint64_t ul);
+static inline short _marpaESLIF_cbor_integerb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_INTEGER_T v);
+static inline short _marpaESLIF_cbor_textb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, char *p, size_t l);
+static inline short _marpaESLIF_cbor_floatb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, float f);
+static inline short _marpaESLIF_cbor_doubleb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, double d);
+static inline short _marpaESLIF_cbor_longdoubleb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, long double ld);
+static inline short _marpaESLIF_cbor_encodeb(marpaESLIF_t *marpaESLIFp, marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline short _marpaESLIF_cbor_decode_headb(marpaESLIF_cbor_decode_t *contextp, int *majorip, int *aip, marpaESLIF_uint64_t *ulp);
+static inline short _marpaESLIF_cbor_decode_textb(marpaESLIF_cbor_decode_t *contextp, int majori, unsigned char **pp, size_t *lp);
+static inline short _marpaESLIF_cbor_decode_signedb(marpaESLIF_cbor_decode_t *contextp, int majori, marpaESLIF_uint64_t ul, MARPAESLIF_CBOR_INTEGER_T *vp);
+static inline void  _marpaESLIF_cbor_decode_integerv(marpaESLIFValueResult_t *marpaESLIFValueResultp, MARPAESLIF_CBOR_INTEGER_T v);
+static inline short _marpaESLIF_cbor_decode_bigfloatb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline short _marpaESLIF_cbor_decode_objectb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline short _marpaESLIF_cbor_decode_itemb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp, size_t *countlp);
+static inline short _marpaESLIF_cbor_decode_passb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline float _marpaESLIF_cbor_halftofloatf(marpaESLIF_uint32_t halfi);
+
+/*****************************************************************************/
+short marpaESLIFValueResult_cbor_encodeb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **bytespp, size_t *bytelp)
+/*****************************************************************************/
+{
+  marpaESLIF_stringGenerator_t marpaESLIF_stringGenerator;
+  short                        rcb;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || (marpaESLIFValueResultp == NULL) || (bytespp == NULL) || (bytelp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  _marpaESLIF_stringGeneratorInitv(marpaESLIFp, &marpaESLIF_stringGenerator);
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_encodeb(marpaESLIFp, &marpaESLIF_stringGenerator, marpaESLIFValueResultp))) {
+    goto err;
+  }
+
+  /* The string generator keeps a hiden NUL byte that is not part of the output */
+  *bytespp = marpaESLIF_stringGenerator.s;
+  *bytelp  = marpaESLIF_stringGenerator.l - 1;
+  rcb = 1;
+  goto done;
+
+ err:
+  _marpaESLIF_stringGeneratorFreev(marpaESLIFp, &marpaESLIF_stringGenerator, 1 /* onStackb */);
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFValueResult_cbor_decodeb(marpaESLIF_t *marpaESLIFp, char *bytes, size_t bytel, marpaESLIFValueResult_t **marpaESLIFValueResultpp)
+/*****************************************************************************/
+{
+  marpaESLIF_cbor_decode_t  context;
+  char                     *areap = NULL;
+  short                     rcb;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || (bytes == NULL) || (bytel <= 0) || (marpaESLIFValueResultpp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  context.marpaESLIFp = marpaESLIFp;
+  context.framep      = NULL;
+  context.framel      = 0;
+  context.frameallocl = 0;
+
+  /* First pass: validation and sizing. The root value and the encoding name are always there. */
+  context.p       = (unsigned char *) bytes;
+  context.endp    = context.p + bytel;
+  context.fillb   = 0;
+  context.resultl = sizeof(marpaESLIFValueResult_t);
+  context.bytel   = sizeof(MARPAESLIF_CBOR_UTF8);
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_passb(&context, &(context.scratch)))) {
+    goto err;
+  }
+
+  areap = (char *) MARPAESLIF_MALLOC(marpaESLIFp, context.resultl + context.bytel);
+  if (MARPAESLIF_UNLIKELY(areap == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+
+  /* Second pass: values are carved out of the area */
+  context.p       = (unsigned char *) bytes;
+  context.fillb   = 1;
+  context.resultp = areap + sizeof(marpaESLIFValueResult_t);
+  context.utf8s   = areap + context.resultl;
+  context.bytep   = context.utf8s + sizeof(MARPAESLIF_CBOR_UTF8);
+  memcpy(context.utf8s, MARPAESLIF_CBOR_UTF8, sizeof(MARPAESLIF_CBOR_UTF8));
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_passb(&context, (marpaESLIFValueResult_t *) areap))) {
+    goto err;
+  }
+
+  *marpaESLIFValueResultpp = (marpaESLIFValueResult_t *) areap;
+  rcb = 1;
+  goto done;
+
+ err:
+  if (areap != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, areap);
+  }
+  rcb = 0;
+
+ done:
+  if (context.framep != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, context.framep);
+  }
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_fixedb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, int aii, marpaESLIF_uint64_t ul, size_t argumentl)
+/*****************************************************************************/
+{
+  unsigned char headc[9];
+  size_t        i;
+
+  headc[0] = (unsigned char) ((majori << 5) | aii);
+  /* Network byte order */
+  for (i = argumentl; i > 0; i--) {
+    headc[i] = (unsigned char) (ul & 0xFF);
+    ul >>= 8;
+  }
+
+  return _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_stringGeneratorp, (char *) headc, argumentl + 1);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_headb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, marpaESLIF_uint64_t ul)
+/*****************************************************************************/
+/* Preferred serialization: the argument always uses the shortest form       */
+/*****************************************************************************/
+{
+  if (ul < 24) {
+    return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, majori, (int) ul, 0, 0);
+  } else if (ul <= 0xFF) {
+    return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, majori, 24, ul, 1);
+  } else if (ul <= 0xFFFF) {
+    return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, majori, 25, ul, 2);
+  } else if (ul <= 0xFFFFFFFFUL) {
+    return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, majori, 26, ul, 4);
+  } else {
+    return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, majori, 27, ul, 8);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_integerb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_INTEGER_T v)
+/*****************************************************************************/
+{
+  /* -1 - v is computed as -(v + 1) to never overflow */
+  return (v >= 0) ?
+    _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_UINT, (marpaESLIF_uint64_t) v)
+    :
+    _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_NINT, (marpaESLIF_uint64_t) (-(v + 1)));
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_textb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, int majori, char *p, size_t l)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, majori, (marpaESLIF_uint64_t) l))) {
+    return 0;
+  }
+  if (l <= 0) {
+    return 1;
+  }
+  return _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_stringGeneratorp, p, l);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_doubleb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, double d)
+/*****************************************************************************/
+{
+  marpaESLIF_uint64_t ul;
+
+  memcpy(&ul, &d, sizeof(marpaESLIF_uint64_t));
+  return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_SIMPLE, MARPAESLIF_CBOR_SIMPLE_DOUBLE, ul, 8);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_floatb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, float f)
+/*****************************************************************************/
+{
+  marpaESLIF_uint32_t ui;
+
+  memcpy(&ui, &f, sizeof(marpaESLIF_uint32_t));
+  return _marpaESLIF_cbor_fixedb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_SIMPLE, MARPAESLIF_CBOR_SIMPLE_FLOAT, (marpaESLIF_uint64_t) ui, 4);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_longdoubleb(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, long double ld)
+/*****************************************************************************/
+/* A finite long double is sent exactly as a bigfloat [exponent, mantissa],  */
+/* with an integer mantissa of at most LDBL_MANT_DIG bits.                   */
+/*****************************************************************************/
+{
+  unsigned char       mantissac[(LDBL_MANT_DIG + 7) / 8];
+  size_t              mantissal;
+  long double         mantissald;
+  long double         bytld;
+  marpaESLIF_uint64_t mantissaul;
+  short               negativeb;
+  int                 exponenti;
+  size_t              i;
+
+  if ((ld - ld) != (ld - ld)) {
+    /* Infinity or NaN: there is no bigfloat for them */
+    return _marpaESLIF_cbor_doubleb(marpaESLIF_stringGeneratorp, (double) ld);
+  }
+
+  negativeb  = (ld < 0) ? 1 : 0;
+  mantissald = frexpl(negativeb ? -ld : ld, &exponenti);
+  mantissald = ldexpl(mantissald, LDBL_MANT_DIG);
+  exponenti -= LDBL_MANT_DIG;
+
+  /* Remove trailing zero bits, for compacity */
+  mantissal = 0;
+  if (mantissald > 0) {
+    while (fmodl(mantissald, 2.0L) == 0) {
+      mantissald /= 2;
+      exponenti++;
+    }
+    /* Big-endian bytes of the mantissa */
+    while (mantissald > 0) {
+      bytld = fmodl(mantissald, 256.0L);
+      mantissac[mantissal++] = (unsigned char) bytld;
+      mantissald = (mantissald - bytld) / 256;
+    }
+    for (i = 0; i < mantissal / 2; i++) {
+      unsigned char c = mantissac[i];
+      mantissac[i] = mantissac[mantissal - 1 - i];
+      mantissac[mantissal - 1 - i] = c;
+    }
+  } else {
+    exponenti = 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TAG, MARPAESLIF_CBOR_TAG_BIGFLOAT))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_ARRAY, 2))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) exponenti))) {
+    return 0;
+  }
+
+  /* A negative mantissa -m is encoded as m - 1 */
+  if (negativeb) {
+    for (i = mantissal; i > 0; i--) {
+      if (mantissac[i - 1]-- != 0) {
+        break;
+      }
+    }
+  }
+
+  if (mantissal <= sizeof(marpaESLIF_uint64_t)) {
+    mantissaul = 0;
+    for (i = 0; i < mantissal; i++) {
+      mantissaul = (mantissaul << 8) | mantissac[i];
+    }
+    return _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, negativeb ? MARPAESLIF_CBOR_MAJOR_NINT : MARPAESLIF_CBOR_MAJOR_UINT, mantissaul);
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TAG, negativeb ? MARPAESLIF_CBOR_TAG_NEGBIGNUM : MARPAESLIF_CBOR_TAG_POSBIGNUM))) {
+    return 0;
+  }
+  return _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_BYTES, (char *) mantissac, mantissal);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_encodeb(marpaESLIF_t *marpaESLIFp, marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  static const char       *funcs      = "_marpaESLIF_cbor_encodeb";
+  genericStack_t           todoStack;
+  genericStack_t          *todoStackp = &todoStack;
+  marpaESLIFValueResult_t *marpaESLIFValueResultTmpp;
+  char                    *encodingasciis;
+  size_t                   i;
+  short                    rcb;
+
+  GENERICSTACK_INIT(todoStackp);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp initialization failure, %s", strerror(errno));
+    todoStackp = NULL;
+    goto err;
+  }
+
+  GENERICSTACK_PUSH_PTR(todoStackp, marpaESLIFValueResultp);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+    goto err;
+  }
+
+  /* Preorder: a container header is followed by its items, pushed in reverse order */
+  while (GENERICSTACK_USED(todoStackp) > 0) {
+    marpaESLIFValueResultTmpp = (marpaESLIFValueResult_t *) GENERICSTACK_POP_PTR(todoStackp);
+
+    switch (marpaESLIFValueResultTmpp->type) {
+    case MARPAESLIF_VALUE_TYPE_UNDEF:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_SIMPLE, MARPAESLIF_CBOR_SIMPLE_NULL))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_CHAR:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.c))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_SHORT:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.b))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_INT:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.i))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_LONG:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.l))) {
+        goto err;
+      }
+      break;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+    case MARPAESLIF_VALUE_TYPE_LONG_LONG:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.ll))) {
+        goto err;
+      }
+      break;
+#endif
+    case MARPAESLIF_VALUE_TYPE_FLOAT:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_floatb(marpaESLIF_stringGeneratorp, marpaESLIFValueResultTmpp->u.f))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_DOUBLE:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_doubleb(marpaESLIF_stringGeneratorp, marpaESLIFValueResultTmpp->u.d))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_LONG_DOUBLE:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_longdoubleb(marpaESLIF_stringGeneratorp, marpaESLIFValueResultTmpp->u.ld))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_BOOL:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_SIMPLE, (marpaESLIFValueResultTmpp->u.y == MARPAESLIFVALUERESULTBOOL_FALSE) ? MARPAESLIF_CBOR_SIMPLE_FALSE : MARPAESLIF_CBOR_SIMPLE_TRUE))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_ARRAY:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_BYTES, marpaESLIFValueResultTmpp->u.a.p, marpaESLIFValueResultTmpp->u.a.sizel))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_STRING:
+      encodingasciis = marpaESLIFValueResultTmpp->u.s.encodingasciis;
+      if ((encodingasciis == NULL) || (strcmp(encodingasciis, MARPAESLIF_CBOR_UTF8) == 0)) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TEXT, (char *) marpaESLIFValueResultTmpp->u.s.p, marpaESLIFValueResultTmpp->u.s.sizel))) {
+          goto err;
+        }
+      } else {
+        /* 27(["marpaESLIF:string", encoding, bytes]) */
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TAG, MARPAESLIF_CBOR_TAG_OBJECT))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_ARRAY, 3))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TEXT, (char *) MARPAESLIF_CBOR_TYPENAME_STRING, sizeof(MARPAESLIF_CBOR_TYPENAME_STRING) - 1))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TEXT, encodingasciis, strlen(encodingasciis)))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_BYTES, (char *) marpaESLIFValueResultTmpp->u.s.p, marpaESLIFValueResultTmpp->u.s.sizel))) {
+          goto err;
+        }
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_OFFSET_AND_LENGTH:
+      /* 27(["marpaESLIF:offsetAndLength", offset, length]) */
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TAG, MARPAESLIF_CBOR_TAG_OBJECT))) {
+        goto err;
+      }
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_ARRAY, 3))) {
+        goto err;
+      }
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_textb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_TEXT, (char *) MARPAESLIF_CBOR_TYPENAME_OFFSETANDLENGTH, sizeof(MARPAESLIF_CBOR_TYPENAME_OFFSETANDLENGTH) - 1))) {
+        goto err;
+      }
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_integerb(marpaESLIF_stringGeneratorp, (MARPAESLIF_CBOR_INTEGER_T) marpaESLIFValueResultTmpp->u.o.p))) {
+        goto err;
+      }
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_UINT, (marpaESLIF_uint64_t) marpaESLIFValueResultTmpp->u.o.sizel))) {
+        goto err;
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_ROW:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_ARRAY, (marpaESLIF_uint64_t) marpaESLIFValueResultTmpp->u.r.sizel))) {
+        goto err;
+      }
+      for (i = marpaESLIFValueResultTmpp->u.r.sizel; i > 0; i--) {
+        GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultTmpp->u.r.p[i - 1]));
+        if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+          goto err;
+        }
+      }
+      break;
+    case MARPAESLIF_VALUE_TYPE_TABLE:
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_headb(marpaESLIF_stringGeneratorp, MARPAESLIF_CBOR_MAJOR_MAP, (marpaESLIF_uint64_t) marpaESLIFValueResultTmpp->u.t.sizel))) {
+        goto err;
+      }
+      for (i = marpaESLIFValueResultTmpp->u.t.sizel; i > 0; i--) {
+        GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultTmpp->u.t.p[i - 1].value));
+        if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+          goto err;
+        }
+        GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultTmpp->u.t.p[i - 1].key));
+        if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+          goto err;
+        }
+      }
+      break;
+    default:
+      /* PTR is opaque by definition */
+      MARPAESLIF_ERRORF(marpaESLIFp, "%s: %s type cannot be serialized", funcs, _marpaESLIF_value_types(marpaESLIFValueResultTmpp->type));
+      errno = EINVAL;
+      goto err;
+    }
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  GENERICSTACK_RESET(todoStackp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_headb(marpaESLIF_cbor_decode_t *contextp, int *majorip, int *aip, marpaESLIF_uint64_t *ulp)
+/*****************************************************************************/
+{
+  marpaESLIF_t        *marpaESLIFp = contextp->marpaESLIFp;
+  marpaESLIF_uint64_t  ul;
+  size_t               argumentl;
+  int                  ai;
+
+  if (MARPAESLIF_UNLIKELY(contextp->p >= contextp->endp)) {
+    MARPAESLIF_ERROR(marpaESLIFp, "CBOR: truncated input");
+    errno = EINVAL;
+    return 0;
+  }
+
+  *majorip = *(contextp->p) >> 5;
+  ai       = *(contextp->p) & 0x1F;
+  contextp->p++;
+
+  if (ai < 24) {
+    argumentl = 0;
+    ul        = (marpaESLIF_uint64_t) ai;
+  } else if (ai <= 27) {
+    argumentl = ((size_t) 1) << (ai - 24);
+    ul        = 0;
+  } else {
+    /* Indefinite lengths are never produced by the encoder */
+    MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: unsupported additional information %d", ai);
+    errno = EINVAL;
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY((size_t) (contextp->endp - contextp->p) < argumentl)) {
+    MARPAESLIF_ERROR(marpaESLIFp, "CBOR: truncated input");
+    errno = EINVAL;
+    return 0;
+  }
+  while (argumentl-- > 0) {
+    ul = (ul << 8) | *(contextp->p++);
+  }
+
+  *aip = ai;
+  *ulp = ul;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_textb(marpaESLIF_cbor_decode_t *contextp, int majori, unsigned char **pp, size_t *lp)
+/*****************************************************************************/
+{
+  int                 gotmajori;
+  int                 ai;
+  marpaESLIF_uint64_t ul;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &gotmajori, &ai, &ul))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(gotmajori != majori)) {
+    MARPAESLIF_ERRORF(contextp->marpaESLIFp, "CBOR: major type %d instead of %d", gotmajori, majori);
+    errno = EINVAL;
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY((marpaESLIF_uint64_t) (contextp->endp - contextp->p) < ul)) {
+    MARPAESLIF_ERROR(contextp->marpaESLIFp, "CBOR: truncated input");
+    errno = EINVAL;
+    return 0;
+  }
+
+  *pp = contextp->p;
+  *lp = (size_t) ul;
+  contextp->p += ul;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_signedb(marpaESLIF_cbor_decode_t *contextp, int majori, marpaESLIF_uint64_t ul, MARPAESLIF_CBOR_INTEGER_T *vp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY((majori != MARPAESLIF_CBOR_MAJOR_UINT) && (majori != MARPAESLIF_CBOR_MAJOR_NINT))) {
+    MARPAESLIF_ERRORF(contextp->marpaESLIFp, "CBOR: major type %d is not an integer", majori);
+    errno = EINVAL;
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(ul > (marpaESLIF_uint64_t) MARPAESLIF_CBOR_INTEGER_MAX)) {
+    MARPAESLIF_ERROR(contextp->marpaESLIFp, "CBOR: integer out of range");
+    errno = ERANGE;
+    return 0;
+  }
+
+  *vp = (majori == MARPAESLIF_CBOR_MAJOR_UINT) ? (MARPAESLIF_CBOR_INTEGER_T) ul : -1 - (MARPAESLIF_CBOR_INTEGER_T) ul;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIF_cbor_decode_integerv(marpaESLIFValueResult_t *marpaESLIFValueResultp, MARPAESLIF_CBOR_INTEGER_T v)
+/*****************************************************************************/
+{
+  /* Like marpaESLIF_numberb(), the smallest type that fits is used */
+  if ((SHRT_MIN <= v) && (v <= SHRT_MAX)) {
+    marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_SHORT;
+    marpaESLIFValueResultp->u.b  = (short) v;
+  } else if ((INT_MIN <= v) && (v <= INT_MAX)) {
+    marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_INT;
+    marpaESLIFValueResultp->u.i  = (int) v;
+  } else if ((LONG_MIN <= v) && (v <= LONG_MAX)) {
+    marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_LONG;
+    marpaESLIFValueResultp->u.l  = (long) v;
+  }
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+  else {
+    marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_LONG_LONG;
+    marpaESLIFValueResultp->u.ll = v;
+  }
+#endif
+}
+
+/*****************************************************************************/
+static inline float _marpaESLIF_cbor_halftofloatf(marpaESLIF_uint32_t halfi)
+/*****************************************************************************/
+{
+  int   exponenti = (int) ((halfi >> 10) & 0x1F);
+  int   mantissai = (int) (halfi & 0x3FF);
+  float f;
+
+  if (exponenti == 0) {
+    f = (float) ldexp((double) mantissai, -24);
+  } else if (exponenti != 31) {
+    f = (float) ldexp((double) (mantissai + 1024), exponenti - 25);
+  } else if (mantissai == 0) {
+    f = MARPAESLIF_HUGE_VALF;
+  } else {
+    f = (float) MARPAESLIF_NAN;
+  }
+
+  return (halfi & 0x8000) ? -f : f;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_bigfloatb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  marpaESLIF_t              *marpaESLIFp = contextp->marpaESLIFp;
+  int                        majori;
+  int                        ai;
+  marpaESLIF_uint64_t        ul;
+  MARPAESLIF_CBOR_INTEGER_T  exponentv;
+  long double                mantissald;
+  unsigned char             *p;
+  size_t                     l;
+  short                      negativeb;
+
+  /* [exponent, mantissa] */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY((majori != MARPAESLIF_CBOR_MAJOR_ARRAY) || (ul != 2))) {
+    MARPAESLIF_ERROR(marpaESLIFp, "CBOR: a bigfloat must be an array of two items");
+    errno = EINVAL;
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_signedb(contextp, majori, ul, &exponentv))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY((exponentv < INT_MIN) || (exponentv > INT_MAX))) {
+    MARPAESLIF_ERROR(marpaESLIFp, "CBOR: bigfloat exponent out of range");
+    errno = ERANGE;
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+    return 0;
+  }
+  switch (majori) {
+  case MARPAESLIF_CBOR_MAJOR_UINT:
+  case MARPAESLIF_CBOR_MAJOR_NINT:
+    negativeb  = (majori == MARPAESLIF_CBOR_MAJOR_NINT);
+    mantissald = (long double) ul;
+    break;
+  case MARPAESLIF_CBOR_MAJOR_TAG:
+    if (MARPAESLIF_UNLIKELY((ul != MARPAESLIF_CBOR_TAG_POSBIGNUM) && (ul != MARPAESLIF_CBOR_TAG_NEGBIGNUM))) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: unsupported tag %lu in bigfloat mantissa", (unsigned long) ul);
+      errno = EINVAL;
+      return 0;
+    }
+    negativeb = (ul == MARPAESLIF_CBOR_TAG_NEGBIGNUM);
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_textb(contextp, MARPAESLIF_CBOR_MAJOR_BYTES, &p, &l))) {
+      return 0;
+    }
+    mantissald = 0;
+    while (l-- > 0) {
+      mantissald = (mantissald * 256) + *p++;
+    }
+    break;
+  default:
+    MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: major type %d is not a bigfloat mantissa", majori);
+    errno = EINVAL;
+    return 0;
+  }
+
+  /* A negative mantissa -m is encoded as m - 1 */
+  if (negativeb) {
+    mantissald = -(mantissald + 1);
+  }
+
+  marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_LONG_DOUBLE;
+  marpaESLIFValueResultp->u.ld = ldexpl(mantissald, (int) exponentv);
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_objectb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  marpaESLIF_t              *marpaESLIFp = contextp->marpaESLIFp;
+  int                        majori;
+  int                        ai;
+  marpaESLIF_uint64_t        ul;
+  unsigned char             *typenamep;
+  size_t                     typenamel;
+  unsigned char             *encodingp;
+  size_t                     encodingl;
+  unsigned char             *p;
+  size_t                     l;
+  MARPAESLIF_CBOR_INTEGER_T  v;
+
+  /* [typename, args...] */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY((majori != MARPAESLIF_CBOR_MAJOR_ARRAY) || (ul != 3))) {
+    MARPAESLIF_ERROR(marpaESLIFp, "CBOR: unsupported serialized object");
+    errno = EINVAL;
+    return 0;
+  }
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_textb(contextp, MARPAESLIF_CBOR_MAJOR_TEXT, &typenamep, &typenamel))) {
+    return 0;
+  }
+
+  if ((typenamel == sizeof(MARPAESLIF_CBOR_TYPENAME_STRING) - 1) && (memcmp(typenamep, MARPAESLIF_CBOR_TYPENAME_STRING, typenamel) == 0)) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_textb(contextp, MARPAESLIF_CBOR_MAJOR_TEXT, &encodingp, &encodingl))) {
+      return 0;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_textb(contextp, MARPAESLIF_CBOR_MAJOR_BYTES, &p, &l))) {
+      return 0;
+    }
+    /* Both the encoding and the string are NUL terminated */
+    marpaESLIFValueResultp->type                   = MARPAESLIF_VALUE_TYPE_STRING;
+    marpaESLIFValueResultp->u.s.shallowb           = 1;
+    marpaESLIFValueResultp->u.s.freeUserDatavp     = NULL;
+    marpaESLIFValueResultp->u.s.freeCallbackp      = NULL;
+    marpaESLIFValueResultp->u.s.sizel              = l;
+    if (contextp->fillb) {
+      marpaESLIFValueResultp->u.s.encodingasciis   = contextp->bytep;
+      memcpy(contextp->bytep, encodingp, encodingl);
+      contextp->bytep[encodingl] = '\0';
+      contextp->bytep += encodingl + 1;
+      marpaESLIFValueResultp->u.s.p                = (unsigned char *) contextp->bytep;
+      if (l > 0) {
+        memcpy(contextp->bytep, p, l);
+      }
+      contextp->bytep[l] = '\0';
+      contextp->bytep += l + 1;
+    } else {
+      contextp->bytel += encodingl + 1 + l + 1;
+    }
+  } else if ((typenamel == sizeof(MARPAESLIF_CBOR_TYPENAME_OFFSETANDLENGTH) - 1) && (memcmp(typenamep, MARPAESLIF_CBOR_TYPENAME_OFFSETANDLENGTH, typenamel) == 0)) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+      return 0;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_signedb(contextp, majori, ul, &v))) {
+      return 0;
+    }
+    marpaESLIFValueResultp->type  = MARPAESLIF_VALUE_TYPE_OFFSET_AND_LENGTH;
+    marpaESLIFValueResultp->u.o.p = (ptrdiff_t) v;
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+      return 0;
+    }
+    if (MARPAESLIF_UNLIKELY(majori != MARPAESLIF_CBOR_MAJOR_UINT)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: major type %d is not a length", majori);
+      errno = EINVAL;
+      return 0;
+    }
+    marpaESLIFValueResultp->u.o.sizel = (size_t) ul;
+  } else {
+    MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: unsupported serialized object type %.*s", (int) typenamel, (char *) typenamep);
+    errno = EINVAL;
+    return 0;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_itemb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp, size_t *countlp)
+/*****************************************************************************/
+/* Decodes one item into marpaESLIFValueResultp. For a ROW or a TABLE, the   */
+/* number of items to follow is put in *countlp, that is 0 otherwise.        */
+/*****************************************************************************/
+{
+  marpaESLIF_t              *marpaESLIFp = contextp->marpaESLIFp;
+  int                        majori;
+  int                        ai;
+  marpaESLIF_uint64_t        ul;
+  unsigned char             *p;
+  size_t                     l;
+  MARPAESLIF_CBOR_INTEGER_T  v;
+  marpaESLIF_uint32_t        ui;
+  float                      f;
+  double                     d;
+
+  *countlp = 0;
+  marpaESLIFValueResultp->contextp        = NULL;
+  marpaESLIFValueResultp->representationp = NULL;
+
+ again:
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_headb(contextp, &majori, &ai, &ul))) {
+    return 0;
+  }
+
+  switch (majori) {
+  case MARPAESLIF_CBOR_MAJOR_UINT:
+  case MARPAESLIF_CBOR_MAJOR_NINT:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_signedb(contextp, majori, ul, &v))) {
+      return 0;
+    }
+    _marpaESLIF_cbor_decode_integerv(marpaESLIFValueResultp, v);
+    break;
+  case MARPAESLIF_CBOR_MAJOR_BYTES:
+  case MARPAESLIF_CBOR_MAJOR_TEXT:
+    if (MARPAESLIF_UNLIKELY((marpaESLIF_uint64_t) (contextp->endp - contextp->p) < ul)) {
+      MARPAESLIF_ERROR(marpaESLIFp, "CBOR: truncated input");
+      errno = EINVAL;
+      return 0;
+    }
+    p = contextp->p;
+    l = (size_t) ul;
+    contextp->p += l;
+    if (majori == MARPAESLIF_CBOR_MAJOR_BYTES) {
+      marpaESLIFValueResultp->type             = MARPAESLIF_VALUE_TYPE_ARRAY;
+      marpaESLIFValueResultp->u.a.shallowb     = 1;
+      marpaESLIFValueResultp->u.a.freeUserDatavp = NULL;
+      marpaESLIFValueResultp->u.a.freeCallbackp  = NULL;
+      marpaESLIFValueResultp->u.a.sizel        = l;
+      if (contextp->fillb) {
+        marpaESLIFValueResultp->u.a.p = contextp->bytep;
+        if (l > 0) {
+          memcpy(contextp->bytep, p, l);
+        }
+        contextp->bytep += l;
+      } else {
+        contextp->bytel += l;
+      }
+    } else {
+      marpaESLIFValueResultp->type               = MARPAESLIF_VALUE_TYPE_STRING;
+      marpaESLIFValueResultp->u.s.shallowb       = 1;
+      marpaESLIFValueResultp->u.s.freeUserDatavp = NULL;
+      marpaESLIFValueResultp->u.s.freeCallbackp  = NULL;
+      marpaESLIFValueResultp->u.s.sizel          = l;
+      if (contextp->fillb) {
+        marpaESLIFValueResultp->u.s.encodingasciis = contextp->utf8s;
+        marpaESLIFValueResultp->u.s.p              = (unsigned char *) contextp->bytep;
+        if (l > 0) {
+          memcpy(contextp->bytep, p, l);
+        }
+        contextp->bytep[l] = '\0';
+        contextp->bytep += l + 1;
+      } else {
+        contextp->bytel += l + 1;
+      }
+    }
+    break;
+  case MARPAESLIF_CBOR_MAJOR_ARRAY:
+  case MARPAESLIF_CBOR_MAJOR_MAP:
+    /* Every item takes at least one byte: this protects against huge allocations. */
+    /* The count is divided, not multiplied, so that a hostile count cannot overflow. */
+    l = (size_t) (contextp->endp - contextp->p);
+    if (MARPAESLIF_UNLIKELY(ul > (marpaESLIF_uint64_t) ((majori == MARPAESLIF_CBOR_MAJOR_ARRAY) ? l : l / 2))) {
+      MARPAESLIF_ERROR(marpaESLIFp, "CBOR: truncated input");
+      errno = EINVAL;
+      return 0;
+    }
+    if (MARPAESLIF_UNLIKELY(ul > (marpaESLIF_uint64_t) (((size_t) -1) / ((majori == MARPAESLIF_CBOR_MAJOR_ARRAY) ? sizeof(marpaESLIFValueResult_t) : sizeof(marpaESLIFValueResultPair_t))))) {
+      MARPAESLIF_ERROR(marpaESLIFp, "CBOR: too many items");
+      errno = ERANGE;
+      return 0;
+    }
+    if (majori == MARPAESLIF_CBOR_MAJOR_ARRAY) {
+      marpaESLIFValueResultp->type               = MARPAESLIF_VALUE_TYPE_ROW;
+      marpaESLIFValueResultp->u.r.shallowb       = 1;
+      marpaESLIFValueResultp->u.r.freeUserDatavp = NULL;
+      marpaESLIFValueResultp->u.r.freeCallbackp  = NULL;
+      marpaESLIFValueResultp->u.r.sizel          = (size_t) ul;
+      marpaESLIFValueResultp->u.r.p              = NULL;
+      if (contextp->fillb) {
+        if (ul > 0) {
+          marpaESLIFValueResultp->u.r.p = (marpaESLIFValueResult_t *) contextp->resultp;
+          contextp->resultp += (size_t) ul * sizeof(marpaESLIFValueResult_t);
+        }
+      } else {
+        contextp->resultl += (size_t) ul * sizeof(marpaESLIFValueResult_t);
+      }
+      *countlp = (size_t) ul;
+    } else {
+      marpaESLIFValueResultp->type               = MARPAESLIF_VALUE_TYPE_TABLE;
+      marpaESLIFValueResultp->u.t.shallowb       = 1;
+      marpaESLIFValueResultp->u.t.freeUserDatavp = NULL;
+      marpaESLIFValueResultp->u.t.freeCallbackp  = NULL;
+      marpaESLIFValueResultp->u.t.sizel          = (size_t) ul;
+      marpaESLIFValueResultp->u.t.p              = NULL;
+      if (contextp->fillb) {
+        if (ul > 0) {
+          marpaESLIFValueResultp->u.t.p = (marpaESLIFValueResultPair_t *) contextp->resultp;
+          contextp->resultp += (size_t) ul * sizeof(marpaESLIFValueResultPair_t);
+        }
+      } else {
+        contextp->resultl += (size_t) ul * sizeof(marpaESLIFValueResultPair_t);
+      }
+      *countlp = (size_t) ul * 2;
+    }
+    break;
+  case MARPAESLIF_CBOR_MAJOR_TAG:
+    switch (ul) {
+    case MARPAESLIF_CBOR_TAG_BIGFLOAT:
+      return _marpaESLIF_cbor_decode_bigfloatb(contextp, marpaESLIFValueResultp);
+    case MARPAESLIF_CBOR_TAG_OBJECT:
+      return _marpaESLIF_cbor_decode_objectb(contextp, marpaESLIFValueResultp);
+    case MARPAESLIF_CBOR_TAG_POSBIGNUM:
+    case MARPAESLIF_CBOR_TAG_NEGBIGNUM:
+      MARPAESLIF_ERROR(marpaESLIFp, "CBOR: bignums are not supported");
+      errno = ERANGE;
+      return 0;
+    default:
+      /* Other tags are semantic hints on the enclosed item, that is taken as is */
+      goto again;
+    }
+    break;
+  default:
+    switch (ai) {
+    case MARPAESLIF_CBOR_SIMPLE_FALSE:
+    case MARPAESLIF_CBOR_SIMPLE_TRUE:
+      marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_BOOL;
+      marpaESLIFValueResultp->u.y  = (ai == MARPAESLIF_CBOR_SIMPLE_TRUE) ? MARPAESLIFVALUERESULTBOOL_TRUE : MARPAESLIFVALUERESULTBOOL_FALSE;
+      break;
+    case MARPAESLIF_CBOR_SIMPLE_NULL:
+    case MARPAESLIF_CBOR_SIMPLE_UNDEF:
+      marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_UNDEF;
+      break;
+    case MARPAESLIF_CBOR_SIMPLE_HALF:
+      marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_FLOAT;
+      marpaESLIFValueResultp->u.f  = _marpaESLIF_cbor_halftofloatf((marpaESLIF_uint32_t) ul);
+      break;
+    case MARPAESLIF_CBOR_SIMPLE_FLOAT:
+      ui = (marpaESLIF_uint32_t) ul;
+      memcpy(&f, &ui, sizeof(float));
+      marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_FLOAT;
+      marpaESLIFValueResultp->u.f  = f;
+      break;
+    case MARPAESLIF_CBOR_SIMPLE_DOUBLE:
+      memcpy(&d, &ul, sizeof(double));
+      marpaESLIFValueResultp->type = MARPAESLIF_VALUE_TYPE_DOUBLE;
+      marpaESLIFValueResultp->u.d  = d;
+      break;
+    default:
+      MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: unsupported simple value %lu", (unsigned long) ul);
+      errno = EINVAL;
+      return 0;
+    }
+    break;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_cbor_decode_passb(marpaESLIF_cbor_decode_t *contextp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  marpaESLIF_t            *marpaESLIFp = contextp->marpaESLIFp;
+  marpaESLIF_cbor_frame_t *framep;
+  marpaESLIFValueResult_t *containerp;
+  size_t                   frameallocl;
+  size_t                   countl;
+  size_t                   nextl;
+
+  contextp->framel = 0;
+
+  containerp = marpaESLIFValueResultp;
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_itemb(contextp, marpaESLIFValueResultp, &countl))) {
+    return 0;
+  }
+
+  while (1) {
+    if (countl > 0) {
+      /* Remember the new container */
+      if (contextp->framel >= contextp->frameallocl) {
+        frameallocl = (contextp->frameallocl > 0) ? contextp->frameallocl * 2 : 16;
+        framep = (marpaESLIF_cbor_frame_t *) MARPAESLIF_REALLOC(marpaESLIFp, contextp->framep, frameallocl * sizeof(marpaESLIF_cbor_frame_t));
+        if (MARPAESLIF_UNLIKELY(framep == NULL)) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
+          return 0;
+        }
+        contextp->framep      = framep;
+        contextp->frameallocl = frameallocl;
+      }
+      framep = &(contextp->framep[contextp->framel++]);
+      framep->containerp = containerp;
+      framep->nextl      = 0;
+      framep->countl     = countl;
+    }
+
+    /* Drop completed containers */
+    while ((contextp->framel > 0) && (contextp->framep[contextp->framel - 1].nextl >= contextp->framep[contextp->framel - 1].countl)) {
+      contextp->framel--;
+    }
+    if (contextp->framel <= 0) {
+      break;
+    }
+
+    /* Next item of the innermost container */
+    framep = &(contextp->framep[contextp->framel - 1]);
+    nextl  = framep->nextl++;
+    if (! contextp->fillb) {
+      containerp = &(contextp->scratch);
+    } else if (framep->containerp->type == MARPAESLIF_VALUE_TYPE_ROW) {
+      containerp = &(framep->containerp->u.r.p[nextl]);
+    } else {
+      containerp = ((nextl % 2) == 0) ? &(framep->containerp->u.t.p[nextl / 2].key) : &(framep->containerp->u.t.p[nextl / 2].value);
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_cbor_decode_itemb(contextp, containerp, &countl))) {
+      return 0;
+    }
+  }
+
+  if (MARPAESLIF_UNLIKELY(contextp->p != contextp->endp)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "CBOR: %lu trailing bytes", (unsigned long) (contextp->endp - contextp->p));
+    errno = EINVAL;
+    return 0;
+  }
+
+  return 1;
+}
@@ -120,7 +120,7 @@
                                                                         \
   err:                                                                  \
     if (marpaESLIF_stringGenerator.s != NULL) {                         \
-      free(marpaESLIF_stringGenerator.s);                               \
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);        \
       marpaESLIF_stringGenerator.s = NULL;                              \
     }                                                                   \
                                                                         \
@@ -11,11 +11,29 @@
 typedef struct marpaESLIFJSONDecodeDepositCallbackContext marpaESLIFJSONDecodeDepositCallbackContext_t;
 typedef struct marpaESLIFJSONDecodeDeposit                marpaESLIFJSONDecodeDeposit_t;
 typedef struct marpaESLIFJSONDecodeContext                marpaESLIFJSONDecodeContext_t;
+typedef struct marpaESLIFJSONDecodeSegment                marpaESLIFJSONDecodeSegment_t;
+typedef struct marpaESLIFJSONDecodePath                   marpaESLIFJSONDecodePath_t;
 typedef short (*marpaESLIFJSONDecodeDepositCallback_t)(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDepositCallbackContext_t *contextp, marpaESLIFValueResult_t *dstp, marpaESLIFValueResult_t *srcp);
 typedef struct marpaESLIFJSONEncodeContext                marpaESLIFJSONEncodeContext_t;
+typedef struct marpaESLIFJSONEncodeStream                 marpaESLIFJSONEncodeStream_t;
 
 #define MARPAESLIFJSON_ARRAYL_IN_STRUCTURE 128
 #define MARPAESLIFJSON_STRINGALLOCL_DEFAULT_VALUE 128
+
+/* A reference token of a decoder path, unescaped */
+struct marpaESLIFJSONDecodeSegment {
+  char   *p;         /* Not NUL terminated */
+  size_t  l;
+  short   wildcardb; /* "*": any key or index */
+  short   indexb;    /* Reference token is also an array index */
+  size_t  indexl;
+};
+
+struct marpaESLIFJSONDecodePath {
+  marpaESLIFJSONDecodeSegment_t *segmentp; /* Reference tokens are stored after the segments */
+  size_t                         segmentl;
+};
+
 struct marpaESLIFJSONDecodeContext {
   marpaESLIF_t                      *marpaESLIFp;
   marpaESLIFJSONDecodeOption_t      *marpaESLIFJSONDecodeOptionp;
@@ -33,6 +51,13 @@ struct marpaESLIFJSONDecodeContext {
   marpaESLIFValueResult_t            currentValue; /* Temporary work area - UNDEF at beginning, always reset to UNDEF when commited */
   marpaESLIF_uint32_t               _uint32p[MARPAESLIFJSON_ARRAYL_IN_STRUCTURE + 1]; /* Ditto */
   marpaESLIFValueResult_t            import;
+  short                              documentb; /* Set when a top-level value is complete */
+  marpaESLIFJSONDecodePath_t        *pathp;          /* Compiled marpaESLIFJSONDecodeOptionp->pathsp */
+  size_t                             pathl;          /* 0 when there is no projection */
+  char                              *selectionp;     /* Paths still selected by the value to come */
+  char                              *nextSelectionp; /* selectionp, or NULL when all the value to come is selected */
+  size_t                             skipl;          /* Number of skipped containers we are in */
+  short                              skipb;          /* Current string, constant or number is skipped */
 };
 
 struct marpaESLIFJSONEncodeContext {
@@ -40,10 +65,54 @@ struct marpaESLIFJSONEncodeContext {
   marpaESLIFRepresentationDispose_t  representationDisposep;
 };
 
+/* Direct encoder: the output buffer is flushed to the writer, or grown, when full */
+#define MARPAESLIFJSON_ENCODE_CHUNKL_DEFAULT 4096
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+#  define MARPAESLIFJSON_ENCODE_INTEGER_T MARPAESLIF_LONG_LONG
+#else
+#  define MARPAESLIFJSON_ENCODE_INTEGER_T long
+#endif
+/* Punctuations in the work stack are CHAR items, this one says that next item is an object key */
+#define MARPAESLIFJSON_ENCODE_KEY '\0'
+struct marpaESLIFJSONEncodeStream {
+  marpaESLIF_t                 *marpaESLIFp;
+  marpaESLIFJSONEncodeOption_t *marpaESLIFJSONEncodeOptionp;
+  char                         *bufferp;
+  size_t                        bufferl; /* Used bytes */
+  size_t                        allocl;  /* Allocated bytes */
+};
+
+static marpaESLIFJSONEncodeOption_t marpaESLIFJSONEncodeOptionDefault = {
+  1,    /* strictb */
+  NULL, /* writerp */
+  NULL, /* userDatavp */
+  0     /* chunkl */
+};
+
+/* Append to the direct encoder output */
+#define MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, p, l) do { \
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamAppendb(marpaESLIFJSONEncodeStreamp, (char *) (p), (size_t) (l)))) { \
+      goto err;                                                         \
+    }                                                                   \
+  } while (0)
+
+/* Same thing for a single character, the common case */
+#define MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, c) do { \
+    if ((marpaESLIFJSONEncodeStreamp)->bufferl < (marpaESLIFJSONEncodeStreamp)->allocl) { \
+      (marpaESLIFJSONEncodeStreamp)->bufferp[(marpaESLIFJSONEncodeStreamp)->bufferl++] = (c); \
+    } else {                                                            \
+      char _c = (c);                                                    \
+      MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, &_c, 1); \
+    }                                                                   \
+  } while (0)
+
 struct marpaESLIFJSONDecodeDepositCallbackContext {
   marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp;
   short                          keyb; /* MUST BE INITIALIZED to 1 (case when destination is a table) */
   size_t                         allocl;
+  marpaESLIFValueResultTableIndex_t *tableIndexp; /* Index on keys when destination is a table and duplicate keys are disallowed */
+  char                          *selectionp; /* Paths selecting this container, NULL when all its content is selected */
+  size_t                         indexl;     /* Number of items seen when destination is an array with a selection */
 };
   
 struct marpaESLIFJSONDecodeDeposit {
@@ -149,6 +218,14 @@ static short                                _marpaESLIFJSONDecodeSetValueCallbac
 static short                                _marpaESLIFJSONDecodePushRowCallbackv(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp, marpaESLIFValueResult_t *dstp, marpaESLIFValueResult_t *srcp);
 static short                                _marpaESLIFJSONDecodeSetHashCallbackv(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp, marpaESLIFValueResult_t *dstp, marpaESLIFValueResult_t *srcp);
 static inline short                         _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFValueResult_t *marpaESLIFValueresultp);
+static inline short                         _marpaESLIFJSONDecodeValueCallbackb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp, marpaESLIFValueResult_t *marpaESLIFValueresultp);
+static inline short                         _marpaESLIFJSONDecodeDropKeyb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDeposit_t *depositp);
+static inline short                         _marpaESLIFJSONDecodePathsb(marpaESLIF_t *marpaESLIFp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
+static inline void                          _marpaESLIFJSONDecodePathsFreev(marpaESLIF_t *marpaESLIFp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
+static inline short                         _marpaESLIFJSONDecodeProjectb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, short containerb, short *skipbp);
+static inline short                         _marpaESLIFJSONDecodeSkipOpeningb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, short *skipbp);
+static inline short                         _marpaESLIFJSONDecodeSkipScalarb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
+static inline short                         _marpaESLIFJSONDecodeImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static short                                _marpaESLIFJSONDecodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
 static short                                _marpaESLIFJSONDecodeValueResultInternalImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
 static short                                _marpaESLIFJSONDecodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp);
@@ -158,6 +235,15 @@ static inline void                          _marpaESLIFJSONDecodeDepositDisposev
 static short                                _marpaESLIFJSONEncodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
 static short                                _marpaESLIFJSONEncodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp);
 static void                                 _marpaESLIFJSONEncodeRepresentationDisposev(void *userDatavp, char *inputcp, size_t inputl, char *encodingasciis);
+static inline short                         _marpaESLIFJSONEncodeStreamAppendb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l);
+static inline short                         _marpaESLIFJSONEncodeStreamFlushb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp);
+static inline short                         _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, MARPAESLIFJSON_ENCODE_INTEGER_T v, short quoteb);
+static inline short                         _marpaESLIFJSONEncodeStreamFloatingb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *floattos, short quoteb);
+static inline short                         _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *words, short quoteb);
+static inline short                         _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l, short utf8b);
+static inline short                         _marpaESLIFJSONEncodeStreamStringb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l, char *encodingasciis);
+static inline short                         _marpaESLIFJSONEncodeStreamRepresentationb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short keyb, short *donebp);
+static inline short                         _marpaESLIFJSONEncodeStreamValueb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, genericStack_t *todoStackp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short keyb);
 static inline short                         _marpaESLIFJSONDecodeObjectOpeningb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
 static inline short                         _marpaESLIFJSONDecodeObjectClosingb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
 static inline short                         _marpaESLIFJSONDecodeArrayOpeningb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp);
@@ -309,20 +395,112 @@ short marpaESLIFJSON_encodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   return rcb;
 }
 
+/*****************************************************************************/
+short marpaESLIFJSON_encode_streamb(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp, marpaESLIFJSONEncodeOption_t *marpaESLIFJSONEncodeOptionp, char **bytespp, size_t *bytelp)
+/*****************************************************************************/
+/* Same output as marpaESLIFJSON_encodeb(), without a recognizer nor a       */
+/* valuation: the tree is walked using a work stack where punctuations are   */
+/* CHAR items and values are PTR items.                                      */
+/*****************************************************************************/
+{
+  static const char            *funcs                       = "marpaESLIFJSON_encode_streamb";
+  marpaESLIFJSONEncodeStream_t  marpaESLIFJSONEncodeStream;
+  marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp = &marpaESLIFJSONEncodeStream;
+  genericStack_t                todoStack;
+  genericStack_t               *todoStackp                  = &todoStack;
+  short                         keyb                        = 0;
+  char                          c;
+  short                         rcb;
+
+  if (marpaESLIFJSONEncodeOptionp == NULL) {
+    marpaESLIFJSONEncodeOptionp = &marpaESLIFJSONEncodeOptionDefault;
+  }
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || (marpaESLIFValueResultp == NULL) || ((marpaESLIFJSONEncodeOptionp->writerp == NULL) && ((bytespp == NULL) || (bytelp == NULL))))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  marpaESLIFJSONEncodeStreamp->marpaESLIFp                 = marpaESLIFp;
+  marpaESLIFJSONEncodeStreamp->marpaESLIFJSONEncodeOptionp = marpaESLIFJSONEncodeOptionp;
+  marpaESLIFJSONEncodeStreamp->bufferl                     = 0;
+  marpaESLIFJSONEncodeStreamp->allocl                      = (marpaESLIFJSONEncodeOptionp->chunkl > 0) ? marpaESLIFJSONEncodeOptionp->chunkl : MARPAESLIFJSON_ENCODE_CHUNKL_DEFAULT;
+  marpaESLIFJSONEncodeStreamp->bufferp                     = (char *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFJSONEncodeStreamp->allocl);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONEncodeStreamp->bufferp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    todoStackp = NULL;
+    goto err;
+  }
+
+  GENERICSTACK_INIT(todoStackp);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp initialization failure, %s", strerror(errno));
+    todoStackp = NULL;
+    goto err;
+  }
+
+  GENERICSTACK_PUSH_PTR(todoStackp, marpaESLIFValueResultp);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+    goto err;
+  }
+
+  while (GENERICSTACK_USED(todoStackp) > 0) {
+    if (GENERICSTACK_IS_CHAR(todoStackp, GENERICSTACK_USED(todoStackp) - 1)) {
+      c = GENERICSTACK_POP_CHAR(todoStackp);
+      if (c == MARPAESLIFJSON_ENCODE_KEY) {
+        keyb = 1;
+      } else {
+        MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, c);
+      }
+    } else {
+      marpaESLIFValueResultp = (marpaESLIFValueResult_t *) GENERICSTACK_POP_PTR(todoStackp);
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamValueb(marpaESLIFJSONEncodeStreamp, todoStackp, marpaESLIFValueResultp, keyb))) {
+        goto err;
+      }
+      keyb = 0;
+    }
+  }
+
+  if (marpaESLIFJSONEncodeOptionp->writerp != NULL) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamFlushb(marpaESLIFJSONEncodeStreamp))) {
+      goto err;
+    }
+  } else {
+    /* Hiden NUL byte */
+    MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '\0');
+    *bytespp = marpaESLIFJSONEncodeStreamp->bufferp;
+    *bytelp  = marpaESLIFJSONEncodeStreamp->bufferl - 1;
+    marpaESLIFJSONEncodeStreamp->bufferp = NULL;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  GENERICSTACK_RESET(todoStackp);
+  if (marpaESLIFJSONEncodeStreamp->bufferp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFJSONEncodeStreamp->bufferp);
+  }
+  return rcb;
+}
+
 /*****************************************************************************/
 short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaESLIFJSONDecodeOption_t *marpaESLIFJSONDecodeOptionp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp)
 /*****************************************************************************/
 {
-  static const char                            *funcs                 = "marpaESLIFJSON_decodeb";
-  marpaESLIFValue_t                            *marpaESLIFValuep      = NULL;
-  marpaESLIFRecognizer_t                       *marpaESLIFRecognizerp = NULL;
+  static const char                            *funcs                       = "marpaESLIFJSON_decodeb";
+  marpaESLIFRecognizer_t                       *marpaESLIFRecognizerp       = NULL;
+  marpaESLIFRecognizer_t                       *marpaESLIFRecognizerSharedp = NULL; /* First recognizer: it owns the stream */
   short                                         continueb             = 1;
   char                                         *inputs;
   size_t                                        inputl                = 0;
   marpaESLIFSymbol_t                            jsonString;
   marpaESLIFSymbol_t                            jsonConstantOrNumber;
   marpaESLIFRecognizerOption_t                  marpaESLIFRecognizerOption;
-  marpaESLIFValueOption_t                       marpaESLIFValueOption;
   marpaESLIFJSONDecodeContext_t                 marpaESLIFJSONDecodeContext;
   marpaESLIFJSONDecodeDeposit_t                 marpaESLIFJSONDecodeDeposit;
   marpaESLIFJSONDecodeDepositCallbackContext_t  marpaESLIFJSONDecodeDepositCallbackContext;
@@ -333,6 +511,9 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   short                                         matchb;
   size_t                                        discardl;
   int                                           depositStackpUsedi;
+  short                                         importb;
+  short                                         skipb;
+  size_t                                        i;
   short                                         rcb;
 
   /* This is vicious but we do not want to recompute the symbols. Since we are internal */
@@ -354,6 +535,13 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   marpaESLIFJSONDecodeContext.stringallocl                = 0;
   marpaESLIFJSONDecodeContext.uint32allocl                = 0;
   marpaESLIFJSONDecodeContext.currentValue                = marpaESLIFValueResultUndef;
+  marpaESLIFJSONDecodeContext.documentb                   = 0;
+  marpaESLIFJSONDecodeContext.pathp                       = NULL;
+  marpaESLIFJSONDecodeContext.pathl                       = 0;
+  marpaESLIFJSONDecodeContext.selectionp                  = NULL;
+  marpaESLIFJSONDecodeContext.nextSelectionp              = NULL;
+  marpaESLIFJSONDecodeContext.skipl                       = 0;
+  marpaESLIFJSONDecodeContext.skipb                       = 0;
 
   GENERICSTACK_INIT(marpaESLIFJSONDecodeContext.depositStackp);
   if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFJSONDecodeContext.depositStackp))) {
@@ -371,6 +559,15 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
     goto err;
   }
 
+  if (marpaESLIFJSONDecodeOptionp->pathl > 0) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodePathsb(marpaESLIFGrammarJSONp->marpaESLIFp, &marpaESLIFJSONDecodeContext))) {
+      goto err;
+    }
+  }
+
+  /* A top-level value that went to the value callback is not imported */
+  importb = (marpaESLIFJSONDecodeOptionp->valueCallbackp == NULL) || (marpaESLIFJSONDecodeOptionp->valueDepthl > 0);
+
   marpaESLIFRecognizerOption                      = *marpaESLIFRecognizerOptionp;
   marpaESLIFRecognizerOption.userDatavp           = &marpaESLIFJSONDecodeContext;
   marpaESLIFRecognizerOption.readerCallbackp      = _marpaESLIFJSONDecodeReaderb;
@@ -378,8 +575,12 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   marpaESLIFRecognizerOption.eventActionResolverp = NULL;
   marpaESLIFRecognizerOption.regexActionResolverp = _marpaESLIFJSONDecodeRegexActionResolverp;
   marpaESLIFRecognizerOption.importerp            = _marpaESLIFJSONDecodeValueResultInternalImportb;
+  if (marpaESLIFJSONDecodeOptionp->multipleb) {
+    /* Data remains after a document: this is the next one */
+    marpaESLIFRecognizerOption.exhaustedb         = 1;
+  }
 
-  marpaESLIFRecognizerp = _marpaESLIFRecognizer_newp(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFGrammarJSONp->grammarp, &marpaESLIFRecognizerOption, 0 /* discardb */, 0 /* noEventb */, 0 /* silentb */);
+  marpaESLIFRecognizerSharedp = marpaESLIFRecognizerp = _marpaESLIFRecognizer_newp(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFGrammarJSONp->grammarp, &marpaESLIFRecognizerOption, 0 /* discardb */, 0 /* noEventb */, 0 /* silentb */);
   if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
     goto err;
   }
@@ -397,20 +598,41 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   marpaESLIFJSONDecodeDepositCallbackContext.marpaESLIFJSONDecodeContextp  = &marpaESLIFJSONDecodeContext;
   marpaESLIFJSONDecodeDepositCallbackContext.keyb                          = 1;
   marpaESLIFJSONDecodeDepositCallbackContext.allocl                        = 0;
+  marpaESLIFJSONDecodeDepositCallbackContext.tableIndexp                   = NULL;
+  marpaESLIFJSONDecodeDepositCallbackContext.selectionp                    = NULL;
+  marpaESLIFJSONDecodeDepositCallbackContext.indexl                        = 0;
 
-  finalValuep = marpaESLIFJSONDecodeDeposit.dstp = (marpaESLIFValueResult_t *) malloc(sizeof(marpaESLIFValueResult_t));
+  finalValuep = marpaESLIFJSONDecodeDeposit.dstp = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFGrammarJSONp->marpaESLIFp, sizeof(marpaESLIFValueResult_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDeposit.dstp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFGrammarJSONp->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
   *(marpaESLIFJSONDecodeDeposit.dstp) = marpaESLIFValueResultUndef;
 
-  marpaESLIFJSONDecodeDeposit.contextp = (marpaESLIFJSONDecodeDepositCallbackContext_t *) malloc(sizeof(marpaESLIFJSONDecodeDepositCallbackContext_t));
+  marpaESLIFJSONDecodeDeposit.contextp = (marpaESLIFJSONDecodeDepositCallbackContext_t *) MARPAESLIF_MALLOC(marpaESLIFGrammarJSONp->marpaESLIFp, sizeof(marpaESLIFJSONDecodeDepositCallbackContext_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDeposit.contextp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFGrammarJSONp->marpaESLIFp, "malloc failure, %s", strerror(errno));
-    free(marpaESLIFJSONDecodeDeposit.dstp);
+    MARPAESLIF_FREE(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFJSONDecodeDeposit.dstp);
     goto err;
   }
+  *(marpaESLIFJSONDecodeDeposit.contextp) = marpaESLIFJSONDecodeDepositCallbackContext;
+
+  /* The document is selected by all the paths, unless one of them is "" */
+  for (i = 0; i < marpaESLIFJSONDecodeContext.pathl; i++) {
+    if (marpaESLIFJSONDecodeContext.pathp[i].segmentl <= 0) {
+      break;
+    }
+  }
+  if ((marpaESLIFJSONDecodeContext.pathl > 0) && (i >= marpaESLIFJSONDecodeContext.pathl)) {
+    marpaESLIFJSONDecodeDeposit.contextp->selectionp = (char *) MARPAESLIF_MALLOC(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFJSONDecodeContext.pathl);
+    if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDeposit.contextp->selectionp == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFGrammarJSONp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+      MARPAESLIF_FREE(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFJSONDecodeDeposit.contextp);
+      MARPAESLIF_FREE(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFJSONDecodeDeposit.dstp);
+      goto err;
+    }
+    memset(marpaESLIFJSONDecodeDeposit.contextp->selectionp, 1, marpaESLIFJSONDecodeContext.pathl);
+  }
 
   marpaESLIFJSONDecodeDeposit.actionp          = _marpaESLIFJSONDecodeSetValueCallbackv;
 
@@ -449,9 +671,14 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
       if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizerp, &marpaESLIFAlternative, 1 /* lengthl */))) {
         goto err;
       }
-      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeObjectOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeSkipOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext, &skipb))) {
         goto err;
       }
+      if (! skipb) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeObjectOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
+      }
       break;
 
     case '}':
@@ -459,8 +686,16 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
       if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizerp, &marpaESLIFAlternative, 1 /* lengthl */))) {
         goto err;
       }
-      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeObjectClosingb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
-        goto err;
+      if (marpaESLIFJSONDecodeContext.skipl > 0) {
+        /* End of a skipped container */
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeDecb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
+        marpaESLIFJSONDecodeContext.skipl--;
+      } else {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeObjectClosingb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
       }
       break;
 
@@ -469,9 +704,14 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
       if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizerp, &marpaESLIFAlternative, 1 /* lengthl */))) {
         goto err;
       }
-      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeArrayOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeSkipOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext, &skipb))) {
         goto err;
       }
+      if (! skipb) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeArrayOpeningb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
+      }
       break;
 
     case ']':
@@ -479,8 +719,16 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
       if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizerp, &marpaESLIFAlternative, 1 /* lengthl */))) {
         goto err;
       }
-      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeArrayClosingb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
-        goto err;
+      if (marpaESLIFJSONDecodeContext.skipl > 0) {
+        /* End of a skipped container */
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeDecb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
+        marpaESLIFJSONDecodeContext.skipl--;
+      } else {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeArrayClosingb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+          goto err;
+        }
       }
       break;
 
@@ -492,10 +740,14 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
       break;
 
     case '"':
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeSkipScalarb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+        goto err;
+      }
       /* The external symbol has regex callouts */
       if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, &jsonString, &matchb))) {
         goto err;
       }
+      marpaESLIFJSONDecodeContext.skipb = 0;
       if (! matchb) {
         /* Bad string - common case is that a user put a valid JSON isn't it. */
         _marpaESLIFRecognizer_errorv(marpaESLIFRecognizerp);
@@ -535,10 +787,14 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
     case '9': /* Number - Only extended grammar will accept it */
     case 'i': /* Infinity - Only extended grammar will accept it */
     case 'I': /* Infinity - Only extended grammar will accept it */
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeSkipScalarb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext))) {
+        goto err;
+      }
       /* The external symbol has regex callouts */
       if (MARPAESLIF_UNLIKELY(! marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, &jsonConstantOrNumber, &matchb))) {
         goto err;
       }
+      marpaESLIFJSONDecodeContext.skipb = 0;
       if (! matchb) {
         /* Bad constant or number - common case is that a user put a valid JSON isn't it. */
         _marpaESLIFRecognizer_errorv(marpaESLIFRecognizerp);
@@ -562,15 +818,44 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
         goto err;
       }
     }
+
+    if (marpaESLIFJSONDecodeContext.documentb && marpaESLIFJSONDecodeOptionp->multipleb) {
+      /* A document is complete: give it to the importer and continue with a new recognizer on the same stream */
+      if (importb) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeImportb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext, finalValuep))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, finalValuep, 1 /* deepb */))) {
+          goto err;
+        }
+        *finalValuep = marpaESLIFValueResultUndef;
+      }
+      marpaESLIFJSONDecodeContext.documentb = 0;
+
+      if (marpaESLIFRecognizerp != marpaESLIFRecognizerSharedp) {
+        marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+      }
+      marpaESLIFRecognizerp = _marpaESLIFRecognizer_newFromp(marpaESLIFGrammarJSONp->grammarp, marpaESLIFRecognizerSharedp, 0 /* discardb */, 0 /* noEventb */, 0 /* silentb */);
+      if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+        goto err;
+      }
+      jsonString.marpaESLIFSymbolOption.userDatavp           = marpaESLIFRecognizerp;
+      jsonConstantOrNumber.marpaESLIFSymbolOption.userDatavp = marpaESLIFRecognizerp;
+    }
   }
 
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Number of items in depositStackp: %d", GENERICSTACK_USED(marpaESLIFJSONDecodeContext.depositStackp));
 
-  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_checkStartCompletionb(marpaESLIFRecognizerp, 0 /* lengthl */))) {
-    goto err;
-  }
-  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_isStartCompleteb(marpaESLIFRecognizerp, &isStartCompleteb))) {
-    goto err;
+  if (marpaESLIFJSONDecodeOptionp->multipleb) {
+    /* Documents are already delivered: the last recognizer must not have started a new one */
+    isStartCompleteb = 1;
+  } else {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_checkStartCompletionb(marpaESLIFRecognizerp, 0 /* lengthl */))) {
+      goto err;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_isStartCompleteb(marpaESLIFRecognizerp, &isStartCompleteb))) {
+      goto err;
+    }
   }
   if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_isEofb(marpaESLIFRecognizerp, &isEofb))) {
     goto err;
@@ -596,29 +881,10 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   }
 
   /* Here by definition, there is only one item remaining in deposit stack */
-  /* Verify valuation */
-  marpaESLIFValueOption                           = *marpaESLIFValueOptionp;
-  marpaESLIFValueOption.userDatavp                = &marpaESLIFJSONDecodeContext;
-  marpaESLIFValueOption.ruleActionResolverp       = NULL;
-  marpaESLIFValueOption.symbolActionResolverp     = NULL;
-  marpaESLIFValueOption.importerp                 = ((marpaESLIFValueOptionp != NULL) && (marpaESLIFValueOptionp->importerp != NULL)) ? _marpaESLIFJSONDecodeValueResultImportb : NULL;
-  marpaESLIFValueOption.highRankOnlyb             = 1; /* Fixed */
-  marpaESLIFValueOption.orderByRankb              = 1; /* Fixed */
-  marpaESLIFValueOption.ambiguousb                = 0; /* Fixed */
-  marpaESLIFValueOption.nullb                     = 0; /* Fixed */
-  marpaESLIFValueOption.maxParsesi                = 0; /* Fixed */
-
-  marpaESLIFValuep = _marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption, 0 /* silentb */, 1 /* fakeb */, 0 /* directTransferb */);
-  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep == NULL)) {
-    goto err;
-  }
-
-  /* Set-up proxy representation */
-  marpaESLIFValuep->proxyRepresentationp = _marpaESLIFJSONDecodeRepresentationb;
-
-  /* Call for import (no-op if end-user has set no importer */
-  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_importb(marpaESLIFValuep, finalValuep))) {
-    goto err;
+  if (importb && (! marpaESLIFJSONDecodeOptionp->multipleb)) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeImportb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeContext, finalValuep))) {
+      goto err;
+    }
   }
 
   rcb = 1;
@@ -628,9 +894,11 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
   rcb = 0;
 
  done:
-  if (marpaESLIFValuep != NULL) {
-    marpaESLIFValue_freev(marpaESLIFValuep);
+  /* The recognizer for the current document, if any, is not the one that owns the stream */
+  if ((marpaESLIFRecognizerp != NULL) && (marpaESLIFRecognizerp != marpaESLIFRecognizerSharedp)) {
+    marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
   }
+  marpaESLIFRecognizerp = marpaESLIFRecognizerSharedp;
   if (marpaESLIFJSONDecodeContext.depositStackp != NULL) {
     /* It is in theory impossible that marpaESLIFRecognizerp is NULL if marpaESLIFJSONDecodeContext.depositStackp is not NULL */
     if (marpaESLIFRecognizerp != NULL) {
@@ -644,8 +912,9 @@ short marpaESLIFJSON_decodeb(marpaESLIFGrammar_t *marpaESLIFGrammarJSONp, marpaE
     GENERICSTACK_RESET(marpaESLIFJSONDecodeContext.depositStackp);
   }
   if (marpaESLIFJSONDecodeContext.uint32p != NULL) {
-    free(marpaESLIFJSONDecodeContext.uint32p);
+    MARPAESLIF_FREE(marpaESLIFGrammarJSONp->marpaESLIFp, marpaESLIFJSONDecodeContext.uint32p);
   }
+  _marpaESLIFJSONDecodePathsFreev(marpaESLIFGrammarJSONp->marpaESLIFp, &marpaESLIFJSONDecodeContext);
   if (marpaESLIFJSONDecodeContext.currentValue.type != MARPAESLIF_VALUE_TYPE_UNDEF) {
       MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "Freeing currentValue content");
       _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, &(marpaESLIFJSONDecodeContext.currentValue), 1 /* deepb */);
@@ -736,6 +1005,13 @@ static short _marpaESLIFJSONDecodeRegexCallbackb(void *userDatavp, marpaESLIFRec
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
+  if (marpaESLIFJSONDecodeContextp->skipb) {
+    /* Syntax check only: nothing is converted nor allocated */
+    *marpaESLIFValueResultOutp = 0;
+    rcb = 1;
+    goto done;
+  }
+
   switch ((blockNumberl = marpaESLIFCalloutBlockp->u.t.p[MARPAESLIFCALLOUTBLOCK_CALLOUT_NUMBER].value.u.l)) {
 
   case 50:
@@ -928,7 +1204,7 @@ static short _marpaESLIFJSONDecodeRegexCallbackb(void *userDatavp, marpaESLIFRec
   }
 #endif
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
-  return 1;
+  return rcb;
 }
 
 /*****************************************************************************/
@@ -1185,7 +1461,7 @@ static inline short _marpaESLIFJSONDecodeExtendStringContainerb(marpaESLIFRecogn
     } else {
       heapl = MARPAESLIFJSON_STRINGALLOCL_DEFAULT_VALUE;
     }
-    marpaESLIFJSONDecodeContextp->currentValue.u.s.p = (unsigned char *) malloc(heapl + 1); /* +1 for NUL byte */
+    marpaESLIFJSONDecodeContextp->currentValue.u.s.p = (unsigned char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, heapl + 1); /* +1 for NUL byte */
     if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeContextp->currentValue.u.s.p == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -1214,7 +1490,7 @@ static inline short _marpaESLIFJSONDecodeExtendStringContainerb(marpaESLIFRecogn
         goto err;
       }
 
-      tmps = (unsigned char *) realloc(marpaESLIFJSONDecodeContextp->currentValue.u.s.p, heapl + 1); /* +1 for NUL byte */
+      tmps = (unsigned char *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFJSONDecodeContextp->currentValue.u.s.p, heapl + 1); /* +1 for NUL byte */
       if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -1383,7 +1659,7 @@ static inline short _marpaESLIFJSONDecodeAppendCharb(marpaESLIFRecognizer_t *mar
           goto err;
         }
         if (marpaESLIFJSONDecodeContextp->uint32p == NULL) {
-          marpaESLIFJSONDecodeContextp->uint32p = (marpaESLIF_uint32_t *) malloc(heapl * sizeof(marpaESLIF_uint32_t));
+          marpaESLIFJSONDecodeContextp->uint32p = (marpaESLIF_uint32_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, heapl * sizeof(marpaESLIF_uint32_t));
           if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeContextp->uint32p == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
@@ -1392,7 +1668,7 @@ static inline short _marpaESLIFJSONDecodeAppendCharb(marpaESLIFRecognizer_t *mar
           uint32p = marpaESLIFJSONDecodeContextp->uint32p;
           marpaESLIFJSONDecodeContextp->uint32allocl = heapl;
         } else if (marpaESLIFJSONDecodeContextp->uint32allocl < heapl) {
-          tmpp = (marpaESLIF_uint32_t *) realloc(marpaESLIFJSONDecodeContextp->uint32p, heapl * sizeof(marpaESLIF_uint32_t));
+          tmpp = (marpaESLIF_uint32_t *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFJSONDecodeContextp->uint32p, heapl * sizeof(marpaESLIF_uint32_t));
           if (MARPAESLIF_UNLIKELY(tmpp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
             goto err;
@@ -1772,7 +2048,7 @@ static short _marpaESLIFJSONDecodePushRowCallbackv(marpaESLIFRecognizer_t *marpa
   } else {
     if (marpaESLIFJSONDecodeDepositCallbackContextp->allocl <= 0) {
       /* First time */
-      dstp->u.r.p = (marpaESLIFValueResult_t *) malloc(sizeof(marpaESLIFValueResult_t));
+      dstp->u.r.p = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIFValueResult_t));
       if (MARPAESLIF_UNLIKELY(dstp->u.r.p == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -1796,7 +2072,7 @@ static short _marpaESLIFJSONDecodePushRowCallbackv(marpaESLIFRecognizer_t *marpa
           MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "size_t turnaround when computing nextAllocl");
           goto err;
         }
-        marpaESLIFValueResultTmpp = (marpaESLIFValueResult_t *) realloc(dstp->u.r.p, nextAllocl * sizeof(marpaESLIFValueResult_t));
+        marpaESLIFValueResultTmpp = (marpaESLIFValueResult_t *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, dstp->u.r.p, nextAllocl * sizeof(marpaESLIFValueResult_t));
         if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultTmpp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
           goto err;
@@ -1839,12 +2115,13 @@ static short _marpaESLIFJSONDecodePushRowCallbackv(marpaESLIFRecognizer_t *marpa
 static short _marpaESLIFJSONDecodeSetHashCallbackv(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp, marpaESLIFValueResult_t *dstp, marpaESLIFValueResult_t *srcp)
 /*****************************************************************************/
 {
-  static const char           *funcs                                 = "_marpaESLIFJSONDecodeSetHashCallbackv";
-  size_t                       nextSizel;
-  size_t                       nextAllocl;
-  marpaESLIFValueResultPair_t *marpaESLIFValueResultPairTmpp;
-  size_t                       indicel;
-  short                        rcb;
+  static const char                     *funcs                                 = "_marpaESLIFJSONDecodeSetHashCallbackv";
+  size_t                                 nextSizel;
+  size_t                                 nextAllocl;
+  marpaESLIFValueResultPair_t           *marpaESLIFValueResultPairTmpp;
+  size_t                                 indicel;
+  marpaESLIFValueResultPair_t           *pairp;
+  short                                  rcb;
 
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
@@ -1859,20 +2136,39 @@ static short _marpaESLIFJSONDecodeSetHashCallbackv(marpaESLIFRecognizer_t *marpa
     dstp->u.t.freeUserDatavp = marpaESLIFRecognizerp->marpaESLIFp;
     dstp->u.t.freeCallbackp  = _marpaESLIF_generic_freeCallbackv;
     dstp->u.t.sizel          = 0;
+
+    if (marpaESLIFJSONDecodeDepositCallbackContextp->marpaESLIFJSONDecodeContextp->marpaESLIFJSONDecodeOptionp->disallowDupkeysb) {
+      /* Duplicate keys are detected in constant time with an index on the keys of this object */
+      marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp = _marpaESLIFValueResult_table_index_newp(marpaESLIFRecognizerp->marpaESLIFp, dstp);
+      if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp == NULL)) {
+        goto err;
+      }
+    }
   } else {
     if (marpaESLIFJSONDecodeDepositCallbackContextp->keyb) {
+      if (marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp != NULL) {
+        /* Key is checked before it is stored: on failure the caller still owns it */
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_lookupb(marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp, srcp, &pairp))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(pairp != NULL)) {
+          MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Duplicate key at object member No %ld", (unsigned long) (dstp->u.t.sizel + 1));
+          goto err;
+        }
+      }
+
       if (marpaESLIFJSONDecodeDepositCallbackContextp->allocl <= 0) {
         /* First time */
 
         /* It is not a hasard that MARPAESLIF_VALUE_TYPE_UNDEF is 0... */
         if (marpaESLIFRecognizerp->marpaESLIFp->NULLisZeroBytesb && marpaESLIFRecognizerp->marpaESLIFp->ZeroIntegerisZeroBytesb) {
-          dstp->u.t.p = (marpaESLIFValueResultPair_t *) calloc(1, sizeof(marpaESLIFValueResultPair_t));
+          dstp->u.t.p = (marpaESLIFValueResultPair_t *) MARPAESLIF_CALLOC(marpaESLIFRecognizerp->marpaESLIFp, 1, sizeof(marpaESLIFValueResultPair_t));
           if (MARPAESLIF_UNLIKELY(dstp->u.t.p == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "calloc failure, %s", strerror(errno));
             goto err;
           }
         } else {
-          dstp->u.t.p = (marpaESLIFValueResultPair_t *) malloc(sizeof(marpaESLIFValueResultPair_t));
+          dstp->u.t.p = (marpaESLIFValueResultPair_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIFValueResultPair_t));
           if (MARPAESLIF_UNLIKELY(dstp->u.t.p == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "calloc failure, %s", strerror(errno));
             goto err;
@@ -1901,7 +2197,7 @@ static short _marpaESLIFJSONDecodeSetHashCallbackv(marpaESLIFRecognizer_t *marpa
             MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "size_t turnaround when computing nextAllocl");
             goto err;
           }
-          marpaESLIFValueResultPairTmpp = (marpaESLIFValueResultPair_t *) realloc(dstp->u.t.p, nextAllocl * sizeof(marpaESLIFValueResultPair_t));
+          marpaESLIFValueResultPairTmpp = (marpaESLIFValueResultPair_t *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, dstp->u.t.p, nextAllocl * sizeof(marpaESLIFValueResultPair_t));
           if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultPairTmpp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
             goto err;
@@ -1928,6 +2224,14 @@ static short _marpaESLIFJSONDecodeSetHashCallbackv(marpaESLIFRecognizer_t *marpa
       MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Setting key of type %s at array indice %ld", _marpaESLIF_value_types(srcp->type), (unsigned long) (dstp->u.t.sizel - 1));
       dstp->u.t.p[dstp->u.t.sizel - 1].key = *srcp;
       marpaESLIFJSONDecodeDepositCallbackContextp->keyb = 0;
+
+      if (marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp != NULL) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_addb(marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp, dstp->u.t.sizel - 1))) {
+          /* Give back the key to the caller */
+          dstp->u.t.p[dstp->u.t.sizel - 1].key = marpaESLIFValueResultUndef;
+          goto err;
+        }
+      }
     } else {
       MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Setting value of type %s at array indice %ld", _marpaESLIF_value_types(srcp->type), (unsigned long) (dstp->u.t.sizel - 1));
       dstp->u.t.p[dstp->u.t.sizel - 1].value = *srcp;
@@ -1952,7 +2256,9 @@ static inline short _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizer_t
 /*****************************************************************************/
 {
   static const char             *funcs = "_marpaESLIFJSONDecodePropagateValueb";
+  marpaESLIFJSONDecodeOption_t  *marpaESLIFJSONDecodeOptionp = marpaESLIFJSONDecodeContextp->marpaESLIFJSONDecodeOptionp;
   marpaESLIFJSONDecodeDeposit_t  marpaESLIFJSONDecodeDeposit;
+  size_t                         depthl;
   short                          rcb;
 
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
@@ -1962,8 +2268,25 @@ static inline short _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizer_t
     goto err;
   }
 
-  if (MARPAESLIF_UNLIKELY(! marpaESLIFJSONDecodeDeposit.actionp(marpaESLIFRecognizerp, marpaESLIFJSONDecodeDeposit.contextp, marpaESLIFJSONDecodeDeposit.dstp, marpaESLIFValueresultp))) {
-    goto err;
+  /* The top-level deposit is at indice 0 of the deposit stack */
+  depthl = (size_t) (GENERICSTACK_USED(marpaESLIFJSONDecodeContextp->depositStackp) - 1);
+  if (depthl <= 0) {
+    marpaESLIFJSONDecodeContextp->documentb = 1;
+  }
+
+  /* An object key always goes to its container */
+  if ((marpaESLIFJSONDecodeOptionp->valueCallbackp != NULL)
+      &&
+      (depthl == marpaESLIFJSONDecodeOptionp->valueDepthl)
+      &&
+      ((marpaESLIFJSONDecodeDeposit.actionp != _marpaESLIFJSONDecodeSetHashCallbackv) || (! marpaESLIFJSONDecodeDeposit.contextp->keyb))) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeValueCallbackb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, &marpaESLIFJSONDecodeDeposit, marpaESLIFValueresultp))) {
+      goto err;
+    }
+  } else {
+    if (MARPAESLIF_UNLIKELY(! marpaESLIFJSONDecodeDeposit.actionp(marpaESLIFRecognizerp, marpaESLIFJSONDecodeDeposit.contextp, marpaESLIFJSONDecodeDeposit.dstp, marpaESLIFValueresultp))) {
+      goto err;
+    }
   }
 
   /* Re-initialise the source */
@@ -1981,27 +2304,42 @@ static inline short _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizer_t
 }
 
 /*****************************************************************************/
-static short _marpaESLIFJSONDecodeValueResultInternalImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+static inline short _marpaESLIFJSONDecodeValueCallbackb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp, marpaESLIFValueResult_t *marpaESLIFValueresultp)
 /*****************************************************************************/
-/* Internal importer used for marpaESLIFRecognizer_symbol_tryb               */
+/* Gives a completed value to the user instead of storing it: the caller     */
+/* still owns it on failure.                                                 */
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONDecodeValueResultImportb";
-  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
-  short                          rcb;
+  static const char           *funcs = "_marpaESLIFJSONDecodeValueCallbackb";
+  marpaESLIFValueResult_t     *dstp  = depositp->dstp;
+  marpaESLIFValueResult_t     *keyp  = NULL;
+  short                        rcb;
 
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
-  /* We expect a marpaESLIFValueResult_t of type ARRAY and nothing else because by definition the recognizer is a top-level recognizer */
-  if (marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_ARRAY) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFValueResultp->type is not ARRAY (got %d, %s)",
-                      marpaESLIFValueResultp->type,
-                      _marpaESLIF_value_types(marpaESLIFValueResultp->type));
+  if (depositp->actionp == _marpaESLIFJSONDecodeSetHashCallbackv) {
+    /* The key is already in the object */
+    keyp = &(dstp->u.t.p[dstp->u.t.sizel - 1].key);
+  }
+
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Calling value callback on value of type %s", _marpaESLIF_value_types(marpaESLIFValueresultp->type));
+  if (MARPAESLIF_UNLIKELY(! marpaESLIFJSONDecodeContextp->marpaESLIFJSONDecodeOptionp->valueCallbackp(marpaESLIFJSONDecodeContextp->marpaESLIFRecognizerOptionp->userDatavp, keyp, marpaESLIFValueresultp))) {
+    MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "Value callback failure");
     goto err;
   }
 
-  marpaESLIFJSONDecodeContextp->import = *marpaESLIFValueResultp;
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, marpaESLIFValueresultp, 1 /* deepb */))) {
+    goto err;
+  }
+  *marpaESLIFValueresultp = marpaESLIFValueResultUndef;
+
+  if (keyp != NULL) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeDropKeyb(marpaESLIFRecognizerp, depositp))) {
+      goto err;
+    }
+  }
+
   rcb = 1;
   goto done;
 
@@ -2015,188 +2353,1164 @@ static short _marpaESLIFJSONDecodeValueResultInternalImportb(marpaESLIFRecognize
 }
 
 /*****************************************************************************/
-static short _marpaESLIFJSONDecodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+static inline short _marpaESLIFJSONDecodeDropKeyb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeDeposit_t *depositp)
+/*****************************************************************************/
+/* The value of the last object member will not be stored: when there is an  */
+/* index on keys the key must remain, else the pair is recycled.             */
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONDecodeValueResultImportb";
-  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
+  static const char       *funcs = "_marpaESLIFJSONDecodeDropKeyb";
+  marpaESLIFValueResult_t *dstp  = depositp->dstp;
+  marpaESLIFValueResult_t *keyp  = &(dstp->u.t.p[dstp->u.t.sizel - 1].key);
+  short                    rcb;
 
-  /* Proxy to user-defined importb */
-  return marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp->importerp(marpaESLIFValuep,
-                                                                         marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp->userDatavp,
-                                                                         marpaESLIFValueResultp,
-                                                                         haveUndefb);
-}
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
-/*****************************************************************************/
-static short _marpaESLIFJSONDecodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp)
-/*****************************************************************************/
-{
-  static const char             *funcs                        = "_marpaESLIFJSONDecodeRepresentationb";
-  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
-  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp;
-  short                          rcb;
+  if (depositp->contextp->tableIndexp == NULL) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, keyp, 1 /* deepb */))) {
+      goto err;
+    }
+    *keyp = marpaESLIFValueResultUndef;
+    dstp->u.t.sizel--;
+  }
+  depositp->contextp->keyb = 1;
 
-  /* Proxy to caller's representation */
-  rcb = marpaESLIFValueResultp->representationp(marpaESLIFValueOptionp->userDatavp,
-                                                marpaESLIFValueResultp,
-                                                inputcpp,
-                                                inputlp,
-                                                encodingasciisp,
-                                                &(marpaESLIFJSONDecodeContextp->representationDisposep),
-                                                stringbp);
+  rcb = 1;
+  goto done;
 
-  *disposeCallbackpp = _marpaESLIFJSONDecodeRepresentationDisposev;
+ err:
+  rcb = 0;
 
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
   return rcb;
 }
 
 /*****************************************************************************/
-static void _marpaESLIFJSONDecodeRepresentationDisposev(void *userDatavp, char *inputcp, size_t inputl, char *encodingasciis)
+static inline short _marpaESLIFJSONDecodePathsb(marpaESLIF_t *marpaESLIFp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp)
+/*****************************************************************************/
+/* Compiles JSON Pointer-like paths (RFC 6901): "" is the whole document,    */
+/* else every reference token is preceded by '/', with "~0" for '~' and "~1" */
+/* for '/'.                                                                  */
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONDecodeRepresentationDisposev";
-  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
-  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp;
+  marpaESLIFJSONDecodeOption_t  *marpaESLIFJSONDecodeOptionp = marpaESLIFJSONDecodeContextp->marpaESLIFJSONDecodeOptionp;
+  size_t                         pathl                       = marpaESLIFJSONDecodeOptionp->pathl;
+  marpaESLIFJSONDecodePath_t    *pathp;
+  marpaESLIFJSONDecodeSegment_t *segmentp;
+  char                          *paths;
+  char                          *p;
+  char                          *q;
+  size_t                         stringl;
+  size_t                         i;
+  size_t                         j;
+  short                          rcb;
 
-  /* Proxy to caller's representation disposer */
-  if (marpaESLIFJSONDecodeContextp->representationDisposep != NULL) {
-    marpaESLIFJSONDecodeContextp->representationDisposep(marpaESLIFValueOptionp->userDatavp,
-                                                         inputcp,
-                                                         inputl,
-                                                         encodingasciis);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeOptionp->pathsp == NULL)) {
+    MARPAESLIF_ERROR(marpaESLIFp, "pathsp is NULL");
+    errno = EINVAL;
+    goto err;
   }
-}
 
-/*****************************************************************************/
-static inline short _marpaESLIFJSONDecodeDepositInitb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp, marpaESLIFJSONDecodeDepositCallback_t actionp)
-/*****************************************************************************/
-{
-  static const char                            *funcs = "_marpaESLIFJSONEncodeRepresentationDisposev";
-  marpaESLIFValueResult_t                      *dstp;
-  marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp;
-  short                                         rcb;
+  marpaESLIFJSONDecodeContextp->pathp = (marpaESLIFJSONDecodePath_t *) MARPAESLIF_CALLOC(marpaESLIFp, pathl, sizeof(marpaESLIFJSONDecodePath_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeContextp->pathp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
+    goto err;
+  }
+  marpaESLIFJSONDecodeContextp->pathl = pathl;
 
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
-  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+  marpaESLIFJSONDecodeContextp->selectionp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, pathl);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeContextp->selectionp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+
+  for (i = 0; i < pathl; i++) {
+    pathp = &(marpaESLIFJSONDecodeContextp->pathp[i]);
+    paths = marpaESLIFJSONDecodeOptionp->pathsp[i];
+    if (MARPAESLIF_UNLIKELY(paths == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Path No %ld is NULL", (unsigned long) i);
+      errno = EINVAL;
+      goto err;
+    }
+    if (MARPAESLIF_UNLIKELY((*paths != '\0') && (*paths != '/'))) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Path \"%s\" does not start with '/'", paths);
+      errno = EINVAL;
+      goto err;
+    }
+
+    stringl = 0;
+    for (p = paths; *p != '\0'; p++) {
+      if (*p == '/') {
+        pathp->segmentl++;
+      }
+      stringl++;
+    }
+    if (pathp->segmentl <= 0) {
+      continue;
+    }
+
+    /* Unescaped reference tokens are never longer than the path */
+    pathp->segmentp = (marpaESLIFJSONDecodeSegment_t *) MARPAESLIF_MALLOC(marpaESLIFp, (pathp->segmentl * sizeof(marpaESLIFJSONDecodeSegment_t)) + stringl);
+    if (MARPAESLIF_UNLIKELY(pathp->segmentp == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+      goto err;
+    }
+
+    q = (char *) &(pathp->segmentp[pathp->segmentl]);
+    p = paths;
+    for (j = 0; j < pathp->segmentl; j++) {
+      segmentp = &(pathp->segmentp[j]);
+      segmentp->p      = q;
+      segmentp->indexb = 1;
+      segmentp->indexl = 0;
+      /* Skip the '/' */
+      for (p++; (*p != '\0') && (*p != '/'); p++) {
+        if (*p == '~') {
+          switch (*++p) {
+          case '0':
+            *q = '~';
+            break;
+          case '1':
+            *q = '/';
+            break;
+          default:
+            MARPAESLIF_ERRORF(marpaESLIFp, "Path \"%s\" has an invalid escape sequence", paths);
+            errno = EINVAL;
+            goto err;
+          }
+        } else {
+          *q = *p;
+        }
+        if ((*q >= '0') && (*q <= '9')) {
+          segmentp->indexl = (segmentp->indexl * 10) + (*q - '0');
+        } else {
+          segmentp->indexb = 0;
+        }
+        q++;
+      }
+      segmentp->l         = q - segmentp->p;
+      segmentp->wildcardb = ((segmentp->l == 1) && (segmentp->p[0] == '*'));
+      /* Per RFC 6901, an array index has no leading zero */
+      if ((segmentp->l <= 0) || ((segmentp->l > 1) && (segmentp->p[0] == '0'))) {
+        segmentp->indexb = 0;
+      }
+    }
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFJSONDecodePathsFreev(marpaESLIF_t *marpaESLIFp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp)
+/*****************************************************************************/
+{
+  size_t i;
+
+  if (marpaESLIFJSONDecodeContextp->pathp != NULL) {
+    for (i = 0; i < marpaESLIFJSONDecodeContextp->pathl; i++) {
+      if (marpaESLIFJSONDecodeContextp->pathp[i].segmentp != NULL) {
+        MARPAESLIF_FREE(marpaESLIFp, marpaESLIFJSONDecodeContextp->pathp[i].segmentp);
+      }
+    }
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFJSONDecodeContextp->pathp);
+  }
+  if (marpaESLIFJSONDecodeContextp->selectionp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFJSONDecodeContextp->selectionp);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONDecodeProjectb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, short containerb, short *skipbp)
+/*****************************************************************************/
+/* Called when a string, a constant, a number or a container starts, outside */
+/* of any skipped container. Says if it is skipped, and if not prepares the  */
+/* selection of a container in marpaESLIFJSONDecodeContextp->nextSelectionp. */
+/*****************************************************************************/
+{
+  static const char                            *funcs        = "_marpaESLIFJSONDecodeProjectb";
+  marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp;
+  marpaESLIFJSONDecodeDeposit_t                 marpaESLIFJSONDecodeDeposit;
+  marpaESLIFJSONDecodePath_t                   *pathp;
+  marpaESLIFJSONDecodeSegment_t                *segmentp;
+  marpaESLIFValueResult_t                      *keyp         = NULL;
+  size_t                                        indexl       = 0;
+  size_t                                        depthl;
+  size_t                                        selectedl;
+  short                                         allb;
+  short                                         matchb;
+  size_t                                        i;
+  short                                         rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeDepositStackGetLastb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, &marpaESLIFJSONDecodeDeposit))) {
+    goto err;
+  }
+  marpaESLIFJSONDecodeDepositCallbackContextp = marpaESLIFJSONDecodeDeposit.contextp;
+
+  *skipbp = 0;
+  marpaESLIFJSONDecodeContextp->nextSelectionp = NULL;
+
+  if (marpaESLIFJSONDecodeDepositCallbackContextp->selectionp == NULL) {
+    /* Everything is selected */
+    goto ok;
+  }
+
+  if (marpaESLIFJSONDecodeDeposit.actionp == _marpaESLIFJSONDecodeSetValueCallbackv) {
+    /* The top-level value is always kept and has the selection of the document */
+    memcpy(marpaESLIFJSONDecodeContextp->selectionp, marpaESLIFJSONDecodeDepositCallbackContextp->selectionp, marpaESLIFJSONDecodeContextp->pathl);
+    marpaESLIFJSONDecodeContextp->nextSelectionp = marpaESLIFJSONDecodeContextp->selectionp;
+    goto ok;
+  }
+
+  if (marpaESLIFJSONDecodeDeposit.actionp == _marpaESLIFJSONDecodeSetHashCallbackv) {
+    if (marpaESLIFJSONDecodeDepositCallbackContextp->keyb) {
+      /* Keys are always decoded, they are needed to match the paths */
+      goto ok;
+    }
+    keyp = &(marpaESLIFJSONDecodeDeposit.dstp->u.t.p[marpaESLIFJSONDecodeDeposit.dstp->u.t.sizel - 1].key);
+  } else {
+    indexl = marpaESLIFJSONDecodeDepositCallbackContextp->indexl++;
+  }
+
+  /* The first container is at indice 1 in the deposit stack and at depth 0 */
+  depthl    = (size_t) (GENERICSTACK_USED(marpaESLIFJSONDecodeContextp->depositStackp) - 2);
+  selectedl = 0;
+  allb      = 0;
+  for (i = 0; i < marpaESLIFJSONDecodeContextp->pathl; i++) {
+    marpaESLIFJSONDecodeContextp->selectionp[i] = 0;
+    if (! marpaESLIFJSONDecodeDepositCallbackContextp->selectionp[i]) {
+      continue;
+    }
+    pathp = &(marpaESLIFJSONDecodeContextp->pathp[i]);
+    if (pathp->segmentl <= depthl) {
+      continue;
+    }
+    segmentp = &(pathp->segmentp[depthl]);
+    if (segmentp->wildcardb) {
+      matchb = 1;
+    } else if (keyp != NULL) {
+      matchb = (keyp->type == MARPAESLIF_VALUE_TYPE_STRING) && (keyp->u.s.sizel == segmentp->l) && (memcmp(keyp->u.s.p, segmentp->p, segmentp->l) == 0);
+    } else {
+      matchb = segmentp->indexb && (segmentp->indexl == indexl);
+    }
+    if (matchb) {
+      marpaESLIFJSONDecodeContextp->selectionp[i] = 1;
+      selectedl++;
+      if (pathp->segmentl == (depthl + 1)) {
+        allb = 1;
+      }
+    }
+  }
+
+  if (allb) {
+    /* A path ends here: all the value is selected */
+    goto ok;
+  }
+
+  /* Paths going deeper select nothing in a string, a constant or a number */
+  if ((selectedl <= 0) || (! containerb)) {
+    MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "Value is skipped");
+    if (keyp != NULL) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeDropKeyb(marpaESLIFRecognizerp, &marpaESLIFJSONDecodeDeposit))) {
+        goto err;
+      }
+    }
+    *skipbp = 1;
+    goto ok;
+  }
+
+  marpaESLIFJSONDecodeContextp->nextSelectionp = marpaESLIFJSONDecodeContextp->selectionp;
+
+ ok:
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONDecodeSkipOpeningb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, short *skipbp)
+/*****************************************************************************/
+{
+  short skipb;
+
+  if (marpaESLIFJSONDecodeContextp->pathl <= 0) {
+    skipb = 0;
+  } else if (marpaESLIFJSONDecodeContextp->skipl > 0) {
+    skipb = 1;
+  } else if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeProjectb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, 1 /* containerb */, &skipb))) {
+    return 0;
+  }
+
+  if (skipb) {
+    /* Maximum depth applies to skipped containers as well */
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodeIncb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp))) {
+      return 0;
+    }
+    marpaESLIFJSONDecodeContextp->skipl++;
+  }
+
+  *skipbp = skipb;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONDecodeSkipScalarb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp)
+/*****************************************************************************/
+{
+  if (marpaESLIFJSONDecodeContextp->pathl <= 0) {
+    return 1;
+  }
+  if (marpaESLIFJSONDecodeContextp->skipl > 0) {
+    marpaESLIFJSONDecodeContextp->skipb = 1;
+    return 1;
+  }
+
+  return _marpaESLIFJSONDecodeProjectb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, 0 /* containerb */, &(marpaESLIFJSONDecodeContextp->skipb));
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONDecodeImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+/* Gives a top-level value to the end-user importer, using a fake valuation  */
+/*****************************************************************************/
+{
+  static const char       *funcs                  = "_marpaESLIFJSONDecodeImportb";
+  marpaESLIFValueOption_t *marpaESLIFValueOptionp = marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp;
+  marpaESLIFValue_t       *marpaESLIFValuep       = NULL;
+  marpaESLIFValueOption_t  marpaESLIFValueOption;
+  short                    rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  marpaESLIFValueOption                           = *marpaESLIFValueOptionp;
+  marpaESLIFValueOption.userDatavp                = marpaESLIFJSONDecodeContextp;
+  marpaESLIFValueOption.ruleActionResolverp       = NULL;
+  marpaESLIFValueOption.symbolActionResolverp     = NULL;
+  marpaESLIFValueOption.importerp                 = (marpaESLIFValueOptionp->importerp != NULL) ? _marpaESLIFJSONDecodeValueResultImportb : NULL;
+  marpaESLIFValueOption.highRankOnlyb             = 1; /* Fixed */
+  marpaESLIFValueOption.orderByRankb              = 1; /* Fixed */
+  marpaESLIFValueOption.ambiguousb                = 0; /* Fixed */
+  marpaESLIFValueOption.nullb                     = 0; /* Fixed */
+  marpaESLIFValueOption.maxParsesi                = 0; /* Fixed */
+
+  marpaESLIFValuep = _marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption, 0 /* silentb */, 1 /* fakeb */, 0 /* directTransferb */);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep == NULL)) {
+    goto err;
+  }
+
+  /* Set-up proxy representation */
+  marpaESLIFValuep->proxyRepresentationp = _marpaESLIFJSONDecodeRepresentationb;
+
+  /* Call for import (no-op if end-user has set no importer */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_importb(marpaESLIFValuep, marpaESLIFValueResultp))) {
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (marpaESLIFValuep != NULL) {
+    marpaESLIFValue_freev(marpaESLIFValuep);
+  }
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static short _marpaESLIFJSONDecodeValueResultInternalImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/*****************************************************************************/
+/* Internal importer used for marpaESLIFRecognizer_symbol_tryb               */
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONDecodeValueResultImportb";
+  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
+  short                          rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  /* We expect a marpaESLIFValueResult_t of type ARRAY and nothing else because by definition the recognizer is a top-level recognizer */
+  if (marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_ARRAY) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFValueResultp->type is not ARRAY (got %d, %s)",
+                      marpaESLIFValueResultp->type,
+                      _marpaESLIF_value_types(marpaESLIFValueResultp->type));
+    goto err;
+  }
+
+  marpaESLIFJSONDecodeContextp->import = *marpaESLIFValueResultp;
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static short _marpaESLIFJSONDecodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONDecodeValueResultImportb";
+  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
+
+  /* Proxy to user-defined importb */
+  return marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp->importerp(marpaESLIFValuep,
+                                                                         marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp->userDatavp,
+                                                                         marpaESLIFValueResultp,
+                                                                         haveUndefb);
+}
+
+/*****************************************************************************/
+static short _marpaESLIFJSONDecodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONDecodeRepresentationb";
+  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
+  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp;
+  short                          rcb;
+
+  /* Proxy to caller's representation */
+  rcb = marpaESLIFValueResultp->representationp(marpaESLIFValueOptionp->userDatavp,
+                                                marpaESLIFValueResultp,
+                                                inputcpp,
+                                                inputlp,
+                                                encodingasciisp,
+                                                &(marpaESLIFJSONDecodeContextp->representationDisposep),
+                                                stringbp);
+
+  *disposeCallbackpp = _marpaESLIFJSONDecodeRepresentationDisposev;
+
+  return rcb;
+}
+
+/*****************************************************************************/
+static void _marpaESLIFJSONDecodeRepresentationDisposev(void *userDatavp, char *inputcp, size_t inputl, char *encodingasciis)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONDecodeRepresentationDisposev";
+  marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp = (marpaESLIFJSONDecodeContext_t *) userDatavp;
+  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONDecodeContextp->marpaESLIFValueOptionp;
+
+  /* Proxy to caller's representation disposer */
+  if (marpaESLIFJSONDecodeContextp->representationDisposep != NULL) {
+    marpaESLIFJSONDecodeContextp->representationDisposep(marpaESLIFValueOptionp->userDatavp,
+                                                         inputcp,
+                                                         inputl,
+                                                         encodingasciis);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONDecodeDepositInitb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp, marpaESLIFJSONDecodeDepositCallback_t actionp)
+/*****************************************************************************/
+{
+  static const char                            *funcs = "_marpaESLIFJSONEncodeRepresentationDisposev";
+  marpaESLIFValueResult_t                      *dstp;
+  marpaESLIFJSONDecodeDepositCallbackContext_t *marpaESLIFJSONDecodeDepositCallbackContextp;
+  short                                         rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  dstp = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIFValueResult_t));
+  if (MARPAESLIF_UNLIKELY(dstp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  *dstp = marpaESLIFValueResultUndef;
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Allocated destination dstp to %p, initialized to UNDEF", dstp);
+
+  marpaESLIFJSONDecodeDepositCallbackContextp = (marpaESLIFJSONDecodeDepositCallbackContext_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIFJSONDecodeDepositCallbackContext_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDepositCallbackContextp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Allocated callback context to %p", marpaESLIFJSONDecodeDepositCallbackContextp);
+
+  marpaESLIFJSONDecodeDepositCallbackContextp->marpaESLIFJSONDecodeContextp = marpaESLIFJSONDecodeContextp;
+  marpaESLIFJSONDecodeDepositCallbackContextp->keyb                         = 1;
+  marpaESLIFJSONDecodeDepositCallbackContextp->allocl                       = 0;
+  marpaESLIFJSONDecodeDepositCallbackContextp->tableIndexp                  = NULL;
+  marpaESLIFJSONDecodeDepositCallbackContextp->selectionp                   = NULL;
+  marpaESLIFJSONDecodeDepositCallbackContextp->indexl                       = 0;
+
+  if (marpaESLIFJSONDecodeContextp->nextSelectionp != NULL) {
+    marpaESLIFJSONDecodeDepositCallbackContextp->selectionp = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFJSONDecodeContextp->pathl);
+    if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDepositCallbackContextp->selectionp == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+      MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFJSONDecodeDepositCallbackContextp);
+      goto err;
+    }
+    memcpy(marpaESLIFJSONDecodeDepositCallbackContextp->selectionp, marpaESLIFJSONDecodeContextp->nextSelectionp, marpaESLIFJSONDecodeContextp->pathl);
+  }
+
+  depositp->dstp             = dstp;
+  depositp->contextp         = marpaESLIFJSONDecodeDepositCallbackContextp;
+  depositp->actionp          = actionp;
+
+  rcb = 1;
+  goto done;
+
+ err:
+  if (dstp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, dstp);
+  }
+  rcb = 0;
+  /* marpaESLIFJSONDecodeDepositCallbackContextp cannot be NULL if we are in err */
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFJSONDecodeDepositDisposev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp)
+/*****************************************************************************/
+{
+  static const char *funcs = "_marpaESLIFJSONDecodeDepositDisposev";
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (depositp->contextp != NULL) {
+    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit context %p", depositp->contextp);
+    _marpaESLIFValueResult_table_index_freev(marpaESLIFRecognizerp->marpaESLIFp, depositp->contextp->tableIndexp);
+    if (depositp->contextp->selectionp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, depositp->contextp->selectionp);
+    }
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, depositp->contextp);
+  }
+  if (depositp->dstp != NULL) {
+    if (depositp->dstp->type != MARPAESLIF_VALUE_TYPE_UNDEF) {
+      MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit dstp %p content", depositp->dstp);
+      _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, depositp->dstp, 1 /* deepb */);
+    }
+    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit dstp %p", depositp->dstp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, depositp->dstp);
+  }
+
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "return");
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+}
+
+/*****************************************************************************/
+static short _marpaESLIFJSONEncodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONEncodeValueResultImportb";
+  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
+
+  /* Proxy to user-defined importb */
+  return marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp->importerp(marpaESLIFValuep,
+                                                                         marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp->userDatavp,
+                                                                         marpaESLIFValueResultp,
+                                                                         haveUndefb);
+}
+
+/*****************************************************************************/
+static short _marpaESLIFJSONEncodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONEncodeRepresentationb";
+  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
+  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp;
+  short                          rcb;
+
+  /* Proxy to caller's representation */
+  rcb = marpaESLIFValueResultp->representationp(marpaESLIFValueOptionp->userDatavp,
+                                                marpaESLIFValueResultp,
+                                                inputcpp,
+                                                inputlp,
+                                                encodingasciisp,
+                                                &(marpaESLIFJSONEncodeContextp->representationDisposep),
+                                                stringbp);
+
+  *disposeCallbackpp = _marpaESLIFJSONEncodeRepresentationDisposev;
+
+  return rcb;
+}
+
+/*****************************************************************************/
+static void _marpaESLIFJSONEncodeRepresentationDisposev(void *userDatavp, char *inputcp, size_t inputl, char *encodingasciis)
+/*****************************************************************************/
+{
+  static const char             *funcs                        = "_marpaESLIFJSONEncodeRepresentationDisposev";
+  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
+  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp;
+
+  /* Proxy to caller's representation disposer */
+  if (marpaESLIFJSONEncodeContextp->representationDisposep != NULL) {
+    marpaESLIFJSONEncodeContextp->representationDisposep(marpaESLIFValueOptionp->userDatavp,
+                                                         inputcp,
+                                                         inputl,
+                                                         encodingasciis);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONEncodeStreamAppendb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l)
+/*****************************************************************************/
+{
+  marpaESLIFJSONEncodeOption_t *marpaESLIFJSONEncodeOptionp = marpaESLIFJSONEncodeStreamp->marpaESLIFJSONEncodeOptionp;
+  marpaESLIF_t                 *marpaESLIFp                 = marpaESLIFJSONEncodeStreamp->marpaESLIFp;
+  size_t                        allocl;
+  char                         *bufferp;
+
+  if (l > (marpaESLIFJSONEncodeStreamp->allocl - marpaESLIFJSONEncodeStreamp->bufferl)) {
+    if (marpaESLIFJSONEncodeOptionp->writerp != NULL) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamFlushb(marpaESLIFJSONEncodeStreamp))) {
+        return 0;
+      }
+      /* Data that would not fit in a chunk goes directly to the writer */
+      if (l >= marpaESLIFJSONEncodeStreamp->allocl) {
+        if (MARPAESLIF_UNLIKELY(! marpaESLIFJSONEncodeOptionp->writerp(marpaESLIFJSONEncodeOptionp->userDatavp, p, l))) {
+          MARPAESLIF_ERROR(marpaESLIFp, "JSON writer failure");
+          return 0;
+        }
+        return 1;
+      }
+    } else {
+      allocl = marpaESLIFJSONEncodeStreamp->allocl;
+      do {
+        if (MARPAESLIF_UNLIKELY((allocl * 2) < allocl)) {
+          MARPAESLIF_ERROR(marpaESLIFp, "size_t turnaround when computing output size");
+          errno = EINVAL;
+          return 0;
+        }
+        allocl *= 2;
+      } while (l > (allocl - marpaESLIFJSONEncodeStreamp->bufferl));
+      bufferp = (char *) MARPAESLIF_REALLOC(marpaESLIFp, marpaESLIFJSONEncodeStreamp->bufferp, allocl);
+      if (MARPAESLIF_UNLIKELY(bufferp == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
+        return 0;
+      }
+      marpaESLIFJSONEncodeStreamp->bufferp = bufferp;
+      marpaESLIFJSONEncodeStreamp->allocl  = allocl;
+    }
+  }
+
+  memcpy(marpaESLIFJSONEncodeStreamp->bufferp + marpaESLIFJSONEncodeStreamp->bufferl, p, l);
+  marpaESLIFJSONEncodeStreamp->bufferl += l;
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONEncodeStreamFlushb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp)
+/*****************************************************************************/
+{
+  marpaESLIFJSONEncodeOption_t *marpaESLIFJSONEncodeOptionp = marpaESLIFJSONEncodeStreamp->marpaESLIFJSONEncodeOptionp;
 
-  dstp = (marpaESLIFValueResult_t *) malloc(sizeof(marpaESLIFValueResult_t));
-  if (MARPAESLIF_UNLIKELY(dstp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
-    goto err;
+  if (marpaESLIFJSONEncodeStreamp->bufferl > 0) {
+    if (MARPAESLIF_UNLIKELY(! marpaESLIFJSONEncodeOptionp->writerp(marpaESLIFJSONEncodeOptionp->userDatavp, marpaESLIFJSONEncodeStreamp->bufferp, marpaESLIFJSONEncodeStreamp->bufferl))) {
+      MARPAESLIF_ERROR(marpaESLIFJSONEncodeStreamp->marpaESLIFp, "JSON writer failure");
+      return 0;
+    }
+    marpaESLIFJSONEncodeStreamp->bufferl = 0;
   }
-  *dstp = marpaESLIFValueResultUndef;
-  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Allocated destination dstp to %p, initialized to UNDEF", dstp);
 
-  marpaESLIFJSONDecodeDepositCallbackContextp = (marpaESLIFJSONDecodeDepositCallbackContext_t *) malloc(sizeof(marpaESLIFJSONDecodeDepositCallbackContext_t));
-  if (MARPAESLIF_UNLIKELY(marpaESLIFJSONDecodeDepositCallbackContextp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
-    goto err;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, MARPAESLIFJSON_ENCODE_INTEGER_T v, short quoteb)
+/*****************************************************************************/
+{
+  char                                     digits[64]; /* Large enough for a 128 bits integer, its sign and the quotes */
+  char                                    *p          = digits + sizeof(digits);
+  unsigned MARPAESLIFJSON_ENCODE_INTEGER_T u          = (v < 0) ? ((unsigned MARPAESLIFJSON_ENCODE_INTEGER_T) 0) - (unsigned MARPAESLIFJSON_ENCODE_INTEGER_T) v : (unsigned MARPAESLIFJSON_ENCODE_INTEGER_T) v;
+
+  if (quoteb) {
+    *--p = '"';
+  }
+  do {
+    *--p = (char) ('0' + (int) (u % 10));
+    u /= 10;
+  } while (u > 0);
+  if (v < 0) {
+    *--p = '-';
+  }
+  if (quoteb) {
+    *--p = '"';
   }
-  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Allocated callback context to %p", marpaESLIFJSONDecodeDepositCallbackContextp);
 
-  marpaESLIFJSONDecodeDepositCallbackContextp->marpaESLIFJSONDecodeContextp = marpaESLIFJSONDecodeContextp;
-  marpaESLIFJSONDecodeDepositCallbackContextp->keyb                         = 1;
-  marpaESLIFJSONDecodeDepositCallbackContextp->allocl                       = 0;
-      
-  depositp->dstp             = dstp;
-  depositp->contextp         = marpaESLIFJSONDecodeDepositCallbackContextp;
-  depositp->actionp          = actionp;
+  return _marpaESLIFJSONEncodeStreamAppendb(marpaESLIFJSONEncodeStreamp, p, (size_t) ((digits + sizeof(digits)) - p));
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONEncodeStreamFloatingb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *floattos, short quoteb)
+/*****************************************************************************/
+/* floattos is the output of marpaESLIF_[ld|d|f]tos(), modified in place     */
+/*****************************************************************************/
+{
+  char  decimalPointc = marpaESLIFJSONEncodeStreamp->marpaESLIFp->decimalPointc;
+  char *decimalPointp;
+
+  if ((decimalPointc != '\0') && (decimalPointc != '.')) {
+    decimalPointp = strchr(floattos, decimalPointc);
+    if (decimalPointp != NULL) {
+      *decimalPointp = '.';
+    }
+  }
+
+  return _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStreamp, floattos, quoteb);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *words, short quoteb)
+/*****************************************************************************/
+{
+  short rcb;
+
+  if (quoteb) {
+    MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '"');
+  }
+  MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, words, strlen(words));
+  if (quoteb) {
+    MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '"');
+  }
 
   rcb = 1;
   goto done;
 
  err:
-  if (dstp != NULL) {
-    free(dstp);
-  }
   rcb = 0;
-  /* marpaESLIFJSONDecodeDepositCallbackContextp cannot be NULL if we are in err */
 
  done:
-  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
   return rcb;
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIFJSONDecodeDepositDisposev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFJSONDecodeContext_t *marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit_t *depositp)
+static inline short _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l, short utf8b)
+/*****************************************************************************/
+/* Same escaping as _marpaESLIFRecognizer_concat_valueResultCallbackb(): the */
+/* characters outside of the printable ASCII range are always escaped. When  */
+/* utf8b is false every byte is a code point.                                */
 /*****************************************************************************/
 {
-  static const char *funcs = "_marpaESLIFJSONDecodeDepositDisposev";
+  static const char    hexdigits[] = "0123456789abcdef";
+  char                *maxp        = p + l;
+  char                *startp      = p;
+  char                 escapes[12];
+  marpaESLIF_uint32_t  codepointi;
+  marpaESLIF_uint32_t  surrogatei;
+  unsigned char        c;
+  int                  lengthi;
+  size_t               escapel;
+  short                rcb;
+
+  MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '"');
+
+  while (p < maxp) {
+    c = (unsigned char) *p;
+    if ((c >= 0x20) && (c < 0x7F) && (c != '"') && (c != '\\')) {
+      p++;
+      continue;
+    }
 
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
-  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+    /* Flush the run of characters that do not need to be escaped */
+    if (p > startp) {
+      MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, startp, p - startp);
+    }
 
-  if (depositp->contextp != NULL) {
-    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit context %p", depositp->contextp);
-    free(depositp->contextp);
-  }
-  if (depositp->dstp != NULL) {
-    if (depositp->dstp->type != MARPAESLIF_VALUE_TYPE_UNDEF) {
-      MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit dstp %p content", depositp->dstp);
-      _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, depositp->dstp, 1 /* deepb */);
+    if (utf8b && (c >= 0x80)) {
+      lengthi = _marpaESLIF_utf82ordi((PCRE2_SPTR8) p, &codepointi, (PCRE2_SPTR8) maxp);
+      if (MARPAESLIF_UNLIKELY(lengthi <= 0)) {
+        MARPAESLIF_ERROR(marpaESLIFJSONEncodeStreamp->marpaESLIFp, "Malformed UTF-8 byte");
+        errno = EINVAL;
+        goto err;
+      }
+    } else {
+      codepointi = (marpaESLIF_uint32_t) c;
+      lengthi = 1;
     }
-    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing deposit dstp %p", depositp->dstp);
-    free(depositp->dstp);
+
+    escapes[0] = '\\';
+    escapel = 2;
+    switch (codepointi) {
+    case 0x08: /* backspace */
+      escapes[1] = 'b';
+      break;
+    case 0x09: /* horizontal tab */
+      escapes[1] = 't';
+      break;
+    case 0x0A: /* newline */
+      escapes[1] = 'n';
+      break;
+    case 0x0C: /* formfeed */
+      escapes[1] = 'f';
+      break;
+    case 0x0D: /* carriage return */
+      escapes[1] = 'r';
+      break;
+    case 0x22: /* quotation mark */
+      escapes[1] = '"';
+      break;
+    case 0x5C: /* reverse solidus */
+      escapes[1] = '\\';
+      break;
+    default:
+      if (codepointi > 0xFFFF) {
+        surrogatei = 0xD7C0 + (codepointi >> 10);
+        codepointi = 0xDC00 + (codepointi & 0x3FF);
+        escapes[1] = 'u';
+        escapes[2] = hexdigits[(surrogatei >> 12) & 0xF];
+        escapes[3] = hexdigits[(surrogatei >>  8) & 0xF];
+        escapes[4] = hexdigits[(surrogatei >>  4) & 0xF];
+        escapes[5] = hexdigits[ surrogatei        & 0xF];
+        escapes[6] = '\\';
+        escapel = 8;
+      }
+      escapes[escapel - 1]  = 'u';
+      escapes[escapel++] = hexdigits[(codepointi >> 12) & 0xF];
+      escapes[escapel++] = hexdigits[(codepointi >>  8) & 0xF];
+      escapes[escapel++] = hexdigits[(codepointi >>  4) & 0xF];
+      escapes[escapel++] = hexdigits[ codepointi        & 0xF];
+      break;
+    }
+    MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, escapes, escapel);
+
+    p += lengthi;
+    startp = p;
   }
 
-  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "return");
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  if (p > startp) {
+    MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, startp, p - startp);
+  }
+
+  MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '"');
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
 }
 
 /*****************************************************************************/
-static short _marpaESLIFJSONEncodeValueResultImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+static inline short _marpaESLIFJSONEncodeStreamStringb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, char *p, size_t l, char *encodingasciis)
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONEncodeValueResultImportb";
-  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
+  marpaESLIF_string_t  string;
+  marpaESLIF_string_t *utf8p = NULL;
+  short                rcb;
+
+  if ((p == NULL) || (l <= 0)) {
+    MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, "\"\"", 2);
+  } else if ((encodingasciis == (char *) MARPAESLIF_UTF8_STRING) || ((encodingasciis != NULL) && (strcmp(encodingasciis, MARPAESLIF_UTF8_STRING) == 0))) {
+    /* No conversion: validation is done while escaping, only a BOM has to be skipped */
+    if ((l >= 3) && ((unsigned char) p[0] == 0xEF) && ((unsigned char) p[1] == 0xBB) && ((unsigned char) p[2] == 0xBF)) {
+      p += 3;
+      l -= 3;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStreamp, p, l, 1 /* utf8b */))) {
+      goto err;
+    }
+  } else {
+    string.bytep          = p;
+    string.bytel          = l;
+    string.encodingasciis = encodingasciis;
+    string.asciis         = NULL;
+    utf8p = _marpaESLIF_string2utf8p(marpaESLIFJSONEncodeStreamp->marpaESLIFp, &string, 0 /* tconvsilentb */);
+    if (MARPAESLIF_UNLIKELY(utf8p == NULL)) {
+      goto err;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStreamp, utf8p->bytep, utf8p->bytel, 1 /* utf8b */))) {
+      goto err;
+    }
+  }
 
-  /* Proxy to user-defined importb */
-  return marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp->importerp(marpaESLIFValuep,
-                                                                         marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp->userDatavp,
-                                                                         marpaESLIFValueResultp,
-                                                                         haveUndefb);
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if ((utf8p != NULL) && (utf8p != &string)) {
+    _marpaESLIF_string_freev(marpaESLIFJSONEncodeStreamp->marpaESLIFp, utf8p, 0 /* onStackb */);
+  }
+  return rcb;
 }
 
 /*****************************************************************************/
-static short _marpaESLIFJSONEncodeRepresentationb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp)
+static inline short _marpaESLIFJSONEncodeStreamRepresentationb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short keyb, short *donebp)
+/*****************************************************************************/
+/* *donebp is set to a true value if the representation was used             */
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONEncodeRepresentationb";
-  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
-  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp;
-  short                          rcb;
+  void                              *userDatavp       = marpaESLIFJSONEncodeStreamp->marpaESLIFJSONEncodeOptionp->userDatavp;
+  char                              *srcs             = NULL;
+  size_t                             srcl             = 0;
+  char                              *encodingasciis   = NULL;
+  marpaESLIFRepresentationDispose_t  disposeCallbackp = NULL;
+  short                              isTrueStringb    = 1; /* Default value is always the safe value */
+  short                              rcb;
 
-  /* Proxy to caller's representation */
-  rcb = marpaESLIFValueResultp->representationp(marpaESLIFValueOptionp->userDatavp,
-                                                marpaESLIFValueResultp,
-                                                inputcpp,
-                                                inputlp,
-                                                encodingasciisp,
-                                                &(marpaESLIFJSONEncodeContextp->representationDisposep),
-                                                stringbp);
+  *donebp = 0;
 
-  *disposeCallbackpp = _marpaESLIFJSONEncodeRepresentationDisposev;
+  if (MARPAESLIF_UNLIKELY(! marpaESLIFValueResultp->representationp(userDatavp, marpaESLIFValueResultp, &srcs, &srcl, &encodingasciis, &disposeCallbackp, &isTrueStringb))) {
+    goto err;
+  }
+
+  if ((srcs != NULL) && (srcl > 0)) {
+    /* isTrueStringb is taken into account only when the original is opaque, i.e. PTR. A key is always a string. */
+    if ((marpaESLIFValueResultp->type == MARPAESLIF_VALUE_TYPE_PTR) && (! isTrueStringb) && (! keyb)) {
+      MARPAESLIFJSON_ENCODE_APPEND(marpaESLIFJSONEncodeStreamp, srcs, srcl);
+    } else if (encodingasciis != NULL) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamStringb(marpaESLIFJSONEncodeStreamp, srcs, srcl, encodingasciis))) {
+        goto err;
+      }
+    } else {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStreamp, srcs, srcl, 0 /* utf8b */))) {
+        goto err;
+      }
+    }
+    *donebp = 1;
+  }
+
+  rcb = 1;
+  goto done;
 
+ err:
+  rcb = 0;
+
+ done:
+  if (disposeCallbackp != NULL) {
+    disposeCallbackp(userDatavp, srcs, srcl, encodingasciis);
+  }
   return rcb;
 }
 
+/* Floating point values are formatted like marpaESLIFJSON_encodeb() does */
+#define MARPAESLIFJSON_ENCODE_FLOATING(marpaESLIFJSONEncodeStreamp, type, value, quoteb) do { \
+    char *_floattos;                                                    \
+    short _floatb;                                                      \
+                                                                        \
+    if (MARPAESLIF_ISINF(value)) {                                      \
+      _floatb = _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStreamp, (marpaESLIFJSONEncodeStreamp)->marpaESLIFJSONEncodeOptionp->strictb ? "null" : (((value) < 0) ? "-Infinity" : "+Infinity"), quoteb); \
+    } else if (MARPAESLIF_ISNAN(value)) {                               \
+      _floatb = _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStreamp, (marpaESLIFJSONEncodeStreamp)->marpaESLIFJSONEncodeOptionp->strictb ? "null" : MARPAESLIFJSON_ENCODE_NAN(value), quoteb); \
+    } else {                                                            \
+      _floattos = marpaESLIF_##type##tos((marpaESLIFJSONEncodeStreamp)->marpaESLIFp, value); \
+      if (MARPAESLIF_UNLIKELY(_floattos == NULL)) {                     \
+        goto err;                                                       \
+      }                                                                 \
+      _floatb = _marpaESLIFJSONEncodeStreamFloatingb(marpaESLIFJSONEncodeStreamp, _floattos, quoteb); \
+      MARPAESLIF_FREE((marpaESLIFJSONEncodeStreamp)->marpaESLIFp, _floattos); \
+    }                                                                   \
+    if (MARPAESLIF_UNLIKELY(! _floatb)) {                               \
+      goto err;                                                         \
+    }                                                                   \
+  } while (0)
+
+#ifdef C_SIGNBIT
+#  define MARPAESLIFJSON_ENCODE_NAN(value) ((C_SIGNBIT(value) == 0) ? "+NaN" : "-NaN")
+#else
+   /* No "+" sign, an indication that we really do not know */
+#  define MARPAESLIFJSON_ENCODE_NAN(value) "NaN"
+#endif
+
 /*****************************************************************************/
-static void _marpaESLIFJSONEncodeRepresentationDisposev(void *userDatavp, char *inputcp, size_t inputl, char *encodingasciis)
+static inline short _marpaESLIFJSONEncodeStreamValueb(marpaESLIFJSONEncodeStream_t *marpaESLIFJSONEncodeStreamp, genericStack_t *todoStackp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short keyb)
+/*****************************************************************************/
+/* Containers push their items, in reverse order, and their punctuations.    */
 /*****************************************************************************/
 {
-  static const char             *funcs                        = "_marpaESLIFJSONEncodeRepresentationDisposev";
-  marpaESLIFJSONEncodeContext_t *marpaESLIFJSONEncodeContextp = (marpaESLIFJSONEncodeContext_t *) userDatavp;
-  marpaESLIFValueOption_t       *marpaESLIFValueOptionp       = marpaESLIFJSONEncodeContextp->marpaESLIFValueOptionp;
+  static const char *funcs       = "_marpaESLIFJSONEncodeStreamValueb";
+  marpaESLIF_t      *marpaESLIFp = marpaESLIFJSONEncodeStreamp->marpaESLIFp;
+  short              doneb;
+  size_t             i;
+  short              rcb;
 
-  /* Proxy to caller's representation disposer */
-  if (marpaESLIFJSONEncodeContextp->representationDisposep != NULL) {
-    marpaESLIFJSONEncodeContextp->representationDisposep(marpaESLIFValueOptionp->userDatavp,
-                                                         inputcp,
-                                                         inputl,
-                                                         encodingasciis);
+  if (marpaESLIFValueResultp->representationp != NULL) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamRepresentationb(marpaESLIFJSONEncodeStreamp, marpaESLIFValueResultp, keyb, &doneb))) {
+      goto err;
+    }
+    if (doneb) {
+      goto ok;
+    }
+  }
+
+  switch (marpaESLIFValueResultp->type) {
+  case MARPAESLIF_VALUE_TYPE_UNDEF:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStreamp, "null", keyb))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_CHAR:
+    if (keyb) {
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStreamp, &(marpaESLIFValueResultp->u.c), 1, 0 /* utf8b */))) {
+        goto err;
+      }
+    } else {
+      MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, marpaESLIFValueResultp->u.c);
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_SHORT:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) marpaESLIFValueResultp->u.b, keyb))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_INT:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) marpaESLIFValueResultp->u.i, keyb))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_LONG:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) marpaESLIFValueResultp->u.l, keyb))) {
+      goto err;
+    }
+    break;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+  case MARPAESLIF_VALUE_TYPE_LONG_LONG:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) marpaESLIFValueResultp->u.ll, keyb))) {
+      goto err;
+    }
+    break;
+#endif
+  case MARPAESLIF_VALUE_TYPE_FLOAT:
+    MARPAESLIFJSON_ENCODE_FLOATING(marpaESLIFJSONEncodeStreamp, f, marpaESLIFValueResultp->u.f, keyb);
+    break;
+  case MARPAESLIF_VALUE_TYPE_DOUBLE:
+    MARPAESLIFJSON_ENCODE_FLOATING(marpaESLIFJSONEncodeStreamp, d, marpaESLIFValueResultp->u.d, keyb);
+    break;
+  case MARPAESLIF_VALUE_TYPE_LONG_DOUBLE:
+    MARPAESLIFJSON_ENCODE_FLOATING(marpaESLIFJSONEncodeStreamp, ld, marpaESLIFValueResultp->u.ld, keyb);
+    break;
+  case MARPAESLIF_VALUE_TYPE_PTR:
+#if SIZEOF_VOID_STAR <= SIZEOF_LONG
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) (long) marpaESLIFValueResultp->u.p.p, keyb))) {
+      goto err;
+    }
+#else
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamIntegerb(marpaESLIFJSONEncodeStreamp, (MARPAESLIFJSON_ENCODE_INTEGER_T) marpaESLIFValueResultp->u.p.p, keyb))) {
+      goto err;
+    }
+#endif
+    break;
+  case MARPAESLIF_VALUE_TYPE_ARRAY:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamBytesb(marpaESLIFJSONEncodeStreamp, marpaESLIFValueResultp->u.a.p, (marpaESLIFValueResultp->u.a.p != NULL) ? marpaESLIFValueResultp->u.a.sizel : 0, 0 /* utf8b */))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_BOOL:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamWordb(marpaESLIFJSONEncodeStreamp, (marpaESLIFValueResultp->u.y == MARPAESLIFVALUERESULTBOOL_TRUE) ? "true" : "false", keyb))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_STRING:
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONEncodeStreamStringb(marpaESLIFJSONEncodeStreamp, (char *) marpaESLIFValueResultp->u.s.p, marpaESLIFValueResultp->u.s.sizel, marpaESLIFValueResultp->u.s.encodingasciis))) {
+      goto err;
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_ROW:
+    MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '[');
+    GENERICSTACK_PUSH_CHAR(todoStackp, ']');
+    if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+      goto err;
+    }
+    for (i = marpaESLIFValueResultp->u.r.sizel; i > 0; i--) {
+      GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultp->u.r.p[i - 1]));
+      if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+        goto err;
+      }
+      if (i > 1) {
+        GENERICSTACK_PUSH_CHAR(todoStackp, ',');
+        if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+          goto err;
+        }
+      }
+    }
+    break;
+  case MARPAESLIF_VALUE_TYPE_TABLE:
+    MARPAESLIFJSON_ENCODE_APPENDC(marpaESLIFJSONEncodeStreamp, '{');
+    GENERICSTACK_PUSH_CHAR(todoStackp, '}');
+    if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+      goto err;
+    }
+    for (i = marpaESLIFValueResultp->u.t.sizel; i > 0; i--) {
+      GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultp->u.t.p[i - 1].value));
+      if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+        goto err;
+      }
+      GENERICSTACK_PUSH_CHAR(todoStackp, ':');
+      if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+        goto err;
+      }
+      GENERICSTACK_PUSH_PTR(todoStackp, &(marpaESLIFValueResultp->u.t.p[i - 1].key));
+      if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+        goto err;
+      }
+      GENERICSTACK_PUSH_CHAR(todoStackp, MARPAESLIFJSON_ENCODE_KEY);
+      if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+        goto err;
+      }
+      if (i > 1) {
+        GENERICSTACK_PUSH_CHAR(todoStackp, ',');
+        if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(todoStackp))) {
+          MARPAESLIF_ERRORF(marpaESLIFp, "todoStackp push failure, %s", strerror(errno));
+          goto err;
+        }
+      }
+    }
+    break;
+  default:
+    MARPAESLIF_ERRORF(marpaESLIFp, "%s: %s type cannot be encoded", funcs, _marpaESLIF_value_types(marpaESLIFValueResultp->type));
+    errno = EINVAL;
+    goto err;
   }
+
+ ok:
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
 }
 
 /*****************************************************************************/
@@ -2268,6 +3582,8 @@ static inline short _marpaESLIFJSONDecodeObjectClosingb(marpaESLIFRecognizer_t *
   }
 
   if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit.dstp))) {
+    /* The container was not given to anybody */
+    _marpaESLIFJSONDecodeDepositDisposev(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, &marpaESLIFJSONDecodeDeposit);
     goto err;
   }
 
@@ -2356,6 +3672,8 @@ static inline short _marpaESLIFJSONDecodeArrayClosingb(marpaESLIFRecognizer_t *m
   }
 
   if (MARPAESLIF_UNLIKELY(! _marpaESLIFJSONDecodePropagateValueb(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, marpaESLIFJSONDecodeDeposit.dstp))) {
+    /* The container was not given to anybody */
+    _marpaESLIFJSONDecodeDepositDisposev(marpaESLIFRecognizerp, marpaESLIFJSONDecodeContextp, &marpaESLIFJSONDecodeDeposit);
     goto err;
   }
 
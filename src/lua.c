@@ -104,6 +104,7 @@
 #undef  FILENAMES
 #define FILENAMES "lua.c" /* For logging */
 
+static void             *_marpaESLIF_lua_allocp(void *userDatavp, void *p, size_t osize, size_t nsize);
 static inline lua_State *_marpaESLIF_lua_grammar_newp(marpaESLIFGrammar_t *marpaESLIFGrammarp);
 static inline lua_State *_marpaESLIF_lua_recognizer_newp(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline lua_State *_marpaESLIF_lua_value_newp(marpaESLIFValue_t *marpaESLIFValuep);
@@ -294,8 +295,9 @@ static inline short      _marpaESLIF_lua_recognizer_function_precompileb(marpaES
     LUA_GC(marpaESLIFp, L, LUA_GCCOLLECT, 0)                            \
   } while (0)
 
+/* Lua states use the allocator of ESLIF, if any */
 #define LUA_NEWSTATE(marpaESLIFp, Lp) do {                              \
-    if (MARPAESLIF_UNLIKELY(luaunpanicL_newstate(Lp))) {                \
+    if (MARPAESLIF_UNLIKELY(((marpaESLIFp)->allocatorp != NULL) ? luaunpanic_newstate(Lp, _marpaESLIF_lua_allocp, (void *) (marpaESLIFp)) : luaunpanicL_newstate(Lp))) { \
       /* No L at this stage */                                          \
       MARPAESLIF_ERROR(marpaESLIFp, "luaL_newstate failure");           \
       errno = ENOSYS;                                                   \
@@ -356,6 +358,24 @@ static inline short      _marpaESLIF_lua_recognizer_function_precompileb(marpaES
     LUA_GC(marpaESLIFp, L, LUA_GCCOLLECT, 0)                            \
   } while (0)
 
+/*****************************************************************************/
+static void *_marpaESLIF_lua_allocp(void *userDatavp, void *p, size_t osize, size_t nsize)
+/*****************************************************************************/
+/* Same semantics as the default allocator of luaL_newstate().               */
+/*****************************************************************************/
+{
+  marpaESLIF_t *marpaESLIFp = (marpaESLIF_t *) userDatavp;
+
+  if (nsize == 0) {
+    if (p != NULL) {
+      MARPAESLIF_FREE(marpaESLIFp, p);
+    }
+    return NULL;
+  }
+
+  return MARPAESLIF_REALLOC(marpaESLIFp, p, nsize);
+}
+
 /*****************************************************************************/
 static inline lua_State *_marpaESLIF_lua_newp(marpaESLIF_t *marpaESLIFp)
 /*****************************************************************************/
@@ -940,7 +960,7 @@ static inline int _marpaESLIF_lua_writeri(marpaESLIF_t *marpaESLIFp, char **luap
 
   if (sz > 0) {
     if (*luaprecompiledpp == NULL) {
-      *luaprecompiledpp = (char *) malloc(sz);
+      *luaprecompiledpp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, sz);
       if (MARPAESLIF_UNLIKELY(*luaprecompiledpp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -948,7 +968,7 @@ static inline int _marpaESLIF_lua_writeri(marpaESLIF_t *marpaESLIFp, char **luap
       q = *luaprecompiledpp;
       *luaprecompiledlp = sz;
     } else {
-      q = (char *) realloc(*luaprecompiledpp, *luaprecompiledlp + sz);
+      q = (char *) MARPAESLIF_REALLOC(marpaESLIFp, *luaprecompiledpp, *luaprecompiledlp + sz);
       if (MARPAESLIF_UNLIKELY(q == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -1997,7 +2017,7 @@ static inline marpaESLIFGrammar_t *_marpaESLIF_lua_grammarp(marpaESLIF_t *marpaE
       + strlen("\n:start :[2]:= <")
       + strlen(starts)
       + strlen(">\n");
-    grammars = (char *) malloc(grammarl + 1);
+    grammars = (char *) MARPAESLIF_MALLOC(marpaESLIFp, grammarl + 1);
     if (MARPAESLIF_UNLIKELY(grammars == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -2020,7 +2040,7 @@ static inline marpaESLIFGrammar_t *_marpaESLIF_lua_grammarp(marpaESLIF_t *marpaE
 
  done:
   if ((grammars != NULL) && (grammars != (char *) luas)) {
-    free(grammars);
+    MARPAESLIF_FREE(marpaESLIFp, grammars);
   }
   return rcp;
 }
@@ -2439,7 +2459,7 @@ static inline short _marpaESLIF_lua_recognizer_push_contextb(marpaESLIFRecognize
   /* --------------------------------------------------------------------------------------------- */
   if (symbolp->pushContextActionp == NULL) {
     /* We initialize the correct action content. */
-    symbolp->pushContextActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    symbolp->pushContextActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(symbolp->pushContextActionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -2471,7 +2491,7 @@ static inline short _marpaESLIF_lua_recognizer_push_contextb(marpaESLIFRecognize
       goto err;
     }
     if ((symbolp->declp != NULL) && (symbolp->declp->sizei > 0)) {
-      parlistWithoutParens = strdup(symbolp->declp->luaparlists);
+      parlistWithoutParens = MARPAESLIF_STRDUP(marpaESLIFp, symbolp->declp->luaparlists);
       if (MARPAESLIF_UNLIKELY(parlistWithoutParens == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -2529,11 +2549,11 @@ static inline short _marpaESLIF_lua_recognizer_push_contextb(marpaESLIFRecognize
 
  done:
   if (marpaESLIF_stringGenerator.s != NULL) {
-    free(marpaESLIF_stringGenerator.s);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);
   }
   GENERICLOGGER_FREE(genericLoggerp);
   if (parlistWithoutParens != NULL) {
-    free(parlistWithoutParens);
+    MARPAESLIF_FREE(marpaESLIFp, parlistWithoutParens);
   }
   return rcb;
 }
@@ -2567,7 +2587,7 @@ static inline short _marpaESLIF_lua_recognizer_pop_contextb(marpaESLIFRecognizer
   /* ---------------------------------------------------------------------------------------------------------------- */
   if (marpaESLIFRecognizerp->popContextActionp == NULL) {
     /* We initialize the correct action content. */
-    marpaESLIFRecognizerp->popContextActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    marpaESLIFRecognizerp->popContextActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->popContextActionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -2581,7 +2601,7 @@ static inline short _marpaESLIF_lua_recognizer_pop_contextb(marpaESLIFRecognizer
     marpaESLIFRecognizerp->popContextActionp->u.luaFunction.luacstripp = NULL; /* Precompiled stripped chunk - not used */
     marpaESLIFRecognizerp->popContextActionp->u.luaFunction.luacstripl = 0;    /* Precompiled stripped chunk length */
 
-    marpaESLIFRecognizerp->popContextActionp->u.luaFunction.actions = strdup(pops);
+    marpaESLIFRecognizerp->popContextActionp->u.luaFunction.actions = MARPAESLIF_STRDUP(marpaESLIFRecognizerp->marpaESLIFp, pops);
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->popContextActionp->u.luaFunction.actions == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -2647,7 +2667,7 @@ static inline short _marpaESLIF_lua_recognizer_get_contextp(marpaESLIFRecognizer
   /* ---------------------------------------------------------------------------------------------------------------- */
   if (marpaESLIFRecognizerp->getContextActionp == NULL) {
     /* We initialize the correct action content. */
-    marpaESLIFRecognizerp->getContextActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    marpaESLIFRecognizerp->getContextActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->getContextActionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -2661,7 +2681,7 @@ static inline short _marpaESLIF_lua_recognizer_get_contextp(marpaESLIFRecognizer
     marpaESLIFRecognizerp->getContextActionp->u.luaFunction.luacstripp = NULL; /* Precompiled stripped chunk - not used */
     marpaESLIFRecognizerp->getContextActionp->u.luaFunction.luacstripl = 0;    /* Precompiled stripped chunk length */
 
-    marpaESLIFRecognizerp->getContextActionp->u.luaFunction.actions = strdup(gets);
+    marpaESLIFRecognizerp->getContextActionp->u.luaFunction.actions = MARPAESLIF_STRDUP(marpaESLIFp, gets);
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->getContextActionp->u.luaFunction.actions == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -2724,7 +2744,7 @@ static inline short _marpaESLIF_lua_recognizer_set_contextb(marpaESLIFRecognizer
   /* ---------------------------------------------------------------------------------------------------------------- */
   if (marpaESLIFRecognizerp->setContextActionp == NULL) {
     /* We initialize the correct action content. */
-    marpaESLIFRecognizerp->setContextActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+    marpaESLIFRecognizerp->setContextActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->setContextActionp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -2738,7 +2758,7 @@ static inline short _marpaESLIF_lua_recognizer_set_contextb(marpaESLIFRecognizer
     marpaESLIFRecognizerp->setContextActionp->u.luaFunction.luacstripp = NULL; /* Precompiled stripped chunk - not used */
     marpaESLIFRecognizerp->setContextActionp->u.luaFunction.luacstripl = 0;    /* Precompiled stripped chunk length */
 
-    marpaESLIFRecognizerp->setContextActionp->u.luaFunction.actions = strdup(sets);
+    marpaESLIFRecognizerp->setContextActionp->u.luaFunction.actions = MARPAESLIF_STRDUP(marpaESLIFp, sets);
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->setContextActionp->u.luaFunction.actions == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
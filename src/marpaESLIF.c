@@ -199,6 +199,55 @@ static const int utf8_table3[] = { 0xff, 0x1f, 0x0f, 0x07, 0x03, 0x01};
 #define MARPAESLIF_MAX_DECIMAL_DIGITS_LONGLONG MARPAESLIF_MAX_DECIMAL_DIGITS_TYPE(long long)
 #endif
 
+/* Number parsing: digits are checked without the locale, and the significant digits are accumulated */
+/* in an unsigned 64 bits integer, where any number of 19 digits fits.                               */
+#define MARPAESLIF_NUMBER_IS_DIGIT(c) (((c) >= '0') && ((c) <= '9'))
+#define MARPAESLIF_NUMBER_DIGITS_MAX   19
+#define MARPAESLIF_NUMBER_EXPONENT_MAX 100000000 /* Saturation of the exponent */
+#define MARPAESLIF_NUMBER_BUFSIZ       128       /* Local copy given to the C library */
+#define MARPAESLIF_NUMBER_PUSH_DIGIT(c) do {                            \
+    if (significantl < MARPAESLIF_NUMBER_DIGITS_MAX) {                  \
+      mantissau = (mantissau * 10) + ((c) - '0');                       \
+      if (mantissau > 0) {                                              \
+        significantl++;                                                 \
+      }                                                                 \
+    } else {                                                            \
+      significantl = MARPAESLIF_NUMBER_DIGITS_MAX + 1;                  \
+    }                                                                   \
+  } while (0)
+
+/* Clinger's fast path: when the mantissa and the power of ten are both exactly representable, */
+/* i.e. mantissa <= 2^MANT_DIG and 5^n < 2^MANT_DIG, a single multiplication or division gives */
+/* the correctly rounded result. This requires that there is no excess precision.              */
+#if defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)
+#  if defined(LDBL_MANT_DIG) && defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD >= 0) && (FLT_EVAL_METHOD <= 2)
+#    if LDBL_MANT_DIG >= 64
+#      define MARPAESLIF_NUMBER_POW10L_MAX    27
+#      define MARPAESLIF_NUMBER_MANTISSAL_MAX (~((marpaESLIF_uint64_t) 0))
+#    elif LDBL_MANT_DIG >= 53
+#      define MARPAESLIF_NUMBER_POW10L_MAX    22
+#      define MARPAESLIF_NUMBER_MANTISSAL_MAX (((marpaESLIF_uint64_t) 1) << LDBL_MANT_DIG)
+#    endif
+#  endif
+#  ifdef MARPAESLIF_NUMBER_POW10L_MAX
+static const long double _marpaESLIF_number_pow10ld[] = {
+  1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+  1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+  1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+#  endif
+#else
+#  if defined(DBL_MANT_DIG) && (DBL_MANT_DIG == 53) && defined(FLT_EVAL_METHOD) && ((FLT_EVAL_METHOD == 0) || (FLT_EVAL_METHOD == 1))
+#    define MARPAESLIF_NUMBER_POW10_MAX    22
+#    define MARPAESLIF_NUMBER_MANTISSA_MAX (((marpaESLIF_uint64_t) 1) << 53)
+static const double _marpaESLIF_number_pow10d[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+  1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+  1e20, 1e21, 1e22
+};
+#  endif
+#endif
+
 #ifndef C_SIGNBIT
 /* Based on npymath/_signbit.c */
 #  ifdef __GNUC__
@@ -306,6 +355,11 @@ static inline int _marpaESLIF_signbit_d(double x)
     )                                                                   \
   )
 
+/* Maximum number of bytes scanned when looking for a regex literal code unit */
+#ifndef MARPAESLIF_CODEUNIT_MAXSCANL
+#define MARPAESLIF_CODEUNIT_MAXSCANL 4096
+#endif
+
 #ifndef MARPAESLIF_VALUEERRORPROGRESSREPORT
 #define MARPAESLIF_VALUEERRORPROGRESSREPORT 0 /* Left in the code, although not needed IMHO */
 #endif
@@ -333,6 +387,11 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
 /* -------------------------------------------------------------------------------------------- */
 #define MARPAESLIF_EVENTTYPE_EXHAUSTED_NAME "'exhausted'"
 
+/* -------------------------------------------------------------------------------------------- */
+/* All event types a recognizer can subscribe to                                                */
+/* -------------------------------------------------------------------------------------------- */
+#define MARPAESLIF_EVENTTYPE_ALL (MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_BEFORE|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD)
+
 /* -------------------------------------------------------------------------------------------- */
 /* Util macros on symbol                                                                        */
 /* -------------------------------------------------------------------------------------------- */
@@ -350,6 +409,10 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
 #define MARPAESLIFRECOGNIZER_IS_TOP(marpaESLIFRecognizerp) ((marpaESLIFRecognizerp)->marpaESLIFRecognizerParentp == NULL)
 #define MARPAESLIFRECOGNIZER_IS_CHILD(marpaESLIFRecognizerp) ((marpaESLIFRecognizerp)->marpaESLIFRecognizerParentp != NULL)
 #define MARPAESLIFRECOGNIZER_IS_INTERACTIVE(marpaESLIFRecognizerp) (MARPAESLIFRECOGNIZER_IS_TOP(marpaESLIFRecognizerp) || (! (marpaESLIFRecognizerp)->noEventb))
+/* Heap storage of a generic stack, its inline storage is part of the structure that embeds it */
+#define MARPAESLIF_GENERICSTACK_HEAPL(stackp) ((((stackp) != NULL) && ((stackp)->heapItems != NULL)) ? ((size_t) (stackp)->heapi * sizeof(genericStackItem_t)) : 0)
+/* Estimated size of a libmarpa Earley item: the item, its first source link and its slot in the Earley set */
+#define MARPAESLIF_EARLEY_ITEM_SIZEL (9 * sizeof(void *))
 #define MARPAESLIFRECOGNIZER_MATCH_TRACE(funcs, marpaESLIFRecognizerp, symbolp, rci, marpaESLIFValueResultp) do { \
     if (rci == MARPAESLIF_MATCH_OK) {                                   \
       MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Match OK for %s", symbolp->descp->asciis); \
@@ -364,6 +427,16 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
 /* -------------------------------------------------------------------------------------------- */
 #define MARPAESLIF_CHUNKED_SIZE_UPPER(size, chunk) ((size) < (chunk)) ? (chunk) : ((1 + ((size) / (chunk))) * (chunk))
 
+/* -------------------------------------------------------------------------------------------- */
+/* Every allocation goes through the allocator of the ESLIF instance. A NULL marpaESLIFp, as    */
+/* well as no allocator, means the C library.                                                   */
+/* -------------------------------------------------------------------------------------------- */
+#define MARPAESLIF_MALLOC(marpaESLIFp, sizel)       _marpaESLIF_mallocp(marpaESLIFp, sizel)
+#define MARPAESLIF_CALLOC(marpaESLIFp, nmemb, sizel) _marpaESLIF_callocp(marpaESLIFp, nmemb, sizel)
+#define MARPAESLIF_REALLOC(marpaESLIFp, p, sizel)   _marpaESLIF_reallocp(marpaESLIFp, p, sizel)
+#define MARPAESLIF_STRDUP(marpaESLIFp, s)           _marpaESLIF_strdupp(marpaESLIFp, s)
+#define MARPAESLIF_FREE(marpaESLIFp, p)             _marpaESLIF_freev(marpaESLIFp, p)
+
 /* -------------------------------------------------------------------------------------------- */
 /* Get a symbol from stack - with an extra check when not in production mode                    */
 /* -------------------------------------------------------------------------------------------- */
@@ -545,7 +618,7 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
       }                                                                 \
     }                                                                   \
     GENERICLOGGER_TRACEF(genericLoggerp, "%s", _floattos);              \
-    free(_floattos);                                                    \
+    MARPAESLIF_FREE(marpaESLIFp, _floattos);                             \
     if (MARPAESLIF_UNLIKELY(! marpaESLIF_stringGeneratorp->okb)) {      \
       goto err;                                                         \
     }                                                                   \
@@ -676,7 +749,7 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
         nTerminall++;                                                     \
       }                                                                 \
       if (nTerminall > 0) {                                               \
-        symbolArraypp = (marpaESLIF_symbol_t **) malloc(sizeof(marpaESLIF_symbol_t *) * nTerminall); \
+        symbolArraypp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t *) * nTerminall); \
         if (MARPAESLIF_UNLIKELY(symbolArraypp == NULL)) {               \
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno)); \
           goto err;                                                     \
@@ -792,7 +865,7 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
             MARPAESLIF_STRING_CREATESHOW(asciishowl, asciishows, "\n"); \
           }                                                             \
           if (_marpaESLIF_stringGenerator.s != NULL) {                  \
-            free(_marpaESLIF_stringGenerator.s);                        \
+            MARPAESLIF_FREE(_marpaESLIFp, _marpaESLIF_stringGenerator.s); \
           }                                                             \
           _marpaESLIF_stringGenerator.s = NULL;                         \
           _marpaESLIF_stringGenerator.okb = 0;                          \
@@ -857,7 +930,7 @@ static marpaESLIFValueResult_t marpaESLIFValueResultLazyWithUndef = {
         MARPAESLIF_STRING_CREATESHOW(asciishowl, asciishows, "\n");     \
       }                                                                 \
       if (_marpaESLIF_stringGenerator.s != NULL) {                      \
-        free(_marpaESLIF_stringGenerator.s);                            \
+        MARPAESLIF_FREE(_marpaESLIFp, _marpaESLIF_stringGenerator.s);    \
       }                                                                 \
       GENERICLOGGER_FREE(_genericLoggerp);                              \
     }                                                                   \
@@ -1298,28 +1371,46 @@ static const char *MARPAESLIF__START = ":start";
 
 /* Please note that EVERY _marpaESLIFRecognizer_xxx() method is logging at start and at return */
 
+static inline void                  *_marpaESLIF_mallocp(marpaESLIF_t *marpaESLIFp, size_t sizel);
+static inline void                  *_marpaESLIF_callocp(marpaESLIF_t *marpaESLIFp, size_t nmemb, size_t sizel);
+static inline void                  *_marpaESLIF_reallocp(marpaESLIF_t *marpaESLIFp, void *p, size_t sizel);
+static inline char                  *_marpaESLIF_strdupp(marpaESLIF_t *marpaESLIFp, const char *s);
+static inline void                   _marpaESLIF_freev(marpaESLIF_t *marpaESLIFp, void *p);
+static        void                  *_marpaESLIF_pcre2_mallocp(size_t sizel, void *userDatavp);
+static        void                   _marpaESLIF_pcre2_freev(void *p, void *userDatavp);
 static inline marpaESLIF_t          *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptionp);
 static inline marpaESLIF_string_t   *_marpaESLIF_string_newp(marpaESLIF_t *marpaESLIFp, char *encodingasciis, char *bytep, size_t bytel);
 static inline marpaESLIF_string_t   *_marpaESLIF_string_clonep(marpaESLIF_t *marpaESLIFp, marpaESLIF_string_t *stringp);
-static inline void                   _marpaESLIF_string_freev(marpaESLIF_string_t *stringp, short onStstackb);
+static inline void                   _marpaESLIF_string_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_string_t *stringp, short onStstackb);
 static inline short                  _marpaESLIF_string_utf8_eqb(marpaESLIF_string_t *string1p, marpaESLIF_string_t *string2p);
 static inline short                  _marpaESLIF_string_eqb(marpaESLIF_string_t *string1p, marpaESLIF_string_t *string2p);
 static inline marpaESLIF_string_t   *_marpaESLIF_string2utf8p(marpaESLIF_t *marpaESLIFp, marpaESLIF_string_t *stringp, short tconvsilentb);
 static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *marpaESLIFp, marpaWrapperGrammar_t *marpaWrapperGrammarp, int eventSeti, char *descEncodings, char *descs, size_t descl, marpaESLIF_terminal_type_t type, char *modifiers, char *utf8s, size_t utf8l, char *testFullMatchs, char *testPartialMatchs, short pseudob, short characterClassb, marpaESLIF_terminal_type_t wantType, short substitutionb);
-static inline void                   _marpaESLIF_terminal_freev(marpaESLIF_terminal_t *terminalp);
+static inline void                   _marpaESLIF_terminal_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp);
+static inline short                  _marpaESLIF_terminal_codeunitb(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp, marpaESLIF_uint32_t allOptionsi, marpaESLIF_uint32_t typeWhati, marpaESLIF_uint32_t codeUnitWhati, short *codeunitbp, unsigned char *codeunits);
+static inline char                  *_marpaESLIF_regexcache_keys(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, size_t *keylp);
+static inline short                  _marpaESLIF_regexcache_getb(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, pcre2_code **patternpp);
+static inline short                  _marpaESLIF_regexcache_setb(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, pcre2_code *patternp);
+static inline short                  _marpaESLIF_regexcache_addb(marpaESLIF_t *marpaESLIFp, char *keys, size_t keyl, uint8_t *serializedp, size_t serializedl);
+static inline short                  _marpaESLIF_regexcache_serialized_validb(uint8_t *serializedp, size_t serializedl);
+static inline short                  _marpaESLIF_regexcache_enableb(marpaESLIF_t *marpaESLIFp);
+static inline void                   _marpaESLIF_regexcache_disablev(marpaESLIF_t *marpaESLIFp);
+static        unsigned long          _marpaESLIF_regexcache_hashl(void *userDatavp, void *keyp);
+static        short                  _marpaESLIF_regexcache_cmpb(void *userDatavp, void *key1p, void *key2p);
+static inline size_t                 _marpaESLIF_substitution_refl(char *patterns, size_t patternl);
 static marpaESLIF_string_t          *_marpaESLIF_terminal_add_substitution_desc_to_terminal_descp(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp, marpaESLIF_terminal_t *substitutionTerminalp);
 
 static inline marpaESLIF_meta_t     *_marpaESLIF_meta_newp(marpaESLIF_t *marpaESLIFp, marpaWrapperGrammar_t *marpaWrapperGrammarp, int eventSeti, char *asciinames, char *descEncodings, char *descs, size_t descl, short lazyb);
-static inline void                   _marpaESLIF_meta_freev(marpaESLIF_meta_t *metap);
+static inline void                   _marpaESLIF_meta_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_meta_t *metap);
 
 static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clonep(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarBootstrapp, marpaESLIF_grammar_bootstrap_t *grammarOrigp);
 static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarBootstrapp, marpaWrapperGrammarOption_t *marpaWrapperGrammarOptionp, int leveli, int symbolStackSizei, int ruleStackSizei, marpaESLIF_string_t *descp);
 static inline short                  _marpaESLIF_grammar_initb(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp, int leveli, marpaESLIFGrammar_t *marpaESLIFGrammarp);
 static inline marpaESLIF_grammar_t  *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaWrapperGrammarOption_t *marpaWrapperGrammarOptionp, int leveli, char *descEncodings, char *descs, size_t descl, marpaESLIF_action_t *defaultSymbolActionp, marpaESLIF_action_t *defaultRuleActionp, marpaESLIF_action_t *defaultEventActionp, marpaESLIF_action_t *defaultRegexActionp, char *defaultEncodings, char *fallbackEncodings);
-static inline void                   _marpaESLIF_grammar_bootstrap_freev(marpaESLIF_grammar_bootstrap_t *grammarp);
-static inline void                   _marpaESLIF_grammar_freev(marpaESLIF_grammar_t *grammarp);
+static inline void                   _marpaESLIF_grammar_bootstrap_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_bootstrap_t *grammarp);
+static inline void                   _marpaESLIF_grammar_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp);
 
-static inline void                   _marpaESLIF_ruleStack_freev(genericStack_t *ruleStackp);
+static inline void                   _marpaESLIF_ruleStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *ruleStackp);
 static inline void                   _marpaESLIFRecognizer_lexemeStack_freev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline void                   _marpaESLIFRecognizer_lexemeStack_resetv(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline short                  _marpaESLIFRecognizer_lexemeStack_i_p_and_sizeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int i, char **pp, size_t *sizelp);
@@ -1330,12 +1421,12 @@ static inline const char            *_marpaESLIF_genericStack_i_types(genericSta
 static inline const char            *_marpaESLIF_value_types(int typei);
 
 static inline marpaESLIF_rule_t     *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp, genericStack_t *symbolStackp, int leveli, marpaWrapperGrammar_t *marpaWrapperGrammarStartp, char *descEncodings, char *descs, size_t descl, int lhsi, size_t nrhsl, int *rhsip, int exceptioni, int ranki, short nullRanksHighb, short sequenceb, int minimumi, int separatori, short properb, marpaESLIF_action_t *actionp, short hideseparatorb, short *skipbp, marpaESLIF_lua_functiondecl_t *declp, marpaESLIF_lua_functioncall_t **callpp, marpaESLIF_lua_functioncall_t *separatorcallp);
-static inline void                   _marpaESLIF_rule_freev(marpaESLIF_rule_t *rulep);
+static inline void                   _marpaESLIF_rule_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_rule_t *rulep);
 
 static inline marpaESLIF_symbol_t   *_marpaESLIF_symbol_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFSymbolOption_t *marpaESLIFSymbolOptionp);
-static inline void                   _marpaESLIF_symbol_freev(marpaESLIF_symbol_t *symbolp);
+static inline void                   _marpaESLIF_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_symbol_t *symbolp);
 
-static inline void                   _marpaESLIF_symbolStack_freev(genericStack_t *symbolStackp);
+static inline void                   _marpaESLIF_symbolStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *symbolStackp);
 
 static inline marpaESLIF_grammar_t  *_marpaESLIF_bootstrap_grammar_L0p(marpaESLIFGrammar_t *marpaESLIFGrammarp, short withLazyb);
 static inline marpaESLIF_grammar_t  *_marpaESLIF_bootstrap_grammar_G1p(marpaESLIFGrammar_t *marpaESLIFGrammarp, short withLazyb);
@@ -1379,10 +1470,11 @@ static const  char                  *_marpaESLIF_utf82printableascii_defaultp =
 static        void                   _marpaESLIF_tconvTraceCallback(void *userDatavp, const char *msgs);
 #endif
 
-static inline char                  *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEncodings, char *fromEncodings, char *srcs, size_t srcl, size_t *dstlp, char **fromEncodingsp, tconv_t *tconvpp, short eofb, char **byteleftsp, size_t *byteleftlp, size_t *byteleftalloclp, short tconvsilentb, char *defaultEncodings, char *fallbackEncodings);
+static inline char                  *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEncodings, char *fromEncodings, char *srcs, size_t srcl, size_t *dstlp, char **fromEncodingsp, tconv_t *tconvpp, short eofb, char **byteleftsp, size_t *byteleftlp, size_t *byteleftalloclp, char **outbufsp, size_t *outbufalloclp, short tconvsilentb, char *defaultEncodings, char *fallbackEncodings);
+static inline short                  _marpaESLIF_utf8_validb(char *srcs, size_t srcl, size_t *validlp);
 
 static inline char                  *_marpaESLIF_utf82printableascii_newp(marpaESLIF_t *marpaESLIFp, char *descs, size_t descl);
-static inline void                   _marpaESLIF_utf82printableascii_freev(char *utf82printableasciip);
+static inline void                   _marpaESLIF_utf82printableascii_freev(marpaESLIF_t *marpaESLIFp, char *utf82printableasciip);
 static        short                  _marpaESLIFReader_grammarReader(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp);
 static inline short                  _marpaESLIFRecognizer_isZeroLengthLexemeExpectedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short *isZeroLengthLexemeExpectedbp);
 static inline short                  _marpaESLIFRecognizer_isDiscardExpectedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short *isDiscardExpectedbp, size_t *fastDiscardlp, marpaESLIF_symbol_t **fastDiscardSymbolpp, marpaESLIFValueResult_t *marpaESLIFValueResultArrayp);
@@ -1400,15 +1492,17 @@ static inline marpaESLIF_symbol_t   *_marpaESLIF_symbol_findp(marpaESLIF_t *marp
 static inline short                  _marpaESLIFRecognizer_fast_alternativeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_alternative_t *alternativep);
 static inline short                  _marpaESLIFRecognizer_alternative_completeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t lengthl);
 static inline short                  __marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_grammar_t *grammarp, marpaESLIF_symbol_t *symbolp, short *matchbp);
-static inline short                  _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, short *matchbp);
-static inline short                  _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **trysp, size_t *trylp);
+static inline short                  _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, short *matchbp);
+static inline short                  _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, char **trysp, size_t *trylp);
+static inline short                  _marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *symbols, int symboli, marpaESLIFEventType_t eventSeti, short onoffb);
+static inline short                  _marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, char **offsetpp, size_t *lengthlp);
 static inline short                  _marpaESLIFRecognizer_discard_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_grammar_t *grammarp, marpaESLIF_symbol_t *symbolp, short *matchbp);
 
 static inline void                   _marpaESLIFRecognizer_alternativeStack_freev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, genericStack_t *alternativeStackSymbolp);
 static inline marpaESLIF_alternative_t *_marpaESLIFRecognizer_alternativeStack_getp(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, genericStack_t *alternativeStackSymbolp, int indicei);
 static inline short                  _marpaESLIFRecognizer_alternative_and_valueb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_alternative_t *alternativep, int valuei);
 static inline short                  _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFEventType_t type, marpaESLIF_symbol_t *symbolp, char *events, char *discardp, size_t discardl, marpaESLIF_internal_event_action_t event_actione);
-static inline short                  _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *lexemes, char **bytesp, size_t *bytelp, marpaESLIF_symbol_data_t **symbolDatapp, short forPauseb, marpaESLIF_symbol_type_t type, short onlyLhsb, short onlyRhsb);
+static inline short                  _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *lexemes, int symboli, char **bytesp, size_t *bytelp, marpaESLIF_symbol_data_t **symbolDatapp, short forPauseb, marpaESLIF_symbol_type_t type, short onlyLhsb, short onlyRhsb);
 static inline short                  _marpaESLIFRecognizer_discard_lastb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **bytesp, size_t *bytelp);
 static inline short                  _marpaESLIFRecognizer_set_symbolDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_grammar_t *grammarp, marpaESLIF_symbol_t *symbolp, char *xsbytes, size_t bytel, marpaESLIF_symbol_data_t **symbolDatapp);
 static inline short                  _marpaESLIFRecognizer_set_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_grammar_t *grammarp, marpaESLIF_symbol_t *symbolp, char *bytes, size_t bytel);
@@ -1420,10 +1514,13 @@ static inline short                  _marpaESLIFRecognizer_value_validb(marpaESL
 static inline short                  __marpaESLIFRecognizer_value_validb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static        short                  _marpaESLIFRecognizer_concat_valueResultCallbackb(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 
-static inline void                   _marpaESLIFRecognizer_sort_eventsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline void                   _marpaESLIFRecognizer_valueResultFreev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp) MARPAESLIF_FUNC_ATTRIBUTE_FLATTEN;
 static inline short                  _marpaESLIFRecognizer_stream_initb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t bufsizl, int buftriggerperci, short eofb, short utfb);
 static inline void                   _marpaESLIF_stream_disposev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
+static inline size_t                  _marpaESLIFRecognizer_memoryl(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
+static inline short                   _marpaESLIFRecognizer_memory_chargeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerTopp, size_t *memorylp, size_t newl, size_t extral);
+static inline short                   _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t extral);
+static inline short                   _marpaESLIFValue_memory_syncb(marpaESLIFValue_t *marpaESLIFValuep, short doneb);
 static inline marpaESLIFRecognizer_t *_marpaESLIFRecognizer_newp(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, short discardb, short noEventb, short silentb);
 static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, short discardb, short noEventb, short silentb, marpaESLIFRecognizer_t *marpaESLIFRecognizerParentp, short fakeb, int maxStartCompletionsi, short utfb, short isLexemeb);
 static inline short                  _marpaESLIFRecognizer_shareb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFRecognizer_t *marpaESLIFRecognizerSharedp);
@@ -1438,18 +1535,27 @@ static        void                   _marpaESLIF_traceLoggerCallbackv(void *user
 static        void                   _marpaESLIFRecognizer_loggerCallbackv(void *userDatavp, genericLoggerLevel_t logLeveli, const char *msgs);
 static inline void                   _marpaESLIF_stringGeneratorInitv(marpaESLIF_t *marpaESLIFp, marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp);
 static inline void                   _marpaESLIF_stringGeneratorResetv(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp);
-static inline void                   _marpaESLIF_stringGeneratorFreev(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, short onStackb);
+static inline void                   _marpaESLIF_stringGeneratorFreev(marpaESLIF_t *marpaESLIFp, marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, short onStackb);
 static inline short                  _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, char *p, size_t sizel);
 static inline short                  _marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **inputsp, size_t *inputlp);
 static inline short                  __marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline short                  _marpaESLIFRecognizer_flush_charconvb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline short                  _marpaESLIFRecognizer_start_charconvb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *encodings, size_t encodingl, char *srcs, size_t srcl, short eofb, char *defaultEncodings, char *fallbackEncodings);
+static inline short                  _marpaESLIFRecognizer_utf8_appendDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *srcs, size_t srcl, short eofb);
 
 /* All wrappers, even the Lexeme and Grammar wrappers go through these routines */
 static        short                  _marpaESLIFValue_ruleCallbackWrapperb(void *userDatavp, int rulei, int arg0i, int argni, int resulti);
-static inline short                  _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueRuleCallback_t *ruleCallbackpp, char *asciishows, marpaESLIF_action_t *actionp, marpaESLIF_internal_rule_action_t rule_actione);
+static inline short                  _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueRuleCallback_t *ruleCallbackpp, char *asciishows, marpaESLIF_action_t *actionp, marpaESLIF_internal_rule_action_t rule_actione, short nullableb, int idi);
+static inline short                  _marpaESLIFValue_resolvedCallbacks_newb(marpaESLIFValue_t *marpaESLIFValuep);
 static        short                  _marpaESLIFValue_symbolCallbackWrapperb(void *userDatavp, int symboli, int argi, int resulti);
 static        short                  _marpaESLIFValue_nullingCallbackWrapperb(void *userDatavp, int symboli, int resulti);
+static inline short                  _marpaESLIFValue_walkb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalkCallback_t walkCallbackp, void *walkUserDatavp);
+static inline short                  _marpaESLIFValue_partition_skipb(marpaESLIFValue_t *marpaESLIFValuep);
+static inline short                  _marpaESLIFValue_walk_nodeb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp);
+static        short                  _marpaESLIFValue_flatast_walkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp);
+static        short                  _marpaESLIFValue_walk_ruleCallbackb(void *userDatavp, int rulei, int arg0i, int argni, int resulti);
+static        short                  _marpaESLIFValue_walk_symbolCallbackb(void *userDatavp, int symboli, int argi, int resulti);
+static        short                  _marpaESLIFValue_walk_nullingCallbackb(void *userDatavp, int symboli, int resulti);
 static inline short                  _marpaESLIFValue_anySymbolCallbackWrapperb(void *userDatavp, int symboli, int argi, int resulti, short nullableb);
 static inline short                  _marpaESLIFValue_symbolActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueSymbolCallback_t *symbolCallbackpp, short nullableb, marpaESLIFValueRuleCallback_t *ruleCallbackpp, marpaESLIF_symbol_t *symbolp);
 static inline short                  _marpaESLIFRecognizer_recognizerIfActionCallbackb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *asciishows, marpaESLIF_action_t *ifActionp, marpaESLIFRecognizerIfCallback_t *ifCallbackpp);
@@ -1464,9 +1570,9 @@ static inline short                  _marpaESLIF_eslif2hostb(marpaESLIF_t *marpa
 static inline short                  _marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static inline short                  __marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 
-static inline void                   _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarp);
-static inline void                   _marpaESLIF_grammarBootstrapStack_freev(genericStack_t *grammarStackp);
-static inline void                   _marpaESLIF_grammarStack_freev(genericStack_t *grammarStackp);
+static inline void                   _marpaESLIFGrammar_bootstrap_freev(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarp);
+static inline void                   _marpaESLIF_grammarBootstrapStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *grammarStackp);
+static inline void                   _marpaESLIF_grammarStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *grammarStackp);
 static inline void                   _marpaESLIFGrammar_freev(marpaESLIFGrammar_t *marpaESLIFGrammarp, short onStackb);
 static        char                  *_marpaESLIFGrammar_symbolDescriptionCallbacks(void *userDatavp, int symboli);
 static        short                  _marpaESLIFGrammar_symbolOptionSetterInitb(void *userDatavp, int symboli, marpaWrapperGrammarSymbolOption_t *marpaWrapperGrammarSymbolOptionp);
@@ -1479,6 +1585,8 @@ static inline void                   _marpaESLIF_grammar_createshowv(marpaESLIFG
 static inline int                    _marpaESLIF_utf82ordi(PCRE2_SPTR8 utf8bytes, marpaESLIF_uint32_t *uint32p, PCRE2_SPTR8 utf8maxexcludedp);
 static inline short                  _marpaESLIFRecognizer_matchPostProcessingb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t matchl);
 static inline short                  _marpaESLIFRecognizer_getNextLineAndColumnb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t matchl);
+static inline void                   _marpaESLIF_stream_locationv(marpaESLIF_stream_t *marpaESLIF_streamp);
+static inline size_t                 _marpaESLIF_stream_offsetl(marpaESLIF_stream_t *marpaESLIF_streamp);
 static inline short                  _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *datas, size_t datal, short eofb);
 static inline short                  _marpaESLIFRecognizer_createDiscardStateb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline short                  _marpaESLIFRecognizer_createBeforeStateb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
@@ -1511,6 +1619,7 @@ static inline void                   _marpaESLIF_generic_freeCallback_inlinev(vo
 static inline marpaESLIFValue_t     *_marpaESLIFValue_newp(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueOption_t *marpaESLIFValueOptionp, short silentb, short fakeb, short isLexemeb);
 static inline short                  _marpaESLIFValue_stack_newb(marpaESLIFValue_t *marpaESLIFValuep);
 static inline short                  _marpaESLIFValue_stack_freeb(marpaESLIFValue_t *marpaESLIFValuep);
+static inline void                   _marpaESLIFValue_stack_disposev(marpaESLIFValue_t *marpaESLIFValuep);
 static inline marpaESLIFValueResult_t *_marpaESLIFRecognizer_context_getp(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *contextp);
 static inline short                  _marpaESLIFValue_stack_setb(marpaESLIFValue_t *marpaESLIFValuep, int indicei, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static inline short                  _marpaESLIFValue_stack_switchb(marpaESLIFValue_t *marpaESLIFValuep, int i, int j);
@@ -1545,33 +1654,56 @@ static        short                  _marpaESLIF_symbol_action___trueb(void *use
 static        short                  _marpaESLIF_symbol_action___falseb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp, int resulti);
 static        short                  _marpaESLIF_symbol_action___jsonb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp, int resulti);
 static        short                  _marpaESLIF_symbol_action___jsonfb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp, int resulti);
-static INLINE_QSORT int              _marpaESLIF_event_sorti(const void *p1, const void *p2);
-static inline int                    _marpaESLIF_event_sort_inlinedi(marpaESLIFEvent_t *p1, marpaESLIFEvent_t *p2);
+static inline int                    _marpaESLIF_event_ranki(marpaESLIFEventType_t type);
 static INLINE_QSORT int              _marpaESLIF_symbol_priority_sorti(const void *p1, const void *p2);
 static inline int                    _marpaESLIF_symbol_priority_sort_inlinedi(marpaESLIF_symbol_t **p1, marpaESLIF_symbol_t **p2);
 static INLINE_QSORT int              _marpaESLIF_cleanup_sorti(const void *p1, const void *p2);
 static inline int                    _marpaESLIF_cleanup_sort_inlinedi(genericStackItem_t *p1, genericStackItem_t *p2);
 static inline unsigned long          _marpaESLIF_djb2_s(unsigned char *str, size_t lengthl);
-static inline int                    _marpaESLIF_inlined_ptrhashi(void *p);
-int                                  _marpaESLIF_ptrhashi(void *userDatavp, genericStackItemType_t itemType, void **pp);
-int                                  _marpaESLIF_string_hash_callbacki(void *userDatavp, genericStackItemType_t itemType, void **pp);
-short                                _marpaESLIF_string_cmp_callbackb(void *userDatavp, void **pp1, void **pp2);
+static inline short                  _marpaESLIFValueResult_table_index_keyb(marpaESLIFValueResult_t *keyp, unsigned long *hashlp);
+static inline short                  _marpaESLIFValueResult_table_index_eqb(marpaESLIFValueResult_t *key1p, marpaESLIFValueResult_t *key2p);
+static inline marpaESLIFValueResultTableIndex_t *_marpaESLIFValueResult_table_index_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
+static inline marpaESLIFValueResult_t *_marpaESLIFValueResult_table_index_resolvep(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, void *keyp);
+static        unsigned long          _marpaESLIFValueResult_table_index_hashl(void *userDatavp, void *keyp);
+static        short                  _marpaESLIFValueResult_table_index_cmpb(void *userDatavp, void *key1p, void *key2p);
+static inline short                  _marpaESLIFValueResult_table_index_lookupb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResultPair_t **pairpp);
+static inline short                  _marpaESLIFValueResult_table_index_addb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, size_t pairl);
+static inline void                   _marpaESLIFValueResult_table_index_freev(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp);
+static inline unsigned long          _marpaESLIF_inlined_ptrhashl(void *p);
+static inline unsigned long          _marpaESLIF_hash_mixl(unsigned long hashl);
+static inline void                   _marpaESLIF_hash_initv(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, void *userDatavp, marpaESLIF_hashFunction_t hashFunctionp, marpaESLIF_hashCmpFunction_t cmpFunctionp, marpaESLIF_hashFreeFunction_t keyFreeFunctionp, marpaESLIF_hashFreeFunction_t valFreeFunctionp);
+static inline marpaESLIF_hashSlot_t *_marpaESLIF_hash_slotp(marpaESLIF_hash_t *hashp, void *keyp, unsigned long hashl);
+static inline short                  _marpaESLIF_hash_findb(marpaESLIF_hash_t *hashp, void *keyp, void **valpp);
+static inline short                  _marpaESLIF_hash_reserveb(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, size_t countl);
+static inline short                  _marpaESLIF_hash_setb(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, void *keyp, void *valp);
+static inline short                  _marpaESLIF_hash_removeb(marpaESLIF_hash_t *hashp, void *keyp);
+static inline void                   _marpaESLIF_hash_resetv(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp);
+static        unsigned long          _marpaESLIF_ptr_hashl(void *userDatavp, void *keyp);
+static        unsigned long          _marpaESLIF_string_hashl(void *userDatavp, void *keyp);
+static        short                  _marpaESLIF_string_cmpb(void *userDatavp, void *key1p, void *key2p);
+static        unsigned long          _marpaESLIF_symbolname_hashl(void *userDatavp, void *keyp);
+static        short                  _marpaESLIF_symbolname_cmpb(void *userDatavp, void *key1p, void *key2p);
 void                                *_marpaESLIF_string_copy_callbackp(void *userDatavp, void **pp);
-void                                 _marpaESLIF_string_free_callbackv(void *userDatavp, void **pp);
-static        void                   _marpaESLIFRecognizerHash_free_callbackv(void *userDatavp, void **pp);
-static        void                   _lexemeGrammarHash_free_callbackv(void *userDatavp, void **pp);
+static        void                   _marpaESLIF_string_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p);
+static        void                   _marpaESLIFRecognizerHash_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p);
+static        void                   _lexemeGrammarHash_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p);
 static inline void                   _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, short forceb);
 static inline short                  _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp, short discardb, short noEventb, short silentb, marpaESLIFRecognizer_t *marpaESLIFRecognizerParentp, short fakeb, marpaESLIFRecognizer_t **marpaESLIFRecognizerpp, short isLexemeb);
 static inline short                   _marpaESLIFRecognizer_getLexemeGrammarFromCachep(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_string_t *utf8p, marpaESLIFGrammar_t **marpaESLIFGrammarCachedpp);
 static inline short                   _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline short                   _marpaESLIFRecognizer_putLexemeGrammarToCacheb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_string_t *utf8p, marpaESLIFGrammar_t *marpaESLIFGrammarCachedp);
+static inline void                    _marpaESLIFGrammar_lexemeGrammar_unlinkv(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_lexemeGrammarEntry_t *entryp);
+static inline void                    _marpaESLIFGrammar_lexemeGrammar_linkv(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_lexemeGrammarEntry_t *entryp);
+static inline short                   _marpaESLIFGrammar_lexemeGrammar_busyb(marpaESLIFGrammar_t *marpaESLIFGrammarp);
+static inline void                    _marpaESLIFGrammar_lexemeGrammar_evictv(marpaESLIFGrammar_t *marpaESLIFGrammarp);
 static inline char                   *_marpaESLIF_action2asciis(marpaESLIF_action_t *actionp);
 static inline short                   _marpaESLIF_action_validb(marpaESLIF_t *marpaESLIFp, marpaESLIF_action_t *actionp);
 static inline short                   _marpaESLIF_action_eqb(marpaESLIF_action_t *action1p, marpaESLIF_action_t *action2p);
 static inline marpaESLIF_action_t    *_marpaESLIF_action_clonep(marpaESLIF_t *marpaESLIFp, marpaESLIF_action_t *actionp);
-static inline void                    _marpaESLIF_action_freev(marpaESLIF_action_t *actionp);
+static inline void                    _marpaESLIF_action_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_action_t *actionp);
 static inline short                   _marpaESLIF_string_removebomb(marpaESLIF_t *marpaESLIFp, char *bytep, size_t *bytelp, char *encodingasciis, size_t *bomsizelp);
 static inline short                   _marpaESLIFRecognizer_pointers_cleanupb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultOrigp, marpaESLIFValueResult_t *marpaESLIFValueResultNewp);
+static inline short                   _marpaESLIFRecognizer_valueResultStacksb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp);
 static inline int                     _marpaESLIFRecognizer_pointers_tracki(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp, genericStack_t *marpaESLIFValueResultStackp);
 static inline marpaESLIFGrammar_t    *_marpaESLIFJSON_decode_newp(marpaESLIF_t *marpaESLIFp, short strictb);
 static inline marpaESLIFGrammar_t    *_marpaESLIFJSON_encode_newp(marpaESLIF_t *marpaESLIFp, short strictb);
@@ -1586,6 +1718,7 @@ static inline marpaESLIF_symbol_t   *_marpaESLIFSymbol_meta_new_by_levelp(marpaE
 static inline marpaESLIFSymbol_t    *__marpaESLIFSymbol_meta_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammar_t *marpaESLIFGrammarp, char *symbols, int leveli, marpaESLIFString_t *descp, marpaESLIFSymbolOption_t *marpaESLIFSymbolOptionp);
 static inline unsigned int           _marpaESLIF_charset_toupperi(marpaESLIF_t *marpaESLIFp, const char c);
 static inline short                  _marpaESLIF_charset_eqb(marpaESLIF_t *marpaESLIFp, const char *s, const char *p, size_t sizel);
+static inline short                  _marpaESLIF_charset_utf8b(marpaESLIF_t *marpaESLIFp, const char *s, size_t sizel);
 static inline char                  *_marpaESLIF_charset_canonicals(marpaESLIF_t *marpaESLIFp, const char *s, const size_t sizel);
 #ifdef MARPAESLIF_NAN
 static inline void                   _marpaESLIF_guessNanv(marpaESLIF_t *marpaESLIFp);
@@ -1600,22 +1733,24 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_newp(m
 static inline marpaESLIF_lua_functiondecl_t *_marpaESLIF_lua_functiondecl_clonep(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functiondecl_t *declp);
 static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_clonep(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functioncall_t *callp);
 static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functiondecl2callp(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functiondecl_t *declp);
-static inline void                   _marpaESLIF_lua_functiondecl_freev(marpaESLIF_lua_functiondecl_t *declp);
-static inline void                   _marpaESLIF_lua_functioncall_freev(marpaESLIF_lua_functioncall_t *callp);
+static inline void                   _marpaESLIF_lua_functiondecl_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functiondecl_t *declp);
+static inline void                   _marpaESLIF_lua_functioncall_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functioncall_t *callp);
 static inline short                  _marpaESLIFRecognizer_eventb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *eventArraylp, marpaESLIFEvent_t **eventArraypp);
-static inline short                  _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *lexemes, char **pausesp, size_t *pauselp);
+static inline short                  _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *lexemes, int symboli, char **pausesp, size_t *pauselp);
 static inline short                  _marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFAlternative_t *marpaESLIFAlternativep, size_t lengthl);
 static inline size_t                 _marpaESLIF_next_power_of_twob(marpaESLIF_t *marpaESLIFp, size_t wantedl);
 static inline short                  _marpaESLIFValue_importb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static inline short                  _marpaESLIFRecognizer_importb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 static inline short                  _marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nNamelp, char ***namesArraypp);
+static inline short                  _marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nSymbollp, int *symbolArrayip, size_t symbolArrayAllocl, size_t *generationlp);
 static inline short                  _marpaESLIFRecognizer_discard_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **trysp, size_t *trylp);
 static inline short                  _marpaESLIFRecognizer_alternativeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFAlternative_t *marpaESLIFAlternativep);
 static inline marpaESLIF_symbol_t   *_marpaESLIFSymbol_string_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFString_t *stringp, char *modifiers, marpaESLIFSymbolOption_t *marpaESLIFSymbolOptionp);
 static inline marpaESLIF_symbol_t   *_marpaESLIFSymbol_regex_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFString_t *stringp, char *modifiers, marpaESLIFString_t *substitutionStringp, char *substitutionModifiers, marpaESLIFSymbolOption_t *marpaESLIFSymbolOptionp);
 static inline short                  _marpaESLIFSymbol_tryb(marpaESLIFSymbol_t *marpaESLIFSymbolp, char *inputs, size_t inputl, short *matchbp);
 static inline short                  _marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp);
-static inline short                 __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp);
+static inline short                 __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp, size_t *matchedLengthlp);
+static inline short                  _marpaESLIFRecognizer_recover_skipb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFRecoveryOption_t *marpaESLIFRecoveryOptionp);
 static        short                  _marpaESLIFRecognizerSymbolProxyImportb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
 
 /*****************************************************************************/
@@ -1629,7 +1764,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_newp(marpaESLIF_t *marpaES
   marpaESLIF_string_t *stringp = NULL;
   char                *dstbytep;
 
-  stringp = (marpaESLIF_string_t *) malloc(sizeof(marpaESLIF_string_t));
+  stringp = (marpaESLIF_string_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_string_t));
   if (MARPAESLIF_UNLIKELY(stringp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -1640,7 +1775,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_newp(marpaESLIF_t *marpaES
 
   if (bytel > 0) {
     /* bytel + 1 for the hiden NUL byte */
-    if (MARPAESLIF_UNLIKELY((stringp->bytep = dstbytep = (char *) calloc(1, bytel + 1)) == NULL)) {
+    if (MARPAESLIF_UNLIKELY((stringp->bytep = dstbytep = (char *) MARPAESLIF_CALLOC(marpaESLIFp, 1, bytel + 1)) == NULL)) {
       /* We always add a NUL byte for convenience */
       MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
       goto err;
@@ -1654,7 +1789,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_newp(marpaESLIF_t *marpaES
 
   if (bytel > 0) {
     /* This will fill stringp->encodingasciis if not already set */
-    if (MARPAESLIF_UNLIKELY((stringp->asciis = _marpaESLIF_charconvb(marpaESLIFp, "ASCII//TRANSLIT//IGNORE", encodingasciis, bytep, bytel, NULL, &(stringp->encodingasciis), NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
+    if (MARPAESLIF_UNLIKELY((stringp->asciis = _marpaESLIF_charconvb(marpaESLIFp, "ASCII//TRANSLIT//IGNORE", encodingasciis, bytep, bytel, NULL, &(stringp->encodingasciis), NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, NULL /* outbufsp */, NULL /* outbufalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
       goto err;
     }
   } else {
@@ -1666,7 +1801,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_newp(marpaESLIF_t *marpaES
         /* Internal variable used to avoid unnecessary strdup() call */
         stringp->encodingasciis = (char *) MARPAESLIF_UTF8_STRING;
       } else {
-        if (MARPAESLIF_UNLIKELY((stringp->encodingasciis = strdup(encodingasciis)) == NULL)) {
+        if (MARPAESLIF_UNLIKELY((stringp->encodingasciis = MARPAESLIF_STRDUP(marpaESLIFp, encodingasciis)) == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
           goto err;
         }
@@ -1677,7 +1812,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_newp(marpaESLIF_t *marpaES
   goto done;
 
  err:
-  _marpaESLIF_string_freev(stringp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, stringp, 0 /* onStackb */);
   stringp = NULL;
 
  done:
@@ -1696,7 +1831,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
     goto err;
   }
 
-  rcp = (marpaESLIF_string_t *) malloc(sizeof(marpaESLIF_string_t));
+  rcp = (marpaESLIF_string_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_string_t));
   if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -1706,7 +1841,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
   rcp->asciis         = NULL;
 
   if ((rcp->bytel = stringp->bytel) > 0) {
-    bytep = rcp->bytep = (char *) calloc(1, (bytel = stringp->bytel) + 1); /* We always add a NUL byte for convenience */
+    bytep = rcp->bytep = (char *) MARPAESLIF_CALLOC(marpaESLIFp, 1, (bytel = stringp->bytel) + 1); /* We always add a NUL byte for convenience */
     if (MARPAESLIF_UNLIKELY(bytep == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
       goto err;
@@ -1720,7 +1855,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
     if (stringp->asciis == MARPAESLIF_EMPTY_STRING) {
       rcp->asciis = (char *) MARPAESLIF_EMPTY_STRING;
     } else {
-      if (MARPAESLIF_UNLIKELY((rcp->asciis = strdup(stringp->asciis)) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((rcp->asciis = MARPAESLIF_STRDUP(marpaESLIFp, stringp->asciis)) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
@@ -1732,7 +1867,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
       /* Internal variable used to avoid unnecesary strdup() call */
       rcp->encodingasciis = (char *) MARPAESLIF_UTF8_STRING;
     } else {
-      if (MARPAESLIF_UNLIKELY((rcp->encodingasciis = strdup(stringp->encodingasciis)) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((rcp->encodingasciis = MARPAESLIF_STRDUP(marpaESLIFp, stringp->encodingasciis)) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
@@ -1742,7 +1877,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
   goto done;
 
  err:
-  _marpaESLIF_string_freev(rcp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, rcp, 0 /* onStackb */);
   rcp = NULL;
 
  done:
@@ -1750,21 +1885,21 @@ static inline marpaESLIF_string_t *_marpaESLIF_string_clonep(marpaESLIF_t *marpa
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_string_freev(marpaESLIF_string_t *stringp, short onStackb)
+static inline void _marpaESLIF_string_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_string_t *stringp, short onStackb)
 /*****************************************************************************/
 {
   if (stringp != NULL) {
     if ((stringp->bytep != NULL) && (stringp->bytep != MARPAESLIF_EMPTY_STRING)) {
-      free(stringp->bytep);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->bytep);
     }
     if ((stringp->encodingasciis != NULL) && (stringp->encodingasciis != MARPAESLIF_UTF8_STRING)) {
-      free(stringp->encodingasciis);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->encodingasciis);
     }
     if ((stringp->asciis != NULL) && (stringp->asciis != MARPAESLIF_EMPTY_STRING)) {
-      free(stringp->asciis);
+      MARPAESLIF_FREE(marpaESLIFp, stringp->asciis);
     }
     if (! onStackb) {
-      free(stringp);
+      MARPAESLIF_FREE(marpaESLIFp, stringp);
     }
   }
 }
@@ -1811,6 +1946,365 @@ static inline short _marpaESLIF_string_eqb(marpaESLIF_string_t *string1p, marpaE
   return (memcmp(byte1p, byte2p, bytel) == 0) ? 1 : 0;
 }
 
+/*****************************************************************************/
+static inline char *_marpaESLIF_regexcache_keys(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, size_t *keylp)
+/*****************************************************************************/
+/* The key is "PCRE2 <major>.<minor> <options> <pattern>": a serialized      */
+/* pattern can only be decoded by the same PCRE2 version.                    */
+/*****************************************************************************/
+{
+  char   prefixs[64];
+  size_t prefixl;
+  char  *keys;
+
+  prefixl = (size_t) sprintf(prefixs, "PCRE2 %d.%d %lx ", (int) PCRE2_MAJOR, (int) PCRE2_MINOR, (unsigned long) pcre2Optioni);
+
+  /* We always add a NUL byte for convenience */
+  keys = (char *) MARPAESLIF_MALLOC(marpaESLIFp, prefixl + utf8l + 1);
+  if (MARPAESLIF_UNLIKELY(keys == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    return NULL;
+  }
+
+  memcpy(keys, prefixs, prefixl);
+  if (utf8l > 0) {
+    memcpy(keys + prefixl, utf8s, utf8l);
+  }
+  keys[prefixl + utf8l] = '\0';
+
+  *keylp = prefixl + utf8l;
+  return keys;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_regexcache_getb(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, pcre2_code **patternpp)
+/*****************************************************************************/
+/* *patternpp is set to NULL on a cache miss.                                */
+/*****************************************************************************/
+{
+  static const char       *funcs               = "_marpaESLIF_regexcache_getb";
+  marpaESLIF_regexcache_t *regexcachep         = NULL;
+  pcre2_code              *patternp            = NULL;
+  short                    findResultb         = 0;
+  marpaESLIF_regexcache_t  regexcache;
+  marpaESLIF_regexcache_t *regexcachekeyp;
+  short                    rcb;
+
+  regexcache.keys = _marpaESLIF_regexcache_keys(marpaESLIFp, utf8s, utf8l, pcre2Optioni, &(regexcache.keyl));
+  if (MARPAESLIF_UNLIKELY(regexcache.keys == NULL)) {
+    goto err;
+  }
+  regexcachekeyp = &regexcache;
+
+  findResultb = _marpaESLIF_hash_findb(marpaESLIFp->regexCacheHashp, regexcachekeyp, (void **) &regexcachep);
+
+  if (findResultb) {
+    /* The character tables are part of the serialized data */
+    if (pcre2_serialize_decode(&patternp, 1, (PCRE2_SPTR8) regexcachep->serializedp, marpaESLIFp->pcre2GeneralContextp) != 1) {
+      /* Not fatal: the caller will compile the pattern */
+      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%s: pcre2_serialize_decode failure", regexcache.keys);
+      patternp = NULL;
+    } else {
+      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%s: pattern restored from cache", regexcache.keys);
+    }
+  }
+
+  if (patternp != NULL) {
+    marpaESLIFp->regexCacheHitl++;
+  } else {
+    marpaESLIFp->regexCacheMissl++;
+  }
+
+  *patternpp = patternp;
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (regexcache.keys != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, regexcache.keys);
+  }
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_regexcache_setb(marpaESLIF_t *marpaESLIFp, char *utf8s, size_t utf8l, marpaESLIF_uint32_t pcre2Optioni, pcre2_code *patternp)
+/*****************************************************************************/
+{
+  static const char       *funcs         = "_marpaESLIF_regexcache_setb";
+  char                    *keys          = NULL;
+  uint8_t                 *serializedp   = NULL;
+  uint8_t                 *pcre2bytesp   = NULL;
+  marpaESLIF_regexcache_t *regexcachep;
+  marpaESLIF_regexcache_t  regexcache;
+  marpaESLIF_regexcache_t *regexcachekeyp;
+  PCRE2_SIZE               pcre2bytesl;
+  size_t                   keyl;
+  int32_t                  pcre2Errornumberi;
+  PCRE2_UCHAR              pcre2ErrorBuffer[256];
+  short                    rcb;
+
+  pcre2Errornumberi = pcre2_serialize_encode((const pcre2_code **) &patternp, 1, &pcre2bytesp, &pcre2bytesl, marpaESLIFp->pcre2GeneralContextp);
+  if (MARPAESLIF_UNLIKELY(pcre2Errornumberi != 1)) {
+    /* Not fatal: we just do not cache this pattern */
+    pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "pcre2_serialize_encode failure: %s", pcre2ErrorBuffer);
+    pcre2bytesp = NULL;
+    goto ok;
+  }
+
+  /* An area that the import would reject is not cached */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_serialized_validb(pcre2bytesp, (size_t) pcre2bytesl))) {
+    MARPAESLIF_TRACE(marpaESLIFp, funcs, "pcre2_serialize_encode produced an area with an unexpected layout");
+    goto ok;
+  }
+
+  keys = _marpaESLIF_regexcache_keys(marpaESLIFp, utf8s, utf8l, pcre2Optioni, &keyl);
+  if (MARPAESLIF_UNLIKELY(keys == NULL)) {
+    goto err;
+  }
+
+  /* PCRE2 serialized area has a private header in front of it: we own a copy */
+  serializedp = (uint8_t *) MARPAESLIF_MALLOC(marpaESLIFp, (size_t) pcre2bytesl);
+  if (MARPAESLIF_UNLIKELY(serializedp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  memcpy(serializedp, pcre2bytesp, (size_t) pcre2bytesl);
+
+  /* An entry that could not be decoded is replaced */
+  regexcache.keys = keys;
+  regexcache.keyl = keyl;
+  regexcachekeyp  = &regexcache;
+  if (_marpaESLIF_hash_findb(marpaESLIFp->regexCacheHashp, regexcachekeyp, (void **) &regexcachep)) {
+    MARPAESLIF_FREE(marpaESLIFp, regexcachep->serializedp);
+    regexcachep->serializedp = serializedp;
+    regexcachep->serializedl = (size_t) pcre2bytesl;
+    serializedp = NULL;
+    goto ok;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_addb(marpaESLIFp, keys, keyl, serializedp, (size_t) pcre2bytesl))) {
+    goto err;
+  }
+  /* keys and serializedp now belong to the cache */
+  keys        = NULL;
+  serializedp = NULL;
+
+ ok:
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (pcre2bytesp != NULL) {
+    pcre2_serialize_free(pcre2bytesp);
+  }
+  if (keys != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, keys);
+  }
+  if (serializedp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, serializedp);
+  }
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_regexcache_addb(marpaESLIF_t *marpaESLIFp, char *keys, size_t keyl, uint8_t *serializedp, size_t serializedl)
+/*****************************************************************************/
+/* On success keys and serializedp belong to the cache.                      */
+/*****************************************************************************/
+{
+  marpaESLIF_regexcache_t *regexcachep;
+
+  regexcachep = (marpaESLIF_regexcache_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_regexcache_t));
+  if (MARPAESLIF_UNLIKELY(regexcachep == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    return 0;
+  }
+  regexcachep->keys        = keys;
+  regexcachep->keyl        = keyl;
+  regexcachep->serializedp = serializedp;
+  regexcachep->serializedl = serializedl;
+
+  /* The stack owns the entries, the hash is only an index on them */
+  GENERICSTACK_PUSH_PTR(marpaESLIFp->regexCacheStackp, regexcachep);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFp->regexCacheStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "regexCacheStackp push failure, %s", strerror(errno));
+    MARPAESLIF_FREE(marpaESLIFp, regexcachep);
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_setb(marpaESLIFp, marpaESLIFp->regexCacheHashp, regexcachep, regexcachep))) {
+    /* Entry is still owned by the stack: release only the caller's buffers */
+    regexcachep->keys        = NULL;
+    regexcachep->serializedp = NULL;
+    return 0;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_regexcache_serialized_validb(uint8_t *serializedp, size_t serializedl)
+/*****************************************************************************/
+/* pcre2_serialize_decode() has no length parameter: it trusts the sizes     */
+/* inside the area. They are checked here, so that decoding never reads     */
+/* outside of it. The compiled code itself cannot be checked.               */
+/*****************************************************************************/
+{
+  marpaESLIF_pcre2CodeHeader_t codeHeader;
+  size_t                       offsetl = MARPAESLIF_PCRE2_SERIALIZED_HEADERL + MARPAESLIF_PCRE2_TABLESL;
+
+  if (serializedl < offsetl + sizeof(marpaESLIF_pcre2CodeHeader_t)) {
+    return 0;
+  }
+  /* Magic number, PCRE2 version and code unit width, then our single pattern */
+  if (pcre2_serialize_get_number_of_codes(serializedp) != 1) {
+    return 0;
+  }
+  memcpy(&codeHeader, serializedp + offsetl, sizeof(marpaESLIF_pcre2CodeHeader_t));
+  if ((codeHeader.magic_numberi != MARPAESLIF_PCRE2_CODE_MAGIC) || (codeHeader.blocksizel <= sizeof(marpaESLIF_pcre2CodeHeader_t)) || (codeHeader.blocksizel != serializedl - offsetl)) {
+    return 0;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_regexcache_enableb(marpaESLIF_t *marpaESLIFp)
+/*****************************************************************************/
+{
+  if (marpaESLIFp->regexCacheStackp != NULL) {
+    /* Already enabled */
+    return 1;
+  }
+
+  marpaESLIFp->regexCacheStackp = &(marpaESLIFp->_regexCacheStack);
+  GENERICSTACK_INIT(marpaESLIFp->regexCacheStackp);
+  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFp->regexCacheStackp))) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "regexCacheStackp initialization failure, %s", strerror(errno));
+    marpaESLIFp->regexCacheStackp = NULL;
+    return 0;
+  }
+
+  marpaESLIFp->regexCacheHashp = &(marpaESLIFp->_regexCacheHash);
+  _marpaESLIF_hash_initv(marpaESLIFp, marpaESLIFp->regexCacheHashp,
+                         NULL, /* userDatavp */
+                         _marpaESLIF_regexcache_hashl,
+                         _marpaESLIF_regexcache_cmpb,
+                         NULL, /* keyFreeFunctionp - entries are owned by regexCacheStackp */
+                         NULL  /* valFreeFunctionp */);
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIF_regexcache_disablev(marpaESLIF_t *marpaESLIFp)
+/*****************************************************************************/
+{
+  marpaESLIF_regexcache_t *regexcachep;
+  int                      i;
+
+  if (marpaESLIFp->regexCacheHashp != NULL) {
+    _marpaESLIF_hash_resetv(marpaESLIFp, marpaESLIFp->regexCacheHashp);
+    marpaESLIFp->regexCacheHashp = NULL;
+  }
+  if (marpaESLIFp->regexCacheStackp != NULL) {
+    for (i = 0; i < GENERICSTACK_USED(marpaESLIFp->regexCacheStackp); i++) {
+      regexcachep = (marpaESLIF_regexcache_t *) GENERICSTACK_GET_PTR(marpaESLIFp->regexCacheStackp, i);
+      if (regexcachep->keys != NULL) {
+        MARPAESLIF_FREE(marpaESLIFp, regexcachep->keys);
+      }
+      if (regexcachep->serializedp != NULL) {
+        MARPAESLIF_FREE(marpaESLIFp, regexcachep->serializedp);
+      }
+      MARPAESLIF_FREE(marpaESLIFp, regexcachep);
+    }
+    GENERICSTACK_RESET(marpaESLIFp->regexCacheStackp); /* Take care, this is a pointer to a stack inside ESLIF structure */
+    marpaESLIFp->regexCacheStackp = NULL;
+  }
+  if (marpaESLIFp->regexCacheExportp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFp->regexCacheExportp);
+    marpaESLIFp->regexCacheExportp = NULL;
+    marpaESLIFp->regexCacheExportl = 0;
+  }
+}
+
+/****************************************************************************/
+static unsigned long _marpaESLIF_regexcache_hashl(void *userDatavp, void *keyp)
+/****************************************************************************/
+{
+  /* We know what we are doing, i.e. that keyp is a marpaESLIF_regexcache_t pointer */
+  marpaESLIF_regexcache_t *p = (marpaESLIF_regexcache_t *) keyp;
+
+  return _marpaESLIF_hash_mixl(_marpaESLIF_djb2_s((unsigned char *) p->keys, p->keyl));
+}
+
+/****************************************************************************/
+static short _marpaESLIF_regexcache_cmpb(void *userDatavp, void *key1p, void *key2p)
+/****************************************************************************/
+{
+  marpaESLIF_regexcache_t *p1 = (marpaESLIF_regexcache_t *) key1p;
+  marpaESLIF_regexcache_t *p2 = (marpaESLIF_regexcache_t *) key2p;
+
+  return ((p1->keyl == p2->keyl) && (memcmp(p1->keys, p2->keys, p1->keyl) == 0)) ? 1 : 0;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_terminal_codeunitb(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp, marpaESLIF_uint32_t allOptionsi, marpaESLIF_uint32_t typeWhati, marpaESLIF_uint32_t codeUnitWhati, short *codeunitbp, unsigned char *codeunits)
+/*****************************************************************************/
+/* Get first or last literal code unit of a compiled regex. PCRE2 does not   */
+/* say if it is caseless, so we always accept its other case as well.        */
+/*****************************************************************************/
+{
+  static const char   *funcs = "_marpaESLIF_terminal_codeunitb";
+  marpaESLIF_uint32_t  typei;
+  marpaESLIF_uint32_t  codeuniti;
+  int                  pcre2Errornumberi;
+  PCRE2_UCHAR          pcre2ErrorBuffer[256];
+
+  *codeunitbp = 0;
+
+  pcre2Errornumberi = pcre2_pattern_info(terminalp->regex.patternp, typeWhati, &typei);
+  if (MARPAESLIF_UNLIKELY(pcre2Errornumberi != 0)) {
+    pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
+    MARPAESLIF_ERRORF(marpaESLIFp, "%s: pcre2_pattern_info failure: %s", terminalp->descp->asciis, pcre2ErrorBuffer);
+    return 0;
+  }
+  /* Type 1 means there is a literal code unit, other values are not usable */
+  if (typei != 1) {
+    return 1;
+  }
+
+  pcre2Errornumberi = pcre2_pattern_info(terminalp->regex.patternp, codeUnitWhati, &codeuniti);
+  if (MARPAESLIF_UNLIKELY(pcre2Errornumberi != 0)) {
+    pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
+    MARPAESLIF_ERRORF(marpaESLIFp, "%s: pcre2_pattern_info failure: %s", terminalp->descp->asciis, pcre2ErrorBuffer);
+    return 0;
+  }
+
+  if ((codeuniti < 128) || ((codeuniti < 256) && ((allOptionsi & (PCRE2_UTF|PCRE2_UCP)) == 0))) {
+    /* The flip case table follows the lower case table in the output of pcre2_maketables() */
+    codeunits[0] = (unsigned char) codeuniti;
+    codeunits[1] = marpaESLIFp->tablesp[256 + codeuniti];
+  } else if (((allOptionsi & PCRE2_UTF) == PCRE2_UTF) && (codeuniti < 256)) {
+    /* In UTF-8 mode this is a lead or continuation byte, that has no case */
+    codeunits[0] = codeunits[1] = (unsigned char) codeuniti;
+  } else {
+    /* In UCP mode the other case can be outside of the code unit range */
+    return 1;
+  }
+
+  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%s: %s code unit is 0x%02x or 0x%02x", terminalp->descp->asciis, (typeWhati == PCRE2_INFO_FIRSTCODETYPE) ? "first" : "required", (unsigned int) codeunits[0], (unsigned int) codeunits[1]);
+  *codeunitbp = 1;
+  return 1;
+}
+
 /*****************************************************************************/
 static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *marpaESLIFp, marpaWrapperGrammar_t *marpaWrapperGrammarp, int eventSeti, char *descEncodings, char *descs, size_t descl, marpaESLIF_terminal_type_t type, char *modifiers, char *utf8s, size_t utf8l, char *testFullMatchs, char *testPartialMatchs, short pseudob, short characterClassb, marpaESLIF_terminal_type_t wantType, short substitutionb)
 /*****************************************************************************/
@@ -1828,10 +2322,12 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
   marpaESLIF_string_t              *content2descp             = NULL;
   char                             *generatedasciis           = NULL;
   short                             memcmpb                   = 0;
+  short                             regexCachedb              = 0;
   marpaESLIF_terminal_t            *terminalp                 = NULL;
   size_t                            pcre2JitOptionl           = 0;
   marpaESLIF_uint32_t               pcre2Optioni              = PCRE2_ANCHORED;
   marpaESLIF_uint32_t               pcre2SubstitutionOptioni  = 0;
+  marpaESLIF_uint32_t               pcre2AllOptioni;
   int                               pcre2Errornumberi;
   PCRE2_SIZE                        pcre2ErrorOffsetl;
   PCRE2_UCHAR                       pcre2ErrorBuffer[256];
@@ -1911,7 +2407,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
   }
 
   /* Please note the "fakeb" parameter below */
-  terminalp = (marpaESLIF_terminal_t *) malloc(sizeof(marpaESLIF_terminal_t));
+  terminalp = (marpaESLIF_terminal_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_terminal_t));
   if (MARPAESLIF_UNLIKELY(terminalp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -1931,6 +2427,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
   terminalp->substitutionPatterns                        = NULL;
   terminalp->substitutionPatternl                        = 0;
   terminalp->substitutionPatterni                        = 0;
+  terminalp->substitutionRefl                            = 0;
   terminalp->regex.patternp                              = NULL;
   terminalp->regex.match_datap                           = NULL;
 #ifdef PCRE2_CONFIG_JIT
@@ -1949,11 +2446,13 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
   terminalp->bytel                                       = 0;
   terminalp->pseudob                                     = pseudob;
   terminalp->eventSeti                                   = eventSeti;
+  terminalp->firstcodeunitb                              = 0;
+  terminalp->requiredcodeunitb                           = 0;
 
   /* Original input */
   if ((utf8s != NULL) && (utf8l > 0)) {
     terminalp->utf8l = utf8l;
-    terminalp->utf8s = (char *) malloc(utf8l + 1);
+    terminalp->utf8s = (char *) MARPAESLIF_MALLOC(marpaESLIFp, utf8l + 1);
     if (terminalp->utf8s == NULL) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -1964,7 +2463,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
 
   /* ----------- Modifiers ------------ */
   if (modifiers != NULL) {
-    terminalp->modifiers = strdup(modifiers);
+    terminalp->modifiers = MARPAESLIF_STRDUP(marpaESLIFp, modifiers);
     if (MARPAESLIF_UNLIKELY(terminalp->modifiers == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -1993,7 +2492,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       /* Use already escaped version -; */
       if (modifiers != NULL) {
         /* ":xxxx */
-        generatedasciis = (char *) malloc(strlen(content2descp->asciis) + 1 + strlen(modifiers) + 1);
+        generatedasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFp, strlen(content2descp->asciis) + 1 + strlen(modifiers) + 1);
         if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -2002,32 +2501,32 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
         strcat(generatedasciis, ":");
         strcat(generatedasciis, modifiers);
       } else {
-        generatedasciis = strdup(content2descp->asciis);
+        generatedasciis = MARPAESLIF_STRDUP(marpaESLIFp, content2descp->asciis);
         if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
           goto err;
         }
       }
     } else if (type == MARPAESLIF_TERMINAL_TYPE__EOF) {
-      generatedasciis = strdup(content2descp->asciis);
+      generatedasciis = MARPAESLIF_STRDUP(marpaESLIFp, content2descp->asciis);
       if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
     } else if (type == MARPAESLIF_TERMINAL_TYPE__EOL) {
-      generatedasciis = strdup(content2descp->asciis);
+      generatedasciis = MARPAESLIF_STRDUP(marpaESLIFp, content2descp->asciis);
       if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
     } else if (type == MARPAESLIF_TERMINAL_TYPE__SOL) {
-      generatedasciis = strdup(content2descp->asciis);
+      generatedasciis = MARPAESLIF_STRDUP(marpaESLIFp, content2descp->asciis);
       if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
     } else if (type == MARPAESLIF_TERMINAL_TYPE__EMPTY) {
-      generatedasciis = strdup(content2descp->asciis);
+      generatedasciis = MARPAESLIF_STRDUP(marpaESLIFp, content2descp->asciis);
       if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -2043,9 +2542,9 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       }
       if (modifiers != NULL) {
         /* xxxx */
-        generatedasciis = (char *) malloc(1 + slashl + strlen(content2descp->asciis) + 1 + strlen(modifiers) + 1);
+        generatedasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFp, 1 + slashl + strlen(content2descp->asciis) + 1 + strlen(modifiers) + 1);
       } else {
-        generatedasciis = (char *) malloc(1 + slashl + strlen(content2descp->asciis) + 1 + 1);
+        generatedasciis = (char *) MARPAESLIF_MALLOC(marpaESLIFp, 1 + slashl + strlen(content2descp->asciis) + 1 + 1);
       }
       if (MARPAESLIF_UNLIKELY(generatedasciis == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
@@ -2113,7 +2612,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       /* bytes is always guaranteed to get the raw string entirely. We overestimate */
       /* this in another way: the {bytesl,bytel} array must contain the delimiters, that */
       /* are also skipped when parsing it. */
-      bytes = (char *) malloc(utf8l+1);
+      bytes = (char *) MARPAESLIF_MALLOC(marpaESLIFp, utf8l+1);
       if (MARPAESLIF_UNLIKELY(bytes == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -2122,7 +2621,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       terminalp->bytes = bytes;  /* bytes will move everytime we append to the buffer */
       bytel   = 0;               /* bytel will increase everytime we append to the buffer */
 
-      /* If there is a failure, _marpaESLIF_terminal_freev() will take care of bytes */
+      /* If there is a failure, _marpaESLIF_terminal_freev(marpaESLIFp, ) will take care of bytes */
     }
     
 
@@ -2345,14 +2844,14 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       if (substitutionb) {
         /* Raw copy */
         if (strings == NULL) {
-          strings = (char *) malloc(matchedl + 1);
+          strings = (char *) MARPAESLIF_MALLOC(marpaESLIFp, matchedl + 1);
           if (MARPAESLIF_UNLIKELY(strings == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
           }
           memcpy(strings, matchedp, matchedl);
         } else {
-          tmps = (char *) realloc(strings, stringl + matchedl + 1);
+          tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, strings, stringl + matchedl + 1);
           if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
             goto err;
@@ -2366,14 +2865,14 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
         /* Append the ASCII representation */
         stringl += (asciisafeb > 0) ? asciisafeb : hexdigitl;
         if (strings == NULL) {
-          strings = (char *) malloc(stringl + 1);
+          strings = (char *) MARPAESLIF_MALLOC(marpaESLIFp, stringl + 1);
           if (MARPAESLIF_UNLIKELY(strings == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
           }
           strings[0] = '\0'; /* Start with an empty string */
         } else {
-          tmps = (char *) realloc(strings, stringl + 1);
+          tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, strings, stringl + 1);
           if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
             goto err;
@@ -2562,7 +3061,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
 
     if (! substitutionb) {
       /* We want to support callouts, that requires a compile context */
-      terminalp->regex.compile_contextp = pcre2_compile_context_create(NULL);
+      terminalp->regex.compile_contextp = pcre2_compile_context_create(marpaESLIFp->pcre2GeneralContextp);
       if (MARPAESLIF_UNLIKELY(terminalp->regex.compile_contextp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "pcre2_compile_context_create, %s", strerror(errno));
         goto err;
@@ -2571,7 +3070,17 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       /* Documentation says that the result of this function is always 0 ;) */
       pcre2_set_character_tables(terminalp->regex.compile_contextp, marpaESLIFp->tablesp);
 
-      if (utf8s == NULL) {
+      /* Compiled regex cache, if enabled */
+      if (marpaESLIFp->regexCacheHashp != NULL) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_getb(marpaESLIFp, utf8s, utf8l, pcre2Optioni, &(terminalp->regex.patternp)))) {
+          goto err;
+        }
+        regexCachedb = (terminalp->regex.patternp != NULL);
+      }
+
+      if (regexCachedb) {
+        /* Restored from the cache */
+      } else if (utf8s == NULL) {
         /* Case of the empty string => empty pattern */
         /* Note that this is different from // in the grammar: // is NOT recognized as a valid regex */
         terminalp->regex.patternp = pcre2_compile(
@@ -2599,6 +3108,12 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
         goto err;
       }
 
+      if ((marpaESLIFp->regexCacheHashp != NULL) && (! regexCachedb)) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_setb(marpaESLIFp, utf8s, utf8l, pcre2Optioni, terminalp->regex.patternp))) {
+          goto err;
+        }
+      }
+
       /* Set the calloutb flag */
       enumerate_context.marpaESLIFp = NULL; /* Setting NULL here is a hack just to have the calloutb set and nothing else */
       enumerate_context.asciishows  = NULL;
@@ -2608,7 +3123,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       terminalp->regex.calloutb = enumerate_context.calloutb;
 
       /* Set match context in any case */
-      terminalp->regex.match_contextp = pcre2_match_context_create(NULL);
+      terminalp->regex.match_contextp = pcre2_match_context_create(marpaESLIFp->pcre2GeneralContextp);
       if (MARPAESLIF_UNLIKELY(terminalp->regex.match_contextp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "pcre2_match_context_create failure, %s", strerror(errno));
         goto err;
@@ -2620,7 +3135,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       pcre2_set_callout(terminalp->regex.match_contextp, _marpaESLIF_pcre2_callouti, &(terminalp->regex.callout_context));
 
       /* Set match data */
-      terminalp->regex.match_datap = pcre2_match_data_create_from_pattern(terminalp->regex.patternp, NULL /* Default memory allocation */);
+      terminalp->regex.match_datap = pcre2_match_data_create_from_pattern(terminalp->regex.patternp, marpaESLIFp->pcre2GeneralContextp);
       if (MARPAESLIF_UNLIKELY(terminalp->regex.match_datap == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "%s: pcre2_match_data_create_from_pattern failure, %s", terminalp->descp->asciis, strerror(errno));
         goto err;
@@ -2649,19 +3164,30 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
       }
 
       /* And some modes after the pattern was allocated */
-      pcre2Errornumberi = pcre2_pattern_info(terminalp->regex.patternp, PCRE2_INFO_ALLOPTIONS, &pcre2Optioni);
+      /* PCRE2_INFO_ALLOPTIONS includes the leading (*XXX) settings of the pattern itself, e.g. (*UTF) or (*NO_START_OPT) */
+      pcre2Errornumberi = pcre2_pattern_info(terminalp->regex.patternp, PCRE2_INFO_ALLOPTIONS, &pcre2AllOptioni);
       if (MARPAESLIF_UNLIKELY(pcre2Errornumberi != 0)) {
         pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
         MARPAESLIF_ERRORF(marpaESLIFp, "%s: pcre2_pattern_info failure: %s", terminalp->descp->asciis, pcre2ErrorBuffer);
         goto err;
       }
-      terminalp->regex.utfb        = ((pcre2Optioni & PCRE2_UTF) == PCRE2_UTF);
-      terminalp->regex.isAnchoredb = ((pcre2Optioni & PCRE2_ANCHORED) == PCRE2_ANCHORED);
+      terminalp->regex.utfb        = ((pcre2AllOptioni & PCRE2_UTF) == PCRE2_UTF);
+      terminalp->regex.isAnchoredb = ((pcre2AllOptioni & PCRE2_ANCHORED) == PCRE2_ANCHORED);
       MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%s: UTF mode is %s, Anchored mode is %s",
                         terminalp->descp->asciis,
                         terminalp->regex.utfb ? "on" : "off",
                         terminalp->regex.isAnchoredb ? "on" : "off"
                         );
+
+      /* Literal code units that any match must have: they are used to reject input without entering PCRE2 */
+      if ((pcre2AllOptioni & PCRE2_NO_START_OPTIMIZE) != PCRE2_NO_START_OPTIMIZE) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_terminal_codeunitb(marpaESLIFp, terminalp, pcre2AllOptioni, PCRE2_INFO_FIRSTCODETYPE, PCRE2_INFO_FIRSTCODEUNIT, &(terminalp->firstcodeunitb), terminalp->firstcodeunits))) {
+          goto err;
+        }
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIF_terminal_codeunitb(marpaESLIFp, terminalp, pcre2AllOptioni, PCRE2_INFO_LASTCODETYPE, PCRE2_INFO_LASTCODEUNIT, &(terminalp->requiredcodeunitb), terminalp->requiredcodeunits))) {
+          goto err;
+        }
+      }
     }
     break;
 
@@ -2736,7 +3262,7 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
 #endif
 
   /* Creation of PCRE2 pattern is ok - keep it for bootstrap comparison when creating grammars */
-  terminalp->patterns = (char *) malloc(utf8l + 1); /* We always add a NUL byte for convenience */
+  terminalp->patterns = (char *) MARPAESLIF_MALLOC(marpaESLIFp, utf8l + 1); /* We always add a NUL byte for convenience */
   if (MARPAESLIF_UNLIKELY(terminalp->patterns == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -2823,17 +3349,17 @@ static inline marpaESLIF_terminal_t *_marpaESLIF_terminal_newp(marpaESLIF_t *mar
   goto done;
   
  err:
-  _marpaESLIF_terminal_freev(terminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFp, terminalp);
   terminalp = NULL;
 
  done:
   if (strings != NULL) {
-    free(strings);
+    MARPAESLIF_FREE(marpaESLIFp, strings);
   }
   if (generatedasciis != NULL) {
-    free(generatedasciis);
+    MARPAESLIF_FREE(marpaESLIFp, generatedasciis);
   }
-  _marpaESLIF_string_freev(content2descp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, content2descp, 0 /* onStackb */);
 #ifndef MARPAESLIF_NTRACE
   marpaESLIFRecognizer_freev(marpaESLIFRecognizerTestp); /* NULL protected */
 #endif
@@ -2861,7 +3387,7 @@ static inline marpaESLIF_meta_t *_marpaESLIF_meta_newp(marpaESLIF_t *marpaESLIFp
     goto err;
   }
 
-  metap = (marpaESLIF_meta_t *) malloc(sizeof(marpaESLIF_meta_t));
+  metap = (marpaESLIF_meta_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_meta_t));
   if (MARPAESLIF_UNLIKELY(metap == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -2888,7 +3414,7 @@ static inline marpaESLIF_meta_t *_marpaESLIF_meta_newp(marpaESLIF_t *marpaESLIFp
   marpaWrapperGrammarSymbolOption.eventSeti = eventSeti;
 
   /* -------- Meta name -------- */
-  metap->asciinames = strdup(asciinames);
+  metap->asciinames = MARPAESLIF_STRDUP(marpaESLIFp, asciinames);
   if (MARPAESLIF_UNLIKELY(metap->asciinames == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -2913,7 +3439,7 @@ static inline marpaESLIF_meta_t *_marpaESLIF_meta_newp(marpaESLIF_t *marpaESLIFp
   goto done;
 
  err:
-  _marpaESLIF_meta_freev(metap);
+  _marpaESLIF_meta_freev(marpaESLIFp, metap);
   metap = NULL;
 
  done:
@@ -2922,14 +3448,14 @@ static inline marpaESLIF_meta_t *_marpaESLIF_meta_newp(marpaESLIF_t *marpaESLIFp
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_meta_freev(marpaESLIF_meta_t *metap)
+static inline void _marpaESLIF_meta_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_meta_t *metap)
 /*****************************************************************************/
 {
   if (metap != NULL) {
     if (metap->asciinames != NULL) {
-      free(metap->asciinames);
+      MARPAESLIF_FREE(marpaESLIFp, metap->asciinames);
     }
-    _marpaESLIF_string_freev(metap->descp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, metap->descp, 0 /* onStackb */);
     if (metap->marpaWrapperGrammarStartp != NULL) {
       marpaWrapperGrammar_freev(metap->marpaWrapperGrammarStartp);
     }
@@ -2937,17 +3463,17 @@ static inline void _marpaESLIF_meta_freev(marpaESLIF_meta_t *metap)
       marpaWrapperGrammar_freev(metap->marpaWrapperGrammarStartNoEventp);
     }
     if (metap->terminalIdArrayPristinep != NULL) {
-      free(metap->terminalIdArrayPristinep);
+      MARPAESLIF_FREE(marpaESLIFp, metap->terminalIdArrayPristinep);
     }
     if (metap->terminalArrayPristinepp != NULL) {
-      free(metap->terminalArrayPristinepp);
+      MARPAESLIF_FREE(marpaESLIFp, metap->terminalArrayPristinepp);
     }
     if (metap->symbolArraypp != NULL) {
-      free(metap->symbolArraypp);
+      MARPAESLIF_FREE(marpaESLIFp, metap->symbolArraypp);
     }
 
     /* All the rest are shallow pointers - in particular marpaESLIFGrammarLexemeClonep is a hack for performance reasons */
-    free(metap);
+    MARPAESLIF_FREE(marpaESLIFp, metap);
   }
 }
 
@@ -3064,14 +3590,14 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
       goto err;
     }
     if (bootstrap_grammar_terminalp[i].eventBefores != NULL) {
-      symbolp->eventBefores = strdup(bootstrap_grammar_terminalp[i].eventBefores);
+      symbolp->eventBefores = MARPAESLIF_STRDUP(marpaESLIFp, bootstrap_grammar_terminalp[i].eventBefores);
       if (MARPAESLIF_UNLIKELY(symbolp->eventBefores == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
     }
     if (bootstrap_grammar_terminalp[i].eventAfters != NULL) {
-      symbolp->eventAfters = strdup(bootstrap_grammar_terminalp[i].eventAfters);
+      symbolp->eventAfters = MARPAESLIF_STRDUP(marpaESLIFp, bootstrap_grammar_terminalp[i].eventAfters);
       if (MARPAESLIF_UNLIKELY(symbolp->eventAfters == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -3130,14 +3656,14 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
     }
     symbolp->verboseb = bootstrap_grammar_metap[i].verboseb;
     if (bootstrap_grammar_metap[i].eventBefores != NULL) {
-      symbolp->eventBefores = strdup(bootstrap_grammar_metap[i].eventBefores);
+      symbolp->eventBefores = MARPAESLIF_STRDUP(marpaESLIFp, bootstrap_grammar_metap[i].eventBefores);
       if (MARPAESLIF_UNLIKELY(symbolp->eventBefores == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
       }
     }
     if (bootstrap_grammar_metap[i].eventAfters != NULL) {
-      symbolp->eventAfters = strdup(bootstrap_grammar_metap[i].eventAfters);
+      symbolp->eventAfters = MARPAESLIF_STRDUP(marpaESLIFp, bootstrap_grammar_metap[i].eventAfters);
       if (MARPAESLIF_UNLIKELY(symbolp->eventAfters == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -3172,7 +3698,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
 
     /* Symbol :discard event ? We use only the nulled event for that btw */
     if (bootstrap_grammar_metap[i].discardonb) {
-      symbolp->eventNulleds = strdup(":discard[on]");
+      symbolp->eventNulleds = MARPAESLIF_STRDUP(marpaESLIFp, ":discard[on]");
       if (MARPAESLIF_UNLIKELY(symbolp->eventNulleds == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -3180,7 +3706,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
       symbolp->eventNulledb = 1;
     }
     if (bootstrap_grammar_metap[i].discardoffb) {
-      symbolp->eventNulleds = strdup(":discard[off]");
+      symbolp->eventNulleds = MARPAESLIF_STRDUP(marpaESLIFp, ":discard[off]");
       if (MARPAESLIF_UNLIKELY(symbolp->eventNulleds == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -3277,11 +3803,11 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
   goto done;
   
  err:
-  _marpaESLIF_terminal_freev(terminalp);
-  _marpaESLIF_meta_freev(metap);
-  _marpaESLIF_rule_freev(rulep);
-  _marpaESLIF_symbol_freev(symbolp);
-  _marpaESLIF_grammar_freev(grammarp);
+  _marpaESLIF_terminal_freev(marpaESLIFp, terminalp);
+  _marpaESLIF_meta_freev(marpaESLIFp, metap);
+  _marpaESLIF_rule_freev(marpaESLIFp, rulep);
+  _marpaESLIF_symbol_freev(marpaESLIFp, symbolp);
+  _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
   grammarp = NULL;
 
  done:
@@ -3292,41 +3818,48 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_bootstrap_grammarp(marpaESLIFGra
 /*****************************************************************************/
 static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size_t sizel, marpaESLIFValueResult_t *marpaESLIFValueResultp, short *confidencebp)
 /*****************************************************************************/
-{
-  static const char                  *funcs       = "_marpaESLIFRecognizer_numberb";
-  short                               confidenceb = 1; /* Set to 0 only when we got through the double case */
-  char                               *bytes       = s;
-  size_t                              bytel       = (sizel <= 0) ? strlen(s) : sizel; /* Remember the doc: caller must make sure it is NUL terminated if sizel is 0 */
-  char                               *dups        = NULL; /* For the cases where we modify in place s, we want to restore it */
-  char                               *numbers;
-  size_t                              numberl;
-  char                               *endptrendp;
+/* Single pass on the input, that is never modified. The significant digits are accumulated in an   */
+/* unsigned 64 bits mantissa, the non significant leading zeroes of the integer part and trailing    */
+/* zeroes of the decimal part being ignored, with a decimal exponent. When we have to call the C     */
+/* library for a floating point number, it is given a copy, on the heap if the input is too long.    */
+/*****************************************************************************/
+{
+  static const char                  *funcs        = "_marpaESLIF_numberb";
+  short                               confidenceb  = 1; /* Set to 0 only when we got through the double case */
+  char                               *numbers      = s;
+  size_t                              numberl      = (sizel <= 0) ? strlen(s) : sizel; /* Remember the doc: caller must make sure it is NUL terminated if sizel is 0 */
+  short                               isNegb       = 0;
+  short                               fastb        = 0; /* Set to 1 when the mantissa and the exponent are exact */
+  marpaESLIF_uint64_t                 mantissau    = 0;
+  size_t                              significantl = 0; /* Number of digits in mantissau, leading zeroes excluded */
+  size_t                              integerl     = 0; /* Number of integer digits, leading zeroes excluded, minimum 1 */
+  size_t                              decimall     = 0; /* Number of decimal digits, trailing zeroes excluded */
+  size_t                              zerol        = 0; /* Pending zeroes in the decimal part */
+  long                                exponentl    = 0;
+  short                               exponentNegb = 0;
+  long                                scalel       = 0; /* Power of ten to apply to mantissau */
   char                               *p;
-  char                               *q;
-  char                               *pmin;
-  char                               *pmax;
-  char                                dotc;
-  char                                exponentc;
-  char                               *exponentp;
-  long                                exponentl;
-  char                               *dotp;
-  size_t                              numberOfUnsignificantDigitl;
-  char                               *endptrp;
-  size_t                              decimall;
-  short                               isFloatb;
-  short                               isNegb;
+  char                               *endp;
+  char                               *dotp         = NULL;
   size_t                              charsl;
-  size_t                              prevCharsl;
-  size_t                              l;
-  size_t                              shiftl;
-#if defined(MARPAESLIF_HAVE_LONG_LONG) && defined(C_STRTOLL)
+  marpaESLIF_uint64_t                 valueu;
+  marpaESLIF_uint64_t                 maxu;
+  long                                i;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
   MARPAESLIF_LONG_LONG                valuell;
 #else
   long                                valuel;
 #endif
 #if (defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)) || (defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL))
-  short                               decimalPointb;
-  char                               *decimalPoints;
+  char                                floats[MARPAESLIF_NUMBER_BUFSIZ];
+  char                               *floatp;
+  char                               *floatheaps   = NULL;
+  char                               *endptrp;
+  char                               *endptrendp;
+  char                                decimalPointc;
+#  ifdef HAVE_LOCALE_H
+  struct lconv                       *lconvp;
+#  endif
 #  if defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)
   long double                         valueld;
 #  else
@@ -3334,274 +3867,95 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
 #  endif
 #endif
   marpaESLIFValueResult_t             marpaESLIFValueResult;
-  /* Longest integer that we support */
-#ifdef MARPAESLIF_HAVE_LONG_LONG
-  char                                integers[MARPAESLIF_MAX_DECIMAL_DIGITS_LONGLONG + 1];
-#else
-  char                                integers[MARPAESLIF_MAX_DECIMAL_DIGITS_LONG + 1];
-#endif
   short                               rcb;
 
-  if (bytes[0] == '+') {
+  if ((numberl > 0) && (numbers[0] == '+')) {
     MARPAESLIF_TRACE(marpaESLIFp, funcs, "Removing leading '+' sign");
-    numbers = ++bytes;
-    numberl = --bytel;
-  } else {
-    numbers = bytes;
-    numberl = bytel;
+    numbers++;
+    numberl--;
   }
 
-  /* From now on the work area is numbers, with numberl ASCII characters, ending with a '\0' at indice numberl */
-  endptrendp = numbers + numberl;
-
   MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %ld bytes", (int) numberl, numbers, (unsigned long) numberl);
 
-  /* Look for the eventual exponent */
-  exponentp = NULL;
-  for (p = endptrendp - 1; p >= numbers; p--) {
-    exponentc = *p;
-    if ((exponentc == 'e') || (exponentc == 'E')) {
-      exponentp = p;
-      break;
-    }
-  }
+  p    = numbers;
+  endp = numbers + numberl;
 
-  /* Look for the eventual dot */
-  dotp = NULL;
-  for (p = numbers; p < endptrendp; p++) {
-    dotc = *p;
-    if (dotc == '.') {
-      dotp = p;
-      break;
-    }
+  if ((p < endp) && (*p == '-')) {
+    isNegb = 1;
+    p++;
   }
 
-  /* Remove non significant digits on the left, not possible with the strict grammar */
-
-  /* Locate where the scanning will start */
-  pmin = numbers;
-  if (*pmin == '-') {
-    pmin++;
+  /* Integer part: at least one digit, non significant leading zeroes are skipped */
+  if (MARPAESLIF_UNLIKELY((p >= endp) || (! MARPAESLIF_NUMBER_IS_DIGIT(*p)))) {
+    goto parsing_to_double;
   }
-
-  /* Locate where the scanning will stop */
-  if (dotp != NULL) {
-    /* Dot character is present */
-    pmax = dotp;
-  } else if (exponentp != NULL) {
-    /* No dot character but there is the exponent character */
-    pmax = exponentp;
-  } else {
-    /* The string is made only with digits */
-    pmax = endptrendp;
+  while ((p < endp) && (*p == '0')) {
+    p++;
   }
-
-  numberOfUnsignificantDigitl = 0;
-  for (p = pmin; p < pmax; p++) {
-    if (*p != '0') {
-      break;
-    }
-    numberOfUnsignificantDigitl++;
+  while ((p < endp) && MARPAESLIF_NUMBER_IS_DIGIT(*p)) {
+    MARPAESLIF_NUMBER_PUSH_DIGIT(*p);
+    integerl++;
+    p++;
+  }
+  if (integerl <= 0) {
+    /* We always retain one digit on the left of the dot */
+    integerl = 1;
   }
 
-  if ((numberOfUnsignificantDigitl > 0) && (p == pmax)) {
-    /* We want to retain at least one digit before the dot, e.g. we do not want to remove everything */
-
-    /* If we match:  */
-    /* 000000.456000 */
-    /* ^pmin         */
-    /*       ^pmax   */
-    /*       ^p      */
-    /*               */
-    /* we change to: */
-    /* 000000.456000 */
-    /* ^pmin         */
-    /*       ^pmax   */
-    /*      ^p       */
-    if (--numberOfUnsignificantDigitl > 0) {
-      --p;
+  /* Decimal part: zeroes are pending until a non-zero digit is met, so that trailing zeroes are skipped */
+  if ((p < endp) && (*p == '.')) {
+    dotp = p++;
+    if (MARPAESLIF_UNLIKELY((p >= endp) || (! MARPAESLIF_NUMBER_IS_DIGIT(*p)))) {
+      goto parsing_to_double;
+    }
+    while ((p < endp) && MARPAESLIF_NUMBER_IS_DIGIT(*p)) {
+      if (*p == '0') {
+        zerol++;
+      } else {
+        for (; zerol > 0; zerol--) {
+          MARPAESLIF_NUMBER_PUSH_DIGIT('0');
+          decimall++;
+        }
+        MARPAESLIF_NUMBER_PUSH_DIGIT(*p);
+        decimall++;
+      }
+      p++;
     }
   }
 
-  if (numberOfUnsignificantDigitl > 0) {
-    /* Note that is guaranteed that p < pmax */
-
-    /* 000123.456000 */
-    /* ^pmin         */
-    /*       ^pmax   */
-    /*    ^p         */
-
-    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Removing %ld non significant left digits", (int) numberl, numbers, (unsigned long) numberOfUnsignificantDigitl);
-    /* We modify the input in place, keep a copy for restoring at the end */
-    dups = strdup(s);
-    if (MARPAESLIF_UNLIKELY(dups == NULL)) {
-      MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
-      goto err;
+  /* Exponent: saturated, the exact value does not matter beyond the limit of any supported type */
+  if ((p < endp) && ((*p == 'e') || (*p == 'E'))) {
+    p++;
+    if ((p < endp) && ((*p == '+') || (*p == '-'))) {
+      exponentNegb = (*p == '-') ? 1 : 0;
+      p++;
     }
-    memmove(pmin, p, endptrendp - p + 1); /* + 1 for the NUL byte */
-
-    /* Impact of the memmove() */
-    numberl -= numberOfUnsignificantDigitl;
-    endptrendp -= numberOfUnsignificantDigitl;
-    if (dotp != NULL) {
-      dotp -= numberOfUnsignificantDigitl;
+    if (MARPAESLIF_UNLIKELY((p >= endp) || (! MARPAESLIF_NUMBER_IS_DIGIT(*p)))) {
+      goto parsing_to_double;
+    }
+    while ((p < endp) && MARPAESLIF_NUMBER_IS_DIGIT(*p)) {
+      if (exponentl < MARPAESLIF_NUMBER_EXPONENT_MAX) {
+        exponentl = (exponentl * 10) + (*p - '0');
+      }
+      p++;
     }
-    if (exponentp != NULL) {
-      exponentp -= numberOfUnsignificantDigitl;
+    if (exponentNegb) {
+      exponentl = -exponentl;
     }
+  }
 
-    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Now %ld bytes", (int) numberl, numbers, (unsigned long) numberl);
+  if (MARPAESLIF_UNLIKELY(p != endp)) {
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Not a number at offset %ld", (int) numberl, numbers, (unsigned long) (p - numbers));
+    goto parsing_to_double;
   }
 
-  /* Remove non significant digits after the dot character. */
-  if (dotp != NULL) {
-    pmin = dotp + 1;
-    if (exponentp != NULL) {
-      pmax = exponentp;
-    } else {
-      pmax = endptrendp;
-    }
+  /* significantl is only capped when there are too many significant digits: mantissau is then not exact */
+  fastb  = (significantl <= MARPAESLIF_NUMBER_DIGITS_MAX) ? 1 : 0;
+  scalel = exponentl - (long) decimall;
 
-    numberOfUnsignificantDigitl = 0;
-    /* We voluntarily say p > pmin so that */
-    /* we always retain at least one digit */
-    /* after the dot.                      */
-    for (p = pmax - 1; p > pmin; p--) {
-      if (*p != '0') {
-        break;
-      }
-      numberOfUnsignificantDigitl++;
-    }
-
-    if ((numberOfUnsignificantDigitl > 0) || ((p == pmin) && (*p == '0'))) {
-      /* It is guaranteed that numberOfUnsignificantDigitl is < total number of digits after the dot. */
-
-      if ((p == pmin) && (*p == '0')) {
-        /* Special case of (p == pmin) && (*p == '0'), then it means that it something like e.g.; */
-        /* 123.000000      */
-        /*    ^dotp        */
-        /*     ^pmin       */
-        /*           ^pmax */
-        /*     ^p          */
-        numberOfUnsignificantDigitl += 2;
-        MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Removing the dot part", (int) numberl, numbers, (unsigned long) numberOfUnsignificantDigitl);
-        if (dups == NULL) {
-          /* No backup copy yet */
-          dups = strdup(s);
-          if (MARPAESLIF_UNLIKELY(dups == NULL)) {
-            MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
-            goto err;
-          }
-        }
-        memmove(dotp, pmax, endptrendp - pmax + 1); /* + 1 for the NUL byte */
-        dotp = NULL;
-      } else {
-        /* 123.456000      */
-        /*     ^pmin       */
-        /*           ^pmax */
-        /*       ^p        */
-        MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Removing %ld non significant right digits", (int) numberl, numbers, (unsigned long) numberOfUnsignificantDigitl);
-        ++p;
-        if (dups == NULL) {
-          /* No backup copy yet */
-          dups = strdup(s);
-          if (MARPAESLIF_UNLIKELY(dups == NULL)) {
-            MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
-            goto err;
-          }
-        }
-        memmove(p, pmax, endptrendp - pmax + 1); /* + 1 for the NUL byte */
-      }
-
-      /* Impact of the memmove() */
-      numberl -= numberOfUnsignificantDigitl;
-      endptrendp -= numberOfUnsignificantDigitl;
-      if (exponentp != NULL) {
-        exponentp -= numberOfUnsignificantDigitl;
-      }
-
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Now %ld bytes", (int) numberl, numbers, (unsigned long) numberl);
-    }
-  }
-
-  /* We now have a number with no unsignificant digit. We want to know if this is a true floating point number. */
-
-  /* If there is an exponent, take its value - we assume that using a long is fair enough. */
-  if (exponentp == NULL) {
-    exponentl = 0;
-  } else {
-    endptrp = NULL;
-    errno = 0;    /* To distinguish success/failure after call */
-    exponentl = strtol(exponentp + 1, &endptrp, 10);
-    /* Note that the exponent in a JSON number always have at least one digit */
-    if ((endptrp != endptrendp) || (errno != 0)) {
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Exponent parsing failure", (int) numberl, numbers, errno != 0 ? strerror(errno) : "bad final pointer");
-      goto parsing_to_double;
-    }
-  }
-
-  if (dotp == NULL) {
-    decimall = 0;
-  } else {
-    pmin = dotp + 1;
-    if (exponentp != NULL) {
-      pmax = exponentp;
-    } else {
-      pmax = endptrendp;
-    }
-    decimall = pmax - pmin;
-  }
-
-  /* Check the eventual signedness */
-  isNegb = (numbers[0] == '-') ? 1 : 0;
-
-  /* Count the total number of digits needed to represent this non-floating number.                              */
-  /* Take care: decimall is unsigned; exponentl is signed and will be converted to unsigned if we do comparison. */
-  /* The value of charsl is guaranteed to be set only if isFloatb == 0.                                          */
-  if (decimall == 0) {
-    if (exponentl < 0) {
-      isFloatb = 1;
-    } else {
-      isFloatb = 0;
-      if (exponentp != NULL) {
-        /* [-]123E[+]789 */
-        charsl = exponentp - numbers;
-        prevCharsl = charsl;
-        charsl += exponentl;
-        if (MARPAESLIF_UNLIKELY(charsl < prevCharsl)) { /* Turnaround */
-          goto parsing_to_double;
-        }
-      } else {
-        /* [-]123 */
-        charsl = numberl;
-      }
-    }
-  } else {
-    /* Per def decimall here is > 0 */
-    if (exponentl <= 0) {
-      isFloatb = 1;
-    } else {
-      /* decimall is > 0, exponentl is > 0 and unsigned automatic conversion will not change its value */
-      /* I may change to a temporary variable of another type or use compiler's #pragma because        */
-      /* sometimes there is a warning.                                                                 */
-      if (exponentl < decimall) {
-        isFloatb = 1;
-      } else {
-        /* [-]123.456E[+]789 */
-        isFloatb = 0;
-        charsl = dotp - numbers;
-        prevCharsl = charsl;
-        charsl += exponentl;
-        if (MARPAESLIF_UNLIKELY(charsl < prevCharsl)) { /* Turnaround */
-          goto parsing_to_double;
-        }
-      }
-    }
-  }
-
-  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %ld decimals, exponent value is %ld => %sa true floating point number", (int) numberl, numbers, (unsigned long) decimall, (long) exponentl, isFloatb ? "" : "not ");
+  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %ld decimals, exponent value is %ld => %sa true floating point number", (int) numberl, numbers, (unsigned long) decimall, exponentl, (scalel < 0) ? "" : "not ");
 
-  if (isFloatb) {
+  if (scalel < 0) {
     /* A floating point number always trigger the proposal */
     goto parsing_to_double;
   }
@@ -3610,9 +3964,7 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
   /* Since the sign of zero can only be handled by a floating point number, and since zero  */
   /* is always exactly represented by the later, this special case is moved to the proposal */
   /* where we use floating pointer.                                                         */
-  if ((numbers[0] == '-') && (numbers[1] == '0')) {
-    /* It is a signed zero. This test is enough because we removed all non significant digits on */
-    /* the left side, keeping at most one digit. If this digit is '0' we are done.               */
+  if (isNegb && fastb && (mantissau == 0)) {
     MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: signed zero detected, forcing true floating point number", (int) numberl, numbers);
     marpaESLIFValueResult.contextp        = NULL;
     marpaESLIFValueResult.representationp = NULL;
@@ -3621,88 +3973,47 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
     goto proposal;
   }
 
+  /* Number of characters needed to completely represent this non-floating pointer number: this */
+  /* is the fast rejection of numbers that are obviously too long for the largest integer type.  */
+  charsl = (size_t) isNegb + integerl + (size_t) exponentl;
+
   MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %ld characters are needed to completely represent this non-floating pointer number", (int) numberl, numbers, (unsigned long) charsl);
 
-  /* Is it too long for the largest non-floating pointer integer that we have */
-  if (isNegb) {
-#ifdef MARPAESLIF_HAVE_LONG_LONG
-    if (charsl > marpaESLIFp->llongmincharsl) {
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (LLONG_MIN) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) marpaESLIFp->llongmincharsl);
-      goto parsing_to_double;
-    }
-#else
-    if (charsl > marpaESLIFp->longmincharsl) {
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (LONG_MIN) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) marpaESLIFp->longmincharsl);
-      goto parsing_to_double;
-    }
-#endif
-  } else {
 #ifdef MARPAESLIF_HAVE_LONG_LONG
-    if (charsl > marpaESLIFp->llongmaxcharsl) {
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (LLONG_MAX) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) marpaESLIFp->llongmaxcharsl);
-      goto parsing_to_double;
-    }
+  if (charsl > (isNegb ? marpaESLIFp->llongmincharsl : marpaESLIFp->llongmaxcharsl)) {
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (%s) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) (isNegb ? marpaESLIFp->llongmincharsl : marpaESLIFp->llongmaxcharsl), isNegb ? "LLONG_MIN" : "LLONG_MAX");
+    goto parsing_to_double;
+  }
+  maxu = (marpaESLIF_uint64_t) MARPAESLIF_LLONG_MAX + (isNegb ? 1 : 0);
 #else
-    if (charsl > marpaESLIFp->longmaxcharsl) {
-      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (LONG_MAX) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) marpaESLIFp->longmaxcharsl);
-      goto parsing_to_double
-    }
-#endif
+  if (charsl > (isNegb ? marpaESLIFp->longmincharsl : marpaESLIFp->longmaxcharsl)) {
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: charsl is %ld > %ld (%s) : go to proposal", (int) numberl, numbers, (unsigned long) charsl, (unsigned long) (isNegb ? marpaESLIFp->longmincharsl : marpaESLIFp->longmaxcharsl), isNegb ? "LONG_MIN" : "LONG_MAX");
+    goto parsing_to_double;
   }
+  maxu = (marpaESLIF_uint64_t) LONG_MAX + (isNegb ? 1 : 0);
+#endif
 
-  /* The only possibities are: */
-  /* [-]123                    */
-  /* [-]123E[+]789             */
-  /* [-]123.456E[+]789         */
-  p = integers;
-  if (dotp == NULL) {
-    if (exponentp == NULL) {
-      /* [-]123                */
-      memcpy(p, numbers, numberl);
-    } else {
-      /* [-]123E[+]789        */
-      l = exponentp - numbers;
-      memcpy(p, numbers, l);
-      q = p + l;
-      /* exponentl is positive by definition here.                                                     */
-      /* I may change to a temporary variable of another type or use compiler's #pragma because        */
-      /* sometimes there is a warning.                                                                 */
-      for (l = 0; l < exponentl; l++, q++) {
-        *q = '0';
+  if (! fastb) {
+    goto parsing_to_double;
+  }
+  valueu = mantissau;
+  if (valueu > 0) {
+    for (i = 0; i < scalel; i++) {
+      if (valueu > (maxu / 10)) {
+        MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: integer overflow", (int) numberl, numbers);
+        goto parsing_to_double;
       }
-    }
-  } else {
-    /* By definition decimall and exponentl are positive */
-    /* [-]123.456E[+]789      */
-    l = dotp - numbers;
-    memcpy(p, numbers, l);
-    q = p + l;
-
-    l = exponentp - dotp - 1;
-    memcpy(q, dotp + 1, l);
-    q += l;
-
-    shiftl = exponentl - decimall;
-    for (l = 0; l < shiftl; l++, q++) {
-      *q = '0';
+      valueu *= 10;
     }
   }
-
-  integers[charsl] = '\0';
-  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: Transformed for parsing to %s", (int) numberl, numbers, integers);
-  endptrendp = integers + charsl;
-
-#if defined(MARPAESLIF_HAVE_LONG_LONG) && defined(C_STRTOLL)
-  endptrp = NULL;
-  errno = 0;    /* To distinguish success/failure after call */
-  valuell = C_STRTOLL(integers, &endptrp, 10);
-  /* Note that the exponent in a JSON number always have at least one digit */
-  if ((endptrp != endptrendp) || (errno != 0)) {
-    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %s parsing failure, %s", (int) numberl, numbers, integers, errno != 0 ? strerror(errno) : "bad final pointer");
+  if (valueu > maxu) {
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: integer overflow", (int) numberl, numbers);
     goto parsing_to_double;
   }
-  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %s parsing success", (int) numberl, numbers, integers);
-  /* Can we promote it to a less higher thingy ? */
+
+  /* Can we promote it to a less higher thingy ? Note that valueu > 0 when isNegb is true. */
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+  valuell = isNegb ? (- (MARPAESLIF_LONG_LONG) (valueu - 1) - 1) : (MARPAESLIF_LONG_LONG) valueu;
   if ((SHRT_MIN <= valuell) && (valuell <= SHRT_MAX)) {
     MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %d fits in a SHORT", (int) numberl, numbers, (int) valuell);
     marpaESLIFValueResult.contextp        = NULL;
@@ -3729,16 +4040,7 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
     marpaESLIFValueResult.u.ll            = valuell;
   }
 #else
-  endptrp = NULL;
-  errno = 0;    /* To distinguish success/failure after call */
-  valuel = strtol(integers, &endptrp, 10);
-  /* Note that the exponent in a JSON number always have at least one digit */
-  if ((endptrp != endptrendp) || (errno != 0)) {
-    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %s parsing failure, %s", (int) numberl, numbers, integers, errno != 0 ? strerror(errno) : "bad final pointer");
-    goto parsing_to_double;
-  }
-  MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %s parsing success", (int) numberl, numbers, integers);
-  /* Can we promote it to a less higher thingy ? */
+  valuel = isNegb ? (- (long) (valueu - 1) - 1) : (long) valueu;
   if ((SHRT_MIN <= valuel) && (valuel <= SHRT_MAX)) {
     MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %d fits in a SHORT", (int) numberl, numbers, (int) valuel);
     marpaESLIFValueResult.contextp        = NULL;
@@ -3751,7 +4053,7 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
     marpaESLIFValueResult.representationp = NULL;
     marpaESLIFValueResult.type            = MARPAESLIF_VALUE_TYPE_INT;
     marpaESLIFValueResult.u.i             = (int) valuel;
-  } else if ((LONG_MIN <= valuel) && (valuel <= LONG_MAX)) {
+  } else {
     MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: %ld remains a LONG", (int) numberl, numbers, valuel);
     marpaESLIFValueResult.contextp        = NULL;
     marpaESLIFValueResult.representationp = NULL;
@@ -3764,20 +4066,79 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
 
  parsing_to_double:
   confidenceb = 0;
-  /* In the proposal we go back to the original string, as if nothing has happened. Only the eventual leading '+' */
-  /* remains removed. It is never needed.                                                                         */
 #if defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)
-  endptrendp = numbers + numberl;
-  /* Do we have to change the decimal point representation ? */
-  decimalPoints = strchr(numbers, '.');
-  decimalPointb = ((decimalPoints != NULL) && (*decimalPoints != marpaESLIFp->decimalPointc)) ? 1 : 0;
-  if (decimalPointb) {
-    *decimalPoints = marpaESLIFp->decimalPointc;
+#  ifdef MARPAESLIF_NUMBER_POW10L_MAX
+  /* Clinger's fast path: mantissau and the power of ten are exact, so a single operation is correctly rounded */
+  if (fastb && ((mantissau == 0) || ((mantissau <= MARPAESLIF_NUMBER_MANTISSAL_MAX) && (scalel >= -MARPAESLIF_NUMBER_POW10L_MAX) && (scalel <= MARPAESLIF_NUMBER_POW10L_MAX)))) {
+    valueld = (long double) mantissau;
+    if (mantissau != 0) {
+      if (scalel < 0) {
+        valueld /= _marpaESLIF_number_pow10ld[-scalel];
+      } else {
+        valueld *= _marpaESLIF_number_pow10ld[scalel];
+      }
+    }
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: long double fast path success", (int) numberl, numbers);
+    marpaESLIFValueResult.contextp        = NULL;
+    marpaESLIFValueResult.representationp = NULL;
+    marpaESLIFValueResult.type            = MARPAESLIF_VALUE_TYPE_LONG_DOUBLE;
+    marpaESLIFValueResult.u.ld            = isNegb ? -valueld : valueld;
+    goto proposal;
   }
-
+#  endif
+#else /* C_STRTOLD && MARPAESLIF_HUGE_VALL */
+#  if defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL)
+#    ifdef MARPAESLIF_NUMBER_POW10_MAX
+  /* Clinger's fast path: mantissau and the power of ten are exact, so a single operation is correctly rounded */
+  if (fastb && ((mantissau == 0) || ((mantissau <= MARPAESLIF_NUMBER_MANTISSA_MAX) && (scalel >= -MARPAESLIF_NUMBER_POW10_MAX) && (scalel <= MARPAESLIF_NUMBER_POW10_MAX)))) {
+    valued = (double) mantissau;
+    if (mantissau != 0) {
+      if (scalel < 0) {
+        valued /= _marpaESLIF_number_pow10d[-scalel];
+      } else {
+        valued *= _marpaESLIF_number_pow10d[scalel];
+      }
+    }
+    MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: double fast path success", (int) numberl, numbers);
+    marpaESLIFValueResult.contextp        = NULL;
+    marpaESLIFValueResult.representationp = NULL;
+    marpaESLIFValueResult.type            = MARPAESLIF_VALUE_TYPE_DOUBLE;
+    marpaESLIFValueResult.u.d             = isNegb ? -valued : valued;
+    goto proposal;
+  }
+#    endif
+#  endif /* C_STRTOD && MARPAESLIF_HUGE_VAL */
+#endif /* C_STRTOLD && MARPAESLIF_HUGE_VALL */
+#if (defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)) || (defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL))
+  /* The C library depends on the current locale for the decimal point: we give it a copy where the */
+  /* dot is replaced by the decimal point of the locale in effect now, not at marpaESLIF creation.   */
+  if (numberl < MARPAESLIF_NUMBER_BUFSIZ) {
+    floatp = floats;
+  } else {
+    floatheaps = (char *) MARPAESLIF_MALLOC(marpaESLIFp, numberl + 1);
+    if (MARPAESLIF_UNLIKELY(floatheaps == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+      goto err;
+    }
+    floatp = floatheaps;
+  }
+  memcpy(floatp, numbers, numberl);
+  floatp[numberl] = '\0';
+  if (dotp != NULL) {
+#  ifdef HAVE_LOCALE_H
+    lconvp        = localeconv();
+    decimalPointc = ((lconvp != NULL) && (lconvp->decimal_point != NULL) && (*(lconvp->decimal_point) != '\0')) ? *(lconvp->decimal_point) : '.';
+#  else
+    decimalPointc = '.';
+#  endif
+    floatp[dotp - numbers] = decimalPointc;
+  }
+  endptrendp = floatp + numberl;
+#endif
+#if defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)
   endptrp = NULL;
   errno = 0;    /* To distinguish success/failure after call */
-  valueld = C_STRTOLD(numbers, &endptrp);
+  valueld = C_STRTOLD(floatp, &endptrp);
   if (! ((endptrp != endptrendp) /* Parsing error */
          ||
          ((errno == ERANGE) && ((valueld == MARPAESLIF_HUGE_VALL) || (valueld == -MARPAESLIF_HUGE_VALL))) /* Overflow */
@@ -3795,22 +4156,11 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
     marpaESLIFValueResult.representationp = NULL;
     marpaESLIFValueResult.type            = MARPAESLIF_VALUE_TYPE_UNDEF;
   }
-  if (decimalPointb) {
-    *decimalPoints = '.';
-  }
 #else /* C_STRTOLD && MARPAESLIF_HUGE_VALL */
 #  if defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL)
-  endptrendp = numbers + numberl;
-  /* Do we have to change the decimal point representation ? */
-  decimalPoints = strchr(numbers, '.');
-  decimalPointb = ((decimalPoints != NULL) && (*decimalPoints != marpaESLIFp->decimalPointc)) ? 1 : 0;
-  if (decimalPointb) {
-    *decimalPoints = marpaESLIFp->decimalPointc;
-  }
-
   endptrp = NULL;
   errno = 0;    /* To distinguish success/failure after call */
-  valued = C_STRTOD(numbers, &endptrp);
+  valued = C_STRTOD(floatp, &endptrp);
   if (! ((endptrp != endptrendp) /* Parsing error */
          ||
          ((errno == ERANGE) && ((valued == MARPAESLIF_HUGE_VAL) || (valued == -MARPAESLIF_HUGE_VAL))) /* Overflow */
@@ -3828,9 +4178,6 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
     marpaESLIFValueResult.representationp = NULL;
     marpaESLIFValueResult.type            = MARPAESLIF_VALUE_TYPE_UNDEF;
   }
-  if (decimalPointb) {
-    *decimalPoints = '.';
-  }
 #  else /* C_STRTOD && MARPAESLIF_HUGE_VAL */
   MARPAESLIF_TRACEF(marpaESLIFp, funcs, "%.*s: No lib call available for parsing", (int) numberl, numbers);
   marpaESLIFValueResult.contextp        = NULL;
@@ -3850,16 +4197,17 @@ static inline short _marpaESLIF_numberb(marpaESLIF_t *marpaESLIFp, char *s, size
   rcb = 1;
   goto done;
 
+#if (defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)) || (defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL))
  err:
   rcb = 0;
+#endif
 
  done:
-  if (dups != NULL) {
-    /* We changed the input... Restore it */
-    memcpy(s, dups, sizel);
-    free(dups);
+#if (defined(C_STRTOLD) && defined(MARPAESLIF_HUGE_VALL)) || (defined(C_STRTOD) && defined(MARPAESLIF_HUGE_VAL))
+  if (floatheaps != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, floatheaps);
   }
-
+#endif
   return rcb;
 }
 
@@ -3943,13 +4291,13 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     ruleStackp = grammarp->ruleStackp;
 
     if (grammarp->defaultSymbolActionp == NULL) {
-      grammarp->defaultSymbolActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+      grammarp->defaultSymbolActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
       if (MARPAESLIF_UNLIKELY(grammarp->defaultSymbolActionp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
       grammarp->defaultSymbolActionp->type    = MARPAESLIF_ACTION_TYPE_NAME;
-      grammarp->defaultSymbolActionp->u.names = strdup("::transfer");
+      grammarp->defaultSymbolActionp->u.names = MARPAESLIF_STRDUP(marpaESLIFp, "::transfer");
       if (MARPAESLIF_UNLIKELY(grammarp->defaultSymbolActionp->u.names == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -3957,13 +4305,13 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     }
 
     if (grammarp->defaultRuleActionp == NULL) {
-      grammarp->defaultRuleActionp = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+      grammarp->defaultRuleActionp = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
       if (MARPAESLIF_UNLIKELY(grammarp->defaultRuleActionp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
       grammarp->defaultRuleActionp->type    = MARPAESLIF_ACTION_TYPE_NAME;
-      grammarp->defaultRuleActionp->u.names = strdup("::concat");
+      grammarp->defaultRuleActionp->u.names = MARPAESLIF_STRDUP(marpaESLIFp, "::concat");
       if (MARPAESLIF_UNLIKELY(grammarp->defaultRuleActionp->u.names == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -4108,7 +4456,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
       grammarp->nTerminalPristinel = nTerminalPristinel;
 
       if (grammarp->terminalArrayPristinepp == NULL) {
-        grammarp->terminalArrayPristinepp = (marpaESLIF_symbol_t **) malloc(nTerminalPristinel * sizeof(marpaESLIF_symbol_t *));
+        grammarp->terminalArrayPristinepp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalPristinel * sizeof(marpaESLIF_symbol_t *));
         if (MARPAESLIF_UNLIKELY(grammarp->terminalArrayPristinepp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4121,7 +4469,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
       }
 
       if (grammarp->terminalIdArrayPristinep == NULL) {
-        grammarp->terminalIdArrayPristinep = (int *) malloc(nTerminalPristinel * sizeof(int));
+        grammarp->terminalIdArrayPristinep = (int *) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalPristinel * sizeof(int));
         if (MARPAESLIF_UNLIKELY(grammarp->terminalIdArrayPristinep == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4139,14 +4487,14 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     if (grammarp->nTerminall > 0) {
       /* Prepare room for excepted terminals asked by the end-user */
       if (grammarp->expectedTerminalIdArrayp == NULL) {
-        grammarp->expectedTerminalIdArrayp = (int *) malloc(sizeof(int) * grammarp->nTerminall);
+        grammarp->expectedTerminalIdArrayp = (int *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(int) * grammarp->nTerminall);
         if (MARPAESLIF_UNLIKELY(grammarp->expectedTerminalIdArrayp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
         }
       }
       if (grammarp->expectedTerminalArraypp == NULL) {
-        grammarp->expectedTerminalArraypp = (marpaESLIF_symbol_t **) malloc(sizeof(marpaESLIF_symbol_t *) * grammarp->nTerminall);
+        grammarp->expectedTerminalArraypp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t *) * grammarp->nTerminall);
         if (MARPAESLIF_UNLIKELY(grammarp->expectedTerminalArraypp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4157,7 +4505,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     if (GENERICSTACK_USED(symbolStackp) > 0) {
       if (grammarp->allSymbolsArraypp == NULL) {
         MARPAESLIF_TRACEF(marpaESLIFp, funcs, "Flattening all symbols in grammar level %d (%s)", grammari, grammarp->descp->asciis);
-        grammarp->allSymbolsArraypp = (marpaESLIF_symbol_t **) malloc(sizeof(marpaESLIF_symbol_t *) * GENERICSTACK_USED(symbolStackp));
+        grammarp->allSymbolsArraypp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t *) * GENERICSTACK_USED(symbolStackp));
         if (MARPAESLIF_UNLIKELY(grammarp->allSymbolsArraypp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4169,10 +4517,30 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
       }
     }
 
+    if (grammarp->symbolNameHashp == NULL) {
+      MARPAESLIF_TRACEF(marpaESLIFp, funcs, "Indexing all symbols by name in grammar level %d (%s)", grammari, grammarp->descp->asciis);
+      grammarp->symbolNameHashp = &(grammarp->_symbolNameHash);
+      _marpaESLIF_hash_initv(marpaESLIFp, grammarp->symbolNameHashp,
+                             NULL, /* userDatavp */
+                             _marpaESLIF_symbolname_hashl,
+                             _marpaESLIF_symbolname_cmpb,
+                             NULL, /* keyFreeFunctionp - key is the symbol description */
+                             NULL  /* valFreeFunctionp - value is the symbol */);
+      for (symboli = 0; symboli < GENERICSTACK_USED(symbolStackp); symboli++) {
+        MARPAESLIF_INTERNAL_GET_SYMBOL_FROM_STACK(marpaESLIFp, symbolp, symbolStackp, symboli);
+        /* Only the first symbol with a given name is indexed, c.f. _marpaESLIF_symbol_findp() */
+        if (! _marpaESLIF_hash_findb(grammarp->symbolNameHashp, symbolp->descp->asciis, NULL)) {
+          if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_setb(marpaESLIFp, grammarp->symbolNameHashp, symbolp->descp->asciis, symbolp))) {
+            goto err;
+          }
+        }
+      }
+    }
+
     if (GENERICSTACK_USED(ruleStackp) > 0) {
       if (grammarp->allRulesArraypp == NULL) {
         MARPAESLIF_TRACEF(marpaESLIFp, funcs, "Flattening all rules in grammar level %d (%s)", grammari, grammarp->descp->asciis);
-        grammarp->allRulesArraypp = (marpaESLIF_rule_t **) malloc(sizeof(marpaESLIF_rule_t *) * GENERICSTACK_USED(ruleStackp));
+        grammarp->allRulesArraypp = (marpaESLIF_rule_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_rule_t *) * GENERICSTACK_USED(ruleStackp));
         if (MARPAESLIF_UNLIKELY(grammarp->allRulesArraypp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4287,7 +4655,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
 	grammarp->nTerminalDiscardPristinel = nTerminalDiscardPristinel;
 
         if (grammarp->terminalArrayDiscardPristinepp == NULL) {
-          grammarp->terminalArrayDiscardPristinepp = (marpaESLIF_symbol_t **) malloc(nTerminalDiscardPristinel * sizeof(marpaESLIF_symbol_t *));
+          grammarp->terminalArrayDiscardPristinepp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalDiscardPristinel * sizeof(marpaESLIF_symbol_t *));
           if (MARPAESLIF_UNLIKELY(grammarp->terminalArrayDiscardPristinepp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
@@ -4300,7 +4668,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
         }
 
         if (grammarp->terminalIdArrayDiscardPristinep == NULL) {
-          grammarp->terminalIdArrayDiscardPristinep = (int *) malloc(nTerminalDiscardPristinel * sizeof(int));
+          grammarp->terminalIdArrayDiscardPristinep = (int *) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalDiscardPristinel * sizeof(int));
           if (MARPAESLIF_UNLIKELY(grammarp->terminalIdArrayDiscardPristinep == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
             goto err;
@@ -4450,7 +4818,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
         /* The total list of terminals of a meta grammar is always the same as the destination grammar */
         metap->nTerminall    = subGrammarp->nTerminall;
         if (metap->nTerminall > 0) {
-          metap->symbolArraypp = (marpaESLIF_symbol_t **) malloc(sizeof(marpaESLIF_symbol_t *) * metap->nTerminall);
+          metap->symbolArraypp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t *) * metap->nTerminall);
           if (MARPAESLIF_UNLIKELY(metap->symbolArraypp == NULL)) {
               MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
               goto err;
@@ -4470,7 +4838,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
           metap->nTerminalPristinel = nTerminalPristinel;
 
           if (metap->terminalArrayPristinepp == NULL) {
-            metap->terminalArrayPristinepp = (marpaESLIF_symbol_t **) malloc(nTerminalPristinel * sizeof(marpaESLIF_symbol_t *));
+            metap->terminalArrayPristinepp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalPristinel * sizeof(marpaESLIF_symbol_t *));
             if (MARPAESLIF_UNLIKELY(metap->terminalArrayPristinepp == NULL)) {
               MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
               goto err;
@@ -4483,7 +4851,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
           }
 
           if (metap->terminalIdArrayPristinep == NULL) {
-            metap->terminalIdArrayPristinep = (int *) malloc(nTerminalPristinel * sizeof(int));
+            metap->terminalIdArrayPristinep = (int *) MARPAESLIF_MALLOC(marpaESLIFp, nTerminalPristinel * sizeof(int));
             if (MARPAESLIF_UNLIKELY(metap->terminalIdArrayPristinep == NULL)) {
               MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
               goto err;
@@ -4872,7 +5240,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     grammarp->nrulel = GENERICSTACK_USED(ruleStackp);
     if (grammarp->nrulel > 0) {
       if (grammarp->ruleip == NULL) {
-        grammarp->ruleip = (int *) malloc(grammarp->nrulel * sizeof(int));
+        grammarp->ruleip = (int *) MARPAESLIF_MALLOC(marpaESLIFp, grammarp->nrulel * sizeof(int));
         if (MARPAESLIF_UNLIKELY(grammarp->ruleip == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -4882,7 +5250,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
           grammarp->ruleip[rulei] = rulep->idi;
           if (rulep->asciishows == NULL) {
             _marpaESLIF_rule_createshowv(marpaESLIFp, grammarp, rulep, NULL, &asciishowl);
-            rulep->asciishows = (char *) malloc(asciishowl);
+            rulep->asciishows = (char *) MARPAESLIF_MALLOC(marpaESLIFp, asciishowl);
             if (MARPAESLIF_UNLIKELY(rulep->asciishows == NULL)) {
               MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
               goto err;
@@ -4906,7 +5274,7 @@ static inline short _marpaESLIFGrammar_validateb(marpaESLIFGrammar_t *marpaESLIF
     grammarp->nsymboll = GENERICSTACK_USED(symbolStackp);
     if (grammarp->nsymboll > 0) {
       if (grammarp->symbolip == NULL) {
-        grammarp->symbolip = (int *) malloc(grammarp->nsymboll * sizeof(int));
+        grammarp->symbolip = (int *) MARPAESLIF_MALLOC(marpaESLIFp, grammarp->nsymboll * sizeof(int));
         if (MARPAESLIF_UNLIKELY(grammarp->symbolip == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -5180,14 +5548,14 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     }
   }
   if (grammarOrigp->defaultEncodings != NULL) {
-    grammarp->defaultEncodings = strdup(grammarOrigp->defaultEncodings);
+    grammarp->defaultEncodings = MARPAESLIF_STRDUP(marpaESLIFp, grammarOrigp->defaultEncodings);
     if (MARPAESLIF_UNLIKELY(grammarp->defaultEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
     }
   }
   if (grammarOrigp->fallbackEncodings != NULL) {
-    grammarp->fallbackEncodings = strdup(grammarOrigp->fallbackEncodings);
+    grammarp->fallbackEncodings = MARPAESLIF_STRDUP(marpaESLIFp, grammarOrigp->fallbackEncodings);
     if (MARPAESLIF_UNLIKELY(grammarp->fallbackEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -5299,11 +5667,12 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
         symbolp->u.terminalp->substitutionPatterns  = substitutionTerminalp->patterns;
         symbolp->u.terminalp->substitutionPatternl  = substitutionTerminalp->patternl;
         symbolp->u.terminalp->substitutionPatterni  = substitutionTerminalp->patterni;
+        symbolp->u.terminalp->substitutionRefl      = _marpaESLIF_substitution_refl(substitutionTerminalp->patterns, substitutionTerminalp->patternl);
 
         substitutionTerminalp->utf8s     = NULL; /* it is now in symbolp->u.terminalp */
         substitutionTerminalp->modifiers = NULL; /* it is now in symbolp->u.terminalp */
         substitutionTerminalp->patterns  = NULL; /* it is now in symbolp->u.terminalp */
-        _marpaESLIF_terminal_freev(substitutionTerminalp);
+        _marpaESLIF_terminal_freev(marpaESLIFp, substitutionTerminalp);
         substitutionTerminalp = NULL;
       }
 
@@ -5317,7 +5686,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     symbolp->discardb  = symbolOrigp->discardb;
 
     if (symbolOrigp->eventBefores != NULL) {
-      symbolp->eventBefores = strdup(symbolOrigp->eventBefores);
+      symbolp->eventBefores = MARPAESLIF_STRDUP(marpaESLIFp, symbolOrigp->eventBefores);
       if (MARPAESLIF_UNLIKELY(symbolp->eventBefores == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5326,7 +5695,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     symbolp->eventBeforeb = symbolOrigp->eventBeforeb;
 
     if (symbolOrigp->eventAfters != NULL) {
-      symbolp->eventAfters = strdup(symbolOrigp->eventAfters);
+      symbolp->eventAfters = MARPAESLIF_STRDUP(marpaESLIFp, symbolOrigp->eventAfters);
       if (MARPAESLIF_UNLIKELY(symbolp->eventAfters == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5335,7 +5704,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     symbolp->eventAfterb = symbolOrigp->eventAfterb;
 
     if (symbolOrigp->eventPredicteds != NULL) {
-      symbolp->eventPredicteds = strdup(symbolOrigp->eventPredicteds);
+      symbolp->eventPredicteds = MARPAESLIF_STRDUP(marpaESLIFp, symbolOrigp->eventPredicteds);
       if (MARPAESLIF_UNLIKELY(symbolp->eventPredicteds == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5344,7 +5713,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     symbolp->eventPredictedb = symbolOrigp->eventPredictedb;
 
     if (symbolOrigp->eventNulleds != NULL) {
-      symbolp->eventNulleds = strdup(symbolOrigp->eventNulleds);
+      symbolp->eventNulleds = MARPAESLIF_STRDUP(marpaESLIFp, symbolOrigp->eventNulleds);
       if (MARPAESLIF_UNLIKELY(symbolp->eventNulleds == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5353,7 +5722,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     symbolp->eventNulledb = symbolOrigp->eventNulledb;
 
     if (symbolOrigp->eventCompleteds != NULL) {
-      symbolp->eventCompleteds = strdup(symbolOrigp->eventCompleteds);
+      symbolp->eventCompleteds = MARPAESLIF_STRDUP(marpaESLIFp, symbolOrigp->eventCompleteds);
       if (MARPAESLIF_UNLIKELY(symbolp->eventCompleteds == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5439,7 +5808,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
     rulep->internalb = ruleOrigp->internalb;
 
     if (ruleOrigp->discardEvents != NULL) {
-      rulep->discardEvents = strdup(ruleOrigp->discardEvents);
+      rulep->discardEvents = MARPAESLIF_STRDUP(marpaESLIFp, ruleOrigp->discardEvents);
       if (MARPAESLIF_UNLIKELY(rulep->discardEvents == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         goto err;
@@ -5458,15 +5827,15 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_clon
   goto done;
 
  err:
-  _marpaESLIF_grammar_bootstrap_freev(grammarp);
+  _marpaESLIF_grammar_bootstrap_freev(marpaESLIFp, grammarp);
   grammarp = NULL;
 
  done:
-  _marpaESLIF_terminal_freev(terminalp);
-  _marpaESLIF_terminal_freev(substitutionTerminalp);
-  _marpaESLIF_meta_freev(metap);
-  _marpaESLIF_symbol_freev(symbolp);
-  _marpaESLIF_rule_freev(rulep);
+  _marpaESLIF_terminal_freev(marpaESLIFp, terminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFp, substitutionTerminalp);
+  _marpaESLIF_meta_freev(marpaESLIFp, metap);
+  _marpaESLIF_symbol_freev(marpaESLIFp, symbolp);
+  _marpaESLIF_rule_freev(marpaESLIFp, rulep);
   return grammarp;
 }
 
@@ -5484,7 +5853,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_newp
     goto err;
   }
   
-  grammarBootstrapp = (marpaESLIF_grammar_bootstrap_t *) malloc(sizeof(marpaESLIF_grammar_bootstrap_t));
+  grammarBootstrapp = (marpaESLIF_grammar_bootstrap_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_grammar_bootstrap_t));
   if (MARPAESLIF_UNLIKELY(grammarBootstrapp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5529,7 +5898,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_newp
       goto err;
   }
     grammarBootstrapp->descp = _marpaESLIF_string_newp(marpaESLIFp, "ASCII" /* We KNOW we generated an ASCII stringy */, marpaESLIF_stringGenerator.s, strlen(marpaESLIF_stringGenerator.s));
-    free(marpaESLIF_stringGenerator.s);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);
     grammarBootstrapp->descautob = 1;
   } else {
     grammarBootstrapp->descp = _marpaESLIF_string_clonep(marpaESLIFp, descp);
@@ -5567,7 +5936,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_newp
   goto done;
 
  err:
-  _marpaESLIF_grammar_bootstrap_freev(grammarBootstrapp);
+  _marpaESLIF_grammar_bootstrap_freev(marpaESLIFp, grammarBootstrapp);
   grammarBootstrapp = NULL;
 
  done:
@@ -5622,6 +5991,7 @@ static inline short _marpaESLIF_grammar_initb(marpaESLIF_t *marpaESLIFp, marpaES
   grammarp->fallbackEncodings                  = NULL;
   grammarp->fastDiscardb                       = 0;    /* Filled by grammar validation */
   grammarp->allSymbolsArraypp                  = NULL;
+  grammarp->symbolNameHashp                    = NULL;
   grammarp->allRulesArraypp                    = NULL;
   grammarp->expectedTerminalIdArrayp           = NULL;
   grammarp->expectedTerminalArraypp            = NULL;
@@ -5669,7 +6039,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
     goto err;
   }
   
-  grammarp = (marpaESLIF_grammar_t *) malloc(sizeof(marpaESLIF_grammar_t));
+  grammarp = (marpaESLIF_grammar_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_grammar_t));
   if (MARPAESLIF_UNLIKELY(grammarp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -5705,7 +6075,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
       goto err;
     }
     grammarp->descp = _marpaESLIF_string_newp(marpaESLIFp, "ASCII" /* We KNOW we generated an ASCII stringy */, marpaESLIF_stringGenerator.s, strlen(marpaESLIF_stringGenerator.s));
-    free(marpaESLIF_stringGenerator.s);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);
     grammarp->descautob = 1;
   } else {
     grammarp->descp = _marpaESLIF_string_newp(marpaESLIFp, descEncodings, descs, descl);
@@ -5756,7 +6126,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
   }
 
   if (defaultEncodings != NULL) {
-    grammarp->defaultEncodings = strdup(defaultEncodings);
+    grammarp->defaultEncodings = MARPAESLIF_STRDUP(marpaESLIFp, defaultEncodings);
     if (MARPAESLIF_UNLIKELY(grammarp->defaultEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -5764,7 +6134,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
   }
 
   if (fallbackEncodings != NULL) {
-    grammarp->fallbackEncodings = strdup(fallbackEncodings);
+    grammarp->fallbackEncodings = MARPAESLIF_STRDUP(marpaESLIFp, fallbackEncodings);
     if (MARPAESLIF_UNLIKELY(grammarp->fallbackEncodings == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -5774,7 +6144,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
   goto done;
 
  err:
-  _marpaESLIF_grammar_freev(grammarp);
+  _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
   grammarp = NULL;
 
  done:
@@ -5784,36 +6154,36 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_newp(marpaESLIFGrammar_t
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_grammar_bootstrap_freev(marpaESLIF_grammar_bootstrap_t *grammarp)
+static inline void _marpaESLIF_grammar_bootstrap_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_bootstrap_t *grammarp)
 /*****************************************************************************/
 {
   if (grammarp != NULL) {
     if (grammarp->marpaWrapperGrammarStartp != NULL) {
       marpaWrapperGrammar_freev(grammarp->marpaWrapperGrammarStartp);
     }
-    _marpaESLIF_string_freev(grammarp->descp, 0 /* onStackb */);
-    _marpaESLIF_action_freev(grammarp->defaultRuleActionp);
-    _marpaESLIF_action_freev(grammarp->defaultSymbolActionp);
-    _marpaESLIF_action_freev(grammarp->defaultEventActionp);
-    _marpaESLIF_action_freev(grammarp->defaultRegexActionp);
+    _marpaESLIF_string_freev(marpaESLIFp, grammarp->descp, 0 /* onStackb */);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRuleActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultSymbolActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultEventActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRegexActionp);
     if (grammarp->defaultEncodings != NULL) {
-      free(grammarp->defaultEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->defaultEncodings);
     }
     if (grammarp->fallbackEncodings != NULL) {
-      free(grammarp->fallbackEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->fallbackEncodings);
     }
-    _marpaESLIF_symbolStack_freev(grammarp->symbolStackp);
-    _marpaESLIF_ruleStack_freev(grammarp->ruleStackp);
-    free(grammarp);
+    _marpaESLIF_symbolStack_freev(marpaESLIFp, grammarp->symbolStackp);
+    _marpaESLIF_ruleStack_freev(marpaESLIFp, grammarp->ruleStackp);
+    MARPAESLIF_FREE(marpaESLIFp, grammarp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_grammar_freev(marpaESLIF_grammar_t *grammarp)
+static inline void _marpaESLIF_grammar_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_grammar_t *grammarp)
 /*****************************************************************************/
 {
   if (grammarp != NULL) {
-    _marpaESLIF_string_freev(grammarp->descp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, grammarp->descp, 0 /* onStackb */);
     if (grammarp->marpaWrapperGrammarStartp != NULL) {
       marpaWrapperGrammar_freev(grammarp->marpaWrapperGrammarStartp);
     }
@@ -5821,10 +6191,10 @@ static inline void _marpaESLIF_grammar_freev(marpaESLIF_grammar_t *grammarp)
       marpaWrapperGrammar_freev(grammarp->marpaWrapperGrammarStartNoEventp);
     }
     if (grammarp->terminalIdArrayPristinep != NULL) {
-      free(grammarp->terminalIdArrayPristinep);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->terminalIdArrayPristinep);
     }
     if (grammarp->terminalArrayPristinepp != NULL) {
-      free(grammarp->terminalArrayPristinepp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->terminalArrayPristinepp);
     }
     if (grammarp->marpaWrapperGrammarDiscardp != NULL) {
       marpaWrapperGrammar_freev(grammarp->marpaWrapperGrammarDiscardp);
@@ -5833,60 +6203,63 @@ static inline void _marpaESLIF_grammar_freev(marpaESLIF_grammar_t *grammarp)
       marpaWrapperGrammar_freev(grammarp->marpaWrapperGrammarDiscardNoEventp);
     }
     if (grammarp->terminalIdArrayDiscardPristinep != NULL) {
-      free(grammarp->terminalIdArrayDiscardPristinep);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->terminalIdArrayDiscardPristinep);
     }
     if (grammarp->terminalArrayDiscardPristinepp != NULL) {
-      free(grammarp->terminalArrayDiscardPristinepp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->terminalArrayDiscardPristinepp);
     }
-    _marpaESLIF_symbolStack_freev(grammarp->symbolStackp);
-    _marpaESLIF_ruleStack_freev(grammarp->ruleStackp);
+    _marpaESLIF_symbolStack_freev(marpaESLIFp, grammarp->symbolStackp);
+    _marpaESLIF_ruleStack_freev(marpaESLIFp, grammarp->ruleStackp);
     if (grammarp->ruleip != NULL) {
-      free(grammarp->ruleip);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->ruleip);
     }
     if (grammarp->symbolip != NULL) {
-      free(grammarp->symbolip);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->symbolip);
     }
-    _marpaESLIF_action_freev(grammarp->defaultSymbolActionp);
-    _marpaESLIF_action_freev(grammarp->defaultRuleActionp);
-    _marpaESLIF_action_freev(grammarp->defaultEventActionp);
-    _marpaESLIF_action_freev(grammarp->defaultRegexActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultSymbolActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRuleActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultEventActionp);
+    _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRegexActionp);
     if (grammarp->defaultEncodings != NULL) {
-      free(grammarp->defaultEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->defaultEncodings);
     }
     if (grammarp->fallbackEncodings != NULL) {
-      free(grammarp->fallbackEncodings);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->fallbackEncodings);
     }
     if (grammarp->asciishows != NULL) {
-      free(grammarp->asciishows);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->asciishows);
     }
     if (grammarp->symbolArraypp != NULL) {
-      free(grammarp->symbolArraypp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->symbolArraypp);
     }
     if (grammarp->allSymbolsArraypp != NULL) {
-      free(grammarp->allSymbolsArraypp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->allSymbolsArraypp);
+    }
+    if (grammarp->symbolNameHashp != NULL) {
+      _marpaESLIF_hash_resetv(marpaESLIFp, grammarp->symbolNameHashp);
     }
     if (grammarp->allRulesArraypp != NULL) {
-      free(grammarp->allRulesArraypp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->allRulesArraypp);
     }
     if (grammarp->expectedTerminalIdArrayp != NULL) {
-      free(grammarp->expectedTerminalIdArrayp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->expectedTerminalIdArrayp);
     }
     if (grammarp->expectedTerminalArraypp != NULL) {
-      free(grammarp->expectedTerminalArraypp);
+      MARPAESLIF_FREE(marpaESLIFp, grammarp->expectedTerminalArraypp);
     }
-    free(grammarp);
+    MARPAESLIF_FREE(marpaESLIFp, grammarp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_ruleStack_freev(genericStack_t *ruleStackp)
+static inline void _marpaESLIF_ruleStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *ruleStackp)
 /*****************************************************************************/
 {
   if (ruleStackp != NULL) {
     while (GENERICSTACK_USED(ruleStackp) > 0) {
       if (GENERICSTACK_IS_PTR(ruleStackp, GENERICSTACK_USED(ruleStackp) - 1)) {
 	marpaESLIF_rule_t *rulep = (marpaESLIF_rule_t *) GENERICSTACK_POP_PTR(ruleStackp);
-	_marpaESLIF_rule_freev(rulep);
+	_marpaESLIF_rule_freev(marpaESLIFp, rulep);
       } else {
 	GENERICSTACK_USED(ruleStackp)--;
       }
@@ -5935,6 +6308,7 @@ static inline void _marpaESLIFRecognizer_lexemeStack_resetv(marpaESLIFRecognizer
                                                  NULL /* marpaESLIFValueResultOrigp */);
     }
     GENERICSTACK_RELAX(marpaESLIFRecognizerp->lexemeStackp);
+    marpaESLIFRecognizerp->lexemeBytesl = 0;
   }
 }
 
@@ -5960,7 +6334,16 @@ static inline short _marpaESLIFRecognizer_lexemeStack_i_setb(marpaESLIFRecognize
 						   marpaESLIFValueResultp,
 						   0, /* forgetb */
 						   NULL /* marpaESLIFValueResultOrigp */);
-  
+
+  /* Lexemes are kept until the recognizer is reset: account their bytes */
+  if (rcb) {
+    if ((marpaESLIFValueResultp->type == MARPAESLIF_VALUE_TYPE_ARRAY) && (! marpaESLIFValueResultp->u.a.shallowb)) {
+      marpaESLIFRecognizerp->lexemeBytesl += marpaESLIFValueResultp->u.a.sizel;
+    } else if ((marpaESLIFValueResultp->type == MARPAESLIF_VALUE_TYPE_STRING) && (! marpaESLIFValueResultp->u.s.shallowb)) {
+      marpaESLIFRecognizerp->lexemeBytesl += marpaESLIFValueResultp->u.s.sizel;
+    }
+  }
+
   goto done;
 
  err:
@@ -5996,7 +6379,7 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
     goto err;
   }
 
-  rulep = (marpaESLIF_rule_t *) malloc(sizeof(marpaESLIF_rule_t));
+  rulep = (marpaESLIF_rule_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_rule_t));
   if (MARPAESLIF_UNLIKELY(rulep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -6035,17 +6418,17 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
   rulep->internalb          = 0;
 
   if (nrhsl > 0) {
-    rulep->rhspp = (marpaESLIF_symbol_t **) malloc(nrhsl * sizeof(marpaESLIF_symbol_t *));
+    rulep->rhspp = (marpaESLIF_symbol_t **) MARPAESLIF_MALLOC(marpaESLIFp, nrhsl * sizeof(marpaESLIF_symbol_t *));
     if (MARPAESLIF_UNLIKELY(rulep->rhspp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
     }
-    rulep->rhsip = (int *) malloc(nrhsl * sizeof(int));
+    rulep->rhsip = (int *) MARPAESLIF_MALLOC(marpaESLIFp, nrhsl * sizeof(int));
     if (MARPAESLIF_UNLIKELY(rulep->rhsip == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
     }
-    rulep->callpp = (marpaESLIF_lua_functioncall_t **) malloc(nrhsl * sizeof(marpaESLIF_lua_functioncall_t *));
+    rulep->callpp = (marpaESLIF_lua_functioncall_t **) MARPAESLIF_MALLOC(marpaESLIFp, nrhsl * sizeof(marpaESLIF_lua_functioncall_t *));
     if (MARPAESLIF_UNLIKELY(rulep->callpp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -6075,7 +6458,7 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
   /* Set eventual skipped symbols */
   if (nrhsl > 0) {
     if (skipbp != NULL) {
-      rulep->skipbp = (short *) malloc(sizeof(short) * nrhsl);
+      rulep->skipbp = (short *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(short) * nrhsl);
       if (MARPAESLIF_UNLIKELY(rulep->skipbp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -6164,7 +6547,7 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
     }
     rulep->descp = _marpaESLIF_string_newp(marpaESLIFp, "ASCII" /* We KNOW we generated an ASCII stringy */, marpaESLIF_stringGenerator.s, strlen(marpaESLIF_stringGenerator.s));
     rulep->descautob = 1;
-    free(marpaESLIF_stringGenerator.s);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);
   } else {
     rulep->descp = _marpaESLIF_string_newp(marpaESLIFp, descEncodings, descs, descl);
     rulep->descautob = 0;
@@ -6194,7 +6577,7 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
   goto done;
 
  err:
-  _marpaESLIF_rule_freev(rulep);
+  _marpaESLIF_rule_freev(marpaESLIFp, rulep);
   rulep = NULL;
 
  done:
@@ -6204,38 +6587,38 @@ static inline marpaESLIF_rule_t *_marpaESLIF_rule_newp(marpaESLIF_t *marpaESLIFp
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_rule_freev(marpaESLIF_rule_t *rulep)
+static inline void _marpaESLIF_rule_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_rule_t *rulep)
 /*****************************************************************************/
 {
   size_t rhsl;
 
   if (rulep != NULL) {
-    _marpaESLIF_string_freev(rulep->descp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, rulep->descp, 0 /* onStackb */);
     if (rulep->asciishows != NULL) {
-      free(rulep->asciishows);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->asciishows);
     }
-    _marpaESLIF_action_freev(rulep->actionp);
+    _marpaESLIF_action_freev(marpaESLIFp, rulep->actionp);
     if (rulep->rhspp != NULL) {
-      free(rulep->rhspp);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->rhspp);
     }
     if (rulep->rhsip != NULL) {
-      free(rulep->rhsip);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->rhsip);
     }
     if (rulep->skipbp != NULL) {
-      free(rulep->skipbp);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->skipbp);
     }
     if (rulep->discardEvents) {
-      free(rulep->discardEvents);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->discardEvents);
     }
-    _marpaESLIF_lua_functiondecl_freev(rulep->declp);
+    _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, rulep->declp);
     if (rulep->callpp != NULL) {
       for (rhsl = 0; rhsl < rulep->nrhsl; rhsl++) {
-        _marpaESLIF_lua_functioncall_freev(rulep->callpp[rhsl]);
+        _marpaESLIF_lua_functioncall_freev(marpaESLIFp, rulep->callpp[rhsl]);
       }
-      free(rulep->callpp);
+      MARPAESLIF_FREE(marpaESLIFp, rulep->callpp);
     }
-    _marpaESLIF_lua_functioncall_freev(rulep->separatorcallp);
-    free(rulep);
+    _marpaESLIF_lua_functioncall_freev(marpaESLIFp, rulep->separatorcallp);
+    MARPAESLIF_FREE(marpaESLIFp, rulep);
   }
 }
 
@@ -6248,7 +6631,7 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_symbol_newp(marpaESLIF_t *marpaES
 
   /* MARPAESLIF_TRACE(marpaESLIFp, funcs, "Building symbol"); */
 
-  symbolp = (marpaESLIF_symbol_t *) malloc(sizeof(marpaESLIF_symbol_t));
+  symbolp = (marpaESLIF_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t));
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -6336,7 +6719,7 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_symbol_newp(marpaESLIF_t *marpaES
   goto done;
 
  err:
-  _marpaESLIF_symbol_freev(symbolp);
+  _marpaESLIF_symbol_freev(marpaESLIFp, symbolp);
   symbolp = NULL;
 
  done:
@@ -6345,7 +6728,7 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_symbol_newp(marpaESLIF_t *marpaES
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_symbol_freev(marpaESLIF_symbol_t *symbolp)
+static inline void _marpaESLIF_symbol_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_symbol_t *symbolp)
 /*****************************************************************************/
 {
   if (symbolp != NULL) {
@@ -6355,58 +6738,58 @@ static inline void _marpaESLIF_symbol_freev(marpaESLIF_symbol_t *symbolp)
       case MARPAESLIF_SYMBOL_TYPE_TERMINAL:
         if (symbolp->descp != symbolp->u.terminalp->descp) {
           /* A :terminal or :symbol rule overwrote default description */
-          _marpaESLIF_string_freev(symbolp->descp, 0 /* onStackb */);
+          _marpaESLIF_string_freev(marpaESLIFp, symbolp->descp, 0 /* onStackb */);
         }
-        _marpaESLIF_terminal_freev(symbolp->u.terminalp);
+        _marpaESLIF_terminal_freev(marpaESLIFp, symbolp->u.terminalp);
         break;
       case MARPAESLIF_SYMBOL_TYPE_META:
         if (symbolp->descp != symbolp->u.metap->descp) {
           /* A :lexeme or :symbol rule overwrote default description */
-          _marpaESLIF_string_freev(symbolp->descp, 0 /* onStackb */);
+          _marpaESLIF_string_freev(marpaESLIFp, symbolp->descp, 0 /* onStackb */);
         }
-        _marpaESLIF_meta_freev(symbolp->u.metap);
+        _marpaESLIF_meta_freev(marpaESLIFp, symbolp->u.metap);
         break;
       default:
         break;
       }
       if (symbolp->eventBefores != NULL) {
-        free(symbolp->eventBefores);
+        MARPAESLIF_FREE(marpaESLIFp, symbolp->eventBefores);
       }
       if (symbolp->eventAfters != NULL) {
-        free(symbolp->eventAfters);
+        MARPAESLIF_FREE(marpaESLIFp, symbolp->eventAfters);
       }
       if (symbolp->eventPredicteds) {
-        free(symbolp->eventPredicteds);
+        MARPAESLIF_FREE(marpaESLIFp, symbolp->eventPredicteds);
       }
       if (symbolp->eventNulleds) {
-        free(symbolp->eventNulleds);
+        MARPAESLIF_FREE(marpaESLIFp, symbolp->eventNulleds);
       }
       if (symbolp->eventCompleteds) {
-        free(symbolp->eventCompleteds);
+        MARPAESLIF_FREE(marpaESLIFp, symbolp->eventCompleteds);
       }
-      _marpaESLIF_lua_functiondecl_freev(symbolp->eventDeclp);
-      _marpaESLIF_action_freev(symbolp->symbolActionp);
-      _marpaESLIF_action_freev(symbolp->ifActionp);
-      _marpaESLIF_action_freev(symbolp->generatorActionp);
-      _marpaESLIF_action_freev(symbolp->pushContextActionp);
+      _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, symbolp->eventDeclp);
+      _marpaESLIF_action_freev(marpaESLIFp, symbolp->symbolActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, symbolp->ifActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, symbolp->generatorActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, symbolp->pushContextActionp);
 
       GENERICSTACK_RESET(symbolp->nullableRuleStackp); /* Take care, this is a pointer to stack internal to symbol structure */
       GENERICSTACK_RESET(symbolp->lhsRuleStackp); /* Take care, this is a pointer to stack internal to symbol structure */
     } /* contentIsShallowb */
 
-    free(symbolp);
+    MARPAESLIF_FREE(marpaESLIFp, symbolp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_symbolStack_freev(genericStack_t *symbolStackp)
+static inline void _marpaESLIF_symbolStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *symbolStackp)
 /*****************************************************************************/
 {
   if (symbolStackp != NULL) {
     while (GENERICSTACK_USED(symbolStackp) > 0) {
       if (GENERICSTACK_IS_PTR(symbolStackp, GENERICSTACK_USED(symbolStackp) - 1)) {
 	marpaESLIF_symbol_t *symbolp = (marpaESLIF_symbol_t *) GENERICSTACK_POP_PTR(symbolStackp);
-	_marpaESLIF_symbol_freev(symbolp);
+	_marpaESLIF_symbol_freev(marpaESLIFp, symbolp);
       } else {
 	GENERICSTACK_USED(symbolStackp)--;
       }
@@ -6416,28 +6799,28 @@ static inline void _marpaESLIF_symbolStack_freev(genericStack_t *symbolStackp)
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_terminal_freev(marpaESLIF_terminal_t *terminalp)
+static inline void _marpaESLIF_terminal_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp)
 /*****************************************************************************/
 {
   if (terminalp != NULL) {
     if (terminalp->utf8s != NULL) {
-      free(terminalp->utf8s);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->utf8s);
     }
-    _marpaESLIF_string_freev(terminalp->descp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, terminalp->descp, 0 /* onStackb */);
     if (terminalp->modifiers != NULL) {
-      free(terminalp->modifiers);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->modifiers);
     }
     if (terminalp->patterns != NULL) {
-      free(terminalp->patterns);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->patterns);
     }
     if (terminalp->substitutionUtf8s != NULL) {
-      free(terminalp->substitutionUtf8s);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->substitutionUtf8s);
     }
     if (terminalp->substitutionModifiers != NULL) {
-      free(terminalp->substitutionModifiers);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->substitutionModifiers);
     }
     if (terminalp->substitutionPatterns != NULL) {
-      free(terminalp->substitutionPatterns);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->substitutionPatterns);
     }
     if (terminalp->regex.match_datap != NULL) {
       pcre2_match_data_free(terminalp->regex.match_datap);
@@ -6452,9 +6835,9 @@ static inline void _marpaESLIF_terminal_freev(marpaESLIF_terminal_t *terminalp)
       pcre2_match_context_free(terminalp->regex.match_contextp);
     }
     if (terminalp->bytes != NULL) {
-      free(terminalp->bytes);
+      MARPAESLIF_FREE(marpaESLIFp, terminalp->bytes);
     }
-    free(terminalp);
+    MARPAESLIF_FREE(marpaESLIFp, terminalp);
   }
 }
 
@@ -6558,6 +6941,100 @@ short marpaESLIF_versionPatchb(marpaESLIF_t *marpaESLIFp, int *versionPatchip)
   return rcb;
 }
 
+/*****************************************************************************/
+static inline void *_marpaESLIF_mallocp(marpaESLIF_t *marpaESLIFp, size_t sizel)
+/*****************************************************************************/
+{
+  marpaESLIFAllocator_t *allocatorp = (marpaESLIFp != NULL) ? marpaESLIFp->allocatorp : NULL;
+
+  return (allocatorp == NULL) ? malloc(sizel) : allocatorp->mallocp(allocatorp->userDatavp, sizel);
+}
+
+/*****************************************************************************/
+static inline void *_marpaESLIF_callocp(marpaESLIF_t *marpaESLIFp, size_t nmemb, size_t sizel)
+/*****************************************************************************/
+{
+  marpaESLIFAllocator_t *allocatorp = (marpaESLIFp != NULL) ? marpaESLIFp->allocatorp : NULL;
+  void                  *p;
+
+  if (allocatorp == NULL) {
+    return calloc(nmemb, sizel);
+  }
+
+  if (MARPAESLIF_UNLIKELY((sizel > 0) && (nmemb > ((size_t) -1) / sizel))) {
+    errno = ENOMEM;
+    return NULL;
+  }
+
+  p = allocatorp->mallocp(allocatorp->userDatavp, nmemb * sizel);
+  if (MARPAESLIF_LIKELY(p != NULL)) {
+    memset(p, 0, nmemb * sizel);
+  }
+
+  return p;
+}
+
+/*****************************************************************************/
+static inline void *_marpaESLIF_reallocp(marpaESLIF_t *marpaESLIFp, void *p, size_t sizel)
+/*****************************************************************************/
+{
+  marpaESLIFAllocator_t *allocatorp = (marpaESLIFp != NULL) ? marpaESLIFp->allocatorp : NULL;
+
+  if (allocatorp == NULL) {
+    return realloc(p, sizel);
+  }
+
+  return (p == NULL) ? allocatorp->mallocp(allocatorp->userDatavp, sizel) : allocatorp->reallocp(allocatorp->userDatavp, p, sizel);
+}
+
+/*****************************************************************************/
+static inline char *_marpaESLIF_strdupp(marpaESLIF_t *marpaESLIFp, const char *s)
+/*****************************************************************************/
+{
+  marpaESLIFAllocator_t *allocatorp = (marpaESLIFp != NULL) ? marpaESLIFp->allocatorp : NULL;
+  size_t                 sizel;
+  char                  *p;
+
+  if (allocatorp == NULL) {
+    return strdup(s);
+  }
+
+  sizel = strlen(s) + 1;
+  p = (char *) allocatorp->mallocp(allocatorp->userDatavp, sizel);
+  if (MARPAESLIF_LIKELY(p != NULL)) {
+    memcpy(p, s, sizel);
+  }
+
+  return p;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIF_freev(marpaESLIF_t *marpaESLIFp, void *p)
+/*****************************************************************************/
+{
+  marpaESLIFAllocator_t *allocatorp = (marpaESLIFp != NULL) ? marpaESLIFp->allocatorp : NULL;
+
+  if (allocatorp == NULL) {
+    free(p);
+  } else if (p != NULL) {
+    allocatorp->freep(allocatorp->userDatavp, p);
+  }
+}
+
+/*****************************************************************************/
+static void *_marpaESLIF_pcre2_mallocp(size_t sizel, void *userDatavp)
+/*****************************************************************************/
+{
+  return MARPAESLIF_MALLOC((marpaESLIF_t *) userDatavp, sizel);
+}
+
+/*****************************************************************************/
+static void _marpaESLIF_pcre2_freev(void *p, void *userDatavp)
+/*****************************************************************************/
+{
+  MARPAESLIF_FREE((marpaESLIF_t *) userDatavp, p);
+}
+
 /*****************************************************************************/
 marpaESLIF_t *marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptionp)
 /*****************************************************************************/
@@ -6581,6 +7058,7 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
 #endif /*  MARPAESLIF_NAN */
   genericLogger_t              *genericLoggerp;
   genericLoggerLevel_t          genericLoggerLeveli;
+  marpaESLIFAllocator_t        *allocatorp;
   marpaESLIFString_t            newlineString;
   int                           i;
 #ifdef MARPAESLIF_HAVE_LONG_LONG
@@ -6605,7 +7083,19 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
   }
 #endif
 
-  marpaESLIFp = (marpaESLIF_t *) malloc(sizeof(marpaESLIF_t));
+  allocatorp = marpaESLIFOptionp->allocatorp;
+  if (allocatorp != NULL) {
+    if (MARPAESLIF_UNLIKELY((allocatorp->mallocp == NULL) || (allocatorp->reallocp == NULL) || (allocatorp->freep == NULL))) {
+      if (genericLoggerp != NULL) {
+        GENERICLOGGER_ERROR(genericLoggerp, "Allocator must have malloc, realloc and free functions");
+      }
+      errno = EINVAL;
+      goto err;
+    }
+    marpaESLIFp = (marpaESLIF_t *) allocatorp->mallocp(allocatorp->userDatavp, sizeof(marpaESLIF_t));
+  } else {
+    marpaESLIFp = (marpaESLIF_t *) malloc(sizeof(marpaESLIF_t));
+  }
   if (MARPAESLIF_UNLIKELY(marpaESLIFp == NULL)) {
     if (genericLoggerp != NULL) {
       GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
@@ -6613,10 +7103,19 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
     goto err;
   }
 
+  /* The allocator is the very first thing to set: everything else depends on it */
+  if (allocatorp != NULL) {
+    marpaESLIFp->_allocator = *allocatorp;
+    marpaESLIFp->allocatorp = &(marpaESLIFp->_allocator);
+  } else {
+    marpaESLIFp->allocatorp = NULL;
+  }
+  marpaESLIFp->pcre2GeneralContextp      = NULL;
   marpaESLIFp->marpaESLIFGrammarLuap     = NULL;
   marpaESLIFp->marpaESLIFGrammarLuapp[0] = NULL;
   marpaESLIFp->marpaESLIFGrammarLuapp[1] = NULL;
   marpaESLIFp->marpaESLIFOption          = *marpaESLIFOptionp;
+  marpaESLIFp->marpaESLIFOption.allocatorp = marpaESLIFp->allocatorp;
   marpaESLIFp->marpaESLIFGrammarp        = NULL;
   marpaESLIFp->anycharp                  = NULL;
   marpaESLIFp->newlinep                  = NULL;
@@ -6625,6 +7124,12 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
   marpaESLIFp->substitutionModifiersp    = NULL;
   marpaESLIFp->characterClassModifiersp  = NULL;
   marpaESLIFp->regexModifiersp           = NULL;
+  marpaESLIFp->regexCacheStackp          = NULL;
+  marpaESLIFp->regexCacheHashp           = NULL;
+  marpaESLIFp->regexCacheExportp         = NULL;
+  marpaESLIFp->regexCacheExportl         = 0;
+  marpaESLIFp->regexCacheHitl            = 0;
+  marpaESLIFp->regexCacheMissl           = 0;
   marpaESLIFp->traceLoggerp              = NULL;
   marpaESLIFp->NULLisZeroBytesb          = 0;
   marpaESLIFp->ZeroIntegerisZeroBytesb   = 0;
@@ -6705,32 +7210,40 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
   marpaESLIFp->Lshare.marpaESLIFRecognizerLastInjectedp = NULL;
   marpaESLIFp->Lshare.marpaESLIFValueLastInjectedp      = NULL;
 
-  marpaESLIFp->tablesp = pcre2_maketables(NULL);
+  if (marpaESLIFp->allocatorp != NULL) {
+    marpaESLIFp->pcre2GeneralContextp = pcre2_general_context_create(_marpaESLIF_pcre2_mallocp, _marpaESLIF_pcre2_freev, (void *) marpaESLIFp);
+    if (MARPAESLIF_UNLIKELY(marpaESLIFp->pcre2GeneralContextp == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "pcre2_general_context_create failure, %s", strerror(errno));
+      goto err;
+    }
+  }
+
+  marpaESLIFp->tablesp = pcre2_maketables(marpaESLIFp->pcre2GeneralContextp);
   if (MARPAESLIF_UNLIKELY(marpaESLIFp->tablesp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "pcre2_maketables failure, %s", strerror(errno));
     goto err;
   }
 
   /* Check if zero bytes (.i.e calloc'ed memory) is the same thing as NULL */
-  p = calloc(1, sizeof(void *));
+  p = MARPAESLIF_CALLOC(marpaESLIFp, 1, sizeof(void *));
   if (MARPAESLIF_UNLIKELY(p == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
     goto err;
   }
 
   marpaESLIFp->NULLisZeroBytesb = (memcmp(p, &NULLp, sizeof(void *)) == 0);
-  free(p);
+  MARPAESLIF_FREE(marpaESLIFp, p);
   p = NULL;
 
   /* Check if zero bytes (.i.e calloc'ed memory) is the same thing as zero integer */
-  p = calloc(1, sizeof(int));
+  p = MARPAESLIF_CALLOC(marpaESLIFp, 1, sizeof(int));
   if (MARPAESLIF_UNLIKELY(p == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
     goto err;
   }
 
   marpaESLIFp->ZeroIntegerisZeroBytesb = (memcmp(p, &zeroInteger, sizeof(int)) == 0);
-  free(p);
+  MARPAESLIF_FREE(marpaESLIFp, p);
   p = NULL;
 
   /* **************************************************************** */
@@ -7051,7 +7564,7 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
     goto err;
   }
   grammar2p = NULL;
-  _marpaESLIF_grammar_freev(grammarp);
+  _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
   grammarp = NULL;
 
   /* L0 */
@@ -7071,7 +7584,7 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
     goto err;
   }
   grammar2p = NULL;
-  _marpaESLIF_grammar_freev(grammarp);
+  _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
   grammarp = NULL;
 
   /* Validate again the bootstrap grammar */
@@ -7109,7 +7622,7 @@ static inline marpaESLIF_t *_marpaESLIF_newp(marpaESLIFOption_t *marpaESLIFOptio
     genericLogger_logLevel_seti(marpaESLIFOptionp->genericLoggerp, genericLoggerLeveli);
   }
   
-  _marpaESLIF_grammar_freev(grammarp);
+  _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
 #ifndef MARPAESLIF_NTRACE
   if ((marpaESLIFp != NULL) && (genericLoggerp != NULL)) {
     int     ngrammari;
@@ -7156,79 +7669,285 @@ marpaESLIFOption_t *marpaESLIF_optionp(marpaESLIF_t *marpaESLIFp)
 }
 
 /*****************************************************************************/
-void marpaESLIF_freev(marpaESLIF_t *marpaESLIFp)
+short marpaESLIF_regex_cacheb(marpaESLIF_t *marpaESLIFp, short enableb)
 /*****************************************************************************/
 {
-  int i;
+  if (MARPAESLIF_UNLIKELY(marpaESLIFp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
 
-  if (marpaESLIFp != NULL) {
-    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuap, 0 /* onStackb */);
-    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuapp[0], 0 /* onStackb */);
-    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuapp[1], 0 /* onStackb */);
-    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarp, 0 /* onStackb */);
-    _marpaESLIF_terminal_freev(marpaESLIFp->anycharp);
-    _marpaESLIF_terminal_freev(marpaESLIFp->newlinep);
-    _marpaESLIF_symbol_freev(marpaESLIFp->newlineSymbolp);
-    _marpaESLIF_terminal_freev(marpaESLIFp->stringModifiersp);
-    _marpaESLIF_terminal_freev(marpaESLIFp->substitutionModifiersp);
-    _marpaESLIF_terminal_freev(marpaESLIFp->characterClassModifiersp);
-    _marpaESLIF_terminal_freev(marpaESLIFp->regexModifiersp);
-    if (marpaESLIFp->traceLoggerp != NULL) {
-      genericLogger_freev(&(marpaESLIFp->traceLoggerp));
-    }
-    if (marpaESLIFp->tablesp != NULL) {
-      /* Well, our built-in do not export pcre2_maketables_free */
-#ifdef pcre2_maketables_free
-      pcre2_maketables_free(NULL, marpaESLIFp->tablesp);
-#else
-      free((void *) marpaESLIFp->tablesp);
-#endif
-    }
-    for (i = 0; i < _MARPAESLIF_JSON_TYPE_LAST; i++) {
-      _marpaESLIF_symbol_freev(marpaESLIFp->jsonStringpp[i]); /* This is NULL protected */
-      _marpaESLIF_symbol_freev(marpaESLIFp->jsonConstantOrNumberpp[i]); /* This is NULL protected */
-    }
-    _marpaESLIF_lua_freev(marpaESLIFp);
-    /* free(marpaESLIFp->lconvp); */ /* output of localeconv() should never be freed */
-    free(marpaESLIFp);
+  if (enableb) {
+    return _marpaESLIF_regexcache_enableb(marpaESLIFp);
   }
+
+  _marpaESLIF_regexcache_disablev(marpaESLIFp);
+  return 1;
 }
 
 /*****************************************************************************/
-static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_stream_t *marpaESLIF_streamp, marpaESLIF_terminal_t *terminalp, char *inputs, size_t inputl, short eofb, marpaESLIF_matcher_value_t *rcip, marpaESLIFValueResult_t *marpaESLIFValueResultp, size_t *matchedLengthlp)
+short marpaESLIF_regex_cache_exportb(marpaESLIF_t *marpaESLIFp, char **bytespp, size_t *bytelp)
 /*****************************************************************************/
-/* This method is call extremely often, we want to minimize at much as       */
-/* possible the instructions in it:                                          */
-/* - rcip            must be != NULL                                         */
-/* - matchedLengthlp must be != NULL                                         */
+/* Format is the magic string, followed by (keyl, key, serializedl,          */
+/* serialized) records where lengths are native size_t values.               */
 /*****************************************************************************/
 {
-  static const char                 *funcs          = "_marpaESLIFRecognizer_terminal_matcherb";
-  short                              allocb         = 0;
-  size_t                             matchedLengthl = 0;
-  char                              *matchedp       = NULL;
-  PCRE2_UCHAR                       *outputbufferp  = NULL;
-  PCRE2_SIZE                         outputbufferl  = 0;
-  short                              substitutionb  = 0;
-  PCRE2_UCHAR                       *outputbuffertmpp;
-  marpaESLIF_matcher_value_t         rci;
-  marpaESLIF_regex_t                *marpaESLIF_regexp;
-  int                                pcre2Errornumberi;
-  PCRE2_UCHAR                        pcre2ErrorBuffer[256];
-  PCRE2_SIZE                        *pcre2_ovectorp;
-  marpaESLIF_uint32_t                pcre2_optioni;
-  marpaESLIF_uint32_t                pcre2_substitute_optioni;
-  short                              binmodeb;
-  short                              needUtf8Validationb;
-  short                              rcb;
-  short                              rcMatcherb;
-  marpaESLIFValueResult_t            marpaESLIFValueResultArray;
+  marpaESLIF_regexcache_t *regexcachep;
+  char                    *exportp;
+  char                    *p;
+  size_t                   exportl;
+  int                      i;
 
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
-  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+  if (MARPAESLIF_UNLIKELY(marpaESLIFp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
 
-  /*********************************************************************************/
-  /* A matcher tries to match a terminal v.s. input that is eventually incomplete. */
+  if (MARPAESLIF_UNLIKELY(marpaESLIFp->regexCacheStackp == NULL)) {
+    MARPAESLIF_ERROR(marpaESLIFp, "Regex cache is not enabled");
+    errno = EINVAL;
+    return 0;
+  }
+
+  exportl = MARPAESLIF_REGEXCACHE_MAGICL;
+  for (i = 0; i < GENERICSTACK_USED(marpaESLIFp->regexCacheStackp); i++) {
+    regexcachep = (marpaESLIF_regexcache_t *) GENERICSTACK_GET_PTR(marpaESLIFp->regexCacheStackp, i);
+    if ((regexcachep->keys == NULL) || (regexcachep->serializedp == NULL)) {
+      continue;
+    }
+    exportl += sizeof(size_t) + regexcachep->keyl + sizeof(size_t) + regexcachep->serializedl;
+  }
+
+  exportp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, exportl);
+  if (MARPAESLIF_UNLIKELY(exportp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    return 0;
+  }
+
+  p = exportp;
+  memcpy(p, MARPAESLIF_REGEXCACHE_MAGICS, MARPAESLIF_REGEXCACHE_MAGICL);
+  p += MARPAESLIF_REGEXCACHE_MAGICL;
+  for (i = 0; i < GENERICSTACK_USED(marpaESLIFp->regexCacheStackp); i++) {
+    regexcachep = (marpaESLIF_regexcache_t *) GENERICSTACK_GET_PTR(marpaESLIFp->regexCacheStackp, i);
+    if ((regexcachep->keys == NULL) || (regexcachep->serializedp == NULL)) {
+      continue;
+    }
+    memcpy(p, &(regexcachep->keyl), sizeof(size_t));
+    p += sizeof(size_t);
+    memcpy(p, regexcachep->keys, regexcachep->keyl);
+    p += regexcachep->keyl;
+    memcpy(p, &(regexcachep->serializedl), sizeof(size_t));
+    p += sizeof(size_t);
+    memcpy(p, regexcachep->serializedp, regexcachep->serializedl);
+    p += regexcachep->serializedl;
+  }
+
+  if (marpaESLIFp->regexCacheExportp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFp->regexCacheExportp);
+  }
+  marpaESLIFp->regexCacheExportp = exportp;
+  marpaESLIFp->regexCacheExportl = exportl;
+
+  if (bytespp != NULL) {
+    *bytespp = exportp;
+  }
+  if (bytelp != NULL) {
+    *bytelp = exportl;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+short marpaESLIF_regex_cache_importb(marpaESLIF_t *marpaESLIFp, char *bytes, size_t bytel)
+/*****************************************************************************/
+{
+  marpaESLIF_regexcache_t *regexcachep;
+  marpaESLIF_regexcache_t  regexcache;
+  marpaESLIF_regexcache_t *regexcachekeyp;
+  char                    *keys;
+  uint8_t                 *serializedp;
+  size_t                   serializedl;
+  short                    findResultb;
+  char                    *p;
+  char                    *maxp;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || ((bytes == NULL) && (bytel > 0)))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_enableb(marpaESLIFp))) {
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY((bytel < MARPAESLIF_REGEXCACHE_MAGICL) || (memcmp(bytes, MARPAESLIF_REGEXCACHE_MAGICS, MARPAESLIF_REGEXCACHE_MAGICL) != 0))) {
+    MARPAESLIF_ERROR(marpaESLIFp, "Not a regex cache export");
+    errno = EINVAL;
+    return 0;
+  }
+
+  p    = bytes + MARPAESLIF_REGEXCACHE_MAGICL;
+  maxp = bytes + bytel;
+  while (p < maxp) {
+    if (MARPAESLIF_UNLIKELY((size_t) (maxp - p) < sizeof(size_t))) {
+      goto truncated;
+    }
+    memcpy(&(regexcache.keyl), p, sizeof(size_t));
+    p += sizeof(size_t);
+    if (MARPAESLIF_UNLIKELY((size_t) (maxp - p) < regexcache.keyl)) {
+      goto truncated;
+    }
+    regexcache.keys = p;
+    p += regexcache.keyl;
+    if (MARPAESLIF_UNLIKELY((size_t) (maxp - p) < sizeof(size_t))) {
+      goto truncated;
+    }
+    memcpy(&serializedl, p, sizeof(size_t));
+    p += sizeof(size_t);
+    if (MARPAESLIF_UNLIKELY((size_t) (maxp - p) < serializedl)) {
+      goto truncated;
+    }
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_serialized_validb((uint8_t *) p, serializedl))) {
+      MARPAESLIF_ERROR(marpaESLIFp, "Invalid serialized pattern in regex cache export");
+      errno = EINVAL;
+      return 0;
+    }
+
+    /* Existing entries win */
+    regexcachekeyp = &regexcache;
+    findResultb    = _marpaESLIF_hash_findb(marpaESLIFp->regexCacheHashp, regexcachekeyp, (void **) &regexcachep);
+
+    if (! findResultb) {
+      keys = (char *) MARPAESLIF_MALLOC(marpaESLIFp, regexcache.keyl + 1);
+      if (MARPAESLIF_UNLIKELY(keys == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+        return 0;
+      }
+      memcpy(keys, regexcache.keys, regexcache.keyl);
+      keys[regexcache.keyl] = '\0';
+
+      serializedp = (uint8_t *) MARPAESLIF_MALLOC(marpaESLIFp, serializedl);
+      if (MARPAESLIF_UNLIKELY(serializedp == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+        MARPAESLIF_FREE(marpaESLIFp, keys);
+        return 0;
+      }
+      memcpy(serializedp, p, serializedl);
+
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_regexcache_addb(marpaESLIFp, keys, regexcache.keyl, serializedp, serializedl))) {
+        MARPAESLIF_FREE(marpaESLIFp, keys);
+        MARPAESLIF_FREE(marpaESLIFp, serializedp);
+        return 0;
+      }
+    }
+
+    p += serializedl;
+  }
+
+  return 1;
+
+ truncated:
+  MARPAESLIF_ERROR(marpaESLIFp, "Truncated regex cache export");
+  errno = EINVAL;
+  return 0;
+}
+
+/*****************************************************************************/
+short marpaESLIF_regex_cache_statsb(marpaESLIF_t *marpaESLIFp, marpaESLIFRegexCacheStats_t *statsp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || (statsp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  statsp->entriesl = (marpaESLIFp->regexCacheStackp != NULL) ? (size_t) GENERICSTACK_USED(marpaESLIFp->regexCacheStackp) : 0;
+  statsp->hitl     = marpaESLIFp->regexCacheHitl;
+  statsp->missl    = marpaESLIFp->regexCacheMissl;
+
+  return 1;
+}
+
+/*****************************************************************************/
+void marpaESLIF_freev(marpaESLIF_t *marpaESLIFp)
+/*****************************************************************************/
+{
+  int i;
+
+  if (marpaESLIFp != NULL) {
+    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuap, 0 /* onStackb */);
+    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuapp[0], 0 /* onStackb */);
+    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarLuapp[1], 0 /* onStackb */);
+    _marpaESLIFGrammar_freev(marpaESLIFp->marpaESLIFGrammarp, 0 /* onStackb */);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->anycharp);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->newlinep);
+    _marpaESLIF_symbol_freev(marpaESLIFp, marpaESLIFp->newlineSymbolp);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->stringModifiersp);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->substitutionModifiersp);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->characterClassModifiersp);
+    _marpaESLIF_terminal_freev(marpaESLIFp, marpaESLIFp->regexModifiersp);
+    _marpaESLIF_regexcache_disablev(marpaESLIFp);
+    if (marpaESLIFp->traceLoggerp != NULL) {
+      genericLogger_freev(&(marpaESLIFp->traceLoggerp));
+    }
+    if (marpaESLIFp->tablesp != NULL) {
+      /* Well, our built-in do not export pcre2_maketables_free */
+#ifdef pcre2_maketables_free
+      pcre2_maketables_free(marpaESLIFp->pcre2GeneralContextp, marpaESLIFp->tablesp);
+#else
+      MARPAESLIF_FREE(marpaESLIFp, (void *) marpaESLIFp->tablesp);
+#endif
+    }
+    for (i = 0; i < _MARPAESLIF_JSON_TYPE_LAST; i++) {
+      _marpaESLIF_symbol_freev(marpaESLIFp, marpaESLIFp->jsonStringpp[i]); /* This is NULL protected */
+      _marpaESLIF_symbol_freev(marpaESLIFp, marpaESLIFp->jsonConstantOrNumberpp[i]); /* This is NULL protected */
+    }
+    _marpaESLIF_lua_freev(marpaESLIFp);
+    if (marpaESLIFp->pcre2GeneralContextp != NULL) {
+      pcre2_general_context_free(marpaESLIFp->pcre2GeneralContextp);
+    }
+    /* free(marpaESLIFp->lconvp); */ /* output of localeconv() should never be freed */
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFp);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_stream_t *marpaESLIF_streamp, marpaESLIF_terminal_t *terminalp, char *inputs, size_t inputl, short eofb, marpaESLIF_matcher_value_t *rcip, marpaESLIFValueResult_t *marpaESLIFValueResultp, size_t *matchedLengthlp)
+/*****************************************************************************/
+/* This method is call extremely often, we want to minimize at much as       */
+/* possible the instructions in it:                                          */
+/* - rcip            must be != NULL                                         */
+/* - matchedLengthlp must be != NULL                                         */
+/*****************************************************************************/
+{
+  static const char                 *funcs          = "_marpaESLIFRecognizer_terminal_matcherb";
+  short                              allocb         = 0;
+  size_t                             matchedLengthl = 0;
+  char                              *matchedp       = NULL;
+  PCRE2_UCHAR                       *outputbufferp  = NULL;
+  PCRE2_SIZE                         outputbufferl  = 0;
+  short                              substitutionb  = 0;
+  PCRE2_UCHAR                       *outputbuffertmpp;
+  marpaESLIF_matcher_value_t         rci;
+  marpaESLIF_regex_t                *marpaESLIF_regexp;
+  int                                pcre2Errornumberi;
+  PCRE2_UCHAR                        pcre2ErrorBuffer[256];
+  PCRE2_SIZE                        *pcre2_ovectorp;
+  marpaESLIF_uint32_t                pcre2_optioni;
+  marpaESLIF_uint32_t                pcre2_substitute_optioni;
+  short                              binmodeb;
+  short                              needUtf8Validationb;
+  short                              rcb;
+  short                              rcMatcherb;
+  marpaESLIFValueResult_t            marpaESLIFValueResultArray;
+  unsigned char                      uc;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  /*********************************************************************************/
+  /* A matcher tries to match a terminal v.s. input that is eventually incomplete. */
   /* It return 1 on success, 0 on failure, -1 if more data is needed in rcip       */
   /* The method return value itself is 0 on error, 1 on success, -1 on fatal error */
   /*********************************************************************************/
@@ -7292,6 +8011,31 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
 
       marpaESLIF_regexp = &(terminalp->regex);
 
+      /* Literal code units prefilter: the first code unit is known at any time, the required code unit only at eof. */
+      if (terminalp->firstcodeunitb) {
+        if (marpaESLIF_regexp->isAnchoredb) {
+          uc = (unsigned char) inputs[0];
+          if ((uc != terminalp->firstcodeunits[0]) && (uc != terminalp->firstcodeunits[1])) {
+            MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "%s: first code unit 0x%02x is not possible", terminalp->descp->asciis, (unsigned int) uc);
+            rci = MARPAESLIF_MATCH_FAILURE;
+            goto fast_done;
+          }
+        } else if (eofb && (inputl <= MARPAESLIF_CODEUNIT_MAXSCANL)) {
+          if ((memchr(inputs, terminalp->firstcodeunits[0], inputl) == NULL) && (memchr(inputs, terminalp->firstcodeunits[1], inputl) == NULL)) {
+            MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "%s: first code unit not found", terminalp->descp->asciis);
+            rci = MARPAESLIF_MATCH_FAILURE;
+            goto fast_done;
+          }
+        }
+      }
+      if (terminalp->requiredcodeunitb && eofb && (inputl <= MARPAESLIF_CODEUNIT_MAXSCANL)) {
+        if ((memchr(inputs, terminalp->requiredcodeunits[0], inputl) == NULL) && (memchr(inputs, terminalp->requiredcodeunits[1], inputl) == NULL)) {
+          MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "%s: required code unit not found", terminalp->descp->asciis);
+          rci = MARPAESLIF_MATCH_FAILURE;
+          goto fast_done;
+        }
+      }
+
       /* If the regexp is working in UTF mode then we check that character conversion   */
       /* was done. This is how we are sure that calling regexp with PCRE2_NO_UTF_CHECK  */
       /* is ok: we have done ourself the UTF-8 validation on the subject.               */
@@ -7427,18 +8171,22 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
 #endif
         matchedp = inputs + pcre2_ovectorp[0];
 
-        if (terminalp->substitutionPatterns != NULL) {
+        if ((terminalp->substitutionPatterns != NULL) && (marpaESLIFValueResultp != NULL) && (! marpaESLIFRecognizerp->isLexemeb)) {
+          /* Substitution is done only if the caller wants the value: in lexeme mode only offsets are returned */
           substitutionb = 1;
-          /* The most common case is to  extract part of the match, so we pre-allocate that */
-          outputbufferl = matchedLengthl;
-          if (outputbufferl > 0) {
-            outputbufferp = (PCRE2_UCHAR *) malloc((outputbufferl + 1) * sizeof(PCRE2_UCHAR)); /* + 1 for a NUL byte */
-            if (MARPAESLIF_UNLIKELY(outputbufferp == NULL)) {
-              MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+          /* Output cannot be larger than the replacement plus the match for every reference, except with case changes in extended mode */
+          outputbufferl = terminalp->substitutionPatternl + (terminalp->substitutionRefl * matchedLengthl);
+          if (marpaESLIFRecognizerp->substitutionBufferl < outputbufferl + 1) {
+            outputbuffertmpp = (PCRE2_UCHAR *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->substitutionBufferp, (outputbufferl + 1) * sizeof(PCRE2_UCHAR)); /* + 1 for a NUL byte */
+            if (MARPAESLIF_UNLIKELY(outputbuffertmpp == NULL)) {
+              MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
               goto err;
             }
-            outputbufferp[outputbufferl] = '\0';
+            marpaESLIFRecognizerp->substitutionBufferp = outputbuffertmpp;
+            marpaESLIFRecognizerp->substitutionBufferl = outputbufferl + 1;
           }
+          outputbufferp = marpaESLIFRecognizerp->substitutionBufferp;
+          outputbufferl = marpaESLIFRecognizerp->substitutionBufferl;
 
 	  if (matchedp == inputs) {
 	    /* The most common case is anchored regex: then it is ok to reuse preexisting match data */
@@ -7446,6 +8194,7 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
 	    pcre2_substitute_optioni |= PCRE2_SUBSTITUTE_MATCHED;
 	  }
 
+        substitute_retry:
 	  pcre2Errornumberi = pcre2_substitute(marpaESLIF_regexp->patternp,                               /* code */
 					       (PCRE2_SPTR) matchedp,                                     /* subject */
 					       (PCRE2_SIZE) matchedLengthl,                               /* length */
@@ -7460,46 +8209,43 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
 
           /* It if succeed it returns the number of substitutions, that must be > 0 */
           if (pcre2Errornumberi <= 0) {
-            /* Only PCRE2_ERROR_NOMEMORY is an acceptable error */
-            switch (pcre2Errornumberi) {
-            case PCRE2_ERROR_NOMEMORY:
-              /* Realloc and retry */
-              outputbuffertmpp = (PCRE2_UCHAR *) realloc(outputbufferp, (outputbufferl + 1) * sizeof(PCRE2_UCHAR)); /* + 1 for a NUL byte */
+            /* Only PCRE2_ERROR_NOMEMORY is an acceptable error, and only once */
+            if ((pcre2Errornumberi == PCRE2_ERROR_NOMEMORY) && (outputbufferl > marpaESLIFRecognizerp->substitutionBufferl)) {
+              /* outputbufferl is the needed size, including the NUL byte */
+              outputbuffertmpp = (PCRE2_UCHAR *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->substitutionBufferp, outputbufferl * sizeof(PCRE2_UCHAR));
               if (MARPAESLIF_UNLIKELY(outputbuffertmpp == NULL)) {
                 MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
+                outputbufferp = NULL; /* Still owned by the recognizer */
                 goto err;
               }
-              outputbufferp = outputbuffertmpp;
-              outputbufferp[outputbufferl] = '\0';
-              pcre2Errornumberi = pcre2_substitute(marpaESLIF_regexp->patternp,                               /* code */
-                                                   (PCRE2_SPTR) matchedp,                                     /* subject */
-                                                   (PCRE2_SIZE) matchedLengthl,                               /* length */
-                                                   (PCRE2_SIZE) 0,                                            /* startoffset */
-                                                   pcre2_substitute_optioni,                                  /* options */
-                                                   marpaESLIF_regexp->match_datap,                            /* match data */
-                                                   marpaESLIF_regexp->match_contextp,                         /* match context */
-                                                   (PCRE2_SPTR) terminalp->substitutionPatterns,              /* replacement */
-                                                   (PCRE2_SIZE) terminalp->substitutionPatternl,              /* rlength */
-                                                   outputbufferp,
-                                                   &outputbufferl);
-
-              /* Now it must succeed with the number of substitutions, that must be > 0 */
-              if (pcre2Errornumberi == 0) {
-                MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "%s: No substitution though there was a match", terminalp->descp->asciis);
-                goto fatal;
-              }
-              if (pcre2Errornumberi < 0) {
-                pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
-                MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "%s: Uncaught pcre2 match failure: %s", terminalp->descp->asciis, pcre2ErrorBuffer);
-                goto fatal;
-              }
-              break;
-            default:
+              outputbufferp = marpaESLIFRecognizerp->substitutionBufferp = outputbuffertmpp;
+              marpaESLIFRecognizerp->substitutionBufferl = outputbufferl;
+              goto substitute_retry;
+            }
+            if (pcre2Errornumberi == 0) {
+              MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "%s: No substitution though there was a match", terminalp->descp->asciis);
+            } else {
               pcre2_get_error_message(pcre2Errornumberi, pcre2ErrorBuffer, sizeof(pcre2ErrorBuffer));
               MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "%s: Uncaught pcre2 match failure: %s", terminalp->descp->asciis, pcre2ErrorBuffer);
-              goto fatal;
             }
+            outputbufferp = NULL; /* Still owned by the recognizer */
+            goto fatal;
+          }
+
+          /* The scratch area is handed over to the value, without copy: the next substitution allocates */
+          /* a new one at the bound of its terminal. A value that uses less than half of it is shrunk.   */
+          if ((outputbufferl + 1) < (marpaESLIFRecognizerp->substitutionBufferl / 2)) {
+            outputbuffertmpp = (PCRE2_UCHAR *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, outputbufferp, (outputbufferl + 1) * sizeof(PCRE2_UCHAR)); /* + 1 for a NUL byte */
+            if (MARPAESLIF_UNLIKELY(outputbuffertmpp == NULL)) {
+              MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
+              outputbufferp = NULL; /* Still owned by the recognizer */
+              goto err;
+            }
+            outputbufferp = outputbuffertmpp;
           }
+          marpaESLIFRecognizerp->substitutionBufferp = NULL;
+          marpaESLIFRecognizerp->substitutionBufferl = 0;
+          outputbufferp[outputbufferl] = '\0';
         } else {
           /* Need to alloc when eof is reached */
           if (! eofb) {
@@ -7580,6 +8326,7 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
       if (eofb && (inputl <= 0)) {
         rci              = MARPAESLIF_MATCH_FAILURE;
       } else {
+        _marpaESLIF_stream_locationv(marpaESLIF_streamp);
         if (marpaESLIF_streamp->columnl == 1) {
           MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, ":sol match");
           rci            = MARPAESLIF_MATCH_OK;
@@ -7631,7 +8378,7 @@ static inline short _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizer
 
  done:
   if (outputbufferp != NULL) {
-    free(outputbufferp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, outputbufferp);
   }
 #ifndef MARPAESLIF_NTRACE
   switch (rci) {
@@ -7690,7 +8437,7 @@ static inline short _marpaESLIFRecognizer_terminal_matcher_setb(marpaESLIFRecogn
           marpaESLIFValueResultp->type            = MARPAESLIF_VALUE_TYPE_ARRAY;
           marpaESLIFValueResultp->u.a.sizel       = matchedLengthl;
           if (allocb) {
-            marpaESLIFValueResultp->u.a.p = (char *) malloc(matchedLengthl + 1); /* We always add a NUL byte for convenience */
+            marpaESLIFValueResultp->u.a.p = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, matchedLengthl + 1); /* We always add a NUL byte for convenience */
             if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.a.p == NULL)) {
               MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
               goto err;
@@ -7844,7 +8591,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIFRecognizer_meta_subGrammarp(marpa
       strlen(levels)                                                                                        + /*  :[leveli]:=  */
       utf8p->bytel                                                                                            /* Generated grammar */
       ;
-    utf8WithLevelp->bytep = (char *) malloc(utf8WithLevelp->bytel + 1); /* + 1 for a NUL byte */
+    utf8WithLevelp->bytep = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, utf8WithLevelp->bytel + 1); /* + 1 for a NUL byte */
     if (MARPAESLIF_UNLIKELY(utf8WithLevelp->bytep == NULL)) {
       goto err;
     }
@@ -7916,7 +8663,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIFRecognizer_meta_subGrammarp(marpa
         1                                                                                                     + /* \n */
         utf8WithLevelp->bytel                                                                                 /* "Internal[counti] :[leveli]:= generated grammar " */
         ;
-      generatedGrammarOption.bytep     = (char *) malloc(generatedGrammarOption.bytel + 1); /* + 1 for a NUL byte */
+      generatedGrammarOption.bytep     = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, generatedGrammarOption.bytel + 1); /* + 1 for a NUL byte */
       if (MARPAESLIF_UNLIKELY(generatedGrammarOption.bytep == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -7958,7 +8705,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIFRecognizer_meta_subGrammarp(marpa
       generatedGrammarp = _marpaESLIFGrammar_newp(marpaESLIFRecognizerp->marpaESLIFp, &generatedGrammarOption, marpaESLIFGrammarp->Lsharep, 0 /* bootstrapb */, 1 /* rememberGrammarUtf8b */, startSymbols, grammarp->leveli, marpaESLIFGrammarp->marpaESLIFGrammar_bootstrapp /* marpaESLIFGrammar_bootstrapOrigp */);
 
       /* Whatever happens we can free generatedGrammarOption.bytep */
-      free(generatedGrammarOption.bytep);
+      MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, generatedGrammarOption.bytep);
       generatedGrammarOption.bytep = NULL;
       
       if (generatedGrammarp == NULL) {
@@ -8000,10 +8747,10 @@ static inline marpaESLIF_grammar_t *_marpaESLIFRecognizer_meta_subGrammarp(marpa
   _marpaESLIFRecognizer_valueResultFreev(marpaESLIFRecognizerp, &generatedValueResult);
   if ((utf8p != NULL) && (utf8p != &generatedString)) {
     /* We remain paranoid even if this can never happen: this is a string that comes from outside */
-    _marpaESLIF_string_freev(utf8p, 0 /* onStstackb */);
+    _marpaESLIF_string_freev(marpaESLIFRecognizerp->marpaESLIFp, utf8p, 0 /* onStstackb */);
   }
   _marpaESLIFGrammar_freev(generatedGrammarp, 0 /* onStackb */);
-  _marpaESLIF_string_freev(utf8WithLevelp, 0 /* onStstackb */);
+  _marpaESLIF_string_freev(marpaESLIFRecognizerp->marpaESLIFp, utf8WithLevelp, 0 /* onStstackb */);
 
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %p", (int) rcp);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
@@ -8151,7 +8898,7 @@ static inline short _marpaESLIFRecognizer_meta_matcherb(marpaESLIFRecognizer_t *
         marpaESLIFValueResultp->contextp           = NULL;
         marpaESLIFValueResultp->representationp    = NULL;
         marpaESLIFValueResultp->type               = MARPAESLIF_VALUE_TYPE_ARRAY;
-        marpaESLIFValueResultp->u.a.p              = (char *) malloc(marpaESLIFValueResult.u.o.sizel + 1); /* We always add a NUL byte for convenience */
+        marpaESLIFValueResultp->u.a.p              = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFValueResult.u.o.sizel + 1); /* We always add a NUL byte for convenience */
         if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.a.p == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -8490,7 +9237,7 @@ static inline char *_marpaESLIF_utf82printableascii_newp(marpaESLIF_t *marpaESLI
   char                   *asciis;
   unsigned char           c;
 
-  asciis = _marpaESLIF_charconvb(marpaESLIFp, "ASCII//TRANSLIT//IGNORE", (char *) MARPAESLIF_UTF8_STRING, descs, descl, &asciil, NULL /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, 1 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */);
+  asciis = _marpaESLIF_charconvb(marpaESLIFp, "ASCII//TRANSLIT//IGNORE", (char *) MARPAESLIF_UTF8_STRING, descs, descl, &asciil, NULL /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, NULL /* outbufsp */, NULL /* outbufalloclp */, 1 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */);
   if (asciis == NULL) {
     asciis = (char *) _marpaESLIF_utf82printableascii_defaultp;
     asciil = strlen(asciis);
@@ -8515,16 +9262,111 @@ static inline char *_marpaESLIF_utf82printableascii_newp(marpaESLIF_t *marpaESLI
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_utf82printableascii_freev(char *asciis)
+static inline void _marpaESLIF_utf82printableascii_freev(marpaESLIF_t *marpaESLIFp, char *asciis)
 /*****************************************************************************/
 {
   if ((asciis != NULL) && (asciis != _marpaESLIF_utf82printableascii_defaultp)) {
-    free(asciis);
+    MARPAESLIF_FREE(marpaESLIFp, asciis);
+  }
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIF_utf8_validb(char *srcs, size_t srcl, size_t *validlp)
+/*****************************************************************************/
+/* UTF-8 validation as per RFC 3629: no overlong form, no surrogate, nothing above U+10FFFF. */
+/* On success, *validlp is the number of bytes made of complete characters: the remaining   */
+/* (srcl - *validlp) bytes are the start of a valid but incomplete character.               */
+/* On failure, *validlp is the offset of the invalid sequence.                              */
+/* ASCII runs are skipped a machine word at a time.                                         */
+/*****************************************************************************/
+{
+  const size_t         highbitsl = ((size_t) -1) / 0xFF * 0x80; /* 0x8080...80 */
+  unsigned char       *p         = (unsigned char *) srcs;
+  unsigned char       *maxp      = p + srcl;
+  unsigned char       *startp;
+  size_t               wordl;
+  size_t               needl;
+  unsigned char        c;
+  unsigned char        minc;
+  unsigned char        maxc;
+  short                rcb;
+
+  while (p < maxp) {
+    /* ASCII fast path */
+    while (((size_t) (maxp - p)) >= sizeof(size_t)) {
+      memcpy(&wordl, p, sizeof(size_t));
+      if ((wordl & highbitsl) != 0) {
+        break;
+      }
+      p += sizeof(size_t);
+    }
+    if (p >= maxp) {
+      break;
+    }
+
+    startp = p;
+    c = *p++;
+    if (c < 0x80) {
+      continue;
+    }
+
+    /* The second byte has a restricted range, the others are plain continuation bytes */
+    if (c < 0xC2) {
+      /* Continuation byte or overlong two-bytes form */
+      goto err;
+    } else if (c < 0xE0) {
+      needl = 1;
+      minc  = 0x80;
+      maxc  = 0xBF;
+    } else if (c < 0xF0) {
+      needl = 2;
+      minc  = (c == 0xE0) ? 0xA0 : 0x80; /* Overlong */
+      maxc  = (c == 0xED) ? 0x9F : 0xBF; /* Surrogates */
+    } else if (c < 0xF5) {
+      needl = 3;
+      minc  = (c == 0xF0) ? 0x90 : 0x80; /* Overlong */
+      maxc  = (c == 0xF4) ? 0x8F : 0xBF; /* Above U+10FFFF */
+    } else {
+      goto err;
+    }
+
+    if (p >= maxp) {
+      goto incomplete;
+    }
+    if ((*p < minc) || (*p > maxc)) {
+      goto err;
+    }
+    p++;
+    while (--needl > 0) {
+      if (p >= maxp) {
+        goto incomplete;
+      }
+      if ((*p & 0xC0) != 0x80) {
+        goto err;
+      }
+      p++;
+    }
   }
+
+  *validlp = srcl;
+  rcb = 1;
+  goto done;
+
+ incomplete:
+  *validlp = startp - (unsigned char *) srcs;
+  rcb = 1;
+  goto done;
+
+ err:
+  *validlp = startp - (unsigned char *) srcs;
+  rcb = 0;
+
+ done:
+  return rcb;
 }
 
 /*****************************************************************************/
-static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEncodings, char *fromEncodings, char *srcs, size_t srcl, size_t *dstlp, char **fromEncodingsp, tconv_t *tconvpp, short eofb, char **byteleftsp, size_t *byteleftlp, size_t *byteleftalloclp, short tconvsilentb, char *defaultEncodings, char *fallbackEncodings)
+static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEncodings, char *fromEncodings, char *srcs, size_t srcl, size_t *dstlp, char **fromEncodingsp, tconv_t *tconvpp, short eofb, char **byteleftsp, size_t *byteleftlp, size_t *byteleftalloclp, char **outbufsp, size_t *outbufalloclp, short tconvsilentb, char *defaultEncodings, char *fallbackEncodings)
 /*****************************************************************************/
 /* The default is to work with the input as given in the arguments. This is the most efficient. */
 /* Sometimes some bytes remained left over from a previous round. In this case, we have to prepend */
@@ -8534,6 +9376,9 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
 /* Still, the number of converted bytes remain correct. */
 /*****************************************************************************/
 /* If caller provides byteleftsp != NULL he is RESPONSIBLE to also provide byteleftlp != NULL and byteleftalloclp != NULL */
+/*****************************************************************************/
+/* If caller provides outbufsp != NULL he is RESPONSIBLE to also provide outbufalloclp != NULL: the output buffer */
+/* is then *outbufsp, grown on demand, and the returned pointer is owned by the caller's *outbufsp: it must NOT be freed. */
 {
   static const char *funcs       = "_marpaESLIF_charconvb";
   char              *outbuforigp = NULL;
@@ -8566,7 +9411,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
     if (byteleftl > 0) {
       /* By definition, then, byteleftsp is != NULL : this will be a realloc, eventually */
       if (byteleftallocl < (byteleftl + srcl)) {
-	tmps = (char *) realloc(bytelefts, byteleftl + srcl);
+	tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, bytelefts, byteleftl + srcl);
 	if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
           goto err;
@@ -8616,15 +9461,30 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
   /* at the variables via a debugger -;.                                               */
   /* It is more than useful when the destination encoding is ASCII: string will be NUL */
   /* terminated by default.                                                            */
-  outbuforigp = (char *) malloc(srcl + 1);
-  if (MARPAESLIF_UNLIKELY(outbuforigp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
-    goto err;
+  if (outbufsp != NULL) {
+    /* Reusable output buffer: we use all of its allocated size, and grow it only when it is too small */
+    if (*outbufalloclp < (srcl + 1)) {
+      tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, *outbufsp, srcl + 1);
+      if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
+        goto err;
+      }
+      *outbufsp      = tmps;
+      *outbufalloclp = srcl + 1;
+    }
+    outbuforigp = *outbufsp;
+    outbuforigl = *outbufalloclp - 1;
+  } else {
+    outbuforigp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, srcl + 1);
+    if (MARPAESLIF_UNLIKELY(outbuforigp == NULL)) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+      goto err;
+    }
+    outbuforigl = srcl;
   }
   /* This setting is NOT necessary because *outbufp is always set to '\0' as well. But */
   /* I do this just to ease inspection in a debugger. */
-  outbuforigp[srcl] = '\0';
-  outbuforigl = srcl;
+  outbuforigp[outbuforigl] = '\0';
 
   /* We want to translate descriptions in trace or error cases - these are short things, and */
   /* it does not really harm if we redo the whole translation stuff in case of E2BIG:        */
@@ -8684,13 +9544,17 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
         /* Remember current position in output buffer so that we can repostion after the realloc */
         outbufdeltal = outbufp - outbuforigp; /* Always >= 0 */
         /* Note the "+ 1" */
-        tmps = realloc(outbuforigp, outbuforigl + 1); /* Still the +1 to put a NUL just to ease debug of UTF-8 but also its makes sure that ASCII string are ALWAYS NUL terminated */
+        tmps = MARPAESLIF_REALLOC(marpaESLIFp, outbuforigp, outbuforigl + 1); /* Still the +1 to put a NUL just to ease debug of UTF-8 but also its makes sure that ASCII string are ALWAYS NUL terminated */
         if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
           goto err;
         }
         outbuforigp              = tmps;
         outbuforigp[outbuforigl] = '\0';
+        if (outbufsp != NULL) {
+          *outbufsp      = outbuforigp;
+          *outbufalloclp = outbuforigl + 1;
+        }
         outleftl                += outleftdeltal;
         outbufp                  = outbuforigp + outbufdeltal;
         goto again;
@@ -8740,7 +9604,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
         /* Internal constant used to avoid unnecessary strdup() call */
         *fromEncodingsp = (char *) MARPAESLIF_UTF8_STRING;
       } else {
-        if (MARPAESLIF_UNLIKELY((*fromEncodingsp = strdup(fromEncodings)) == NULL)) {
+        if (MARPAESLIF_UNLIKELY((*fromEncodingsp = MARPAESLIF_STRDUP(marpaESLIFp, fromEncodings)) == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
           goto err;
         }
@@ -8755,7 +9619,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
       }
       MARPAESLIF_TRACEF(marpaESLIFp, funcs, "Encoding guessed to %s", *fromEncodingsp);
       /* We do not mind if we loose the original - it is inside tconv that will be freed */
-      if (MARPAESLIF_UNLIKELY((*fromEncodingsp = strdup(*fromEncodingsp)) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((*fromEncodingsp = MARPAESLIF_STRDUP(marpaESLIFp, *fromEncodingsp)) == NULL)) {
 	MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
 	goto err;
       }
@@ -8782,7 +9646,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
 	size_t consumedl = inleftorigl - inleftl;
 	if (bytelefts == NULL) {
 	  /* And this is the first time this happens */
-	  bytelefts = (char *) malloc(inleftl);
+	  bytelefts = (char *) MARPAESLIF_MALLOC(marpaESLIFp, inleftl);
 	  if (MARPAESLIF_UNLIKELY(bytelefts == NULL)) {
 	    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
 	    goto err;
@@ -8793,7 +9657,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
 	} else {
 	  /* And this has already happened in a round older than previous round */
 	  if (byteleftallocl < inleftl) {
-	    tmps = (char *) realloc(bytelefts, inleftl);
+	    tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, bytelefts, inleftl);
 	    if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
 	      MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
 	      goto err;
@@ -8823,7 +9687,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
     marpaESLIFRecognizer_t *marpaESLIFRecognizerp;
 
     /* Particularly dangerous: the MARPAESLIFRECOGNIZER_HEXDUMPV has to use NOTHING ELSE but marpaESLIFRecognizerp->marpaESLIFp (and this is the case -;) */
-    marpaESLIFRecognizerp = (marpaESLIFRecognizer_t *)malloc(sizeof(marpaESLIFRecognizer_t));
+    marpaESLIFRecognizerp = (marpaESLIFRecognizer_t *)MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFRecognizer_t));
     if (marpaESLIFRecognizerp != NULL) {
 
 	marpaESLIFRecognizerp->marpaESLIFp = marpaESLIFp;
@@ -8871,7 +9735,7 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
                                         0 /* columnl */);
 	}
 
-	free(marpaESLIFRecognizerp);
+	MARPAESLIF_FREE(marpaESLIFp, marpaESLIFRecognizerp);
     }
   }
   /* If the caller did not have a tconvp yet, we do not want to return this one that has just failed */
@@ -8881,8 +9745,8 @@ static inline char *_marpaESLIF_charconvb(marpaESLIF_t *marpaESLIFp, char *toEnc
     }
     tconvp = NULL;
   }
-  if (outbuforigp != NULL) {
-    free(outbuforigp);
+  if ((outbuforigp != NULL) && (outbufsp == NULL)) {
+    MARPAESLIF_FREE(marpaESLIFp, outbuforigp);
   }
   outbuforigp = NULL;
 
@@ -8976,7 +9840,7 @@ static inline short _marpaESLIFGrammar_bootstrap_transferb(marpaESLIF_t *marpaES
   marpaESLIFGrammarp->hasLookaheadMetab                         = marpaESLIFGrammar_bootstrapClonep->hasLookaheadMetab;
 
   if ((marpaESLIFGrammar_bootstrapClonep->luabytep != NULL) && (marpaESLIFGrammar_bootstrapClonep->luabytel > 0)) {
-    marpaESLIFGrammarp->luabytep = (char *) malloc(marpaESLIFGrammar_bootstrapClonep->luabytel + 1);
+    marpaESLIFGrammarp->luabytep = (char *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFGrammar_bootstrapClonep->luabytel + 1);
     if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp->luabytep == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -9005,7 +9869,7 @@ static inline short _marpaESLIFGrammar_bootstrap_transferb(marpaESLIF_t *marpaES
         /* In particular inner symbol and rule stacks are of the normal types marpaESLIF_symbol_t and          */
         /* marpaESLIF_rule_t types, respectively. So we just call for bootstrap clone and transfer the stacks. */
         grammarBootstrapClonep = (marpaESLIF_grammar_bootstrap_t *) GENERICSTACK_GET_PTR(grammarBootstrapCloneStackp, grammari);
-        grammarp = (marpaESLIF_grammar_t *) malloc(sizeof(marpaESLIF_grammar_t));
+        grammarp = (marpaESLIF_grammar_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_grammar_t));
         if (MARPAESLIF_UNLIKELY(grammarp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
           goto err;
@@ -9057,7 +9921,7 @@ static inline short _marpaESLIFGrammar_bootstrap_transferb(marpaESLIF_t *marpaES
   rcb = 0;
 
  done:
-  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammar_bootstrapClonep);
+  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFp, marpaESLIFGrammar_bootstrapClonep);
   return rcb;
 }
 
@@ -9079,7 +9943,7 @@ static inline marpaESLIFGrammar_bootstrap_t *_marpaESLIFGrammar_bootstrap_clonep
   genericStack_t                   *symbolStackp;
   genericStack_t                   *symbolStackOrigp;
 
-  marpaESLIFGrammarp = (marpaESLIFGrammar_bootstrap_t *) malloc(sizeof(marpaESLIFGrammar_bootstrap_t));
+  marpaESLIFGrammarp = (marpaESLIFGrammar_bootstrap_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFGrammar_bootstrap_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9101,7 +9965,7 @@ static inline marpaESLIFGrammar_bootstrap_t *_marpaESLIFGrammar_bootstrap_clonep
 
   if ((marpaESLIFGrammarOrigp->luabytep != NULL) && (marpaESLIFGrammarOrigp->luabytel > 0)) {
     marpaESLIFGrammarp->luabytel = marpaESLIFGrammarOrigp->luabytel;
-    marpaESLIFGrammarp->luabytep = (char *) malloc(marpaESLIFGrammarp->luabytel + 1);
+    marpaESLIFGrammarp->luabytep = (char *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFGrammarp->luabytel + 1);
     if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp->luabytep == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -9170,7 +10034,7 @@ static inline marpaESLIFGrammar_bootstrap_t *_marpaESLIFGrammar_bootstrap_clonep
 
  err:
   /* We do not want to free it, if it was injected: parent should take care of that */
-  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammarp);
+  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFp, marpaESLIFGrammarp);
   marpaESLIFGrammarp = NULL;
 
  done:
@@ -9184,7 +10048,7 @@ static inline marpaESLIFGrammar_bootstrap_t *_marpaESLIFGrammar_bootstrap_newp(m
   static const char                *funcs                      = "_marpaESLIFGrammar_bootstrap_newp";
   marpaESLIFGrammar_bootstrap_t    *marpaESLIFGrammarp         = NULL;
 
-  marpaESLIFGrammarp = (marpaESLIFGrammar_bootstrap_t *) malloc(sizeof(marpaESLIFGrammar_bootstrap_t));
+  marpaESLIFGrammarp = (marpaESLIFGrammar_bootstrap_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFGrammar_bootstrap_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9208,7 +10072,7 @@ static inline marpaESLIFGrammar_bootstrap_t *_marpaESLIFGrammar_bootstrap_newp(m
 
  err:
   /* We do not want to free it, if it was injected: parent should take care of that */
-  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammarp);
+  _marpaESLIFGrammar_bootstrap_freev(marpaESLIFp, marpaESLIFGrammarp);
   marpaESLIFGrammarp = NULL;
 
  done:
@@ -9245,7 +10109,7 @@ static inline marpaESLIFGrammar_t *_marpaESLIFGrammar_newp(marpaESLIF_t *marpaES
     }
   }
 
-  marpaESLIFGrammarp = (marpaESLIFGrammar_t *) malloc(sizeof(marpaESLIFGrammar_t));
+  marpaESLIFGrammarp = (marpaESLIFGrammar_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFGrammar_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -9270,6 +10134,15 @@ static inline marpaESLIFGrammar_t *_marpaESLIFGrammar_newp(marpaESLIF_t *marpaES
   marpaESLIFGrammarp->hasSolPseudoTerminalb                     = 0;
   marpaESLIFGrammarp->hasEmptyPseudoTerminalb                   = 0;
   marpaESLIFGrammarp->lexemeGrammarHashp                        = NULL;
+  marpaESLIFGrammarp->lexemeGrammarHeadp                        = NULL;
+  marpaESLIFGrammarp->lexemeGrammarTailp                        = NULL;
+  marpaESLIFGrammarp->lexemeGrammarBytesl                       = 0;
+  marpaESLIFGrammarp->lexemeGrammarMaxEntriesl                  = 0;
+  marpaESLIFGrammarp->lexemeGrammarMaxBytesl                    = 0;
+  marpaESLIFGrammarp->lexemeGrammarHitl                         = 0;
+  marpaESLIFGrammarp->lexemeGrammarMissl                        = 0;
+  marpaESLIFGrammarp->lexemeGrammarEvictionl                    = 0;
+  marpaESLIFGrammarp->recognizerl                               = 0;
   marpaESLIFGrammarp->hasLookaheadMetab                         = 0;
   marpaESLIFGrammarp->jsonStringp                               = NULL;
   marpaESLIFGrammarp->jsonConstantOrNumberp                     = NULL;
@@ -9279,6 +10152,9 @@ static inline marpaESLIFGrammar_t *_marpaESLIFGrammar_newp(marpaESLIF_t *marpaES
   marpaESLIFGrammarp->_Lshare.marpaESLIFValueLastInjectedp      = NULL;
   marpaESLIFGrammarp->Lsharep                                   = (Lsharep != NULL) ? Lsharep : &(marpaESLIFGrammarp->_Lshare);
   marpaESLIFGrammarp->marpaESLIFGrammar_bootstrapp              = NULL;
+  marpaESLIFGrammarp->valueStackCacheb                          = 0;
+  marpaESLIFGrammarp->valueStackItemsp                          = NULL;
+  marpaESLIFGrammarp->valueStackItemsi                          = 0;
 
   /* bootstrap is special - it just need the structure */
   if (bootstrapb) {
@@ -9357,20 +10233,12 @@ static inline marpaESLIFGrammar_t *_marpaESLIFGrammar_newp(marpaESLIF_t *marpaES
 
   /* Initialize external lexeme hash */
   marpaESLIFGrammarp->lexemeGrammarHashp = &(marpaESLIFGrammarp->_lexemeGrammarHash);
-  GENERICHASH_INIT_ALL(marpaESLIFGrammarp->lexemeGrammarHashp,
-                       _marpaESLIF_string_hash_callbacki,
-                       _marpaESLIF_string_cmp_callbackb,
-                       NULL, /* keyCopyFunctionp */
-                       _marpaESLIF_string_free_callbackv,
-                       NULL, /* valCopyFunctionp */
-                       _lexemeGrammarHash_free_callbackv,
-                       MARPAESLIF_HASH_SIZE,
-                       0 /* wantedSubSize */);
-  if (MARPAESLIF_UNLIKELY(GENERICHASH_ERROR(marpaESLIFGrammarp->lexemeGrammarHashp))) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "lexemeGrammarHashp init failure, %s", strerror(errno));
-    marpaESLIFGrammarp->lexemeGrammarHashp = NULL;
-    goto err;
-  }
+  _marpaESLIF_hash_initv(marpaESLIFp, marpaESLIFGrammarp->lexemeGrammarHashp,
+                         NULL, /* userDatavp */
+                         _marpaESLIF_string_hashl,
+                         _marpaESLIF_string_cmpb,
+                         _marpaESLIF_string_free_callbackv,
+                         _lexemeGrammarHash_free_callbackv);
 
   /* Success. We have to take care of one thing: the new grammar maintains a pointer to its parent's ESLIF */
   marpaESLIFGrammarp->marpaESLIFp = marpaESLIFp;
@@ -9925,7 +10793,7 @@ short marpaESLIFGrammar_grammarshowform_by_levelb(marpaESLIFGrammar_t *marpaESLI
     /* Grammar show is delayed until requested because it have a cost -; */
     if (grammarp->asciishows == NULL) {
       _marpaESLIF_grammar_createshowv(marpaESLIFGrammarp, grammarp, NULL /* asciishows */, &asciishowl);
-      grammarp->asciishows = (char *) malloc(asciishowl);
+      grammarp->asciishows = (char *) MARPAESLIF_MALLOC(marpaESLIFGrammarp->marpaESLIFp, asciishowl);
       if (MARPAESLIF_UNLIKELY(grammarp->asciishows == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -10118,7 +10986,7 @@ short marpaESLIFGrammar_symboldisplayform_by_levelb(marpaESLIFGrammar_t *marpaES
 }
 
 /*****************************************************************************/
-short marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp)
+short marpaESLIFGrammar_symbolid_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, char *names, int *symbolip)
 /*****************************************************************************/
 {
   marpaESLIF_grammar_t *grammarp;
@@ -10136,7 +11004,7 @@ short marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammar_t *marpaESLIFG
     goto err;
   }
 
-  rcb = marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammarp, symboli, marpaESLIFSymbolPropertyp, grammarp->leveli, NULL /* descp */);
+  rcb = marpaESLIFGrammar_symbolid_by_levelb(marpaESLIFGrammarp, names, symbolip, grammarp->leveli, NULL /* descp */);
   goto done;
 
  err:
@@ -10147,15 +11015,14 @@ short marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammar_t *marpaESLIFG
 }
 
 /*****************************************************************************/
-short marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp, int leveli, marpaESLIFString_t *descp)
+short marpaESLIFGrammar_symbolid_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, char *names, int *symbolip, int leveli, marpaESLIFString_t *descp)
 /*****************************************************************************/
 {
-  marpaESLIF_grammar_t       *grammarp;
-  marpaESLIF_symbol_t        *symbolp;
-  marpaESLIFSymbolProperty_t  marpaESLIFSymbolProperty;
-  short                       rcb;
+  marpaESLIF_grammar_t *grammarp;
+  marpaESLIF_symbol_t  *symbolp;
+  short                 rcb;
 
-  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL) || MARPAESLIF_UNLIKELY(symboli < 0)) {
+  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL) || MARPAESLIF_UNLIKELY(names == NULL)) {
     errno = EINVAL;
     goto err;
   }
@@ -10166,37 +11033,107 @@ short marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammar_t *marpaESLIF
     goto err;
   }
 
-  symbolp = _marpaESLIF_symbol_findp(marpaESLIFGrammarp->marpaESLIFp, grammarp, NULL /* asciis */, symboli, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb - NOT USED */, 0 /* onlyRhsb - NOT USED */, MARPAESLIF_SYMBOL_TYPE_NA /* NOT USED */);
+  /* Same resolution as the name-driven recognizer methods: the first symbol with that name */
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFGrammarp->marpaESLIFp, grammarp, names, -1 /* symboli */, NULL /* symbolip */, 1 /* silentb */, 0 /* onlyLhsb */, 0 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_NA);
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
-    errno = EINVAL;
+    errno = ENOENT;
     goto err;
   }
 
-  switch (symbolp->type) {
-  case MARPAESLIF_SYMBOL_TYPE_TERMINAL:
-    marpaESLIFSymbolProperty.type = MARPAESLIF_SYMBOLTYPE_TERMINAL;
-    break;
-  case MARPAESLIF_SYMBOL_TYPE_META:
-    marpaESLIFSymbolProperty.type = MARPAESLIF_SYMBOLTYPE_META;
-    break;
-  default:
-    MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "Unsupported symbol type %d", symbolp->type);
-    goto err;
+  if (symbolip != NULL) {
+    *symbolip = symbolp->idi;
   }
-  marpaESLIFSymbolProperty.startb               = symbolp->startb;
-  marpaESLIFSymbolProperty.discardb             = symbolp->discardb;
-  marpaESLIFSymbolProperty.discardRhsb          = symbolp->discardRhsb;
-  marpaESLIFSymbolProperty.lhsb                 = symbolp->lhsb;
-  marpaESLIFSymbolProperty.topb                 = symbolp->topb;
-  marpaESLIFSymbolProperty.idi                  = symbolp->idi;
-  marpaESLIFSymbolProperty.descp                = symbolp->descp;
-  marpaESLIFSymbolProperty.eventBefores         = symbolp->eventBefores;
-  marpaESLIFSymbolProperty.eventBeforeb         = symbolp->eventBeforeb;
-  marpaESLIFSymbolProperty.eventAfters          = symbolp->eventAfters;
-  marpaESLIFSymbolProperty.eventAfterb          = symbolp->eventAfterb;
-  marpaESLIFSymbolProperty.eventPredicteds      = symbolp->eventPredicteds;
-  marpaESLIFSymbolProperty.eventPredictedb      = symbolp->eventPredictedb;
-  marpaESLIFSymbolProperty.eventNulleds         = symbolp->eventNulleds;
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp)
+/*****************************************************************************/
+{
+  marpaESLIF_grammar_t *grammarp;
+  short                 rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  grammarp = marpaESLIFGrammarp->grammarp;
+
+  if (MARPAESLIF_UNLIKELY(grammarp == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  rcb = marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammarp, symboli, marpaESLIFSymbolPropertyp, grammarp->leveli, NULL /* descp */);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFGrammar_symbolproperty_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp, int symboli, marpaESLIFSymbolProperty_t *marpaESLIFSymbolPropertyp, int leveli, marpaESLIFString_t *descp)
+/*****************************************************************************/
+{
+  marpaESLIF_grammar_t       *grammarp;
+  marpaESLIF_symbol_t        *symbolp;
+  marpaESLIFSymbolProperty_t  marpaESLIFSymbolProperty;
+  short                       rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL) || MARPAESLIF_UNLIKELY(symboli < 0)) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  grammarp = _marpaESLIFGrammar_grammar_findp(marpaESLIFGrammarp, leveli, descp);
+  if (MARPAESLIF_UNLIKELY(grammarp == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFGrammarp->marpaESLIFp, grammarp, NULL /* asciis */, symboli, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb - NOT USED */, 0 /* onlyRhsb - NOT USED */, MARPAESLIF_SYMBOL_TYPE_NA /* NOT USED */);
+  if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  switch (symbolp->type) {
+  case MARPAESLIF_SYMBOL_TYPE_TERMINAL:
+    marpaESLIFSymbolProperty.type = MARPAESLIF_SYMBOLTYPE_TERMINAL;
+    break;
+  case MARPAESLIF_SYMBOL_TYPE_META:
+    marpaESLIFSymbolProperty.type = MARPAESLIF_SYMBOLTYPE_META;
+    break;
+  default:
+    MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "Unsupported symbol type %d", symbolp->type);
+    goto err;
+  }
+  marpaESLIFSymbolProperty.startb               = symbolp->startb;
+  marpaESLIFSymbolProperty.discardb             = symbolp->discardb;
+  marpaESLIFSymbolProperty.discardRhsb          = symbolp->discardRhsb;
+  marpaESLIFSymbolProperty.lhsb                 = symbolp->lhsb;
+  marpaESLIFSymbolProperty.topb                 = symbolp->topb;
+  marpaESLIFSymbolProperty.idi                  = symbolp->idi;
+  marpaESLIFSymbolProperty.descp                = symbolp->descp;
+  marpaESLIFSymbolProperty.eventBefores         = symbolp->eventBefores;
+  marpaESLIFSymbolProperty.eventBeforeb         = symbolp->eventBeforeb;
+  marpaESLIFSymbolProperty.eventAfters          = symbolp->eventAfters;
+  marpaESLIFSymbolProperty.eventAfterb          = symbolp->eventAfterb;
+  marpaESLIFSymbolProperty.eventPredicteds      = symbolp->eventPredicteds;
+  marpaESLIFSymbolProperty.eventPredictedb      = symbolp->eventPredictedb;
+  marpaESLIFSymbolProperty.eventNulleds         = symbolp->eventNulleds;
   marpaESLIFSymbolProperty.eventNulledb         = symbolp->eventNulledb;
   marpaESLIFSymbolProperty.eventCompleteds      = symbolp->eventCompleteds;
   marpaESLIFSymbolProperty.eventCompletedb      = symbolp->eventCompletedb;
@@ -10588,7 +11525,7 @@ static inline void _marpaESLIFRecognizer_alternativeStack_freev(marpaESLIFRecogn
 						     (marpaESLIFValueResult_t *) &marpaESLIFValueResultUndef,
 						     0, /* forgetb */
 						     &(alternativep->marpaESLIFValueResult));
-          free(alternativep);
+          MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, alternativep);
         }
       }
     }
@@ -10617,7 +11554,7 @@ static inline marpaESLIF_alternative_t *_marpaESLIFRecognizer_alternativeStack_g
     rcp = (marpaESLIF_alternative_t *) GENERICSTACK_GET_PTR(alternativeStackSymbolp, indicei);
     _marpaESLIFRecognizer_marpaESLIFValueResult_freeb(marpaESLIFRecognizerp, &(rcp->marpaESLIFValueResult), 1 /* deepb */);
   } else {
-    rcp = (marpaESLIF_alternative_t *) malloc(sizeof(marpaESLIF_alternative_t));
+    rcp = (marpaESLIF_alternative_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIF_alternative_t));
     if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -10644,7 +11581,7 @@ static inline marpaESLIF_alternative_t *_marpaESLIFRecognizer_alternativeStack_g
 
  err:
   if (rcp != NULL) {
-    free(rcp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, rcp);
   }
   rcp = NULL;
 
@@ -12121,6 +13058,7 @@ static inline short _marpaESLIFRecognizer_alternative_completeb(marpaESLIFRecogn
   marpaESLIF_symbol_t              *symbolp;
   short                             rcb;
   int                               latestEarleySetIdi;
+  int                               earleySetSizei;
   GENERICSTACKITEMTYPE2TYPE_ARRAY   array;
   char                             *currentOffsetp;
 
@@ -12178,6 +13116,22 @@ static inline short _marpaESLIFRecognizer_alternative_completeb(marpaESLIFRecogn
     _marpaESLIFRecognizer_push_grammar_eventsb(marpaESLIFRecognizerp);
     goto err;
   }
+  /* A new earley set: the expected terminals are not the same */
+  marpaESLIFRecognizerp->expectedGenerationl++;
+
+  /* Earley sets are what grows with the input in libmarpa. Sub-recognizers only match */
+  /* short lexemes: their Earley sets are not counted.                                 */
+  if (MARPAESLIFRECOGNIZER_IS_TOP(marpaESLIFRecognizerp)) {
+    if (MARPAESLIF_UNLIKELY(! marpaWrapperRecognizer_earleySetSizeb(marpaESLIFRecognizerp->marpaWrapperRecognizerp, -1, &earleySetSizei))) {
+      goto err;
+    }
+    marpaESLIFRecognizerp->earleyItemsl += (size_t) earleySetSizei;
+  }
+
+  /* Lexeme and alternative stacks, and the Earley set mapping, may have grown */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerp, 0 /* extral */))) {
+    goto err;
+  }
 
   /* New line processing, increase of startCompletionl, of internal position, etc... */
   if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_matchPostProcessingb(marpaESLIFRecognizerp, lengthl))) {
@@ -12398,7 +13352,7 @@ short marpaESLIFRecognizer_alternative_readb(marpaESLIFRecognizer_t *marpaESLIFR
 }
 
 /*****************************************************************************/
-short _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, short *matchbp)
+static inline short _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, short *matchbp)
 /*****************************************************************************/
 {
   static const char       *funcs = "_marpaESLIFRecognizer_name_tryb";
@@ -12414,9 +13368,13 @@ short _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecogniz
   grammarp           = marpaESLIFRecognizerp->grammarp;
 
   /* This must be an RHS */
-  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, names, -1, NULL /* symbolip */, 1 /* silentb */, 0 /* onlyLhsb */, 1 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_NA);
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, names, symboli, NULL /* symbolip */, 1 /* silentb */, 0 /* onlyLhsb */, 1 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_NA);
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s> used only as an RHS", names);
+    if (names != NULL) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s> used only as an RHS", names);
+    } else {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol ID %d used only as an RHS", symboli);
+    }
     goto err;
   }
 
@@ -12457,7 +13415,42 @@ short marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognize
     goto err;
   }
 
-  rcb = _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizerp, names, matchbp);
+  rcb = _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizerp, names, -1 /* symboli */, matchbp);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_name_try_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, short *matchbp)
+/*****************************************************************************/
+{
+  static const char *funcs = "marpaESLIFRecognizer_name_try_by_idb";
+  short              rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY(symboli < 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid symbol ID %d", symboli);
+    errno = EINVAL;
+    goto err;
+  }
+
+  rcb = _marpaESLIFRecognizer_name_tryb(marpaESLIFRecognizerp, NULL /* names */, symboli, matchbp);
   goto done;
 
  err:
@@ -12572,11 +13565,6 @@ short marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecogn
 /*****************************************************************************/
 {
   static const char    *funcs           = "marpaESLIFRecognizer_event_onoffb";
-  static const int      nativeEventSeti = MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED;
-  marpaESLIF_t         *marpaESLIFp;
-  marpaESLIF_grammar_t *grammarp;
-  marpaESLIF_symbol_t  *symbolp;
-  int                   seti;
   short                 rcb;
 
   if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
@@ -12595,17 +13583,131 @@ short marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecogn
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
-  marpaESLIFp        = marpaESLIFRecognizerp->marpaESLIFp;
-  grammarp           = marpaESLIFRecognizerp->grammarp;
-
   if (MARPAESLIF_UNLIKELY(symbols == NULL)) {
-    MARPAESLIF_ERROR(marpaESLIFp, "Symbol name is NULL");
+    MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "Symbol name is NULL");
+    goto err;
+  }
+
+  rcb = _marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizerp, symbols, -1 /* symboli */, eventSeti, onoffb);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_event_onoff_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, marpaESLIFEventType_t eventSeti, short onoffb)
+/*****************************************************************************/
+{
+  static const char    *funcs           = "marpaESLIFRecognizer_event_onoff_by_idb";
+  short                 rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  /* Not allowed unless this is an interactive recognizer */
+  if (! MARPAESLIFRECOGNIZER_IS_INTERACTIVE(marpaESLIFRecognizerp)) {
+    errno = EPERM;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY(symboli < 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid symbol ID %d", symboli);
+    errno = EINVAL;
+    goto err;
+  }
+
+  rcb = _marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizerp, NULL /* symbols */, symboli, eventSeti, onoffb);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_event_maskb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFEventType_t eventSeti, marpaESLIFEventType_t *previousEventSetip)
+/*****************************************************************************/
+{
+  static const char *funcs = "marpaESLIFRecognizer_event_maskb";
+  short              rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  /* Not allowed unless this is an interactive recognizer */
+  if (! MARPAESLIFRECOGNIZER_IS_INTERACTIVE(marpaESLIFRecognizerp)) {
+    errno = EPERM;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY((eventSeti & ~MARPAESLIF_EVENTTYPE_ALL) != 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid event set 0x%x", (unsigned int) eventSeti);
+    errno = EINVAL;
     goto err;
   }
 
-  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, symbols, -1, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb */, 0 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_META);
+  if (previousEventSetip != NULL) {
+    *previousEventSetip = (marpaESLIFEventType_t) marpaESLIFRecognizerp->eventMaski;
+  }
+  marpaESLIFRecognizerp->eventMaski = (int) eventSeti;
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *symbols, int symboli, marpaESLIFEventType_t eventSeti, short onoffb)
+/*****************************************************************************/
+{
+  static const int      nativeEventSeti = MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED;
+  marpaESLIF_t         *marpaESLIFp     = marpaESLIFRecognizerp->marpaESLIFp;
+  marpaESLIF_grammar_t *grammarp        = marpaESLIFRecognizerp->grammarp;
+  marpaESLIF_symbol_t  *symbolp;
+  int                   seti;
+  short                 rcb;
+
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, symbols, symboli, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb */, 0 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_META);
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s>", symbols);
+    if (symbols != NULL) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s>", symbols);
+    } else {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol ID %d", symboli);
+    }
     goto err;
   }
 
@@ -12638,9 +13740,6 @@ short marpaESLIFRecognizer_event_onoffb(marpaESLIFRecognizer_t *marpaESLIFRecogn
   rcb = 0;
 
  done:
-  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
- fast_done:
   return rcb;
 }
 
@@ -12674,36 +13773,125 @@ short marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t *marpaESLIFReco
 }
 
 /*****************************************************************************/
-void marpaESLIFGrammar_freev(marpaESLIFGrammar_t *marpaESLIFGrammarp)
-/*****************************************************************************/
-{
-  _marpaESLIFGrammar_freev(marpaESLIFGrammarp, 0 /* onStackb */);
-}
-
-/*****************************************************************************/
-static inline void _marpaESLIFRecognizer_symbolData_freev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_symbol_data_t **symbolDatapp)
+short marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nSymbollp, int *symbolArrayip, size_t symbolArrayAllocl, size_t *generationlp)
 /*****************************************************************************/
 {
-  static const char        *funcs       = "_marpaESLIFRecognizer_symbolData_freev";
-  genericStack_t           *symbolStackp;
-  marpaESLIF_grammar_t     *grammarp;
-  int                       symboli;
-  marpaESLIF_symbol_data_t *symbolDatap;
+  static const char    *funcs = "marpaESLIFRecognizer_name_expected_by_idb";
+  short                 rcb;
 
-  if (symbolDatapp != NULL) {
-    grammarp     = marpaESLIFRecognizerp->grammarp;
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY((symbolArrayip == NULL) && (symbolArrayAllocl > 0))) {
+    MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "Symbol array is NULL");
+    errno = EINVAL;
+    goto err;
+  }
+
+  rcb = _marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizerp, nSymbollp, symbolArrayip, symbolArrayAllocl, generationlp);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFGrammar_value_stack_cacheb(marpaESLIFGrammar_t *marpaESLIFGrammarp, short enableb)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  marpaESLIFGrammarp->valueStackCacheb = enableb ? 1 : 0;
+  if ((! enableb) && (marpaESLIFGrammarp->valueStackItemsp != NULL)) {
+    /* genericStack storage: it comes from the C library, not from the allocator */
+    free(marpaESLIFGrammarp->valueStackItemsp);
+    marpaESLIFGrammarp->valueStackItemsp = NULL;
+    marpaESLIFGrammarp->valueStackItemsi = 0;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+short marpaESLIFGrammar_generator_cache_limitb(marpaESLIFGrammar_t *marpaESLIFGrammarp, size_t maxEntriesl, size_t maxBytesl)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY(marpaESLIFGrammarp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  marpaESLIFGrammarp->lexemeGrammarMaxEntriesl = maxEntriesl;
+  marpaESLIFGrammarp->lexemeGrammarMaxBytesl   = maxBytesl;
+  _marpaESLIFGrammar_lexemeGrammar_evictv(marpaESLIFGrammarp);
+
+  return 1;
+}
+
+/*****************************************************************************/
+short marpaESLIFGrammar_generator_cache_statsb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFGrammarGeneratorCacheStats_t *statsp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY((marpaESLIFGrammarp == NULL) || (statsp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  statsp->entriesl  = (marpaESLIFGrammarp->lexemeGrammarHashp != NULL) ? marpaESLIFGrammarp->lexemeGrammarHashp->usedl : 0;
+  statsp->bytesl    = marpaESLIFGrammarp->lexemeGrammarBytesl;
+  statsp->hitl      = marpaESLIFGrammarp->lexemeGrammarHitl;
+  statsp->missl     = marpaESLIFGrammarp->lexemeGrammarMissl;
+  statsp->evictionl = marpaESLIFGrammarp->lexemeGrammarEvictionl;
+
+  return 1;
+}
+
+/*****************************************************************************/
+void marpaESLIFGrammar_freev(marpaESLIFGrammar_t *marpaESLIFGrammarp)
+/*****************************************************************************/
+{
+  _marpaESLIFGrammar_freev(marpaESLIFGrammarp, 0 /* onStackb */);
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFRecognizer_symbolData_freev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIF_symbol_data_t **symbolDatapp)
+/*****************************************************************************/
+{
+  static const char        *funcs       = "_marpaESLIFRecognizer_symbolData_freev";
+  genericStack_t           *symbolStackp;
+  marpaESLIF_grammar_t     *grammarp;
+  int                       symboli;
+  marpaESLIF_symbol_data_t *symbolDatap;
+
+  if (symbolDatapp != NULL) {
+    grammarp     = marpaESLIFRecognizerp->grammarp;
     symbolStackp = grammarp->symbolStackp;
 
     for (symboli = 0; symboli < GENERICSTACK_USED(symbolStackp); symboli++) {
       symbolDatap = symbolDatapp[symboli];
       if (symbolDatap != NULL) {
         if (symbolDatap->bytes != NULL) {
-          free(symbolDatap->bytes);
+          MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, symbolDatap->bytes);
         }
-        free(symbolDatap);
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, symbolDatap);
       }
     }
-    free(symbolDatapp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, symbolDatapp);
   }
 }
 
@@ -12784,6 +13972,238 @@ short marpaESLIFGrammar_parse_by_levelb(marpaESLIFGrammar_t *marpaESLIFGrammarp,
   return rcb;
 }
 
+/*****************************************************************************/
+short marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, marpaESLIFValueOption_t *marpaESLIFValueOptionp, marpaESLIFRecoveryOption_t *marpaESLIFRecoveryOptionp, size_t *errorlp)
+/*****************************************************************************/
+/* The grammar describes one record. Marpa cannot rewind, so every record is */
+/* parsed by a new recognizer sharing the stream, that starts again from the */
+/* start symbol where the previous one stopped. When a record fails, input   */
+/* is skipped up to and including the next synchronisation terminal.         */
+/*****************************************************************************/
+{
+  static const char            *funcs                       = "marpaESLIFGrammar_parse_recoverb";
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerSharedp = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp       = NULL;
+  marpaESLIFValue_t            *marpaESLIFValuep;
+  size_t                        errorl                      = 0;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  marpaESLIFRecoveryError_t     marpaESLIFRecoveryError;
+  marpaESLIF_stream_t          *marpaESLIF_streamp;
+  short                         canContinueb;
+  short                         isExhaustedb;
+  short                         okb;
+  short                         skipb;
+  short                         rcb;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFGrammarp == NULL) || (marpaESLIFRecognizerOptionp == NULL) || (marpaESLIFRecoveryOptionp == NULL) || ((marpaESLIFRecoveryOptionp->syncSymboll > 0) && (marpaESLIFRecoveryOptionp->syncSymbolpp == NULL)))) {
+    errno = EINVAL;
+    goto err;
+  }
+
+  /* A record ends where the start symbol cannot be extended */
+  marpaESLIFRecognizerOption            = *marpaESLIFRecognizerOptionp;
+  marpaESLIFRecognizerOption.exhaustedb = 1;
+
+  marpaESLIFValueOption            = (marpaESLIFValueOptionp != NULL) ? *marpaESLIFValueOptionp : marpaESLIFValueOption_default_template;
+  marpaESLIFValueOption.ambiguousb = 0;
+
+  marpaESLIFRecognizerSharedp = marpaESLIFRecognizerp = _marpaESLIFRecognizer_newp(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->grammarp, &marpaESLIFRecognizerOption, 0 /* discardb */, 1 /* noEventb */, 1 /* silentb */);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    goto err;
+  }
+  marpaESLIF_streamp = marpaESLIFRecognizerSharedp->marpaESLIF_streamp;
+
+  while (1) {
+    if (marpaESLIF_streamp->inputl <= 0) {
+      if (marpaESLIF_streamp->eofb) {
+        break;
+      }
+      if (MARPAESLIF_UNLIKELY(! __marpaESLIFRecognizer_readb(marpaESLIFRecognizerSharedp))) {
+        goto err;
+      }
+      continue;
+    }
+
+    if (marpaESLIFRecognizerp == NULL) {
+      marpaESLIFRecognizerp = _marpaESLIFRecognizer_newFromp(marpaESLIFGrammarp->grammarp, marpaESLIFRecognizerSharedp, 0 /* discardb */, 1 /* noEventb */, 1 /* silentb */);
+      if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+        goto err;
+      }
+    }
+
+    marpaESLIFRecoveryError.startl = _marpaESLIF_stream_offsetl(marpaESLIF_streamp);
+
+    /* A malloc failure inside the record leaves ENOMEM */
+    errno = 0;
+    okb = _marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 0 /* initialEventsb */, &canContinueb, &isExhaustedb);
+    while (okb && canContinueb) {
+      okb = __marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0 /* deltaLengthl */, 0 /* initialEventsb */, &canContinueb, &isExhaustedb);
+    }
+
+    if (! marpaESLIFRecognizerp->haveLexemeb) {
+      /* Only discarded data up to the end: this is not an error */
+      if (marpaESLIF_streamp->eofb && (marpaESLIF_streamp->inputl <= 0)) {
+        break;
+      }
+      okb = 0;
+    }
+
+    if (okb) {
+      /* The record is complete: its value goes to the importer. A failure here consumed the record already */
+      skipb = 0;
+      marpaESLIFValuep = _marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption, 1 /* silentb */, 0 /* fakeb */, 0 /* isLexemeb */);
+      okb = (marpaESLIFValuep != NULL) && (_marpaESLIFValue_valueb(marpaESLIFValuep, NULL /* marpaESLIFValueResultp */) > 0);
+      marpaESLIFValue_freev(marpaESLIFValuep);
+    } else {
+      skipb = 1;
+    }
+
+    if (! okb) {
+      /* Only a parse failure can be skipped: resource and I/O errors would happen again on the next record */
+      if (MARPAESLIF_UNLIKELY(marpaESLIF_streamp->readErrorb || marpaESLIFRecognizerSharedp->memoryLimitb || (errno == ENOMEM))) {
+        MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "Recovery aborted: %s", marpaESLIF_streamp->readErrorb ? "read failure" : "out of memory");
+        if (! marpaESLIF_streamp->readErrorb) {
+          errno = ENOMEM;
+        }
+        goto err;
+      }
+      marpaESLIFRecoveryError.offsetl = _marpaESLIF_stream_offsetl(marpaESLIF_streamp);
+      if (marpaESLIFRecognizerOption.newlineb) {
+        _marpaESLIF_stream_locationv(marpaESLIF_streamp);
+        marpaESLIFRecoveryError.linel   = marpaESLIF_streamp->linel;
+        marpaESLIFRecoveryError.columnl = marpaESLIF_streamp->columnl;
+      } else {
+        marpaESLIFRecoveryError.linel   = 0;
+        marpaESLIFRecoveryError.columnl = 0;
+      }
+      if (skipb) {
+        if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_recover_skipb(marpaESLIFRecognizerp, marpaESLIFRecoveryOptionp))) {
+          goto err;
+        }
+      }
+      marpaESLIFRecoveryError.endl = _marpaESLIF_stream_offsetl(marpaESLIF_streamp);
+
+      errorl++;
+      if (marpaESLIFRecoveryOptionp->errorCallbackp != NULL) {
+        if (MARPAESLIF_UNLIKELY(! marpaESLIFRecoveryOptionp->errorCallbackp(marpaESLIFRecognizerOption.userDatavp, &marpaESLIFRecoveryError))) {
+          goto err;
+        }
+      }
+      if (MARPAESLIF_UNLIKELY((marpaESLIFRecoveryOptionp->maxErrorl > 0) && (errorl >= marpaESLIFRecoveryOptionp->maxErrorl))) {
+        MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "Maximum number of errors reached: %ld", (unsigned long) errorl);
+        goto err;
+      }
+    }
+
+    /* Next record starts from scratch */
+    if (marpaESLIFRecognizerp != marpaESLIFRecognizerSharedp) {
+      marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+    }
+    marpaESLIFRecognizerp = NULL;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if ((marpaESLIFRecognizerp != NULL) && (marpaESLIFRecognizerp != marpaESLIFRecognizerSharedp)) {
+    marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  }
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerSharedp);
+  if (errorlp != NULL) {
+    *errorlp = errorl;
+  }
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_recover_skipb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFRecoveryOption_t *marpaESLIFRecoveryOptionp)
+/*****************************************************************************/
+/* Skips input up to and including the next synchronisation terminal, or up */
+/* to the end of the stream. Terminals are tried at every character.         */
+/*****************************************************************************/
+{
+  static const char   *funcs              = "_marpaESLIFRecognizer_recover_skipb";
+  marpaESLIF_stream_t *marpaESLIF_streamp = marpaESLIFRecognizerp->marpaESLIF_streamp;
+  size_t               syncSymboll;
+  size_t               matchedLengthl;
+  size_t               skipl;
+  short                matchb;
+  short                rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  while (1) {
+    if (marpaESLIF_streamp->inputl <= 0) {
+      if (marpaESLIF_streamp->eofb) {
+        break;
+      }
+      if (MARPAESLIF_UNLIKELY(! __marpaESLIFRecognizer_readb(marpaESLIFRecognizerp))) {
+        goto err;
+      }
+      continue;
+    }
+
+    for (syncSymboll = 0; syncSymboll < marpaESLIFRecoveryOptionp->syncSymboll; syncSymboll++) {
+      matchedLengthl = 0;
+      if (MARPAESLIF_UNLIKELY(! __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, marpaESLIFRecoveryOptionp->syncSymbolpp[syncSymboll], &matchb, &matchedLengthl))) {
+        goto err;
+      }
+      if (matchb && (matchedLengthl > 0)) {
+        break;
+      }
+    }
+
+    if (syncSymboll < marpaESLIFRecoveryOptionp->syncSymboll) {
+      skipl = matchedLengthl;
+    } else {
+      /* Next character */
+      skipl = 1;
+      if (marpaESLIF_streamp->utfb) {
+        while ((skipl < marpaESLIF_streamp->inputl) && ((((unsigned char) marpaESLIF_streamp->inputs[skipl]) & 0xC0) == 0x80)) {
+          skipl++;
+        }
+      }
+    }
+
+    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Skipping %ld bytes", (unsigned long) skipl);
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_getNextLineAndColumnb(marpaESLIFRecognizerp, skipl))) {
+      goto err;
+    }
+    marpaESLIF_streamp->inputs += skipl;
+    marpaESLIF_streamp->inputl -= skipl;
+
+    if (syncSymboll < marpaESLIFRecoveryOptionp->syncSymboll) {
+      break;
+    }
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline size_t _marpaESLIF_stream_offsetl(marpaESLIF_stream_t *marpaESLIF_streamp)
+/*****************************************************************************/
+/* Offset of the current position since the very start of input.             */
+/*****************************************************************************/
+{
+  return ((size_t) (marpaESLIF_streamp->inputs - marpaESLIF_streamp->buffers)) + ((size_t) marpaESLIF_streamp->globalOffsetp);
+}
+
 /*****************************************************************************/
 static short _marpaESLIFReader_grammarReader(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp)
 /*****************************************************************************/
@@ -12841,7 +14261,7 @@ static inline marpaESLIF_grammar_bootstrap_t *_marpaESLIF_grammar_bootstrap_find
   }
 
   if ((utf8p != NULL) && (utf8p != descp)) {
-    _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
   }
 
   return rcp;
@@ -12879,7 +14299,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIF_grammar_findp(marpaESLIF_t *marp
   }
 
   if ((utf8p != NULL) && (utf8p != descp)) {
-    _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
   }
 
   return rcp;
@@ -12918,7 +14338,7 @@ static inline marpaESLIF_grammar_t *_marpaESLIFGrammar_grammar_findp(marpaESLIFG
   }
 
   if ((utf8p != NULL) && (utf8p != descp)) {
-    _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFGrammarp->marpaESLIFp, utf8p, 0 /* onStackb */);
   }
 
   return rcp;
@@ -12955,11 +14375,19 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_symbol_findp(marpaESLIF_t *marpaE
   marpaESLIF_symbol_t  *rcp;
   marpaESLIF_symbol_t  *symbolp;
   int                   i;
+  int                   starti;
+  short                 findResultb;
 
   /* Give precedence to symbol by name - which is possible only for meta symbols */
   if (asciis != NULL) {
     rcp = NULL;
-    for (i = 0; i < GENERICSTACK_USED(symbolStackp); i++) {
+    starti = 0;
+    if (grammarp->symbolNameHashp != NULL) {
+      /* The index gives the first symbol with that name: no symbol before it can match */
+      findResultb = _marpaESLIF_hash_findb(grammarp->symbolNameHashp, asciis, (void **) &symbolp);
+      starti = findResultb ? symbolp->idi : GENERICSTACK_USED(symbolStackp);
+    }
+    for (i = starti; i < GENERICSTACK_USED(symbolStackp); i++) {
       MARPAESLIF_GRAMMAR_INTERNAL_GET_SYMBOL(marpaESLIFp, symbolp, grammarp, i);
       /* First the fastest tests */
       switch (type) {
@@ -13001,7 +14429,7 @@ static inline marpaESLIF_symbol_t *_marpaESLIF_symbol_findp(marpaESLIF_t *marpaE
       goto err;
     }
     symbolp = (marpaESLIF_symbol_t *) GENERICSTACK_GET_PTR(symbolStackp, symboli);
-    if ((symbolp->lhsb && onlyRhsb) || ((! symbolp->lhsb) && onlyLhsb)) {
+    if ((symbolp->lhsb && onlyRhsb) || ((! symbolp->lhsb) && onlyLhsb) || ((type != MARPAESLIF_SYMBOL_TYPE_NA) && (symbolp->type != type))) {
       if (! silentb) {
         MARPAESLIF_ERRORF(marpaESLIFp, "Invalid symbol ID %d", symboli);
       }
@@ -13068,6 +14496,8 @@ static inline short _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *ma
   size_t                    eventArraySizel;
   marpaESLIFEvent_t         eventArray;
   char                     *tmpp;
+  int                       ranki;
+  size_t                    i;
   short                     rcb;
 
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
@@ -13103,13 +14533,13 @@ static inline short _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *ma
   /* discarded data, when trackb is on, he cannot. */
   if ((discardp != NULL) && (discardl > 0)) {
     if (marpaESLIFRecognizerp->lastDiscards == NULL) {
-      marpaESLIFRecognizerp->lastDiscards = (char *) malloc(discardl + 1); /* Hiden NUL byte */
+      marpaESLIFRecognizerp->lastDiscards = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, discardl + 1); /* Hiden NUL byte */
       if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->lastDiscards == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
     } else if (marpaESLIFRecognizerp->lastDiscardl < discardl) {
-      tmpp = (char *) realloc(marpaESLIFRecognizerp->lastDiscards, discardl + 1); /* Hiden NUL byte */
+      tmpp = (char *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->lastDiscards, discardl + 1); /* Hiden NUL byte */
       if (MARPAESLIF_UNLIKELY(tmpp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -13121,6 +14551,12 @@ static inline short _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *ma
     marpaESLIFRecognizerp->lastDiscards[marpaESLIFRecognizerp->lastDiscardl] = '\0';
   }
 
+  /* Events the application did not subscribe to are dropped here */
+  if ((marpaESLIFRecognizerp->eventMaski & type) != type) {
+    MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "%s: event type %d is not subscribed", (symbolp != NULL) ? symbolp->descp->asciis : "??", (int) type);
+    goto no_push;
+  }
+
   /* These statements have a cost - execute them only if we really push the event */
   eventArrayp     = marpaESLIFRecognizerp->eventArrayp;
   eventArraySizel = marpaESLIFRecognizerp->eventArraySizel;
@@ -13138,14 +14574,14 @@ static inline short _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *ma
     if (eventArrayp == NULL) {
       /* In theory, here, eventArrayl can only have the value 1 */
       eventArraySizel = eventArrayl + 1;
-      eventArrayp = (marpaESLIFEvent_t *) malloc(eventArraySizel * sizeof(marpaESLIFEvent_t));
+      eventArrayp = (marpaESLIFEvent_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, eventArraySizel * sizeof(marpaESLIFEvent_t));
       if (MARPAESLIF_UNLIKELY(eventArrayp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
       eventArraySizel *= 2;
-      eventArrayp = realloc(eventArrayp, eventArraySizel * sizeof(marpaESLIFEvent_t));
+      eventArrayp = MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, eventArrayp, eventArraySizel * sizeof(marpaESLIFEvent_t));
       if (MARPAESLIF_UNLIKELY(eventArrayp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -13155,11 +14591,13 @@ static inline short _marpaESLIFRecognizer_push_eventb(marpaESLIFRecognizer_t *ma
     marpaESLIFRecognizerp->eventArraySizel = eventArraySizel;
   }
 
-  eventArrayp[eventArrayl] = eventArray;
-  if ((marpaESLIFRecognizerp->eventArrayl = ++eventArrayl) > 1) {
-    /* Sort the events if there is more than one */
-    _marpaESLIFRecognizer_sort_eventsb(marpaESLIFRecognizerp);
+  /* The array is always kept ordered: insert after the last event of lower or same rank */
+  ranki = _marpaESLIF_event_ranki(type);
+  for (i = eventArrayl; (i > 0) && (_marpaESLIF_event_ranki(eventArrayp[i - 1].type) > ranki); i--) {
+    eventArrayp[i] = eventArrayp[i - 1];
   }
+  eventArrayp[i] = eventArray;
+  marpaESLIFRecognizerp->eventArrayl = ++eventArrayl;
 
  no_push:
   rcb = 1;
@@ -13189,7 +14627,7 @@ static inline short _marpaESLIFRecognizer_set_symbolDatab(marpaESLIFRecognizer_t
 
   /* symbolDatapp is guaranteed to have been allocated. But this is originally an array of NULL pointers */
   if (symbolDatap == NULL) {
-    symbolDatap = (marpaESLIF_symbol_data_t *) malloc(sizeof(marpaESLIF_symbol_data_t));
+    symbolDatap = (marpaESLIF_symbol_data_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(marpaESLIF_symbol_data_t));
     if (MARPAESLIF_UNLIKELY(symbolDatap == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -13215,13 +14653,13 @@ static inline short _marpaESLIFRecognizer_set_symbolDatab(marpaESLIFRecognizer_t
     byteSizel = datal;
 
     if (bytes == NULL) {
-      bytes = (char *) malloc(byteSizel + 1); /* We always add a NUL byte for convenience */
+      bytes = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, byteSizel + 1); /* We always add a NUL byte for convenience */
       if (MARPAESLIF_UNLIKELY(bytes == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
-      bytes = realloc(bytes, byteSizel + 1); /* We always add a NUL byte for convenience */
+      bytes = MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, bytes, byteSizel + 1); /* We always add a NUL byte for convenience */
       if (MARPAESLIF_UNLIKELY(bytes == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -13447,25 +14885,23 @@ static inline void _marpaESLIFRecognizer_clear_grammar_eventsb(marpaESLIFRecogni
   size_t             i;
   size_t             okl             = 0;
 
-  /* We put to NONE the grammar events, sort (NONE will be at the end), and change the length */
+  /* We remove the grammar events in place: remaining events keep their order */
   for (i = 0; i < eventArrayl; i++) {
     switch (eventArrayp[i].type) {
     case MARPAESLIF_EVENTTYPE_PREDICTED:
     case MARPAESLIF_EVENTTYPE_NULLED:
     case MARPAESLIF_EVENTTYPE_COMPLETED:
     case MARPAESLIF_EVENTTYPE_EXHAUSTED:
-      eventArrayp[i].type = MARPAESLIF_EVENTTYPE_NONE;
       break;
     default:
+      if (okl != i) {
+        eventArrayp[okl] = eventArrayp[i];
+      }
       okl++;
       break;
     }
   }
 
-  if (okl > 0) {
-    /* The sort will put eventual NONE events at the very end */
-    _marpaESLIFRecognizer_sort_eventsb(marpaESLIFRecognizerp);
-  }
   marpaESLIFRecognizerp->eventArrayl = okl;
 }
 
@@ -13476,13 +14912,6 @@ static inline void _marpaESLIFRecognizer_clear_all_eventsb(marpaESLIFRecognizer_
   marpaESLIFRecognizerp->eventArrayl = 0;
 }
 
-/*****************************************************************************/
-static inline void  _marpaESLIFRecognizer_sort_eventsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp)
-/*****************************************************************************/
-{
-  MARPAESLIF_QSORT(marpaESLIFEvent_t, marpaESLIFRecognizerp->eventArrayp, marpaESLIFRecognizerp->eventArrayl, _marpaESLIF_event_sort_inlinedi, _marpaESLIF_event_sorti);
-}
-
 /*****************************************************************************/
 static inline void _marpaESLIFRecognizer_valueResultFreev(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
 /*****************************************************************************/
@@ -13572,9 +15001,15 @@ static inline short _marpaESLIFRecognizer_stream_initb(marpaESLIFRecognizer_t *m
   marpaESLIFRecognizerp->_marpaESLIF_stream.encodings            = NULL;
   marpaESLIFRecognizerp->_marpaESLIF_stream.tconvp               = NULL;
   marpaESLIFRecognizerp->_marpaESLIF_stream.bomdoneb             = 0;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.utf8passthroughb     = 0;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.convertedbufs        = NULL;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.convertedbufallocl   = 0;
   marpaESLIFRecognizerp->_marpaESLIF_stream.peeki                = 0;
   marpaESLIFRecognizerp->_marpaESLIF_stream.linel                = 1;
   marpaESLIFRecognizerp->_marpaESLIF_stream.columnl              = 1;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.uncountedl           = 0;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.crb                  = 0;
+  marpaESLIFRecognizerp->_marpaESLIF_stream.readErrorb           = 0;
 
   return 1;
 }
@@ -13615,7 +15050,7 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
 
   /* Nope, this will be a fresh new thingy */
   if (marpaESLIFRecognizerp == NULL) {
-    marpaESLIFRecognizerp = (marpaESLIFRecognizer_t *) malloc(sizeof(marpaESLIFRecognizer_t));
+    marpaESLIFRecognizerp = (marpaESLIFRecognizer_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFRecognizer_t));
     if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -13628,6 +15063,9 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
   marpaESLIFRecognizerp->isExpectedArraybl               = 0;
   marpaESLIFRecognizerp->Lsharep                         = (grammarp != NULL) ? grammarp->Lsharep : NULL;
   marpaESLIFRecognizerp->marpaESLIFGrammarp              = (grammarp != NULL) ? grammarp->marpaESLIFGrammarp : NULL;
+  if (marpaESLIFRecognizerp->marpaESLIFGrammarp != NULL) {
+    marpaESLIFRecognizerp->marpaESLIFGrammarp->recognizerl++;
+  }
   marpaESLIFRecognizerp->isLexemeb                       = isLexemeb;
   marpaESLIFRecognizerp->marpaESLIFRecognizerOption      = *marpaESLIFRecognizerOptionp;
   marpaESLIFRecognizerp->marpaWrapperRecognizerp         = NULL;
@@ -13645,6 +15083,13 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
   marpaESLIFRecognizerp->resumeCounteri                  = 0;
   marpaESLIFRecognizerp->callstackCounteri               = 0;
   marpaESLIFRecognizerp->callstackCounterGlobali         = 0;
+  marpaESLIFRecognizerp->memoryl                         = 0;
+  marpaESLIFRecognizerp->memoryTreel                     = 0;
+  marpaESLIFRecognizerp->memoryPeakl                     = 0;
+  marpaESLIFRecognizerp->lexemeBytesl                    = 0;
+  marpaESLIFRecognizerp->earleyItemsl                    = 0;
+  marpaESLIFRecognizerp->marpaESLIFRecognizerMemoryp     = marpaESLIFRecognizerp; /* Meaningful only for the top-level recognizer */
+  marpaESLIFRecognizerp->memoryLimitb                    = 0;
   /* If there is a parent recognizer, we share quite a lot of information */
   if (marpaESLIFRecognizerParentp != NULL) {
     marpaESLIFRecognizerp->leveli                           = marpaESLIFRecognizerParentp->leveli + 1;
@@ -13653,6 +15098,8 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
     marpaESLIFRecognizerp->parentDeltal                     = marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputs - marpaESLIFRecognizerParentp->marpaESLIF_streamp->buffers;
     marpaESLIFRecognizerp->parentLinel                      = marpaESLIFRecognizerParentp->marpaESLIF_streamp->linel;
     marpaESLIFRecognizerp->parentColumnl                    = marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl;
+    marpaESLIFRecognizerp->parentUncountedl                 = marpaESLIFRecognizerParentp->marpaESLIF_streamp->uncountedl;
+    marpaESLIFRecognizerp->parentCrb                        = marpaESLIFRecognizerParentp->marpaESLIF_streamp->crb;
     marpaESLIFRecognizerp->marpaESLIFRecognizerTopp         = marpaESLIFRecognizerParentp->marpaESLIFRecognizerTopp;
     marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp  = marpaESLIFRecognizerParentp->marpaESLIFValueResultStackOrigp;
     marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp   = marpaESLIFRecognizerParentp->marpaESLIFValueResultStackNewp;
@@ -13663,6 +15110,8 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
     marpaESLIFRecognizerp->parentDeltal                     = 0;
     marpaESLIFRecognizerp->parentLinel                      = 0;
     marpaESLIFRecognizerp->parentColumnl                    = 0;
+    marpaESLIFRecognizerp->parentUncountedl                 = 0;
+    marpaESLIFRecognizerp->parentCrb                        = 0;
     marpaESLIFRecognizerp->marpaESLIFRecognizerTopp         = marpaESLIFRecognizerp; /* We are the top-level recognizer */
     marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp  = NULL; /* Only the top-level recognizer owns this pointer */
     marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp   = NULL; /* Only the top-level recognizer owns this pointer */
@@ -13683,10 +15132,12 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
   marpaESLIFRecognizerp->set2InputStackp                    = NULL;  /* Take care, it is pointer to internal _set2InputStackp if stack init is ok */
   marpaESLIFRecognizerp->namesArrayp                        = NULL;
   marpaESLIFRecognizerp->namesArrayAllocl                   = 0;
+  marpaESLIFRecognizerp->expectedGenerationl                = 0;
   marpaESLIFRecognizerp->discardEventStatebp                = NULL;
   marpaESLIFRecognizerp->beforeEventStatebp                 = NULL;
   marpaESLIFRecognizerp->afterEventStatebp                  = NULL;
   marpaESLIFRecognizerp->discardOnOffb                      = 1; /* By default :discard is enabled */
+  marpaESLIFRecognizerp->eventMaski                         = MARPAESLIF_EVENTTYPE_ALL; /* By default all event types are subscribed */
   marpaESLIFRecognizerp->pristineb                          = 1; /* Until at least one alternative was pushed */
   marpaESLIFRecognizerp->previousMaxMatchedl                = 0;
   marpaESLIFRecognizerp->lastSizel                          = 0;
@@ -13709,6 +15160,8 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
   marpaESLIFRecognizerp->marpaESLIFCalloutBlockp            = NULL;
   marpaESLIFRecognizerp->progressallocl                     = 0;
   marpaESLIFRecognizerp->progressp                          = NULL;
+  marpaESLIFRecognizerp->substitutionBufferp                = NULL;
+  marpaESLIFRecognizerp->substitutionBufferl                = 0;
   marpaESLIFRecognizerp->luaprecompiledp                    = NULL;    /* Lua script source precompiled */
   marpaESLIFRecognizerp->luaprecompiledl                    = 0;    /* Lua script source precompiled length in byte */
   marpaESLIFRecognizerp->getContextActionp                  = NULL;
@@ -13770,13 +15223,13 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
     marpaESLIFRecognizerp->isExpectedArraybl = sizeof(int) * GENERICSTACK_USED(symbolStackp);
     if (marpaESLIFp->ZeroIntegerisZeroBytesb) {
       /* Use calloc to initialize the array */
-      marpaESLIFRecognizerp->isExpectedArraybp = (int *) calloc(sizeof(int), GENERICSTACK_USED(symbolStackp));
+      marpaESLIFRecognizerp->isExpectedArraybp = (int *) MARPAESLIF_CALLOC(marpaESLIFp, sizeof(int), GENERICSTACK_USED(symbolStackp));
       if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->isExpectedArraybp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
-      marpaESLIFRecognizerp->isExpectedArraybp = (int *) malloc(marpaESLIFRecognizerp->isExpectedArraybl);
+      marpaESLIFRecognizerp->isExpectedArraybp = (int *) MARPAESLIF_MALLOC(marpaESLIFp, marpaESLIFRecognizerp->isExpectedArraybl);
       if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp->isExpectedArraybp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -13912,20 +15365,12 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
 
   if (marpaESLIFRecognizerp->marpaESLIFRecognizerHashp == NULL) {
     marpaESLIFRecognizerp->marpaESLIFRecognizerHashp = &(marpaESLIFRecognizerp->_marpaESLIFRecognizerHash);
-    GENERICHASH_INIT_ALL(marpaESLIFRecognizerp->marpaESLIFRecognizerHashp,
-                         _marpaESLIF_ptrhashi,
-                         NULL, /* keyCmpFunctionp */
-                         NULL, /* keyCopyFunctionp */
-                         NULL, /* keyFreeFunctionp */
-                         NULL, /* valCopyFunctionp */
-                         _marpaESLIFRecognizerHash_free_callbackv,
-                         MARPAESLIF_HASH_SIZE,
-                         0 /* wantedSubSize */);
-    if (MARPAESLIF_UNLIKELY(GENERICHASH_ERROR(marpaESLIFRecognizerp->marpaESLIFRecognizerHashp))) {
-      MARPAESLIF_ERRORF(marpaESLIFp, "marpaESLIFRecognizerHashp init failure, %s", strerror(errno));
-      marpaESLIFRecognizerp->marpaESLIFRecognizerHashp = NULL;
-      goto err;
-    }
+    _marpaESLIF_hash_initv(marpaESLIFp, marpaESLIFRecognizerp->marpaESLIFRecognizerHashp,
+                           NULL, /* userDatavp */
+                           _marpaESLIF_ptr_hashl,
+                           NULL, /* cmpFunctionp - key is marpaWrapperGrammarp */
+                           NULL, /* keyFreeFunctionp */
+                           _marpaESLIFRecognizerHash_free_callbackv);
   }
 
   if (marpaESLIFRecognizerp->marpaESLIF_streamp == NULL) {
@@ -13944,31 +15389,12 @@ static inline marpaESLIFRecognizer_t *__marpaESLIFRecognizer_newp(marpaESLIF_t *
   marpaESLIFRecognizerp->marpaESLIFValueOptionDiscard.ambiguousb             = 1;
   marpaESLIFRecognizerp->marpaESLIFValueOptionDiscard.userDatavp             = (void *) marpaESLIFRecognizerp;
 
-  marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp = &(marpaESLIFRecognizerp->_marpaESLIFValueResultWorkStack);
-  GENERICSTACK_INIT(marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp);
-  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp))) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp initialization failure, %s", strerror(errno));
-    marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp = NULL;
-    goto err;
-  }
-
-  marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp = &(marpaESLIFRecognizerp->_marpaESLIFValueResultStackOrig);
-  GENERICSTACK_INIT(marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp);
-  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp))) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp initialization failure, %s", strerror(errno));
-    marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp = NULL;
-    goto err;
-  }
+  _marpaESLIFCalloutBlock_initb(marpaESLIFRecognizerp);
 
-  marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp = &(marpaESLIFRecognizerp->_marpaESLIFValueResultStackNew);
-  GENERICSTACK_INIT(marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp);
-  if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp))) {
-    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp initialization failure, %s", strerror(errno));
-    marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp = NULL;
+  /* Charge what we own to the top-level recognizer */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerp, 0 /* extral */))) {
     goto err;
   }
-
-  _marpaESLIFCalloutBlock_initb(marpaESLIFRecognizerp);
   goto done;
 
  err:
@@ -14113,6 +15539,14 @@ static inline marpaESLIFRecognizer_t *_marpaESLIFRecognizer_newFromp(marpaESLIF_
     goto err;
   }
 
+  /* Both recognizers read the same stream: they are under the same memory limit. The */
+  /* shared recognizer is documented to outlive us.                                   */
+  _marpaESLIFRecognizer_memory_chargeb(marpaESLIFRecognizerp, &(marpaESLIFRecognizerp->memoryl), 0 /* newl */, 0 /* extral */);
+  marpaESLIFRecognizerp->marpaESLIFRecognizerMemoryp = marpaESLIFRecognizerSharedp->marpaESLIFRecognizerTopp->marpaESLIFRecognizerMemoryp;
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerp, 0 /* extral */))) {
+    goto err;
+  }
+
   goto done;
 
  err:
@@ -14696,14 +16130,14 @@ static inline void _marpaESLIF_stringGeneratorResetv(marpaESLIF_stringGenerator_
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_stringGeneratorFreev(marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, short onStackb)
+static inline void _marpaESLIF_stringGeneratorFreev(marpaESLIF_t *marpaESLIFp, marpaESLIF_stringGenerator_t *marpaESLIF_stringGeneratorp, short onStackb)
 /*****************************************************************************/
 {
   if (marpaESLIF_stringGeneratorp->s != NULL) {
-    free(marpaESLIF_stringGeneratorp->s);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGeneratorp->s);
   }
   if (! onStackb) {
-    free(marpaESLIF_stringGeneratorp);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGeneratorp);
   } else {
     marpaESLIF_stringGeneratorp->s      = NULL;
     marpaESLIF_stringGeneratorp->l      = 0;
@@ -14738,7 +16172,7 @@ static inline short _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_str
       MARPAESLIF_ERROR(marpaESLIF_stringGeneratorp->marpaESLIFp, "size_t turnaround detected");
       goto err;
     }
-    marpaESLIF_stringGeneratorp->s  = (char *) malloc(allocl);
+    marpaESLIF_stringGeneratorp->s  = (char *) MARPAESLIF_MALLOC(marpaESLIF_stringGeneratorp->marpaESLIFp, allocl);
     if (MARPAESLIF_UNLIKELY(marpaESLIF_stringGeneratorp->s == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIF_stringGeneratorp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -14759,7 +16193,7 @@ static inline short _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_str
       goto err;
     }
     if (allocl > marpaESLIF_stringGeneratorp->allocl) {
-      tmpp = realloc(marpaESLIF_stringGeneratorp->s, allocl); /* The +1 for the NULL byte is already in */
+      tmpp = MARPAESLIF_REALLOC(marpaESLIF_stringGeneratorp->marpaESLIFp, marpaESLIF_stringGeneratorp->s, allocl); /* The +1 for the NULL byte is already in */
       if (MARPAESLIF_UNLIKELY(tmpp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIF_stringGeneratorp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -14782,7 +16216,7 @@ static inline short _marpaESLIF_appendOpaqueDataToStringGenerator(marpaESLIF_str
 
  err:
   if (marpaESLIF_stringGeneratorp->s != NULL) {
-    free(marpaESLIF_stringGeneratorp->s);
+    MARPAESLIF_FREE(marpaESLIF_stringGeneratorp->marpaESLIFp, marpaESLIF_stringGeneratorp->s);
     marpaESLIF_stringGeneratorp->s = NULL;
   }
   marpaESLIF_stringGeneratorp->okb    = 0;
@@ -14883,6 +16317,8 @@ static inline short __marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep
   if (! _marpaESLIFValue_stack_freeb(marpaESLIFValuep)) {
     rcb = -1;
   }
+  /* The valuation is over: give back what it charged */
+  _marpaESLIFValue_memory_syncb(marpaESLIFValuep, 1 /* doneb */);
  fast_done:
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
@@ -14899,11 +16335,19 @@ static inline short _marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep,
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFValuep->marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "start");
 
+  rcb = _marpaESLIFValue_partition_skipb(marpaESLIFValuep);
+  if (rcb <= 0) {
+    goto done;
+  }
+
   /* We always do a first call with the wanted workflow */
   rcb = __marpaESLIFValue_valueb(marpaESLIFValuep, marpaESLIFValueResultp);
   if (rcb < 0) {
     goto done;
   }
+  if (rcb > 0) {
+    marpaESLIFValuep->treei++;
+  }
 
  done:
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
@@ -14924,33 +16368,477 @@ short marpaESLIFValue_valueb(marpaESLIFValue_t *marpaESLIFValuep)
 }
 
 /*****************************************************************************/
-void marpaESLIFValue_freev(marpaESLIFValue_t *marpaESLIFValuep)
+short marpaESLIFValue_partitionb(marpaESLIFValue_t *marpaESLIFValuep, int parti, int nparti)
 /*****************************************************************************/
 {
-  static const char *funcs = "marpaESLIFValue_freev";
+  static const char *funcs = "marpaESLIFValue_partitionb";
 
-  if (marpaESLIFValuep != NULL) {
-    if (marpaESLIFValuep->marpaWrapperValuep != NULL) {
-      marpaWrapperValue_freev(marpaESLIFValuep->marpaWrapperValuep);
-    }
-    /* The stacks should never be something different than NULL at this stage. */
-    /* The methods to use them are protected so that it is impossible */
-    /* to use them outside of valuation mode. */
-    /*
-    GENERICSTACK_FREE(marpaESLIFValuep->valueResultStackp);
-    */
+  if (MARPAESLIF_UNLIKELY((marpaESLIFValuep == NULL) || (nparti <= 0) || (parti < 0) || (parti >= nparti))) {
+    errno = EINVAL;
+    return 0;
+  }
 
-    _marpaESLIF_stringGeneratorFreev(&(marpaESLIFValuep->stringGenerator), 1 /* onStackb */);
-    GENERICLOGGER_FREE(marpaESLIFValuep->stringGeneratorLoggerp);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->treei > 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s must be called before the first valuation", funcs);
+    errno = EINVAL;
+    return 0;
+  }
+
+  marpaESLIFValuep->parti  = parti;
+  marpaESLIFValuep->nparti = nparti;
+
+  return 1;
+}
+
+/*****************************************************************************/
+short marpaESLIFValue_action_cacheb(marpaESLIFValue_t *marpaESLIFValuep, short enableb)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  marpaESLIFValuep->actionCacheb = enableb ? 1 : 0;
+  if (! enableb) {
+    if (marpaESLIFValuep->ruleCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->ruleCallbackpp);
+      marpaESLIFValuep->ruleCallbackpp = NULL;
+    }
+    if (marpaESLIFValuep->nullableCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->nullableCallbackpp);
+      marpaESLIFValuep->nullableCallbackpp = NULL;
+    }
+    if (marpaESLIFValuep->symbolCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->symbolCallbackpp);
+      marpaESLIFValuep->symbolCallbackpp = NULL;
+    }
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValue_partition_skipb(marpaESLIFValue_t *marpaESLIFValuep)
+/*****************************************************************************/
+/* Moves to the next parse tree of this partition without valuating the     */
+/* others. Returns -1 on failure, 0 when there is no more parse tree.       */
+/*****************************************************************************/
+{
+  short rcb;
+
+  while ((marpaESLIFValuep->treei % marpaESLIFValuep->nparti) != marpaESLIFValuep->parti) {
+    rcb = marpaWrapperValue_skipb(marpaESLIFValuep->marpaWrapperValuep);
+    if (rcb <= 0) {
+      return rcb;
+    }
+    marpaESLIFValuep->treei++;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+short marpaESLIFValue_walkb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalkCallback_t walkCallbackp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY((marpaESLIFValuep == NULL) || (walkCallbackp == NULL))) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  return _marpaESLIFValue_walkb(marpaESLIFValuep, walkCallbackp, marpaESLIFValuep->marpaESLIFValueOption.userDatavp);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValue_walkb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalkCallback_t walkCallbackp, void *walkUserDatavp)
+/*****************************************************************************/
+/* Same iteration semantics as marpaESLIFValue_valueb(), but the parse tree  */
+/* is sent as is to walkCallbackp: no action is resolved, and nothing is     */
+/* pushed on the value stack, that is never created.                         */
+/*****************************************************************************/
+{
+  static const char *funcs = "_marpaESLIFValue_walkb";
+  short              rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFValuep->marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "start");
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->walkCallbackp != NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s cannot be called recursively", funcs);
+    errno = EINVAL;
+    rcb = -1;
+    goto done;
+  }
+
+  rcb = _marpaESLIFValue_partition_skipb(marpaESLIFValuep);
+  if (rcb <= 0) {
+    goto done;
+  }
+
+  marpaESLIFValuep->walkCallbackp  = walkCallbackp;
+  marpaESLIFValuep->walkUserDatavp = walkUserDatavp;
+  rcb = marpaWrapperValue_valueb(marpaESLIFValuep->marpaWrapperValuep,
+                                 (void *) marpaESLIFValuep,
+                                 _marpaESLIFValue_walk_ruleCallbackb,
+                                 _marpaESLIFValue_walk_symbolCallbackb,
+                                 _marpaESLIFValue_walk_nullingCallbackb);
+  marpaESLIFValuep->walkCallbackp  = NULL;
+  marpaESLIFValuep->walkUserDatavp = NULL;
+  if (rcb > 0) {
+    marpaESLIFValuep->treei++;
+  }
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFValuep->marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValue_walk_nodeb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp)
+/*****************************************************************************/
+{
+  static const char *funcs = "_marpaESLIFValue_walk_nodeb";
+  short              rcb;
+
+  if (MARPAESLIF_UNLIKELY(! marpaWrapperValue_value_startb(marpaESLIFValuep->marpaWrapperValuep, &(marpaESLIFValueWalkp->starti)))) {
+    goto err;
+  }
+  if (MARPAESLIF_UNLIKELY(! marpaWrapperValue_value_lengthb(marpaESLIFValuep->marpaWrapperValuep, &(marpaESLIFValueWalkp->lengthi)))) {
+    goto err;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! marpaESLIFValuep->walkCallbackp(marpaESLIFValuep->walkUserDatavp, marpaESLIFValuep, marpaESLIFValueWalkp))) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s: walk callback failure", funcs);
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
+/*****************************************************************************/
+static short _marpaESLIFValue_walk_ruleCallbackb(void *userDatavp, int rulei, int arg0i, int argni, int resulti)
+/*****************************************************************************/
+{
+  marpaESLIFValue_t     *marpaESLIFValuep = (marpaESLIFValue_t *) userDatavp;
+  marpaESLIF_grammar_t  *grammarp         = marpaESLIFValuep->marpaESLIFRecognizerp->grammarp;
+  marpaESLIF_rule_t     *rulep;
+  marpaESLIFValueWalk_t  marpaESLIFValueWalk;
+
+  /* This is an internal method, we know that rulei is correct. */
+  MARPAESLIF_GRAMMAR_INTERNAL_GET_RULE(marpaESLIFValuep->marpaESLIFp, rulep, grammarp, rulei);
+
+  marpaESLIFValueWalk.type        = MARPAESLIF_VALUE_WALK_RULE;
+  marpaESLIFValueWalk.symboli     = rulep->lhsp->idi;
+  marpaESLIFValueWalk.rulei       = rulei;
+  marpaESLIFValueWalk.nbChildreni = argni - arg0i + 1;
+  marpaESLIFValueWalk.lexemep     = NULL;
+
+  return _marpaESLIFValue_walk_nodeb(marpaESLIFValuep, &marpaESLIFValueWalk);
+}
+
+/*****************************************************************************/
+static short _marpaESLIFValue_walk_symbolCallbackb(void *userDatavp, int symboli, int argi, int resulti)
+/*****************************************************************************/
+{
+  marpaESLIFValue_t     *marpaESLIFValuep = (marpaESLIFValue_t *) userDatavp;
+  marpaESLIFValueWalk_t  marpaESLIFValueWalk;
+
+  marpaESLIFValueWalk.type        = MARPAESLIF_VALUE_WALK_LEXEME;
+  marpaESLIFValueWalk.symboli     = symboli;
+  marpaESLIFValueWalk.rulei       = -1;
+  marpaESLIFValueWalk.nbChildreni = 0;
+  marpaESLIFValueWalk.lexemep     = _marpaESLIFRecognizer_lexemeStack_i_getp(marpaESLIFValuep->marpaESLIFRecognizerp, argi);
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValueWalk.lexemep == NULL)) {
+    return 0;
+  }
+
+  return _marpaESLIFValue_walk_nodeb(marpaESLIFValuep, &marpaESLIFValueWalk);
+}
+
+/*****************************************************************************/
+static short _marpaESLIFValue_walk_nullingCallbackb(void *userDatavp, int symboli, int resulti)
+/*****************************************************************************/
+{
+  marpaESLIFValue_t     *marpaESLIFValuep = (marpaESLIFValue_t *) userDatavp;
+  marpaESLIFValueWalk_t  marpaESLIFValueWalk;
+
+  marpaESLIFValueWalk.type        = MARPAESLIF_VALUE_WALK_NULLED;
+  marpaESLIFValueWalk.symboli     = symboli;
+  marpaESLIFValueWalk.rulei       = -1;
+  marpaESLIFValueWalk.nbChildreni = 0;
+  marpaESLIFValueWalk.lexemep     = NULL;
+
+  return _marpaESLIFValue_walk_nodeb(marpaESLIFValuep, &marpaESLIFValueWalk);
+}
+
+/*****************************************************************************/
+short marpaESLIFValue_flatastb(marpaESLIFValue_t *marpaESLIFValuep, short poolb)
+/*****************************************************************************/
+/* Alternative to ::ast: the parse tree is collected in postorder with a     */
+/* walk, then rewritten in preorder into a single buffer that is given to    */
+/* the importer as one ARRAY.                                                */
+/*****************************************************************************/
+{
+  static const char            *funcs                 = "marpaESLIFValue_flatastb";
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp;
+  marpaESLIF_flatast_t          flatast;
+  marpaESLIFValueFlatAst_t     *flatastp;
+  marpaESLIFValueFlatAstNode_t *nodep;
+  marpaESLIFValueResult_t       marpaESLIFValueResult;
+  char                         *bufferp               = NULL;
+  size_t                        bufferl;
+  size_t                       *prelp                 = NULL;
+  size_t                        i;
+  size_t                        childl;
+  size_t                        endl;
+  int                           k;
+  short                         rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep == NULL)) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  marpaESLIFRecognizerp = marpaESLIFValuep->marpaESLIFRecognizerp;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  flatast.marpaESLIFp = marpaESLIFValuep->marpaESLIFp;
+  flatast.nodep       = NULL;
+  flatast.nodel       = 0;
+  flatast.nodeallocl  = 0;
+  flatast.pools       = NULL;
+  flatast.pooll       = 0;
+  flatast.poolallocl  = 0;
+  flatast.poolb       = poolb;
+
+  rcb = _marpaESLIFValue_walkb(marpaESLIFValuep, _marpaESLIFValue_flatast_walkb, &flatast);
+  if (rcb <= 0) {
+    goto done;
+  }
+
+  /* A complete walk always reduces to a single root, the latest node */
+  if (MARPAESLIF_UNLIKELY((flatast.nodel <= 0) || (flatast.nodep[flatast.nodel - 1].sizel != flatast.nodel))) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "%s: parse tree does not reduce to a single root", funcs);
+    goto err;
+  }
+
+  bufferl = sizeof(marpaESLIFValueFlatAst_t) + (flatast.nodel * sizeof(marpaESLIFValueFlatAstNode_t)) + flatast.pooll;
+  bufferp = (char *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, bufferl);
+  if (MARPAESLIF_UNLIKELY(bufferp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  prelp = (size_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, flatast.nodel * sizeof(size_t));
+  if (MARPAESLIF_UNLIKELY(prelp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+
+  flatastp              = (marpaESLIFValueFlatAst_t *) bufferp;
+  flatastp->nbNodel     = flatast.nodel;
+  flatastp->poolOffsetl = sizeof(marpaESLIFValueFlatAst_t) + (flatast.nodel * sizeof(marpaESLIFValueFlatAstNode_t));
+  flatastp->poolLengthl = flatast.pooll;
+  nodep                 = (marpaESLIFValueFlatAstNode_t *) (bufferp + sizeof(marpaESLIFValueFlatAst_t));
+  if (flatast.pooll > 0) {
+    memcpy(bufferp + flatastp->poolOffsetl, flatast.pools, flatast.pooll);
+  }
+
+  /* Reverse postorder visits a parent before its children, so that the preorder */
+  /* position of each child can be derived from its parent's and its siblings' sizes. */
+  prelp[flatast.nodel - 1] = 0;
+  i = flatast.nodel;
+  while (i-- > 0) {
+    nodep[prelp[i]] = flatast.nodep[i];
+    endl   = prelp[i] + flatast.nodep[i].sizel;
+    childl = i;
+    for (k = 0; k < flatast.nodep[i].nbChildreni; k++) {
+      childl--;
+      prelp[childl] = endl - flatast.nodep[childl].sizel;
+      endl          = prelp[childl];
+      childl       -= flatast.nodep[childl].sizel - 1;
+    }
+  }
+
+  marpaESLIFValueResult.type               = MARPAESLIF_VALUE_TYPE_ARRAY;
+  marpaESLIFValueResult.contextp           = NULL;
+  marpaESLIFValueResult.representationp    = NULL;
+  marpaESLIFValueResult.u.a.p              = bufferp;
+  marpaESLIFValueResult.u.a.sizel          = bufferl;
+  marpaESLIFValueResult.u.a.shallowb       = 1; /* We keep ownership */
+  marpaESLIFValueResult.u.a.freeUserDatavp = NULL;
+  marpaESLIFValueResult.u.a.freeCallbackp  = NULL;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_eslif2hostb(marpaESLIFValuep, &marpaESLIFValueResult, NULL /* forcedUserDatavp */, NULL /* forcedImporterp */))) {
+    goto err;
+  }
+
+  goto done;
+
+ err:
+  rcb = -1;
+
+ done:
+  if (bufferp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, bufferp);
+  }
+  if (prelp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, prelp);
+  }
+  if (flatast.nodep != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, flatast.nodep);
+  }
+  if (flatast.pools != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, flatast.pools);
+  }
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static short _marpaESLIFValue_flatast_walkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp)
+/*****************************************************************************/
+{
+  static const char            *funcs    = "_marpaESLIFValue_flatast_walkb";
+  marpaESLIF_flatast_t         *flatastp = (marpaESLIF_flatast_t *) userDatavp;
+  marpaESLIFValueResult_t      *lexemep  = marpaESLIFValueWalkp->lexemep;
+  marpaESLIFValueFlatAstNode_t *nodep;
+  size_t                        nodeallocl;
+  size_t                        poolallocl;
+  size_t                        childl;
+  char                         *pools;
+  char                         *p;
+  size_t                        l;
+  int                           i;
+
+  if (flatastp->nodel >= flatastp->nodeallocl) {
+    nodeallocl = (flatastp->nodeallocl > 0) ? flatastp->nodeallocl * 2 : 1024;
+    nodep = (marpaESLIFValueFlatAstNode_t *) MARPAESLIF_REALLOC(flatastp->marpaESLIFp, flatastp->nodep, nodeallocl * sizeof(marpaESLIFValueFlatAstNode_t));
+    if (MARPAESLIF_UNLIKELY(nodep == NULL)) {
+      MARPAESLIF_ERRORF(flatastp->marpaESLIFp, "realloc failure, %s", strerror(errno));
+      return 0;
+    }
+    flatastp->nodep      = nodep;
+    flatastp->nodeallocl = nodeallocl;
+  }
+
+  nodep = &(flatastp->nodep[flatastp->nodel]);
+  nodep->type        = marpaESLIFValueWalkp->type;
+  nodep->idi         = (marpaESLIFValueWalkp->type == MARPAESLIF_VALUE_WALK_RULE) ? marpaESLIFValueWalkp->rulei : marpaESLIFValueWalkp->symboli;
+  nodep->nbChildreni = marpaESLIFValueWalkp->nbChildreni;
+  nodep->starti      = marpaESLIFValueWalkp->starti;
+  nodep->lengthi     = marpaESLIFValueWalkp->lengthi;
+  nodep->sizel       = 1;
+  nodep->poolOffsetl = 0;
+  nodep->poolLengthl = 0;
+
+  switch (marpaESLIFValueWalkp->type) {
+  case MARPAESLIF_VALUE_WALK_RULE:
+    /* Children are the latest subtrees: the previous one ends just before us */
+    childl = flatastp->nodel;
+    for (i = 0; i < marpaESLIFValueWalkp->nbChildreni; i++) {
+      if (MARPAESLIF_UNLIKELY(childl <= 0)) {
+        MARPAESLIF_ERRORF(flatastp->marpaESLIFp, "%s: rule %d has less nodes than its %d children", funcs, marpaESLIFValueWalkp->rulei, marpaESLIFValueWalkp->nbChildreni);
+        return 0;
+      }
+      nodep->sizel += flatastp->nodep[childl - 1].sizel;
+      childl       -= flatastp->nodep[childl - 1].sizel;
+    }
+    break;
+  case MARPAESLIF_VALUE_WALK_LEXEME:
+    if (! flatastp->poolb) {
+      break;
+    }
+    switch (lexemep->type) {
+    case MARPAESLIF_VALUE_TYPE_ARRAY:
+      p = lexemep->u.a.p;
+      l = lexemep->u.a.sizel;
+      break;
+    case MARPAESLIF_VALUE_TYPE_STRING:
+      p = (char *) lexemep->u.s.p;
+      l = lexemep->u.s.sizel;
+      break;
+    default:
+      p = NULL;
+      l = 0;
+      break;
+    }
+    if (l <= 0) {
+      break;
+    }
+    if (flatastp->pooll + l > flatastp->poolallocl) {
+      poolallocl = (flatastp->poolallocl > 0) ? flatastp->poolallocl * 2 : 4096;
+      while (poolallocl < flatastp->pooll + l) {
+        poolallocl *= 2;
+      }
+      pools = (char *) MARPAESLIF_REALLOC(flatastp->marpaESLIFp, flatastp->pools, poolallocl);
+      if (MARPAESLIF_UNLIKELY(pools == NULL)) {
+        MARPAESLIF_ERRORF(flatastp->marpaESLIFp, "realloc failure, %s", strerror(errno));
+        return 0;
+      }
+      flatastp->pools      = pools;
+      flatastp->poolallocl = poolallocl;
+    }
+    memcpy(flatastp->pools + flatastp->pooll, p, l);
+    nodep->poolOffsetl = flatastp->pooll;
+    nodep->poolLengthl = l;
+    flatastp->pooll   += l;
+    break;
+  default:
+    break;
+  }
+
+  flatastp->nodel++;
+
+  return 1;
+}
+
+/*****************************************************************************/
+void marpaESLIFValue_freev(marpaESLIFValue_t *marpaESLIFValuep)
+/*****************************************************************************/
+{
+  static const char *funcs = "marpaESLIFValue_freev";
+
+  if (marpaESLIFValuep != NULL) {
+    if (marpaESLIFValuep->marpaWrapperValuep != NULL) {
+      marpaWrapperValue_freev(marpaESLIFValuep->marpaWrapperValuep);
+    }
+    /* The stack is empty at this stage: the methods to use it are protected so that it is */
+    /* impossible to use them outside of valuation mode. Only its storage remains.          */
+    _marpaESLIFValue_stack_disposev(marpaESLIFValuep);
+
+    if (marpaESLIFValuep->ruleCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->ruleCallbackpp);
+    }
+    if (marpaESLIFValuep->nullableCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->nullableCallbackpp);
+    }
+    if (marpaESLIFValuep->symbolCallbackpp != NULL) {
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->symbolCallbackpp);
+    }
+
+    _marpaESLIF_stringGeneratorFreev(marpaESLIFValuep->marpaESLIFp, &(marpaESLIFValuep->stringGenerator), 1 /* onStackb */);
+    GENERICLOGGER_FREE(marpaESLIFValuep->stringGeneratorLoggerp);
 
     if (marpaESLIFValuep->luaprecompiledp != NULL) {
-      free(marpaESLIFValuep->luaprecompiledp);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep->luaprecompiledp);
     }
 
     /* Dispose lua if needed */
     _marpaESLIF_lua_value_freev(marpaESLIFValuep);
 
-    free(marpaESLIFValuep);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValuep);
   }
 }
 
@@ -14984,7 +16872,7 @@ static short _marpaESLIFValue_ruleCallbackWrapperb(void *userDatavp, int rulei,
 
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Grammar %d Rule %d %s", grammarp->leveli, rulep->idi, rulep->asciishows);
 
-  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValuep, &ruleCallbackp, rulep->asciishows, rulep->effectiveRuleActionp, rulep->effectiveRuleActione))) {
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValuep, &ruleCallbackp, rulep->asciishows, rulep->effectiveRuleActionp, rulep->effectiveRuleActione, 0 /* nullableb */, rulep->idi))) {
     goto err;
   }
 
@@ -15059,6 +16947,11 @@ static short _marpaESLIFValue_ruleCallbackWrapperb(void *userDatavp, int rulei,
     goto err;
   }
 
+  /* The value stack may have grown */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_memory_syncb(marpaESLIFValuep, 0 /* doneb */))) {
+    goto err;
+  }
+
   rcb = 1;
   goto done;
 
@@ -15142,6 +17035,11 @@ static inline short _marpaESLIFValue_anySymbolCallbackWrapperb(void *userDatavp,
     }
   }
 
+  /* The value stack may have grown */
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_memory_syncb(marpaESLIFValuep, 0 /* doneb */))) {
+    goto err;
+  }
+
   rcb = 1;
   goto done;
 
@@ -15204,15 +17102,15 @@ static short _marpaESLIFValue_nullingCallbackWrapperb(void *userDatavp, int symb
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarp)
+static inline void _marpaESLIFGrammar_bootstrap_freev(marpaESLIF_t *marpaESLIFp, marpaESLIFGrammar_bootstrap_t *marpaESLIFGrammarp)
 /*****************************************************************************/
 {
   if (marpaESLIFGrammarp != NULL) {
-    _marpaESLIF_grammarBootstrapStack_freev(marpaESLIFGrammarp->grammarBootstrapStackp);
+    _marpaESLIF_grammarBootstrapStack_freev(marpaESLIFp, marpaESLIFGrammarp->grammarBootstrapStackp);
     if (marpaESLIFGrammarp->luabytep != NULL) {
-      free(marpaESLIFGrammarp->luabytep);
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIFGrammarp->luabytep);
     }
-    free(marpaESLIFGrammarp);
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFGrammarp);
   }
 }
 
@@ -15221,28 +17119,32 @@ static inline void _marpaESLIFGrammar_freev(marpaESLIFGrammar_t *marpaESLIFGramm
 /*****************************************************************************/
 {
   if (marpaESLIFGrammarp != NULL) {
-    _marpaESLIF_grammarStack_freev(marpaESLIFGrammarp->grammarStackp);
-    _marpaESLIF_string_freev(marpaESLIFGrammarp->luadescp, 0 /* onStackb */);
+    _marpaESLIF_grammarStack_freev(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->grammarStackp);
+    _marpaESLIF_string_freev(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->luadescp, 0 /* onStackb */);
     if (marpaESLIFGrammarp->luabytep != NULL) {
-      free(marpaESLIFGrammarp->luabytep);
+      MARPAESLIF_FREE(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->luabytep);
     }
     if (marpaESLIFGrammarp->luaprecompiledp != NULL) {
-      free(marpaESLIFGrammarp->luaprecompiledp);
+      MARPAESLIF_FREE(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->luaprecompiledp);
     }
     if (marpaESLIFGrammarp->lexemeGrammarHashp != NULL) {
       /* This will free all cached grammars in cascade -; */
-      GENERICHASH_RESET(marpaESLIFGrammarp->lexemeGrammarHashp, marpaESLIFGrammarp->marpaESLIFp);
+      _marpaESLIF_hash_resetv(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->lexemeGrammarHashp);
     }
     _marpaESLIF_lua_grammar_freev(marpaESLIFGrammarp);
-    _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammarp->marpaESLIFGrammar_bootstrapp);
+    _marpaESLIFGrammar_bootstrap_freev(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->marpaESLIFGrammar_bootstrapp);
+    if (marpaESLIFGrammarp->valueStackItemsp != NULL) {
+      /* genericStack storage: it comes from the C library, not from the allocator */
+      free(marpaESLIFGrammarp->valueStackItemsp);
+    }
     if (! onStackb) {
-      free(marpaESLIFGrammarp);
+      MARPAESLIF_FREE(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp);
     }
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_grammarBootstrapStack_freev(genericStack_t *grammarStackp)
+static inline void _marpaESLIF_grammarBootstrapStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *grammarStackp)
 /*****************************************************************************/
 {
   marpaESLIF_grammar_bootstrap_t *grammarp;
@@ -15251,7 +17153,7 @@ static inline void _marpaESLIF_grammarBootstrapStack_freev(genericStack_t *gramm
     while (GENERICSTACK_USED(grammarStackp) > 0) {
       if (GENERICSTACK_IS_PTR(grammarStackp, GENERICSTACK_USED(grammarStackp) - 1)) {
         grammarp = (marpaESLIF_grammar_bootstrap_t *) GENERICSTACK_POP_PTR(grammarStackp);
-        _marpaESLIF_grammar_bootstrap_freev(grammarp);
+        _marpaESLIF_grammar_bootstrap_freev(marpaESLIFp, grammarp);
       } else {
         GENERICSTACK_USED(grammarStackp)--;
       }
@@ -15261,14 +17163,14 @@ static inline void _marpaESLIF_grammarBootstrapStack_freev(genericStack_t *gramm
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_grammarStack_freev(genericStack_t *grammarStackp)
+static inline void _marpaESLIF_grammarStack_freev(marpaESLIF_t *marpaESLIFp, genericStack_t *grammarStackp)
 /*****************************************************************************/
 {
   if (grammarStackp != NULL) {
     while (GENERICSTACK_USED(grammarStackp) > 0) {
       if (GENERICSTACK_IS_PTR(grammarStackp, GENERICSTACK_USED(grammarStackp) - 1)) {
         marpaESLIF_grammar_t *grammarp = (marpaESLIF_grammar_t *) GENERICSTACK_POP_PTR(grammarStackp);
-        _marpaESLIF_grammar_freev(grammarp);
+        _marpaESLIF_grammar_freev(marpaESLIFp, grammarp);
       } else {
         GENERICSTACK_USED(grammarStackp)--;
       }
@@ -15806,11 +17708,15 @@ static inline short __marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaES
             /*     - If encodings and marpaESLIF_streamp->encodings are the same, current conversion engine continue.                                            */
             /* ************************************************************************************************************************************************* */
             /* Continue with current conversion engine */
-            utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, marpaESLIF_streamp->encodings, inputs, inputl, &utf8l, NULL /* encodingsp */, &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), 0 /* tconvsilentb */, grammarp->defaultEncodings, grammarp->fallbackEncodings);
-            if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
-              goto err;
+            if (marpaESLIF_streamp->utf8passthroughb) {
+              appendDatab = _marpaESLIFRecognizer_utf8_appendDatab(marpaESLIFRecognizerp, inputs, inputl, eofb);
+            } else {
+              utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, marpaESLIF_streamp->encodings, inputs, inputl, &utf8l, NULL /* encodingsp */, &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), &(marpaESLIF_streamp->convertedbufs), &(marpaESLIF_streamp->convertedbufallocl), 0 /* tconvsilentb */, grammarp->defaultEncodings, grammarp->fallbackEncodings);
+              if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
+                goto err;
+              }
+              appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
             }
-            appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
             if (MARPAESLIF_UNLIKELY(! appendDatab)) {
               goto err;
             } else if (appendDatab < 0) {
@@ -15823,11 +17729,15 @@ static inline short __marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaES
           /*   - user gave NO encoding (encodings == NULL)                                                                                                     */
           /* ************************************************************************************************************************************************* */
           /* Continue with current conversion engine */
-          utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, marpaESLIF_streamp->encodings, inputs, inputl, &utf8l, NULL /* encodingsp */, &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), 0 /* tconvsilentb */, grammarp->defaultEncodings, grammarp->fallbackEncodings);
-          if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
-            goto err;
+          if (marpaESLIF_streamp->utf8passthroughb) {
+            appendDatab = _marpaESLIFRecognizer_utf8_appendDatab(marpaESLIFRecognizerp, inputs, inputl, eofb);
+          } else {
+            utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, marpaESLIF_streamp->encodings, inputs, inputl, &utf8l, NULL /* encodingsp */, &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), &(marpaESLIF_streamp->convertedbufs), &(marpaESLIF_streamp->convertedbufallocl), 0 /* tconvsilentb */, grammarp->defaultEncodings, grammarp->fallbackEncodings);
+            if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
+              goto err;
+            }
+            appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
           }
-          appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
           if (MARPAESLIF_UNLIKELY(! appendDatab)) {
             goto err;
           } else if (appendDatab < 0) {
@@ -15909,12 +17819,10 @@ static inline short __marpaESLIFRecognizer_readb(marpaESLIFRecognizer_t *marpaES
   goto done;
 
  err:
+  marpaESLIF_streamp->readErrorb = 1;
   rcb = 0;
 
  done:
-  if (utf8s != NULL) {
-    free(utf8s);
-  }
   if (disposeCallbackb) {
     if (disposeCallbackp != NULL) {
       disposeCallbackp(marpaESLIFRecognizerp->marpaESLIFRecognizerOption.userDatavp, inputs, inputl, eofb, characterStreamb, encodings, encodingl);
@@ -16706,7 +18614,7 @@ static inline void _marpaESLIF_grammar_createshowv(marpaESLIFGrammar_t *marpaESL
         }
       }
       if (marpaESLIF_stringGenerator.s != NULL) {
-        free(marpaESLIF_stringGenerator.s);
+        MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_stringGenerator.s);
       }
       GENERICLOGGER_FREE(genericLoggerp);
     }
@@ -17029,81 +18937,135 @@ Returns:      >  0 => the number of bytes consumed
 /*****************************************************************************/
 static inline short _marpaESLIFRecognizer_getNextLineAndColumnb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t matchl)
 /*****************************************************************************/
+/* Line and column numbers are computed lazily: here we only remember how    */
+/* many bytes were consumed, _marpaESLIF_stream_locationv() does the real    */
+/* work when location is needed.                                             */
+/*****************************************************************************/
 {
-  static const char          *funcs              = "_marpaESLIFRecognizer_getNextLineAndColumnb";
-  marpaESLIF_stream_t        *marpaESLIF_streamp = marpaESLIFRecognizerp->marpaESLIF_streamp;
-  marpaESLIF_terminal_t      *newlinep;
-  char                       *linep;
-  char                       *linemaxp;
-  size_t                      linel;
-  size_t                      matchedLengthl;
-  marpaESLIF_matcher_value_t  rci;
-  short                       rcb;
-  int                         utf82ordi;
-  marpaESLIF_uint32_t         codepointi;
-    
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
-  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+  marpaESLIF_stream_t *marpaESLIF_streamp = marpaESLIFRecognizerp->marpaESLIF_streamp;
 
   /* If newline counting is on, so do we */
-  if (marpaESLIFRecognizerp->marpaESLIFRecognizerOption.newlineb && marpaESLIF_streamp->utfb) {
-    newlinep = marpaESLIFRecognizerp->marpaESLIFp->newlinep;
-    linep = marpaESLIF_streamp->inputs;
-    linel = matchl;
-
-    /* Check newline */
-    while (1) {
-      /* We count newlines only when a discard or a complete has happened. So by definition */
-      /* character sequences are complete. This is why we fake EOF to true. */
-      if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_terminal_matcherb(marpaESLIFRecognizerp,
-                                                                        marpaESLIF_streamp,
-                                                                        newlinep,
-                                                                        linep,
-                                                                        linel,
-                                                                        1, /* eofb */
-                                                                        &rci,
-                                                                        NULL /* marpaESLIFValueResultp */,
-                                                                        &matchedLengthl))) {
-        goto err;
-      }
-      if (rci != MARPAESLIF_MATCH_OK) {
+  if (marpaESLIFRecognizerp->marpaESLIFRecognizerOption.newlineb) {
+    if (marpaESLIF_streamp->utfb) {
+      marpaESLIF_streamp->uncountedl += matchl;
+    } else {
+      /* Uncounted bytes must be contiguous up to inputs */
+      _marpaESLIF_stream_locationv(marpaESLIF_streamp);
+      marpaESLIF_streamp->crb = 0;
+    }
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIF_stream_locationv(marpaESLIF_stream_t *marpaESLIF_streamp)
+/*****************************************************************************/
+/* Accounts the uncounted bytes just before inputs in linel and columnl.     */
+/* Newlines are the ones of INTERNAL_NEWLINE_PATTERN, i.e. \R with           */
+/* (*BSR_UNICODE): \r\n, \n, \x0b, \f, \r, \x85, \x{2028} and \x{2029}.      */
+/* Input is known to be valid UTF-8, so characters are counted as bytes that */
+/* are not continuation bytes. Word-at-a-time, we skip words made of         */
+/* ASCII bytes >= 0x0e, that can never be part of a newline.                 */
+/* Lexemes may split a \r\n: crb remembers that the last accounted newline  */
+/* is a \r, so that a \n right after it is not counted again.               */
+/*****************************************************************************/
+{
+  const size_t   onesl     = ((size_t) -1) / 0xFF;      /* 0x0101...01 */
+  const size_t   highbitsl = onesl * 0x80;              /* 0x8080...80 */
+  unsigned char *p;
+  unsigned char *maxp;
+  unsigned char *linep;
+  size_t         wordl;
+  size_t         nlinel;
+  size_t         columnl;
+
+  if (marpaESLIF_streamp->uncountedl <= 0) {
+    return;
+  }
+
+  maxp   = (unsigned char *) marpaESLIF_streamp->inputs;
+  p      = maxp - marpaESLIF_streamp->uncountedl;
+  if (marpaESLIF_streamp->crb && (*p == '\n')) {
+    p++;
+  }
+  linep  = p;    /* Start of the last line */
+  nlinel = 0;
+
+  while (p < maxp) {
+    while (((size_t) (maxp - p)) >= sizeof(size_t)) {
+      memcpy(&wordl, p, sizeof(size_t));
+      if ((((wordl - (onesl * 0x0E)) & ~wordl) | wordl) & highbitsl) {
         break;
       }
-      linep += matchedLengthl;
-      linel -= matchedLengthl;
-      /* A new line, reset column count */
-      marpaESLIF_streamp->linel++;
-      marpaESLIF_streamp->columnl = 1;
+      p += sizeof(size_t);
+    }
+    if (p >= maxp) {
+      break;
     }
 
-    if (linel > 0) {
-      /* Count characters */
-      linemaxp = linep + linel;
-      while (linep < linemaxp) {
-        /* We count newlines only when a discard or a complete has happened. So by definition */
-        /* character sequences are complete. This is why the following should never fail. */
-        utf82ordi = _marpaESLIF_utf82ordi((PCRE2_SPTR8) linep, &codepointi, (PCRE2_SPTR8) linemaxp);
-        if (MARPAESLIF_UNLIKELY(utf82ordi <= 0)) {
-          MARPAESLIF_WARN(marpaESLIFRecognizerp->marpaESLIFp, "Malformed UTF-8 character when processing column number");
-          break;
-        }
-
-        linep += utf82ordi;
-        marpaESLIF_streamp->columnl++;
+    switch (*p++) {
+    case '\r':
+      if ((p < maxp) && (*p == '\n')) {
+        p++;
+      }
+      nlinel++;
+      linep = p;
+      break;
+    case '\n':
+    case 0x0B:
+    case 0x0C:
+      nlinel++;
+      linep = p;
+      break;
+    case 0xC2:
+      if ((p < maxp) && (*p == 0x85)) {
+        p++;
+        nlinel++;
+        linep = p;
+      }
+      break;
+    case 0xE2:
+      if (((maxp - p) >= 2) && (p[0] == 0x80) && ((p[1] == 0xA8) || (p[1] == 0xA9))) {
+        p += 2;
+        nlinel++;
+        linep = p;
       }
+      break;
+    default:
+      break;
     }
   }
 
-  rcb = 1;
-  goto done;
-
- err:
-  rcb = 0;
+  /* Count characters on the last line */
+  columnl = 0;
+  p = linep;
+  while (p < maxp) {
+    while (((size_t) (maxp - p)) >= sizeof(size_t)) {
+      memcpy(&wordl, p, sizeof(size_t));
+      if (wordl & highbitsl) {
+        break;
+      }
+      p += sizeof(size_t);
+      columnl += sizeof(size_t);
+    }
+    if (p >= maxp) {
+      break;
+    }
+    if ((*p++ & 0xC0) != 0x80) {
+      columnl++;
+    }
+  }
 
- done:
-  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
-  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
-  return rcb;
+  if (nlinel > 0) {
+    marpaESLIF_streamp->linel   += nlinel;
+    marpaESLIF_streamp->columnl  = 1 + columnl;
+  } else {
+    marpaESLIF_streamp->columnl += columnl;
+  }
+  /* A line that ends right at inputs with a \r is a lone \r so far */
+  marpaESLIF_streamp->crb        = ((linep == maxp) && (maxp[-1] == '\r')) ? 1 : 0;
+  marpaESLIF_streamp->uncountedl = 0;
 }
 
 /*****************************************************************************/
@@ -17257,6 +19219,7 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
   size_t                   bufsizl            = marpaESLIF_streamp->bufsizl;
   size_t                   buftriggerl        = marpaESLIF_streamp->buftriggerl;
   unsigned int             bufaddperci        = marpaESLIFRecognizerp->marpaESLIFRecognizerOption.bufaddperci;
+  marpaESLIFRecognizer_t  *marpaESLIFRecognizerOwnerp;
   short                    removebomb;
   size_t                   bomsizel;
   size_t                   wantedl;
@@ -17285,6 +19248,12 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
     goto done;
   }
 
+  /* Buffer growth is charged to the recognizer that owns the stream */
+  marpaESLIFRecognizerOwnerp = marpaESLIFRecognizerp;
+  while ((marpaESLIFRecognizerOwnerp != NULL) && (marpaESLIFRecognizerOwnerp->marpaESLIF_streamp != &(marpaESLIFRecognizerOwnerp->_marpaESLIF_stream))) {
+    marpaESLIFRecognizerOwnerp = (marpaESLIFRecognizerOwnerp->marpaESLIFRecognizerParentp != NULL) ? marpaESLIFRecognizerOwnerp->marpaESLIFRecognizerParentp : marpaESLIFRecognizerOwnerp->marpaESLIFRecognizerSharedp;
+  }
+
   if (MARPAESLIFRECOGNIZER_IS_TOP(marpaESLIFRecognizerp) /* Top recognizer ? */
       &&
       (marpaESLIF_streamp->peeki == 0)                   /* Not peeked ? */
@@ -17301,11 +19270,14 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
         ) {
       /* ... then we can realloc to minimum buffer size */
 
+      /* Uncounted bytes for location are about to be forgotten */
+      _marpaESLIF_stream_locationv(marpaESLIF_streamp);
+
       /* Before reallocating, we need to move the remaining bytes at the beginning */
       memmove(buffers, marpaESLIF_streamp->inputs, inputl + 1);       /* + 1 for internal NUL byte */
       /* Try to realloc */
       wantedl = bufsizl;
-      tmps = realloc(buffers, wantedl + 1); /* We always add a hiden NUL byte for convenience */
+      tmps = MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, buffers, wantedl + 1); /* We always add a hiden NUL byte for convenience */
       if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
         /* We COULD continue, this is not truely fatal - but we are in a bad shape anyway -; */
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
@@ -17326,7 +19298,10 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
   if (buffers == NULL) {
     /* First time we put in the buffer */
     wantedl = (bufsizl < datal) ? datal : bufsizl;
-    tmps = (char *) malloc(wantedl + 1); /* We always add a NUL byte for convenience */
+    if ((marpaESLIFRecognizerOwnerp != NULL) && MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerOwnerp, wantedl + 1))) {
+      goto err;
+    }
+    tmps = (char *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, wantedl + 1); /* We always add a NUL byte for convenience */
     if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -17345,7 +19320,10 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
       if (wantedl < minwantedl) {
         wantedl = minwantedl;
       }
-      tmps = (char *) realloc(buffers, wantedl + 1); /* We always add a NUL byte for convenience */
+      if ((marpaESLIFRecognizerOwnerp != NULL) && MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerOwnerp, wantedl - bufferallocl))) {
+        goto err;
+      }
+      tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, buffers, wantedl + 1); /* We always add a NUL byte for convenience */
       if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -17368,6 +19346,11 @@ static inline short _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizer_t *ma
   /* Add a convenient NUL byte after valid data */
   buffers[marpaESLIF_streamp->bufferl] = '\0';
 
+  /* Charge the new buffer sizes, including the ones of character conversion */
+  if ((marpaESLIFRecognizerOwnerp != NULL) && MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizerOwnerp, 0 /* extral */))) {
+    goto err;
+  }
+
   /* In character mode, process BOM if not already done - we test marpaESLIF_streamp->tconvp instead of marpaESLIF_streamp->charconvb because */
   /* the later is set to true only after append data is done */
   if ((marpaESLIF_streamp->tconvp != NULL) && (! marpaESLIF_streamp->bomdoneb)) {
@@ -17430,7 +19413,7 @@ static inline short _marpaESLIFRecognizer_createDiscardStateb(marpaESLIFRecogniz
     grammarp             = marpaESLIFRecognizerp->grammarp;
     symbolStackp         = grammarp->symbolStackp;
 
-    discardEventStatebp = (short *) malloc(sizeof(short) * GENERICSTACK_USED(symbolStackp));
+    discardEventStatebp = (short *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(short) * GENERICSTACK_USED(symbolStackp));
     if (MARPAESLIF_UNLIKELY(discardEventStatebp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -17476,7 +19459,7 @@ static inline short _marpaESLIFRecognizer_createBeforeStateb(marpaESLIFRecognize
     grammarp            = marpaESLIFRecognizerp->grammarp;
     symbolStackp        = grammarp->symbolStackp;
 
-    beforeEventStatebp = (short *) malloc(sizeof(short) * GENERICSTACK_USED(symbolStackp));
+    beforeEventStatebp = (short *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(short) * GENERICSTACK_USED(symbolStackp));
     if (MARPAESLIF_UNLIKELY(beforeEventStatebp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -17522,7 +19505,7 @@ static inline short _marpaESLIFRecognizer_createAfterStateb(marpaESLIFRecognizer
     grammarp            = marpaESLIFRecognizerp->grammarp;
     symbolStackp        = grammarp->symbolStackp;
 
-    afterEventStatebp = (short *) malloc(sizeof(short) * GENERICSTACK_USED(symbolStackp));
+    afterEventStatebp = (short *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, sizeof(short) * GENERICSTACK_USED(symbolStackp));
     if (MARPAESLIF_UNLIKELY(afterEventStatebp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -17570,13 +19553,13 @@ static inline short _marpaESLIFRecognizer_createSymbolDatab(marpaESLIFRecognizer
     symbolStackp        = grammarp->symbolStackp;
 
     if (marpaESLIFp->NULLisZeroBytesb) {
-      symbolDatapp = (marpaESLIF_symbol_data_t **) calloc(GENERICSTACK_USED(symbolStackp), sizeof(marpaESLIF_symbol_data_t *));
+      symbolDatapp = (marpaESLIF_symbol_data_t **) MARPAESLIF_CALLOC(marpaESLIFp, GENERICSTACK_USED(symbolStackp), sizeof(marpaESLIF_symbol_data_t *));
       if (MARPAESLIF_UNLIKELY(symbolDatapp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
-      symbolDatapp = (marpaESLIF_symbol_data_t **) malloc(sizeof(marpaESLIF_symbol_data_t *) * GENERICSTACK_USED(symbolStackp));
+      symbolDatapp = (marpaESLIF_symbol_data_t **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_data_t *) * GENERICSTACK_USED(symbolStackp));
       if (MARPAESLIF_UNLIKELY(symbolDatapp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -17677,6 +19660,17 @@ static inline short _marpaESLIF_charset_eqb(marpaESLIF_t *marpaESLIFp, const cha
   return 1;
 }
 
+/*****************************************************************************/
+static inline short _marpaESLIF_charset_utf8b(marpaESLIF_t *marpaESLIFp, const char *s, size_t sizel)
+/*****************************************************************************/
+/* Says if charset s, of size sizel, is UTF-8.                               */
+/*****************************************************************************/
+{
+  return ((sizel == 5) && _marpaESLIF_charset_eqb(marpaESLIFp, "UTF-8", s, sizel))
+    ||
+    ((sizel == 4) && _marpaESLIF_charset_eqb(marpaESLIFp, "UTF8", s, sizel));
+}
+
 /*****************************************************************************/
 static inline char *_marpaESLIF_charset_canonicals(marpaESLIF_t *marpaESLIFp, const char *s, const size_t sizel)
 /*****************************************************************************/
@@ -17692,7 +19686,7 @@ static inline char *_marpaESLIF_charset_canonicals(marpaESLIF_t *marpaESLIFp, co
     goto err;
   }
 
-  charsets = (char *) malloc(sizel + 1);
+  charsets = (char *) MARPAESLIF_MALLOC(marpaESLIFp, sizel + 1);
   if (MARPAESLIF_UNLIKELY(charsets == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -17708,7 +19702,7 @@ static inline char *_marpaESLIF_charset_canonicals(marpaESLIF_t *marpaESLIFp, co
 
  err:
   if (charsets != NULL) {
-    free(charsets);
+    MARPAESLIF_FREE(marpaESLIFp, charsets);
     charsets = NULL;
   }
 
@@ -17745,7 +19739,7 @@ static inline short _marpaESLIFRecognizer_flush_charconvb(marpaESLIFRecognizer_t
   }
 
   /* Note that here we let tconvsilentb == 0. This is because if we flush, then we were able to start character convertion. Flushing should not fail then. */
-  utf8s = _marpaESLIF_charconvb(marpaESLIFp, NULL /* toEncodings, was MARPAESLIF_UTF8_STRING */, NULL /* fromEncodings */, NULL /* srcs */, 0 /* srcl */, &utf8l /* dstlp */, NULL /* fromEncodingsp */, &(marpaESLIF_streamp->tconvp), 1 /* eofb */, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings*/);
+  utf8s = _marpaESLIF_charconvb(marpaESLIFp, NULL /* toEncodings, was MARPAESLIF_UTF8_STRING */, NULL /* fromEncodings */, NULL /* srcs */, 0 /* srcl */, &utf8l /* dstlp */, NULL /* fromEncodingsp */, &(marpaESLIF_streamp->tconvp), 1 /* eofb */, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), &(marpaESLIF_streamp->convertedbufs), &(marpaESLIF_streamp->convertedbufallocl), 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings*/);
   if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
     goto err;
   }
@@ -17754,7 +19748,7 @@ static inline short _marpaESLIFRecognizer_flush_charconvb(marpaESLIFRecognizer_t
   }
 
   /* last state is cleaned */
-  free(marpaESLIF_streamp->encodings);
+  MARPAESLIF_FREE(marpaESLIFp, marpaESLIF_streamp->encodings);
   marpaESLIF_streamp->encodings = NULL;
 
   if (MARPAESLIF_UNLIKELY(tconv_close(marpaESLIF_streamp->tconvp) != 0)) {
@@ -17765,7 +19759,8 @@ static inline short _marpaESLIFRecognizer_flush_charconvb(marpaESLIFRecognizer_t
   marpaESLIF_streamp->tconvp = NULL;
 
   /* Put global flag to off */
-  marpaESLIF_streamp->charconvb = 0;
+  marpaESLIF_streamp->charconvb        = 0;
+  marpaESLIF_streamp->utf8passthroughb = 0;
 
   rcb = 1;
   goto done;
@@ -17774,9 +19769,6 @@ static inline short _marpaESLIFRecognizer_flush_charconvb(marpaESLIFRecognizer_t
   rcb = 0;
 
  done:
-  if (utf8s != NULL) {
-    free(utf8s);
-  }
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
   return rcb;
@@ -17794,7 +19786,9 @@ static inline short _marpaESLIFRecognizer_start_charconvb(marpaESLIFRecognizer_t
   marpaESLIF_grammar_t       *grammarp            = marpaESLIFRecognizerp->grammarp;
   char                       *encodingasciis     = NULL;
   char                       *utf8s              = NULL;
+  short                       utf8passthroughb;
   size_t                      utf8l;
+  size_t                      validl;
   short                       appendDatab;
   short                       rcb;
 
@@ -17826,8 +19820,26 @@ static inline short _marpaESLIFRecognizer_start_charconvb(marpaESLIFRecognizer_t
     }
   }
 
+  /* When input is UTF-8, either because this is the declared or the default encoding, or because */
+  /* there is no encoding and data is valid UTF-8, there is nothing to convert: chunks are          */
+  /* validated in place and appended as-is. The conversion engine is nevertheless opened, without   */
+  /* feeding it, so that the stream state remains the same as with any other encoding.              */
+  if (encodingasciis != NULL) {
+    utf8passthroughb = _marpaESLIF_charset_utf8b(marpaESLIFp, encodingasciis, strlen(encodingasciis));
+  } else if (defaultEncodings != NULL) {
+    utf8passthroughb = _marpaESLIF_charset_utf8b(marpaESLIFp, defaultEncodings, strlen(defaultEncodings));
+  } else {
+    utf8passthroughb = _marpaESLIF_utf8_validb(srcs, srcl, &validl) && ((! eofb) || (validl == srcl));
+    if (utf8passthroughb) {
+      encodingasciis = _marpaESLIF_charset_canonicals(marpaESLIFp, MARPAESLIF_UTF8_STRING, strlen(MARPAESLIF_UTF8_STRING));
+      if (MARPAESLIF_UNLIKELY(encodingasciis == NULL)) {
+        goto err;
+      }
+    }
+  }
+
   /* Convert input */
-  utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, encodingasciis, srcs, srcl, &utf8l, &(marpaESLIF_streamp->encodings), &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), marpaESLIFRecognizerp->silentb, grammarp->defaultEncodings, grammarp->fallbackEncodings);
+  utf8s = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, encodingasciis, srcs, utf8passthroughb ? 0 : srcl, &utf8l, &(marpaESLIF_streamp->encodings), &(marpaESLIF_streamp->tconvp), eofb, &(marpaESLIF_streamp->bytelefts), &(marpaESLIF_streamp->byteleftl), &(marpaESLIF_streamp->byteleftallocl), &(marpaESLIF_streamp->convertedbufs), &(marpaESLIF_streamp->convertedbufallocl), marpaESLIFRecognizerp->silentb, grammarp->defaultEncodings, grammarp->fallbackEncodings);
   if (MARPAESLIF_UNLIKELY(utf8s == NULL)) {
     goto err;
   }
@@ -17842,10 +19854,15 @@ static inline short _marpaESLIFRecognizer_start_charconvb(marpaESLIFRecognizer_t
     goto err;
   }
 
-  /* We hardcode conversion to UTF-8, tconv will certify UTF-8 correctness */
+  /* We hardcode conversion to UTF-8, tconv or our own validation will certify UTF-8 correctness */
   marpaESLIF_streamp->utfb = 1;
 
-  appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
+  if (utf8passthroughb) {
+    marpaESLIF_streamp->utf8passthroughb = 1;
+    appendDatab = _marpaESLIFRecognizer_utf8_appendDatab(marpaESLIFRecognizerp, srcs, srcl, eofb);
+  } else {
+    appendDatab = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, utf8s, utf8l, eofb);
+  }
   /* Take care: appendDatab can be < 0 */
   if (MARPAESLIF_UNLIKELY(! appendDatab)) {
     goto err;
@@ -17862,11 +19879,94 @@ static inline short _marpaESLIFRecognizer_start_charconvb(marpaESLIFRecognizer_t
 
  done:
   if (encodingasciis != NULL) {
-    free(encodingasciis);
+    MARPAESLIF_FREE(marpaESLIFp, encodingasciis);
+  }
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_utf8_appendDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *srcs, size_t srcl, short eofb)
+/*****************************************************************************/
+/* Character stream that is already UTF-8: data is validated and appended    */
+/* as-is, i.e. without going through the conversion engine. An incomplete    */
+/* character at the end is kept in bytelefts for the next round, as does    */
+/* _marpaESLIF_charconvb().                                                  */
+/* Take care: this CAN RETURN -1, c.f. _marpaESLIFRecognizer_appendDatab()   */
+/*****************************************************************************/
+{
+  static const char   *funcs              = "_marpaESLIFRecognizer_utf8_appendDatab";
+  marpaESLIF_t        *marpaESLIFp        = marpaESLIFRecognizerp->marpaESLIFp;
+  marpaESLIF_stream_t *marpaESLIF_streamp = marpaESLIFRecognizerp->marpaESLIF_streamp;
+  char                *datas;
+  size_t               datal;
+  size_t               validl;
+  size_t               leftl;
+  char                *tmps;
+  short                rcb;
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "start (srcs=%p, srcl=%ld)", srcs, (unsigned long) srcl);
+
+  if (marpaESLIF_streamp->byteleftl > 0) {
+    /* Bytes left over from previous round are prepended, using the conversion buffer */
+    datal = marpaESLIF_streamp->byteleftl + srcl;
+    if (marpaESLIF_streamp->convertedbufallocl < datal) {
+      tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, marpaESLIF_streamp->convertedbufs, datal);
+      if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
+        goto err;
+      }
+      marpaESLIF_streamp->convertedbufs      = tmps;
+      marpaESLIF_streamp->convertedbufallocl = datal;
+    }
+    memcpy(marpaESLIF_streamp->convertedbufs, marpaESLIF_streamp->bytelefts, marpaESLIF_streamp->byteleftl);
+    memcpy(marpaESLIF_streamp->convertedbufs + marpaESLIF_streamp->byteleftl, srcs, srcl);
+    datas = marpaESLIF_streamp->convertedbufs;
+  } else {
+    datas = srcs;
+    datal = srcl;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_utf8_validb(datas, datal, &validl))) {
+    if (! marpaESLIFRecognizerp->silentb) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Invalid UTF-8 character at offset %ld of the current chunk", (unsigned long) validl);
+    }
+    errno = EILSEQ;
+    goto err;
   }
-  if (utf8s != NULL) {
-    free(utf8s);
+
+  leftl = datal - validl;
+  if (leftl > 0) {
+    if (MARPAESLIF_UNLIKELY(eofb)) {
+      if (! marpaESLIFRecognizerp->silentb) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "Incomplete UTF-8 character at offset %ld of the current chunk and eof is reached", (unsigned long) validl);
+      }
+      errno = EILSEQ;
+      goto err;
+    }
+    if (marpaESLIF_streamp->byteleftallocl < leftl) {
+      tmps = (char *) MARPAESLIF_REALLOC(marpaESLIFp, marpaESLIF_streamp->bytelefts, leftl);
+      if (MARPAESLIF_UNLIKELY(tmps == NULL)) {
+        MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
+        goto err;
+      }
+      marpaESLIF_streamp->bytelefts      = tmps;
+      marpaESLIF_streamp->byteleftallocl = leftl;
+    }
+    /* datas is never bytelefts, so there is no overlap */
+    memcpy(marpaESLIF_streamp->bytelefts, datas + validl, leftl);
   }
+  marpaESLIF_streamp->byteleftl = leftl;
+
+  rcb = _marpaESLIFRecognizer_appendDatab(marpaESLIFRecognizerp, datas, validl, eofb);
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
   return rcb;
@@ -18039,9 +20139,9 @@ short marpaESLIFGrammar_defaults_by_level_setb(marpaESLIFGrammar_t *marpaESLIFGr
         grammarp->defaultRuleActionp = previousActionp;
         goto err;
       }
-      _marpaESLIF_action_freev(previousActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, previousActionp);
     } else {
-      _marpaESLIF_action_freev(grammarp->defaultRuleActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRuleActionp);
       grammarp->defaultRuleActionp = NULL;
     }
 
@@ -18055,9 +20155,9 @@ short marpaESLIFGrammar_defaults_by_level_setb(marpaESLIFGrammar_t *marpaESLIFGr
         grammarp->defaultEventActionp = previousActionp;
         goto err;
       }
-      _marpaESLIF_action_freev(previousActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, previousActionp);
     } else {
-      _marpaESLIF_action_freev(grammarp->defaultEventActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultEventActionp);
       grammarp->defaultEventActionp = NULL;
     }
 
@@ -18071,9 +20171,9 @@ short marpaESLIFGrammar_defaults_by_level_setb(marpaESLIFGrammar_t *marpaESLIFGr
         grammarp->defaultRegexActionp = previousActionp;
         goto err;
       }
-      _marpaESLIF_action_freev(previousActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, previousActionp);
     } else {
-      _marpaESLIF_action_freev(grammarp->defaultRegexActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultRegexActionp);
       grammarp->defaultRegexActionp = NULL;
     }
 
@@ -18087,44 +20187,44 @@ short marpaESLIFGrammar_defaults_by_level_setb(marpaESLIFGrammar_t *marpaESLIFGr
         grammarp->defaultSymbolActionp = previousActionp;
         goto err;
       }
-      _marpaESLIF_action_freev(previousActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, previousActionp);
     } else {
-      _marpaESLIF_action_freev(grammarp->defaultSymbolActionp);
+      _marpaESLIF_action_freev(marpaESLIFp, grammarp->defaultSymbolActionp);
       grammarp->defaultSymbolActionp = NULL;
     }
 
     if (marpaESLIFGrammarDefaultsp->defaultEncodings != NULL) {
       previousDefaultEncodings = grammarp->defaultEncodings;
-      grammarp->defaultEncodings = strdup(marpaESLIFGrammarDefaultsp->defaultEncodings);
+      grammarp->defaultEncodings = MARPAESLIF_STRDUP(marpaESLIFp, marpaESLIFGrammarDefaultsp->defaultEncodings);
       if (MARPAESLIF_UNLIKELY(grammarp->defaultEncodings == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         grammarp->defaultEncodings = previousDefaultEncodings;
         goto err;
       }
       if (previousDefaultEncodings != NULL) {
-        free(previousDefaultEncodings);
+        MARPAESLIF_FREE(marpaESLIFp, previousDefaultEncodings);
       }
     } else {
       if (grammarp->defaultEncodings != NULL) {
-        free(grammarp->defaultEncodings);
+        MARPAESLIF_FREE(marpaESLIFp, grammarp->defaultEncodings);
         grammarp->defaultEncodings = NULL;
       }
     }
 
     if (marpaESLIFGrammarDefaultsp->fallbackEncodings != NULL) {
       previousFallbackEncodings = grammarp->fallbackEncodings;
-      grammarp->fallbackEncodings = strdup(marpaESLIFGrammarDefaultsp->fallbackEncodings);
+      grammarp->fallbackEncodings = MARPAESLIF_STRDUP(marpaESLIFp, marpaESLIFGrammarDefaultsp->fallbackEncodings);
       if (MARPAESLIF_UNLIKELY(grammarp->fallbackEncodings == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
         grammarp->fallbackEncodings = previousFallbackEncodings;
         goto err;
       }
       if (previousFallbackEncodings != NULL) {
-        free(previousFallbackEncodings);
+        MARPAESLIF_FREE(marpaESLIFp, previousFallbackEncodings);
       }
     } else {
       if (grammarp->fallbackEncodings != NULL) {
-        free(grammarp->fallbackEncodings);
+        MARPAESLIF_FREE(marpaESLIFp, grammarp->fallbackEncodings);
         grammarp->fallbackEncodings = NULL;
       }
     }
@@ -18246,7 +20346,7 @@ static inline char *_marpaESLIF_ascii2ids(marpaESLIF_t *marpaESLIFp, char *ascii
     goto err;
   }
 
-  rcs = strdup(asciis);
+  rcs = MARPAESLIF_STRDUP(marpaESLIFp, asciis);
   if (MARPAESLIF_UNLIKELY(rcs == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -18269,7 +20369,7 @@ static inline char *_marpaESLIF_ascii2ids(marpaESLIF_t *marpaESLIFp, char *ascii
 
  err:
   if (rcs != NULL) {
-    free(rcs);
+    MARPAESLIF_FREE(marpaESLIFp, rcs);
     rcs = NULL;
   }
 
@@ -19183,7 +21283,7 @@ static inline void _marpaESLIF_generic_freeCallback_inlinev(void *userDatavp, ma
     } else if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.p.p == NULL)) {
       MARPAESLIF_WARN(marpaESLIFp, "Free callback on NULL pointer");
     } else {
-      free(marpaESLIFValueResultp->u.p.p);
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.p.p);
     }
     break;
   case MARPAESLIF_VALUE_TYPE_ARRAY:
@@ -19194,7 +21294,7 @@ static inline void _marpaESLIF_generic_freeCallback_inlinev(void *userDatavp, ma
     } else if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.a.p == NULL)) {
       MARPAESLIF_WARN(marpaESLIFp, "Free callback on NULL array");
     } else {
-      free(marpaESLIFValueResultp->u.a.p);
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.a.p);
     }
     break;
   case MARPAESLIF_VALUE_TYPE_STRING:
@@ -19209,7 +21309,7 @@ static inline void _marpaESLIF_generic_freeCallback_inlinev(void *userDatavp, ma
       string.bytel          = marpaESLIFValueResultp->u.s.sizel;
       string.encodingasciis = marpaESLIFValueResultp->u.s.encodingasciis;
       string.asciis         = NULL;
-      _marpaESLIF_string_freev(&string, 1 /* onStackb */);
+      _marpaESLIF_string_freev(marpaESLIFp, &string, 1 /* onStackb */);
     }
     break;
   case MARPAESLIF_VALUE_TYPE_ROW:
@@ -19220,7 +21320,7 @@ static inline void _marpaESLIF_generic_freeCallback_inlinev(void *userDatavp, ma
     } else if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.r.p == NULL)) {
       MARPAESLIF_WARN(marpaESLIFp, "Free callback on NULL row");
     } else {
-      free(marpaESLIFValueResultp->u.r.p);
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.r.p);
     }
     break;
   case MARPAESLIF_VALUE_TYPE_TABLE:
@@ -19231,7 +21331,7 @@ static inline void _marpaESLIF_generic_freeCallback_inlinev(void *userDatavp, ma
     } else if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultp->u.t.p == NULL)) {
       MARPAESLIF_WARN(marpaESLIFp, "Free callback on NULL table");
     } else {
-      free(marpaESLIFValueResultp->u.t.p);
+      MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultp->u.t.p);
     }
     break;
   default:
@@ -19260,7 +21360,7 @@ static inline marpaESLIFValue_t *_marpaESLIFValue_newp(marpaESLIFRecognizer_t *m
     goto err;
   }
 
-  marpaESLIFValuep = (marpaESLIFValue_t *) malloc(sizeof(marpaESLIFValue_t));
+  marpaESLIFValuep = (marpaESLIFValue_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFValue_t));
   if (MARPAESLIF_UNLIKELY(marpaESLIFValuep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -19286,6 +21386,17 @@ static inline marpaESLIFValue_t *_marpaESLIFValue_newp(marpaESLIFRecognizer_t *m
   marpaESLIFValuep->luaprecompiledl                       = 0;
   marpaESLIFValuep->hideSeparatorb                        = 0;
   marpaESLIFValuep->isLexemeb                             = isLexemeb;
+  marpaESLIFValuep->walkCallbackp                         = NULL;
+  marpaESLIFValuep->walkUserDatavp                        = NULL;
+  marpaESLIFValuep->parti                                 = 0;
+  marpaESLIFValuep->nparti                                = 1;
+  marpaESLIFValuep->treei                                 = 0;
+  marpaESLIFValuep->ruleCallbackpp                        = NULL;
+  marpaESLIFValuep->nullableCallbackpp                    = NULL;
+  marpaESLIFValuep->symbolCallbackpp                      = NULL;
+  /* The bootstrap resolver is stateless */
+  marpaESLIFValuep->actionCacheb                          = (marpaESLIFValueOptionp->ruleActionResolverp == _marpaESLIF_bootstrap_ruleActionResolver) ? 1 : 0;
+  marpaESLIFValuep->memoryl                               = 0;
 
   if (! fakeb) {
     marpaWrapperValueOption.genericLoggerp = silentb ? marpaESLIFp->traceLoggerp : marpaESLIFp->marpaESLIFOption.genericLoggerp;
@@ -19325,17 +21436,42 @@ static inline marpaESLIFValue_t *_marpaESLIFValue_newp(marpaESLIFRecognizer_t *m
 static inline short _marpaESLIFValue_stack_newb(marpaESLIFValue_t *marpaESLIFValuep)
 /*****************************************************************************/
 {
-  short rcb;
+  marpaESLIFGrammar_t *marpaESLIFGrammarp = marpaESLIFValuep->marpaESLIFRecognizerp->marpaESLIFGrammarp;
+  genericStack_t      *valueResultStackp;
+  int                  latestEarleySetIdi;
+  int                  lengthi;
+  short                rcb;
 
-  /* Initialize the stacks */
+  /* Initialize the stacks. The stack is kept between two valuations of the same instance. */
   if (marpaESLIFValuep->valueResultStackp == NULL) {
-    marpaESLIFValuep->valueResultStackp = &(marpaESLIFValuep->_valueResultStack);
-    GENERICSTACK_INIT(marpaESLIFValuep->valueResultStackp);
-    if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(marpaESLIFValuep->valueResultStackp))) {
+    valueResultStackp = &(marpaESLIFValuep->_valueResultStack);
+
+    /* The value stack never goes deeper than the number of tokens and nulled symbols, */
+    /* roughly the number of Earley sets: this avoids repeated reallocations.         */
+    if (MARPAESLIF_UNLIKELY(! marpaWrapperRecognizer_latestb(marpaESLIFValuep->marpaESLIFRecognizerp->marpaWrapperRecognizerp, &latestEarleySetIdi))) {
+      goto err;
+    }
+    lengthi = (latestEarleySetIdi < INT_MAX) ? latestEarleySetIdi + 1 : latestEarleySetIdi;
+
+    if ((marpaESLIFGrammarp != NULL) && (marpaESLIFGrammarp->valueStackItemsp != NULL) && (marpaESLIFGrammarp->valueStackItemsi >= lengthi)) {
+      /* Adopt the buffer of a previous value: genericStack has no API for that. It is */
+      /* always a former genericStack heap, so genericStack may realloc and free it.   */
+      GENERICSTACK_INIT(valueResultStackp);
+      valueResultStackp->items     = valueResultStackp->heapItems = marpaESLIFGrammarp->valueStackItemsp;
+      valueResultStackp->lengthi   = valueResultStackp->heapi     = marpaESLIFGrammarp->valueStackItemsi;
+      marpaESLIFGrammarp->valueStackItemsp = NULL;
+      marpaESLIFGrammarp->valueStackItemsi = 0;
+    } else if (lengthi > GENERICSTACK_DEFAULT_LENGTH) {
+      GENERICSTACK_INIT_SIZED(valueResultStackp, lengthi);
+    } else {
+      GENERICSTACK_INIT(valueResultStackp);
+    }
+    if (MARPAESLIF_UNLIKELY(GENERICSTACK_ERROR(valueResultStackp))) {
       MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "valueResultStackp initialization failure, %s", strerror(errno));
-      marpaESLIFValuep->valueResultStackp = NULL;
+      GENERICSTACK_RESET(valueResultStackp);
       goto err;
     }
+    marpaESLIFValuep->valueResultStackp = valueResultStackp;
   }
 
   rcb = 1;
@@ -19346,6 +21482,37 @@ static inline short _marpaESLIFValue_stack_newb(marpaESLIFValue_t *marpaESLIFVal
   return rcb;
 }
 
+/*****************************************************************************/
+static inline void _marpaESLIFValue_stack_disposev(marpaESLIFValue_t *marpaESLIFValuep)
+/*****************************************************************************/
+/* Releases the value stack storage, or gives it to the grammar for the next */
+/* value if the grammar caches it.                                          */
+/*****************************************************************************/
+{
+  marpaESLIFGrammar_t *marpaESLIFGrammarp;
+  genericStack_t      *valueResultStackp = marpaESLIFValuep->valueResultStackp;
+
+  if (valueResultStackp == NULL) {
+    return;
+  }
+
+  if (valueResultStackp->heapItems != NULL) {
+    marpaESLIFGrammarp = marpaESLIFValuep->marpaESLIFRecognizerp->marpaESLIFGrammarp;
+    if ((marpaESLIFGrammarp != NULL) && marpaESLIFGrammarp->valueStackCacheb && (valueResultStackp->heapi > marpaESLIFGrammarp->valueStackItemsi)) {
+      /* Keep the largest buffer. It is genericStack storage, i.e. from the C library */
+      if (marpaESLIFGrammarp->valueStackItemsp != NULL) {
+        free(marpaESLIFGrammarp->valueStackItemsp);
+      }
+      marpaESLIFGrammarp->valueStackItemsp = valueResultStackp->heapItems;
+      marpaESLIFGrammarp->valueStackItemsi = valueResultStackp->heapi;
+      valueResultStackp->heapItems         = NULL;
+    }
+  }
+
+  GENERICSTACK_RESET(valueResultStackp);
+  marpaESLIFValuep->valueResultStackp = NULL;
+}
+
 /*****************************************************************************/
 static inline short _marpaESLIFValue_stack_freeb(marpaESLIFValue_t *marpaESLIFValuep)
 /*****************************************************************************/
@@ -19378,7 +21545,8 @@ static inline short _marpaESLIFValue_stack_freeb(marpaESLIFValue_t *marpaESLIFVa
           goto err;
         }
       }
-      GENERICSTACK_RESET(valueResultStackp);
+      /* Storage is kept for the next valuation, c.f. _marpaESLIFValue_stack_disposev() */
+      GENERICSTACK_RELAX(valueResultStackp);
     }
   }
 
@@ -19940,7 +22108,7 @@ static short _marpaESLIFRecognizer_concat_valueResultCallbackb(void *userDatavp,
         string.encodingasciis = marpaESLIFValueResultp->u.s.encodingasciis;
         string.asciis         = NULL;
         if (utf8p != &string) {
-          _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+          _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
         }
         utf8p = _marpaESLIF_string2utf8p(marpaESLIFp, &string, 0 /* tconvsilentb */);
         if (MARPAESLIF_UNLIKELY(utf8p == NULL)) {
@@ -20159,7 +22327,7 @@ static short _marpaESLIFRecognizer_concat_valueResultCallbackb(void *userDatavp,
  done:
   GENERICSTACK_RESET(todoStackp);
   if (utf8p != &string) {
-    _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
   }
   if (disposeCallbackb) {
     if (disposeCallbackp != NULL) {
@@ -20251,6 +22419,8 @@ static inline short _marpaESLIF_generic_action___concatb(void *userDatavp, marpa
                                              NULL, /* byteleftsp */
                                              NULL, /* byteleftlp */
                                              NULL, /* byteleftalloclp */
+                                             NULL, /* outbufsp */
+                                             NULL, /* outbufalloclp */
                                              0, /* tconvsilentb */
                                              NULL, /* defaultEncodings */
                                              NULL /* fallbackEncodings */);
@@ -20270,7 +22440,7 @@ static inline short _marpaESLIF_generic_action___concatb(void *userDatavp, marpa
         }
 
         /* Duplicate toEncodings */
-        toEncodingDups = strdup(toEncodings);
+        toEncodingDups = MARPAESLIF_STRDUP(marpaESLIFp, toEncodings);
         if (MARPAESLIF_UNLIKELY(toEncodingDups == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
           goto err;
@@ -20324,10 +22494,10 @@ static inline short _marpaESLIF_generic_action___concatb(void *userDatavp, marpa
   /* No need to do any of these tests when this is a nullable */
   if (! nullableb) {
     if (converteds != NULL) {
-      free(converteds);
+      MARPAESLIF_FREE(marpaESLIFp, converteds);
     }
     if (toEncodingDups != NULL) {
-      free(toEncodingDups);
+      MARPAESLIF_FREE(marpaESLIFp, toEncodingDups);
     }
   }
 
@@ -20535,12 +22705,12 @@ static short _marpaESLIF_rule_action___rowb(void *userDatavp, marpaESLIFValue_t
     if (marpaESLIFValuep->marpaESLIFp->ZeroIntegerisZeroBytesb) {
       /* We do explicitely a calloc instead of a malloc, so that inner types are */
       /* automatically set to MARPAESLIF_VALUE_TYPE_UNDEF.                       */
-      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.r.p = (marpaESLIFValueResult_t *) calloc(marpaESLIFValueResult.u.r.sizel, sizeof(marpaESLIFValueResult_t))) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.r.p = (marpaESLIFValueResult_t *) MARPAESLIF_CALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.r.sizel, sizeof(marpaESLIFValueResult_t))) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "calloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
-      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.r.p = (marpaESLIFValueResult_t *) malloc(marpaESLIFValueResult.u.r.sizel * sizeof(marpaESLIFValueResult_t))) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.r.p = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.r.sizel * sizeof(marpaESLIFValueResult_t))) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
@@ -20577,7 +22747,7 @@ static short _marpaESLIF_rule_action___rowb(void *userDatavp, marpaESLIFValue_t
 
  err:
   if (marpaESLIFValueResult.u.r.p != NULL) {
-    free(marpaESLIFValueResult.u.r.p);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.r.p);
   }
   rcb = 0;
 
@@ -20621,12 +22791,12 @@ static short _marpaESLIF_rule_action___tableb(void *userDatavp, marpaESLIFValue_
     if (marpaESLIFValuep->marpaESLIFp->ZeroIntegerisZeroBytesb) {
       /* We do explicitely a calloc instead of a malloc, so that inner key */
       /* and value type are automatically MARPAESLIF_VALUE_TYPE_UNDEF.     */
-      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) calloc(marpaESLIFValueResult.u.t.sizel, sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) MARPAESLIF_CALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.t.sizel, sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "calloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
-      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) malloc(marpaESLIFValueResult.u.t.sizel * sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.t.sizel * sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
@@ -20679,7 +22849,7 @@ static short _marpaESLIF_rule_action___tableb(void *userDatavp, marpaESLIFValue_
 
  err:
   if (marpaESLIFValueResult.u.t.p != NULL) {
-    free(marpaESLIFValueResult.u.t.p);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, marpaESLIFValueResult.u.t.p);
   }
   rcb = 0;
 
@@ -20713,7 +22883,7 @@ static short _marpaESLIF_rule_action___astb(void *userDatavp, marpaESLIFValue_t
   marpaESLIFValueResult.u.t.freeUserDatavp = marpaESLIFValuep->marpaESLIFp;
   marpaESLIFValueResult.u.t.freeCallbackp  = _marpaESLIF_generic_freeCallbackv;
 
-  if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) malloc(sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
+  if (MARPAESLIF_UNLIKELY((marpaESLIFValueResult.u.t.p = (marpaESLIFValueResultPair_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizeof(marpaESLIFValueResultPair_t))) == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
@@ -20750,7 +22920,7 @@ static short _marpaESLIF_rule_action___astb(void *userDatavp, marpaESLIFValue_t
     valuep->u.r.freeCallbackp  = _marpaESLIF_generic_freeCallbackv;
 
     if (sizel > 0) {
-      if (MARPAESLIF_UNLIKELY((valuep->u.r.p = (marpaESLIFValueResult_t *) malloc(sizel * sizeof(marpaESLIFValueResult_t))) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((valuep->u.r.p = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFValuep->marpaESLIFp, sizel * sizeof(marpaESLIFValueResult_t))) == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
@@ -20803,7 +22973,7 @@ static short _marpaESLIF_rule_action___astb(void *userDatavp, marpaESLIFValue_t
  err:
   if (marpaESLIFValueResult.u.t.p != NULL) {
     if ((valuep->type == MARPAESLIF_VALUE_TYPE_ROW) && (valuep->u.r.p != NULL)) {
-      free(valuep->u.r.p);
+      MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, valuep->u.r.p);
     }
   }
   rcb = 0;
@@ -20837,7 +23007,7 @@ static short _marpaESLIF_rule_action___convertb(void *userDatavp, marpaESLIFValu
     goto err;
   }
 
-  converts = strdup(actions);
+  converts = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, actions);
   if (MARPAESLIF_UNLIKELY(converts == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -20854,7 +23024,7 @@ static short _marpaESLIF_rule_action___convertb(void *userDatavp, marpaESLIFValu
 
  done:
   if (converts != NULL) {
-    free(converts);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, converts);
   }
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFValuep->marpaESLIFRecognizerp);
@@ -20962,7 +23132,7 @@ static short _marpaESLIF_symbol_action___convertb(void *userDatavp, marpaESLIFVa
     goto err;
   }
 
-  converts = strdup(actions);
+  converts = MARPAESLIF_STRDUP(marpaESLIFValuep->marpaESLIFp, actions);
   if (MARPAESLIF_UNLIKELY(converts == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -20979,7 +23149,7 @@ static short _marpaESLIF_symbol_action___convertb(void *userDatavp, marpaESLIFVa
 
  done:
   if (converts != NULL) {
-    free(converts);
+    MARPAESLIF_FREE(marpaESLIFValuep->marpaESLIFp, converts);
   }
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFValuep->marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFValuep->marpaESLIFRecognizerp);
@@ -21198,6 +23368,7 @@ short marpaESLIFRecognizer_locationb(marpaESLIFRecognizer_t *marpaESLIFRecognize
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
   marpaESLIF_streamp = marpaESLIFRecognizerp->marpaESLIF_streamp;
+  _marpaESLIF_stream_locationv(marpaESLIF_streamp);
 
   if (linelp != NULL) {
     *linelp = marpaESLIF_streamp->linel;
@@ -21217,7 +23388,28 @@ short marpaESLIFRecognizer_locationb(marpaESLIFRecognizer_t *marpaESLIFRecognize
 }
 
 /*****************************************************************************/
-static inline short _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *symbols, char **bytesp, size_t *bytelp, marpaESLIF_symbol_data_t **symbolDatapp, short forPauseb, marpaESLIF_symbol_type_t type, short onlyLhsb, short onlyRhsb)
+short marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFRecognizerMemoryStats_t *statsp)
+/*****************************************************************************/
+{
+  marpaESLIFRecognizer_t *marpaESLIFRecognizerMemoryp;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFRecognizerp == NULL) || (statsp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  /* Accounting is done at the top-level recognizer, or at the one it shares the stream with */
+  marpaESLIFRecognizerMemoryp = marpaESLIFRecognizerp->marpaESLIFRecognizerTopp->marpaESLIFRecognizerMemoryp;
+
+  statsp->currentl = marpaESLIFRecognizerMemoryp->memoryTreel;
+  statsp->peakl    = marpaESLIFRecognizerMemoryp->memoryPeakl;
+  statsp->limitl   = marpaESLIFRecognizerMemoryp->marpaESLIFRecognizerOption.maxMemoryl;
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *symbols, int symboli, char **bytesp, size_t *bytelp, marpaESLIF_symbol_data_t **symbolDatapp, short forPauseb, marpaESLIF_symbol_type_t type, short onlyLhsb, short onlyRhsb)
 /*****************************************************************************/
 {
   marpaESLIF_t              *marpaESLIFp = marpaESLIFRecognizerp->marpaESLIFp;
@@ -21230,9 +23422,13 @@ static inline short _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_
   short                      rcb;
 
   /* A symbol that is matched must be an RHS in the current grammar */
-  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, symbols, -1, NULL /* symbolip */, 1 /* silentb */, onlyLhsb, onlyRhsb, type);
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, symbols, symboli, NULL /* symbolip */, 1 /* silentb */, onlyLhsb, onlyRhsb, type);
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s> used only as an RHS", symbols);
+    if (symbols != NULL) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol <%s> used only as an RHS", symbols);
+    } else {
+      MARPAESLIF_ERRORF(marpaESLIFp, "Failed to find symbol ID %d used only as an RHS", symboli);
+    }
     goto err;
   }
 
@@ -21248,7 +23444,7 @@ static inline short _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizer_
   if (symbolDatap == NULL) {
     /* This is an error unless conditionb is true - then it means it was not set */
     if (MARPAESLIF_UNLIKELY(! conditionb)) {
-      MARPAESLIF_ERRORF(marpaESLIFp, "Symbol <%s> has no data setting", symbols);
+      MARPAESLIF_ERRORF(marpaESLIFp, "Symbol <%s> has no data setting", symbolp->descp->asciis);
       errno = EINVAL;
       goto err;
     }
@@ -21326,7 +23522,40 @@ short marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRe
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
-  rcb = _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizerp, names, pausesp, pauselp);
+  rcb = _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizerp, names, -1 /* symboli */, pausesp, pauselp);
+  goto done;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_name_last_pause_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **pausesp, size_t *pauselp)
+/*****************************************************************************/
+{
+  static const char *funcs = "marpaESLIFRecognizer_name_last_pause_by_idb";
+  short              rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  if (MARPAESLIF_UNLIKELY(symboli < 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid symbol ID %d", symboli);
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  rcb = _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizerp, NULL /* names */, symboli, pausesp, pauselp);
   goto done;
 
  done:
@@ -21359,7 +23588,40 @@ short marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFReco
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
-  rcb = _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizerp, names, trysp, trylp);
+  rcb = _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizerp, names, -1 /* symboli */, trysp, trylp);
+  goto done;
+
+ done:
+  MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "return %d", (int) rcb);
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
+ fast_done:
+  return rcb;
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_name_last_try_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **trysp, size_t *trylp)
+/*****************************************************************************/
+{
+  static const char *funcs = "marpaESLIFRecognizer_name_last_try_by_idb";
+  short              rcb;
+
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  if (MARPAESLIF_UNLIKELY(symboli < 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid symbol ID %d", symboli);
+    errno = EINVAL;
+    rcb = 0;
+    goto fast_done;
+  }
+
+  MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
+  MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
+
+  rcb = _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizerp, NULL /* names */, symboli, trysp, trylp);
   goto done;
 
  done:
@@ -21370,10 +23632,10 @@ short marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFReco
 }
 
 /*****************************************************************************/
-static inline short _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **trysp, size_t *trylp)
+static inline short _marpaESLIFRecognizer_name_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, char **trysp, size_t *trylp)
 /*****************************************************************************/
 {
-  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, names, trysp, trylp, marpaESLIFRecognizerp->lastTrypp, 0 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_NA, 0 /* onlyLhsb */, 1 /* onlyRhsb */);
+  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, names, symboli, trysp, trylp, marpaESLIFRecognizerp->lastTrypp, 0 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_NA, 0 /* onlyLhsb */, 1 /* onlyRhsb */);
 }
 
 /*****************************************************************************/
@@ -21429,13 +23691,10 @@ short marpaESLIFRecognizer_discard_lastb(marpaESLIFRecognizer_t *marpaESLIFRecog
 }
 
 /*****************************************************************************/
-static INLINE_QSORT int _marpaESLIF_event_sorti(const void *p1, const void *p2)
+static inline int _marpaESLIF_event_ranki(marpaESLIFEventType_t type)
 /*****************************************************************************/
 {
-  marpaESLIFEvent_t *event1p = (marpaESLIFEvent_t *) p1;
-  marpaESLIFEvent_t *event2p = (marpaESLIFEvent_t *) p2;
-  int                rci;
-  /* The order is:
+  /* Events are delivered in this order:
 
      MARPAESLIF_EVENTTYPE_PREDICTED
      MARPAESLIF_EVENTTYPE_BEFORE
@@ -21444,134 +23703,19 @@ static INLINE_QSORT int _marpaESLIF_event_sorti(const void *p1, const void *p2)
      MARPAESLIF_EVENTTYPE_COMPLETED
      MARPAESLIF_EVENTTYPE_DISCARD
      MARPAESLIF_EVENTTYPE_EXHAUSTED
-     else
-       no order
-  */
 
-  switch (event1p->type) {
-  case MARPAESLIF_EVENTTYPE_NONE: /* Happen when we clear grammar events and repush them */
-    /* This should be rci == 0 when event2p->type is NONE, but this has no consequence:  */
-    /* NONE is at the very end - by doing this we avoid a sub-switch -; */
-    rci = 1;
-    /*
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci =  0; break;
-    default:                              rci =  0; break;
-    }
-    */
-    break;
-  case MARPAESLIF_EVENTTYPE_PREDICTED:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_BEFORE:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_NULLED:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_AFTER:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_COMPLETED:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_DISCARD:
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci = -1; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  case MARPAESLIF_EVENTTYPE_EXHAUSTED: /* Always at the very end, except if event2p->type is NONE */
-    switch (event2p->type) {
-    case MARPAESLIF_EVENTTYPE_PREDICTED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_BEFORE:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_NULLED:     rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_AFTER:      rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_COMPLETED:  rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_DISCARD:    rci =  1; break;
-    case MARPAESLIF_EVENTTYPE_EXHAUSTED:  rci =  0; break;
-    case MARPAESLIF_EVENTTYPE_NONE:       rci = -1; break;
-    default:                              rci =  0; break; /* Should never happen */
-    }
-    break;
-  default: /* Should never happen */
-    rci = 0;
-    break;
+     and, within the same type, in the order they were pushed.
+  */
+  switch (type) {
+  case MARPAESLIF_EVENTTYPE_PREDICTED: return 0;
+  case MARPAESLIF_EVENTTYPE_BEFORE:    return 1;
+  case MARPAESLIF_EVENTTYPE_NULLED:    return 2;
+  case MARPAESLIF_EVENTTYPE_AFTER:     return 3;
+  case MARPAESLIF_EVENTTYPE_COMPLETED: return 4;
+  case MARPAESLIF_EVENTTYPE_DISCARD:   return 5;
+  case MARPAESLIF_EVENTTYPE_EXHAUSTED: return 6;
+  default:                             return 7; /* Should never happen */
   }
-
-  return rci;
-}
-
-/*****************************************************************************/
-static inline int _marpaESLIF_event_sort_inlinedi(marpaESLIFEvent_t *p1, marpaESLIFEvent_t *p2)
-/*****************************************************************************/
-{
-  /* The only thing of interest for inlined qsort is when one element is less than another */
-  return (_marpaESLIF_event_sorti((const void *) p1, (const void *) p2)) < 0 ? 1 : 0;
 }
 
 /*****************************************************************************/
@@ -21623,21 +23767,57 @@ static inline int _marpaESLIF_cleanup_sort_inlinedi(genericStackItem_t *p1, gene
 short marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **offsetpp, size_t *lengthlp)
 /*****************************************************************************/
 {
-  /* This method work only for the CURRENT grammar of CURRENT recognizer */
-  static const char                *funcs = "marpaESLIFRecognizer_last_completedb";
-  marpaESLIF_t                     *marpaESLIFp;
-  marpaWrapperRecognizer_t         *marpaWrapperRecognizerp;
-  marpaESLIF_grammar_t             *grammarp;
-  genericStack_t                   *set2InputStackp;
-  marpaESLIF_symbol_t              *symbolp;
-  short                             rcb;
-  int                               latestEarleySetIdi;
-  int                               earleySetIdi;
-  marpaWrapperRecognizerProgress_t *progressp;
-  size_t                            nProgressl;
-  size_t                            progressl;
-  int                               rulei;
-  int                               positioni;
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(names == NULL)) {
+    MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "Symbol name is NULL");
+    errno = EINVAL;
+    return 0;
+  }
+
+  return _marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizerp, names, -1 /* symboli */, offsetpp, lengthlp);
+}
+
+/*****************************************************************************/
+short marpaESLIFRecognizer_last_completed_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, int symboli, char **offsetpp, size_t *lengthlp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerp == NULL)) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  if (MARPAESLIF_UNLIKELY(symboli < 0)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "Invalid symbol ID %d", symboli);
+    errno = EINVAL;
+    return 0;
+  }
+
+  return _marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizerp, NULL /* names */, symboli, offsetpp, lengthlp);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, char **offsetpp, size_t *lengthlp)
+/*****************************************************************************/
+{
+  /* This method work only for the CURRENT grammar of CURRENT recognizer */
+  static const char                *funcs = "_marpaESLIFRecognizer_last_completedb";
+  marpaESLIF_t                     *marpaESLIFp;
+  marpaWrapperRecognizer_t         *marpaWrapperRecognizerp;
+  marpaESLIF_grammar_t             *grammarp;
+  genericStack_t                   *set2InputStackp;
+  marpaESLIF_symbol_t              *symbolp;
+  short                             rcb;
+  int                               latestEarleySetIdi;
+  int                               earleySetIdi;
+  marpaWrapperRecognizerProgress_t *progressp;
+  size_t                            nProgressl;
+  size_t                            progressl;
+  int                               rulei;
+  int                               positioni;
   int                               origini;
   int                               firstOrigini;
   int                               lhsRuleStacki;
@@ -21675,16 +23855,14 @@ short marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRec
   grammarp                = marpaESLIFRecognizerp->grammarp;
   set2InputStackp         = marpaESLIFRecognizerp->set2InputStackp;
 
-  if (MARPAESLIF_UNLIKELY(names == NULL)) {
-    MARPAESLIF_ERROR(marpaESLIFp, "Symbol name is NULL");
-    errno = EINVAL;
-    goto err;
-  }
-
   /* First look for this symbol */
-  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, names, -1, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb */, 0 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_META);
+  symbolp = _marpaESLIF_symbol_findp(marpaESLIFp, grammarp, names, symboli, NULL /* symbolip */, 0 /* silentb */, 0 /* onlyLhsb */, 0 /* onlyRhsb */, MARPAESLIF_SYMBOL_TYPE_META);
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
-    MARPAESLIF_ERRORF(marpaESLIFp, "No such symbol <%s>", names);
+    if (names != NULL) {
+      MARPAESLIF_ERRORF(marpaESLIFp, "No such symbol <%s>", names);
+    } else {
+      MARPAESLIF_ERRORF(marpaESLIFp, "No such symbol ID %d", symboli);
+    }
     goto err;
   }
   lhsRuleStackp = symbolp->lhsRuleStackp;
@@ -21732,7 +23910,7 @@ short marpaESLIFRecognizer_last_completedb(marpaESLIFRecognizer_t *marpaESLIFRec
 
   if (MARPAESLIF_UNLIKELY(earleySetIdi < 0)) {
     /* Not found */
-    MARPAESLIF_ERRORF(marpaESLIFp, "No match for <%s> in input stack", names);
+    MARPAESLIF_ERRORF(marpaESLIFp, "No match for <%s> in input stack", symbolp->descp->asciis);
     errno = ENOENT;
     goto err;
   }
@@ -21914,7 +24092,7 @@ static inline short __marpaESLIFRecognizer_value_validb(marpaESLIFRecognizer_t *
 /****************************************************************************/
 {
   static const char           *funcs      = "__marpaESLIFRecognizer_value_validb";
-  genericStack_t              *todoStackp = marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp;
+  genericStack_t              *todoStackp;
   short                        rcb;
   size_t                       i;
   marpaESLIFValueResult_t     *marpaESLIFValueResultWorkp;
@@ -21925,6 +24103,11 @@ static inline short __marpaESLIFRecognizer_value_validb(marpaESLIFRecognizer_t *
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_valueResultStacksb(marpaESLIFRecognizerp))) {
+    goto err;
+  }
+  todoStackp = marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp;
+
   GENERICSTACK_RELAX(todoStackp);
 
   /* - We want to make sure this is a known type */
@@ -22108,7 +24291,7 @@ static inline unsigned long _marpaESLIF_djb2_s(unsigned char *str, size_t length
 
 #if SIZEOF_VOID_STAR <= 4
 /****************************************************************************/
-static inline int _marpaESLIF_inlined_ptrhashi(void *p)
+static inline unsigned long _marpaESLIF_inlined_ptrhashl(void *p)
 /****************************************************************************/
 {
   /* C.f. https://nullprogram.com/blog/2018/07/31/ */
@@ -22120,11 +24303,11 @@ static inline int _marpaESLIF_inlined_ptrhashi(void *p)
   u32 *= 0x846ca68b;
   u32 ^= u32 >> 16;
 
-  return (int) (u32 % MARPAESLIF_HASH_SIZE);
+  return (unsigned long) u32;
 }
 #else
 /****************************************************************************/
-static inline int _marpaESLIF_inlined_ptrhashi(void *p)
+static inline unsigned long _marpaESLIF_inlined_ptrhashl(void *p)
 /****************************************************************************/
 {
   /* C.f. https://stackoverflow.com/questions/53110781/whats-the-fastest-portable-way-to-hash-pointers-we-know-are-pointer-aligned-to?noredirect=1&lq=1 */
@@ -22136,37 +24319,304 @@ static inline int _marpaESLIF_inlined_ptrhashi(void *p)
   u64 *= 0xc4ceb9fe1a85ec53;
   u64 ^= (u64 >> 33);
 
-  return (int) (u64 % MARPAESLIF_HASH_SIZE);
+  return (unsigned long) u64;
 }
 #endif
 
 /****************************************************************************/
-int _marpaESLIF_ptrhashi(void *userDatavp, genericStackItemType_t itemType, void **pp)
+static inline unsigned long _marpaESLIF_hash_mixl(unsigned long hashl)
+/****************************************************************************/
+{
+  /* Slot indice is taken from the low bits: make them depend on all the bits */
+  hashl ^= hashl >> 16;
+  hashl *= 0x45d9f3b;
+  hashl ^= hashl >> 16;
+
+  return hashl;
+}
+
+/****************************************************************************/
+static inline void _marpaESLIF_hash_initv(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, void *userDatavp, marpaESLIF_hashFunction_t hashFunctionp, marpaESLIF_hashCmpFunction_t cmpFunctionp, marpaESLIF_hashFreeFunction_t keyFreeFunctionp, marpaESLIF_hashFreeFunction_t valFreeFunctionp)
+/****************************************************************************/
+{
+  hashp->marpaESLIFp      = marpaESLIFp;
+  hashp->userDatavp       = userDatavp;
+  hashp->hashFunctionp    = hashFunctionp;
+  hashp->cmpFunctionp     = cmpFunctionp;
+  hashp->keyFreeFunctionp = keyFreeFunctionp;
+  hashp->valFreeFunctionp = valFreeFunctionp;
+  hashp->slotp            = NULL;
+  hashp->slotl            = 0;
+  hashp->usedl            = 0;
+}
+
+/****************************************************************************/
+static inline marpaESLIF_hashSlot_t *_marpaESLIF_hash_slotp(marpaESLIF_hash_t *hashp, void *keyp, unsigned long hashl)
+/****************************************************************************/
+/* Returns the slot of the key, or the free slot where it would go. Slots    */
+/* must be allocated.                                                        */
+/****************************************************************************/
+{
+  marpaESLIF_hashCmpFunction_t  cmpFunctionp = hashp->cmpFunctionp;
+  size_t                        maskl        = hashp->slotl - 1;
+  marpaESLIF_hashSlot_t        *slotp;
+  size_t                        i;
+
+  /* Linear probing: there is always at least one free slot */
+  for (i = (size_t) hashl & maskl; ; i = (i + 1) & maskl) {
+    slotp = &(hashp->slotp[i]);
+    if (slotp->keyp == NULL) {
+      break;
+    }
+    if (slotp->keyp == keyp) {
+      break;
+    }
+    if ((cmpFunctionp != NULL) && (slotp->hashl == hashl) && cmpFunctionp(hashp->userDatavp, slotp->keyp, keyp)) {
+      break;
+    }
+  }
+
+  return slotp;
+}
+
+/****************************************************************************/
+static inline short _marpaESLIF_hash_findb(marpaESLIF_hash_t *hashp, void *keyp, void **valpp)
+/****************************************************************************/
+{
+  marpaESLIF_hashSlot_t *slotp;
+
+  if (hashp->usedl <= 0) {
+    return 0;
+  }
+
+  slotp = _marpaESLIF_hash_slotp(hashp, keyp, hashp->hashFunctionp(hashp->userDatavp, keyp));
+  if (slotp->keyp == NULL) {
+    return 0;
+  }
+
+  if (valpp != NULL) {
+    *valpp = slotp->valp;
+  }
+  return 1;
+}
+
+/****************************************************************************/
+static inline short _marpaESLIF_hash_reserveb(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, size_t countl)
+/****************************************************************************/
+/* Makes room for countl entries, keeping the load factor under one half.   */
+/****************************************************************************/
+{
+  marpaESLIF_hashSlot_t *slotp;
+  marpaESLIF_hashSlot_t *newslotp;
+  size_t                 newslotl;
+  size_t                 maskl;
+  size_t                 i;
+  size_t                 j;
+
+  if ((countl * 2) <= hashp->slotl) {
+    return 1;
+  }
+  if (MARPAESLIF_UNLIKELY(countl > (((size_t) -1) / 2))) {
+    MARPAESLIF_ERROR(marpaESLIFp, "size_t turnaround when computing newslotl");
+    errno = EINVAL;
+    return 0;
+  }
+
+  newslotl = (hashp->slotl <= 0) ? MARPAESLIF_HASH_SLOTL : hashp->slotl;
+  while (newslotl < (countl * 2)) {
+    if (MARPAESLIF_UNLIKELY((newslotl * 2) < newslotl)) {
+      MARPAESLIF_ERROR(marpaESLIFp, "size_t turnaround when computing newslotl");
+      errno = EINVAL;
+      return 0;
+    }
+    newslotl *= 2;
+  }
+
+  newslotp = (marpaESLIF_hashSlot_t *) MARPAESLIF_CALLOC(marpaESLIFp, newslotl, sizeof(marpaESLIF_hashSlot_t));
+  if (MARPAESLIF_UNLIKELY(newslotp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
+    return 0;
+  }
+  maskl = newslotl - 1;
+  for (i = 0; i < hashp->slotl; i++) {
+    slotp = &(hashp->slotp[i]);
+    if (slotp->keyp != NULL) {
+      for (j = (size_t) slotp->hashl & maskl; newslotp[j].keyp != NULL; j = (j + 1) & maskl) {
+      }
+      newslotp[j] = *slotp;
+    }
+  }
+  if (hashp->slotp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, hashp->slotp);
+  }
+  hashp->slotp = newslotp;
+  hashp->slotl = newslotl;
+
+  return 1;
+}
+
+/****************************************************************************/
+static inline short _marpaESLIF_hash_setb(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp, void *keyp, void *valp)
+/****************************************************************************/
+/* When the key already exists, the hash takes the new key and value and     */
+/* the old ones are freed.                                                   */
+/****************************************************************************/
+{
+  unsigned long          hashl;
+  marpaESLIF_hashSlot_t *slotp;
+
+  if (MARPAESLIF_UNLIKELY(keyp == NULL)) {
+    MARPAESLIF_ERROR(marpaESLIFp, "Hash key is NULL");
+    errno = EINVAL;
+    return 0;
+  }
+
+  hashl = hashp->hashFunctionp(hashp->userDatavp, keyp);
+  if (hashp->slotp != NULL) {
+    slotp = _marpaESLIF_hash_slotp(hashp, keyp, hashl);
+    if (slotp->keyp != NULL) {
+      if ((hashp->keyFreeFunctionp != NULL) && (slotp->keyp != keyp)) {
+        hashp->keyFreeFunctionp(hashp->marpaESLIFp, slotp->keyp);
+      }
+      if ((hashp->valFreeFunctionp != NULL) && (slotp->valp != NULL) && (slotp->valp != valp)) {
+        hashp->valFreeFunctionp(hashp->marpaESLIFp, slotp->valp);
+      }
+      slotp->keyp = keyp;
+      slotp->valp = valp;
+      return 1;
+    }
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_reserveb(marpaESLIFp, hashp, hashp->usedl + 1))) {
+    return 0;
+  }
+
+  slotp = _marpaESLIF_hash_slotp(hashp, keyp, hashl);
+  slotp->keyp  = keyp;
+  slotp->valp  = valp;
+  slotp->hashl = hashl;
+  hashp->usedl++;
+
+  return 1;
+}
+
+/****************************************************************************/
+static inline short _marpaESLIF_hash_removeb(marpaESLIF_hash_t *hashp, void *keyp)
+/****************************************************************************/
+/* Frees the key and the value, and returns 1 if the key was found.          */
+/* Entries after the removed slot are shifted back, so that probing never   */
+/* needs tombstones.                                                         */
+/****************************************************************************/
+{
+  size_t                 maskl;
+  marpaESLIF_hashSlot_t *slotp;
+  size_t                 i;
+  size_t                 j;
+  size_t                 k;
+
+  if (hashp->usedl <= 0) {
+    return 0;
+  }
+
+  slotp = _marpaESLIF_hash_slotp(hashp, keyp, hashp->hashFunctionp(hashp->userDatavp, keyp));
+  if (slotp->keyp == NULL) {
+    return 0;
+  }
+
+  if (hashp->keyFreeFunctionp != NULL) {
+    hashp->keyFreeFunctionp(hashp->marpaESLIFp, slotp->keyp);
+  }
+  if ((hashp->valFreeFunctionp != NULL) && (slotp->valp != NULL)) {
+    hashp->valFreeFunctionp(hashp->marpaESLIFp, slotp->valp);
+  }
+  slotp->keyp = NULL;
+  hashp->usedl--;
+
+  maskl = hashp->slotl - 1;
+  i     = (size_t) (slotp - hashp->slotp);
+  for (j = (i + 1) & maskl; hashp->slotp[j].keyp != NULL; j = (j + 1) & maskl) {
+    /* Entry at j can move to i unless its home k lies cyclically in ]i,j] */
+    k = (size_t) hashp->slotp[j].hashl & maskl;
+    if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) {
+      continue;
+    }
+    hashp->slotp[i]      = hashp->slotp[j];
+    hashp->slotp[j].keyp = NULL;
+    i = j;
+  }
+
+  return 1;
+}
+
+/****************************************************************************/
+static inline void _marpaESLIF_hash_resetv(marpaESLIF_t *marpaESLIFp, marpaESLIF_hash_t *hashp)
+/****************************************************************************/
+/* Frees all entries: the hash remains usable.                               */
+/****************************************************************************/
+{
+  marpaESLIF_hashSlot_t *slotp;
+  size_t                 i;
+
+  if (hashp->slotp != NULL) {
+    if ((hashp->keyFreeFunctionp != NULL) || (hashp->valFreeFunctionp != NULL)) {
+      for (i = 0; i < hashp->slotl; i++) {
+        slotp = &(hashp->slotp[i]);
+        if (slotp->keyp != NULL) {
+          if (hashp->keyFreeFunctionp != NULL) {
+            hashp->keyFreeFunctionp(hashp->marpaESLIFp, slotp->keyp);
+          }
+          if ((hashp->valFreeFunctionp != NULL) && (slotp->valp != NULL)) {
+            hashp->valFreeFunctionp(hashp->marpaESLIFp, slotp->valp);
+          }
+        }
+      }
+    }
+    MARPAESLIF_FREE(marpaESLIFp, hashp->slotp);
+    hashp->slotp = NULL;
+  }
+  hashp->slotl = 0;
+  hashp->usedl = 0;
+}
+
+/****************************************************************************/
+static unsigned long _marpaESLIF_ptr_hashl(void *userDatavp, void *keyp)
 /****************************************************************************/
 {
-  /* We know what we are doing, i.e. that *pp is a void* */
-  return _marpaESLIF_inlined_ptrhashi(*pp);
+  return _marpaESLIF_inlined_ptrhashl(keyp);
 }
 
+/****************************************************************************/
+static unsigned long _marpaESLIF_string_hashl(void *userDatavp, void *keyp)
+/****************************************************************************/
+{
+  /* We know what we are doing, i.e. that keyp is marpaESLIF_string_t pointer */
+  marpaESLIF_string_t *p = (marpaESLIF_string_t *) keyp;
+
+  return _marpaESLIF_hash_mixl(_marpaESLIF_djb2_s((unsigned char *) p->bytep, p->bytel));
+}
 
 /****************************************************************************/
-int _marpaESLIF_string_hash_callbacki(void *userDatavp, genericStackItemType_t itemType, void **pp)
+static short _marpaESLIF_string_cmpb(void *userDatavp, void *key1p, void *key2p)
 /****************************************************************************/
 {
-  /* We know what we are doing, i.e. that *pp is marpaESLIF_string_t pointer */
-  marpaESLIF_string_t *p = * (marpaESLIF_string_t **) pp;
-  /* i.e. we can use that array of bytes as if it is a ( char *) - the lexer made sure it ends with a hiden NUL byte */
-  return (int) (_marpaESLIF_djb2_s((unsigned char *) p->bytep, p->bytel) % MARPAESLIF_HASH_SIZE);
+  return _marpaESLIF_string_eqb((marpaESLIF_string_t *) key1p, (marpaESLIF_string_t *) key2p);
 }
 
 /****************************************************************************/
-short _marpaESLIF_string_cmp_callbackb(void *userDatavp, void **pp1, void **pp2)
+static unsigned long _marpaESLIF_symbolname_hashl(void *userDatavp, void *keyp)
 /****************************************************************************/
 {
-  marpaESLIF_string_t *p1 = * (marpaESLIF_string_t **) pp1;
-  marpaESLIF_string_t *p2 = * (marpaESLIF_string_t **) pp2;
+  /* We know what we are doing, i.e. that keyp is a symbol name (ASCII, NUL terminated) */
+  char *asciis = (char *) keyp;
 
-  return _marpaESLIF_string_eqb(p1, p2);
+  return _marpaESLIF_hash_mixl(_marpaESLIF_djb2_s((unsigned char *) asciis, strlen(asciis)));
+}
+
+/****************************************************************************/
+static short _marpaESLIF_symbolname_cmpb(void *userDatavp, void *key1p, void *key2p)
+/****************************************************************************/
+{
+  return (strcmp((char *) key1p, (char *) key2p) == 0) ? 1 : 0;
 }
 
 /****************************************************************************/
@@ -22180,18 +24630,17 @@ void *_marpaESLIF_string_copy_callbackp(void *userDatavp, void **pp)
 }
 
 /****************************************************************************/
-void _marpaESLIF_string_free_callbackv(void *userDatavp, void **pp)
+static void _marpaESLIF_string_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p)
 /****************************************************************************/
 {
-  marpaESLIF_string_t *p = * (marpaESLIF_string_t **) pp;
-  _marpaESLIF_string_freev(p, 0 /* onStstackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, (marpaESLIF_string_t *) p, 0 /* onStstackb */);
 }
 
 /****************************************************************************/
-static void _marpaESLIFRecognizerHash_free_callbackv(void *userDatavp, void **pp)
+static void _marpaESLIFRecognizerHash_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p)
 /****************************************************************************/
 {
-  genericStack_t         *marpaESLIFRecognizerStackp = * (genericStack_t **) pp;
+  genericStack_t         *marpaESLIFRecognizerStackp = (genericStack_t *) p;
   marpaESLIFRecognizer_t *marpaESLIFRecognizerp;
 
   if (marpaESLIFRecognizerStackp != NULL) {
@@ -22211,12 +24660,110 @@ static void _marpaESLIFRecognizerHash_free_callbackv(void *userDatavp, void **pp
 }
 
 /****************************************************************************/
-static void _lexemeGrammarHash_free_callbackv(void *userDatavp, void **pp)
+static void _lexemeGrammarHash_free_callbackv(marpaESLIF_t *marpaESLIFp, void *p)
 /****************************************************************************/
 {
-  marpaESLIFGrammar_t *marpaESLIFGrammarp = * (marpaESLIFGrammar_t **) pp;
+  marpaESLIF_lexemeGrammarEntry_t *entryp = (marpaESLIF_lexemeGrammarEntry_t *) p;
 
-  _marpaESLIFGrammar_freev(marpaESLIFGrammarp, 0 /* onStackb */);
+  _marpaESLIFGrammar_freev(entryp->marpaESLIFGrammarp, 0 /* onStackb */);
+  MARPAESLIF_FREE(marpaESLIFp, entryp);
+}
+
+/*****************************************************************************/
+static inline size_t _marpaESLIFRecognizer_memoryl(marpaESLIFRecognizer_t *marpaESLIFRecognizerp)
+/*****************************************************************************/
+/* Number of bytes owned by a recognizer. Marpa's own tables are not        */
+/* visible: the Earley items of the top-level recognizer are estimated.     */
+/*****************************************************************************/
+{
+  marpaESLIF_stream_t *marpaESLIF_streamp = &(marpaESLIFRecognizerp->_marpaESLIF_stream);
+  size_t               memoryl            = sizeof(marpaESLIFRecognizer_t);
+
+  memoryl += marpaESLIFRecognizerp->isExpectedArraybl;
+  memoryl += marpaESLIFRecognizerp->eventArraySizel * sizeof(marpaESLIFEvent_t);
+  memoryl += marpaESLIFRecognizerp->namesArrayAllocl * sizeof(char *);
+  memoryl += marpaESLIFRecognizerp->progressallocl * sizeof(marpaESLIFRecognizerProgress_t);
+  memoryl += marpaESLIFRecognizerp->substitutionBufferl * sizeof(PCRE2_UCHAR);
+  memoryl += marpaESLIFRecognizerp->lexemeBytesl;
+  memoryl += marpaESLIFRecognizerp->earleyItemsl * MARPAESLIF_EARLEY_ITEM_SIZEL;
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->lexemeStackp);
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->alternativeStackSymbolp);
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->commitedAlternativeStackSymbolp);
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->set2InputStackp);
+  if (marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp != NULL) {
+    memoryl += 3 * sizeof(genericStack_t);
+  }
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp);
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp);
+  memoryl += MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp);
+
+  /* The stream is charged by the recognizer that will dispose it */
+  if (marpaESLIFRecognizerp->marpaESLIF_streamp == marpaESLIF_streamp) {
+    if (marpaESLIF_streamp->buffers != NULL) {
+      memoryl += marpaESLIF_streamp->bufferallocl + 1; /* + 1 for the hiden NUL byte */
+    }
+    if (marpaESLIF_streamp->bytelefts != NULL) {
+      memoryl += marpaESLIF_streamp->byteleftallocl;
+    }
+    if (marpaESLIF_streamp->convertedbufs != NULL) {
+      memoryl += marpaESLIF_streamp->convertedbufallocl;
+    }
+  }
+
+  return memoryl;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_memory_chargeb(marpaESLIFRecognizer_t *marpaESLIFRecognizerTopp, size_t *memorylp, size_t newl, size_t extral)
+/*****************************************************************************/
+/* Replaces the *memorylp bytes charged to the top-level recognizer by newl */
+/* and checks that extral more bytes would still fit in the limit. The      */
+/* charge is always done, so that once the limit is crossed every later    */
+/* check in the same recognizer tree fails as well. A recognizer created    */
+/* with newFromp charges the recognizer it shares the stream with.          */
+/*****************************************************************************/
+{
+  marpaESLIFRecognizer_t *marpaESLIFRecognizerMemoryp = marpaESLIFRecognizerTopp->marpaESLIFRecognizerMemoryp;
+  size_t                  maxMemoryl                  = marpaESLIFRecognizerMemoryp->marpaESLIFRecognizerOption.maxMemoryl;
+
+  marpaESLIFRecognizerMemoryp->memoryTreel -= *memorylp;
+  marpaESLIFRecognizerMemoryp->memoryTreel += newl;
+  *memorylp = newl;
+  if (marpaESLIFRecognizerMemoryp->memoryTreel > marpaESLIFRecognizerMemoryp->memoryPeakl) {
+    marpaESLIFRecognizerMemoryp->memoryPeakl = marpaESLIFRecognizerMemoryp->memoryTreel;
+  }
+
+  if (MARPAESLIF_UNLIKELY((maxMemoryl > 0) && ((marpaESLIFRecognizerMemoryp->memoryTreel > maxMemoryl) || (extral > (maxMemoryl - marpaESLIFRecognizerMemoryp->memoryTreel))))) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerMemoryp->marpaESLIFp, "Memory limit of %ld bytes reached: %ld bytes in use, %ld more bytes wanted", (unsigned long) maxMemoryl, (unsigned long) marpaESLIFRecognizerMemoryp->memoryTreel, (unsigned long) extral);
+    marpaESLIFRecognizerMemoryp->memoryLimitb = 1;
+    errno = ENOMEM;
+    return 0;
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_memory_syncb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t extral)
+/*****************************************************************************/
+{
+  return _marpaESLIFRecognizer_memory_chargeb(marpaESLIFRecognizerp->marpaESLIFRecognizerTopp, &(marpaESLIFRecognizerp->memoryl), _marpaESLIFRecognizer_memoryl(marpaESLIFRecognizerp), extral);
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValue_memory_syncb(marpaESLIFValue_t *marpaESLIFValuep, short doneb)
+/*****************************************************************************/
+/* A valuation is charged only while it runs: the recognizer may be freed   */
+/* before the value object.                                                 */
+/*****************************************************************************/
+{
+  size_t memoryl = 0;
+
+  if (! doneb) {
+    memoryl = sizeof(marpaESLIFValue_t) + MARPAESLIF_GENERICSTACK_HEAPL(marpaESLIFValuep->valueResultStackp);
+  }
+
+  return _marpaESLIFRecognizer_memory_chargeb(marpaESLIFValuep->marpaESLIFRecognizerp->marpaESLIFRecognizerTopp, &(marpaESLIFValuep->memoryl), memoryl, 0 /* extral */);
 }
 
 /*****************************************************************************/
@@ -22230,17 +24777,20 @@ static inline void _marpaESLIF_stream_disposev(marpaESLIFRecognizer_t *marpaESLI
     if (marpaESLIF_streamp == &(marpaESLIFRecognizerp->_marpaESLIF_stream)) {
 
       if (marpaESLIF_streamp->buffers != NULL) {
-        free(marpaESLIF_streamp->buffers);
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIF_streamp->buffers);
       }
       if (marpaESLIF_streamp->bytelefts != NULL) {
-        free(marpaESLIF_streamp->bytelefts);
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIF_streamp->bytelefts);
       }
       if (marpaESLIF_streamp->encodings != NULL) {
-        free(marpaESLIF_streamp->encodings);
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIF_streamp->encodings);
       }
       if (marpaESLIF_streamp->tconvp != NULL) {
         tconv_close(marpaESLIF_streamp->tconvp);
       }
+      if (marpaESLIF_streamp->convertedbufs != NULL) {
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIF_streamp->convertedbufs);
+      }
     }
   }
 }
@@ -22268,10 +24818,13 @@ static inline void _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLI
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_INC(marpaESLIFRecognizerp);
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "start");
 
+  /* Give back what we charged. The top-level recognizer is freed last. */
+  _marpaESLIFRecognizer_memory_chargeb(marpaESLIFRecognizerp->marpaESLIFRecognizerTopp, &(marpaESLIFRecognizerp->memoryl), 0 /* newl */, 0 /* extral */);
+
   MARPAESLIFRECOGNIZER_TRACEF(marpaESLIFRecognizerp, funcs, "Freeing recognizer %p for grammar %p", marpaESLIFRecognizerp, marpaESLIFRecognizerp->marpaWrapperGrammarp);
 
   if (marpaESLIFRecognizerp->isExpectedArraybp != NULL) {
-    free(marpaESLIFRecognizerp->isExpectedArraybp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->isExpectedArraybp);
   }
 #ifdef MARPAESLIF_NOTICE_ACTION
   MARPAESLIF_NOTICEF(marpaESLIFRecognizerp->marpaESLIFp, "%s: Freeing lexeme stack", funcs);
@@ -22289,13 +24842,13 @@ static inline void _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLI
     GENERICSTACK_RESET(marpaESLIFRecognizerp->set2InputStackp); /* Take care, this is a pointer to a stack inside recognizer's structure */
   }
   if (marpaESLIFRecognizerp->namesArrayp != NULL) {
-    free(marpaESLIFRecognizerp->namesArrayp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->namesArrayp);
   }
   if (marpaESLIFRecognizerp->marpaWrapperRecognizerp != NULL) {
     marpaWrapperRecognizer_freev(marpaESLIFRecognizerp->marpaWrapperRecognizerp);
   }
   if (marpaESLIFRecognizerp->eventArrayp != NULL) {
-    free(marpaESLIFRecognizerp->eventArrayp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->eventArrayp);
   }
 
   _marpaESLIFRecognizer_lastPause_freev(marpaESLIFRecognizerp);
@@ -22303,17 +24856,17 @@ static inline void _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLI
 
   discardEventStatebp = marpaESLIFRecognizerp->discardEventStatebp;
   if (discardEventStatebp != NULL) {
-    free(discardEventStatebp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, discardEventStatebp);
   }
 
   beforeEventStatebp = marpaESLIFRecognizerp->beforeEventStatebp;
   if (beforeEventStatebp != NULL) {
-    free(beforeEventStatebp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, beforeEventStatebp);
   }
 
   afterEventStatebp = marpaESLIFRecognizerp->afterEventStatebp;
   if (afterEventStatebp != NULL) {
-    free(afterEventStatebp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, afterEventStatebp);
   }
 
   _marpaESLIF_stream_disposev(marpaESLIFRecognizerp);
@@ -22321,7 +24874,7 @@ static inline void _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLI
   if (marpaESLIFRecognizerParentp == NULL) {
     if (marpaESLIFRecognizerp->marpaESLIFRecognizerHashp != NULL) {
       /* This will free all cached recognizers in cascade -; */
-      GENERICHASH_RESET(marpaESLIFRecognizerp->marpaESLIFRecognizerHashp, marpaESLIFRecognizerp->marpaESLIFp);
+      _marpaESLIF_hash_resetv(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->marpaESLIFRecognizerHashp);
     }
   } else {
     /* Parent's "current" position have to be updated */
@@ -22329,45 +24882,56 @@ static inline void _marpaESLIFRecognizer_freev(marpaESLIFRecognizer_t *marpaESLI
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputs  = marpaESLIFRecognizerParentp->marpaESLIF_streamp->buffers + marpaESLIFRecognizerp->parentDeltal;
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputl  = marpaESLIFRecognizerParentp->marpaESLIF_streamp->bufferl - marpaESLIFRecognizerp->parentDeltal;
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->linel   = marpaESLIFRecognizerp->parentLinel;
-    marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl = marpaESLIFRecognizerp->parentColumnl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl    = marpaESLIFRecognizerp->parentColumnl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->uncountedl = marpaESLIFRecognizerp->parentUncountedl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->crb        = marpaESLIFRecognizerp->parentCrb;
   }
 
   if (marpaESLIFRecognizerp->lastDiscards != NULL) {
-    free(marpaESLIFRecognizerp->lastDiscards);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->lastDiscards);
   }
 
-  /* Internal stacks for pointers cleanup */
+  /* Internal stacks for pointers cleanup, if they were ever needed */
   if (marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp != NULL) {
     GENERICSTACK_RESET(marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp);
-  }
-  if (marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp != NULL) {
     GENERICSTACK_RESET(marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp);
-  }
-  if (marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp != NULL) {
     GENERICSTACK_RESET(marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp);
   }
   _marpaESLIFCalloutBlock_disposev(marpaESLIFRecognizerp);
 
   if (marpaESLIFRecognizerp->progressp != NULL) {
-    free(marpaESLIFRecognizerp->progressp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->progressp);
+  }
+
+  if (marpaESLIFRecognizerp->substitutionBufferp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->substitutionBufferp);
   }
 
   if (marpaESLIFRecognizerp->luaprecompiledp != NULL) {
-    free(marpaESLIFRecognizerp->luaprecompiledp);
+    MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->luaprecompiledp);
   }
 
-  _marpaESLIF_action_freev(marpaESLIFRecognizerp->getContextActionp);
-  _marpaESLIF_action_freev(marpaESLIFRecognizerp->setContextActionp);
-  _marpaESLIF_action_freev(marpaESLIFRecognizerp->popContextActionp);
+  _marpaESLIF_action_freev(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->getContextActionp);
+  _marpaESLIF_action_freev(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->setContextActionp);
+  _marpaESLIF_action_freev(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp->popContextActionp);
 
   _marpaESLIF_lua_recognizer_freev(marpaESLIFRecognizerp);
 
+  if (marpaESLIFRecognizerp->marpaESLIFGrammarp != NULL) {
+    marpaESLIFRecognizerp->marpaESLIFGrammarp->recognizerl--;
+    if (marpaESLIFRecognizerParentp == NULL) {
+      /* Reusable recognizers are gone: generated grammars they were using can be evicted */
+      _marpaESLIFGrammar_lexemeGrammar_evictv(marpaESLIFRecognizerp->marpaESLIFGrammarp);
+    }
+  }
+
   GENERICLOGGER_FREE(marpaESLIFRecognizerp->genericLoggerp);
 
   MARPAESLIFRECOGNIZER_TRACE(marpaESLIFRecognizerp, funcs, "return");
   MARPAESLIFRECOGNIZER_CALLSTACKCOUNTER_DEC(marpaESLIFRecognizerp);
 
-  free(marpaESLIFRecognizerp);
+  MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerp);
 }
 
 /*****************************************************************************/
@@ -22377,7 +24941,7 @@ static inline short _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *ma
   static const char      *funcs                 = "_marpaESLIFRecognizer_getPristineFromCachep";
   marpaESLIFRecognizer_t *marpaESLIFRecognizerp = NULL;
   marpaWrapperGrammar_t  *marpaWrapperGrammarp;
-  genericHash_t          *marpaESLIFRecognizerHashp;
+  marpaESLIF_hash_t      *marpaESLIFRecognizerHashp;
   genericStack_t         *marpaESLIFRecognizerStackp;
   short                   findResultb;
   short                   rcb;
@@ -22397,16 +24961,9 @@ static inline short _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *ma
     /* The only problematic reuse of pristine recognizers would be those that are based */
     /* on a grammar that have INITIAL events. But this can happen only once: the very top grammar */
     /* which, by definition, is always used only once for the whole lifetime of the recognizer */
-    findResultb = 0;
     marpaESLIFRecognizerHashp = marpaESLIFRecognizerParentp->marpaESLIFRecognizerHashp; /* Owned by the top-level recognizer */
     marpaESLIFRecognizerStackp = NULL;
-    GENERICHASH_FIND(marpaESLIFRecognizerHashp,
-                     NULL, /* userDatavp */
-                     PTR,
-                     marpaWrapperGrammarp,
-                     PTR,
-                     &marpaESLIFRecognizerStackp,
-                     findResultb);
+    findResultb = _marpaESLIF_hash_findb(marpaESLIFRecognizerHashp, marpaWrapperGrammarp, (void **) &marpaESLIFRecognizerStackp);
 #ifndef MARPAESLIF_NTRACE
     if (findResultb && (marpaESLIFRecognizerStackp == NULL)) {
       MARPAESLIF_ERROR(marpaESLIFp, "marpaESLIFRecognizerStackp is NULL");
@@ -22448,6 +25005,8 @@ static inline short _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *ma
         marpaESLIFRecognizerp->parentDeltal                 = marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputs - marpaESLIFRecognizerParentp->marpaESLIF_streamp->buffers;
         marpaESLIFRecognizerp->parentLinel                  = marpaESLIFRecognizerParentp->marpaESLIF_streamp->linel;
         marpaESLIFRecognizerp->parentColumnl                = marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl;
+        marpaESLIFRecognizerp->parentUncountedl             = marpaESLIFRecognizerParentp->marpaESLIF_streamp->uncountedl;
+        marpaESLIFRecognizerp->parentCrb                    = marpaESLIFRecognizerParentp->marpaESLIF_streamp->crb;
         marpaESLIFRecognizerp->scanb                        = 0;
         /* marpaESLIFRecognizerp->noEventb                     = noEventb; */
         /* marpaESLIFRecognizerp->discardb                     = discardb; */
@@ -22464,10 +25023,12 @@ static inline short _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *ma
         /* marpaESLIFRecognizerp->set2InputStackp                 = NULL; */
         /* marpaESLIFRecognizerp->namesArrayp                     = NULL; */
         /* marpaESLIFRecognizerp->namesArrayAllocl                = 0; */
+        /* marpaESLIFRecognizerp->expectedGenerationl             = 0; */
         /* marpaESLIFRecognizerp->discardEventStatebp             = NULL; */
         /* marpaESLIFRecognizerp->beforeEventStatebp              = NULL; */
         /* marpaESLIFRecognizerp->afterEventStatebp               = NULL; */
         /* marpaESLIFRecognizerp->discardOnOffb                   = 1; */
+        /* marpaESLIFRecognizerp->eventMaski                      = MARPAESLIF_EVENTTYPE_ALL; */
         /* marpaESLIFRecognizerp->pristineb                       = 1; */
         /* marpaESLIFRecognizerp->marpaESLIFRecognizerOptionDiscard                   = marpaESLIFRecognizerp->marpaESLIFRecognizerOption; */
         /* marpaESLIFRecognizerp->marpaESLIFRecognizerOptionDiscard.disableThresholdb = 1; */
@@ -22500,26 +25061,32 @@ static inline short _marpaESLIFRecognizer_getPristineFromCachep(marpaESLIF_t *ma
 static inline short _marpaESLIFRecognizer_getLexemeGrammarFromCachep(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_string_t *utf8p, marpaESLIFGrammar_t **marpaESLIFGrammarCachedpp)
 /*****************************************************************************/
 {
-  static const char      *funcs                    = "_marpaESLIFRecognizer_getLexemeGrammarFromCachep";
-  marpaESLIFGrammar_t    *marpaESLIFGrammarCachedp = NULL;
-  short                   findResultb             = 0;
-  short                   rcb;
+  static const char               *funcs                    = "_marpaESLIFRecognizer_getLexemeGrammarFromCachep";
+  marpaESLIF_lexemeGrammarEntry_t *entryp                   = NULL;
+  marpaESLIFGrammar_t             *marpaESLIFGrammarCachedp = NULL;
+  short                            findResultb             = 0;
+  short                            rcb;
 
-  /* Key is utf8p, value is marpaESLIFGrammar_t pointer */
-  GENERICHASH_FIND(marpaESLIFGrammarp->lexemeGrammarHashp,
-                   marpaESLIFGrammarp->marpaESLIFp, /* userDatavp */
-                   PTR,
-                   utf8p,
-                   PTR,
-                   &marpaESLIFGrammarCachedp,
-                   findResultb);
+  /* Key is utf8p, value is a marpaESLIF_lexemeGrammarEntry_t pointer */
+  findResultb = _marpaESLIF_hash_findb(marpaESLIFGrammarp->lexemeGrammarHashp, utf8p, (void **) &entryp);
 #ifndef MARPAESLIF_NTRACE
-  if (findResultb && (marpaESLIFGrammarCachedp == NULL)) {
+  if (findResultb && ((entryp == NULL) || (entryp->marpaESLIFGrammarp == NULL))) {
     MARPAESLIF_ERROR(marpaESLIFGrammarp->marpaESLIFp, "marpaESLIFGrammarp is NULL");
     goto err;
   }
 #endif
 
+  if (findResultb) {
+    marpaESLIFGrammarp->lexemeGrammarHitl++;
+    marpaESLIFGrammarCachedp = entryp->marpaESLIFGrammarp;
+    if (entryp != marpaESLIFGrammarp->lexemeGrammarHeadp) {
+      _marpaESLIFGrammar_lexemeGrammar_unlinkv(marpaESLIFGrammarp, entryp);
+      _marpaESLIFGrammar_lexemeGrammar_linkv(marpaESLIFGrammarp, entryp);
+    }
+  } else {
+    marpaESLIFGrammarp->lexemeGrammarMissl++;
+  }
+
   *marpaESLIFGrammarCachedpp = marpaESLIFGrammarCachedp;
   rcb = 1;
   goto done;
@@ -22538,7 +25105,7 @@ static inline short _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecogniz
   static const char         *funcs                       = "_marpaESLIFRecognizer_putPristineToCacheb";
   marpaESLIFRecognizer_t    *marpaESLIFRecognizerParentp = marpaESLIFRecognizerp->marpaESLIFRecognizerParentp;
   marpaESLIF_stream_t       *marpaESLIF_streamp          = marpaESLIFRecognizerp->marpaESLIF_streamp;
-  genericHash_t             *marpaESLIFRecognizerHashp   = marpaESLIFRecognizerp->marpaESLIFRecognizerHashp;
+  marpaESLIF_hash_t         *marpaESLIFRecognizerHashp   = marpaESLIFRecognizerp->marpaESLIFRecognizerHashp;
   marpaWrapperGrammar_t     *marpaWrapperGrammarp        = marpaESLIFRecognizerp->marpaWrapperGrammarp;
   genericStack_t            *marpaESLIFRecognizerStackp;
   short                      findResultb;
@@ -22550,15 +25117,8 @@ static inline short _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecogniz
       (marpaESLIFRecognizerp->pristineb == 1)) {
 
     /* Eventually create a stack if nothing yet exist in the hash */
-    findResultb = 0;
     marpaESLIFRecognizerStackp = NULL;
-    GENERICHASH_FIND(marpaESLIFRecognizerHashp,
-                     NULL, /* userDatavp */
-                     PTR,
-                     marpaWrapperGrammarp,
-                     PTR,
-                     &marpaESLIFRecognizerStackp,
-                     findResultb);
+    findResultb = _marpaESLIF_hash_findb(marpaESLIFRecognizerHashp, marpaWrapperGrammarp, (void **) &marpaESLIFRecognizerStackp);
 #ifndef MARPAESLIF_NTRACE
     if (MARPAESLIF_UNLIKELY(findResultb && (marpaESLIFRecognizerStackp == NULL))) {
       MARPAESLIF_ERROR(marpaESLIFRecognizerp->marpaESLIFp, "findResultb is true but marpaESLIFRecognizerStackp is NULL");
@@ -22575,9 +25135,7 @@ static inline short _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecogniz
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFRecognizerStackp initialization failure, %s", strerror(errno));
         goto err;
       }
-      GENERICHASH_SET(marpaESLIFRecognizerHashp, NULL, PTR, marpaWrapperGrammarp, PTR, marpaESLIFRecognizerStackp);
-      if (MARPAESLIF_UNLIKELY(GENERICHASH_ERROR(marpaESLIFRecognizerHashp))) {
-        MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "marpaESLIFRecognizerHashp failure, %s", strerror(errno));
+      if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_setb(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFRecognizerHashp, marpaWrapperGrammarp, marpaESLIFRecognizerStackp))) {
         GENERICSTACK_FREE(marpaESLIFRecognizerStackp);
         goto err;
       }
@@ -22593,7 +25151,9 @@ static inline short _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecogniz
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputs  = marpaESLIFRecognizerParentp->marpaESLIF_streamp->buffers + marpaESLIFRecognizerp->parentDeltal;
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->inputl  = marpaESLIFRecognizerParentp->marpaESLIF_streamp->bufferl - marpaESLIFRecognizerp->parentDeltal;
     marpaESLIFRecognizerParentp->marpaESLIF_streamp->linel   = marpaESLIFRecognizerp->parentLinel;
-    marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl = marpaESLIFRecognizerp->parentColumnl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->columnl    = marpaESLIFRecognizerp->parentColumnl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->uncountedl = marpaESLIFRecognizerp->parentUncountedl;
+    marpaESLIFRecognizerParentp->marpaESLIF_streamp->crb        = marpaESLIFRecognizerp->parentCrb;
     /* Now we can disconnect */
     marpaESLIFRecognizerp->marpaESLIFRecognizerParentp = NULL;
     marpaESLIFRecognizerp->marpaESLIF_streamp = NULL;
@@ -22617,19 +25177,32 @@ static inline short _marpaESLIFRecognizer_putPristineToCacheb(marpaESLIFRecogniz
 /*****************************************************************************/
 static inline short _marpaESLIFRecognizer_putLexemeGrammarToCacheb(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_string_t *utf8p, marpaESLIFGrammar_t *marpaESLIFGrammarCachedp)
 /*****************************************************************************/
+/* On success, the cache owns utf8p and marpaESLIFGrammarCachedp.            */
+/*****************************************************************************/
 {
-  short          rcb;
+  marpaESLIF_lexemeGrammarEntry_t *entryp;
+  short                            rcb;
 
-  GENERICHASH_SET(marpaESLIFGrammarp->lexemeGrammarHashp,
-                  marpaESLIFGrammarp->marpaESLIFp,
-                  PTR,
-                  utf8p,
-                  PTR,
-                  marpaESLIFGrammarCachedp);
-  if (MARPAESLIF_UNLIKELY(GENERICHASH_ERROR(marpaESLIFGrammarp->lexemeGrammarHashp))) {
-    MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "lexemeGrammarHashp set failure, %s", strerror(errno));
+  entryp = (marpaESLIF_lexemeGrammarEntry_t *) MARPAESLIF_MALLOC(marpaESLIFGrammarp->marpaESLIFp, sizeof(marpaESLIF_lexemeGrammarEntry_t));
+  if (MARPAESLIF_UNLIKELY(entryp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFGrammarp->marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
+  entryp->utf8p              = utf8p;
+  entryp->marpaESLIFGrammarp = marpaESLIFGrammarCachedp;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_setb(marpaESLIFGrammarp->marpaESLIFp, marpaESLIFGrammarp->lexemeGrammarHashp, utf8p, entryp))) {
+    MARPAESLIF_FREE(marpaESLIFGrammarp->marpaESLIFp, entryp);
+    goto err;
+  }
+  _marpaESLIFGrammar_lexemeGrammar_linkv(marpaESLIFGrammarp, entryp);
+  marpaESLIFGrammarp->lexemeGrammarBytesl += utf8p->bytel;
+
+  /* A generated grammar can have generators too: its own cache inherits the limits */
+  marpaESLIFGrammarCachedp->lexemeGrammarMaxEntriesl = marpaESLIFGrammarp->lexemeGrammarMaxEntriesl;
+  marpaESLIFGrammarCachedp->lexemeGrammarMaxBytesl   = marpaESLIFGrammarp->lexemeGrammarMaxBytesl;
+
+  _marpaESLIFGrammar_lexemeGrammar_evictv(marpaESLIFGrammarp);
 
   rcb = 1;
   goto done;
@@ -22641,6 +25214,92 @@ static inline short _marpaESLIFRecognizer_putLexemeGrammarToCacheb(marpaESLIFGra
   return rcb;
 }
 
+/*****************************************************************************/
+static inline void _marpaESLIFGrammar_lexemeGrammar_unlinkv(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_lexemeGrammarEntry_t *entryp)
+/*****************************************************************************/
+{
+  if (entryp->prevp != NULL) {
+    entryp->prevp->nextp = entryp->nextp;
+  } else {
+    marpaESLIFGrammarp->lexemeGrammarHeadp = entryp->nextp;
+  }
+  if (entryp->nextp != NULL) {
+    entryp->nextp->prevp = entryp->prevp;
+  } else {
+    marpaESLIFGrammarp->lexemeGrammarTailp = entryp->prevp;
+  }
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFGrammar_lexemeGrammar_linkv(marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIF_lexemeGrammarEntry_t *entryp)
+/*****************************************************************************/
+/* Links the entry as the most recently used one.                            */
+/*****************************************************************************/
+{
+  entryp->prevp = NULL;
+  entryp->nextp = marpaESLIFGrammarp->lexemeGrammarHeadp;
+  if (entryp->nextp != NULL) {
+    entryp->nextp->prevp = entryp;
+  } else {
+    marpaESLIFGrammarp->lexemeGrammarTailp = entryp;
+  }
+  marpaESLIFGrammarp->lexemeGrammarHeadp = entryp;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFGrammar_lexemeGrammar_busyb(marpaESLIFGrammar_t *marpaESLIFGrammarp)
+/*****************************************************************************/
+/* A grammar is busy when a recognizer, reusable ones included, is alive on  */
+/* it or on one of its own generated grammars.                               */
+/*****************************************************************************/
+{
+  marpaESLIF_lexemeGrammarEntry_t *entryp;
+
+  if (marpaESLIFGrammarp->recognizerl > 0) {
+    return 1;
+  }
+  for (entryp = marpaESLIFGrammarp->lexemeGrammarHeadp; entryp != NULL; entryp = entryp->nextp) {
+    if (_marpaESLIFGrammar_lexemeGrammar_busyb(entryp->marpaESLIFGrammarp)) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFGrammar_lexemeGrammar_evictv(marpaESLIFGrammar_t *marpaESLIFGrammarp)
+/*****************************************************************************/
+/* Evicts least recently used entries until the cache is within its limits. */
+/* The most recently used entry and busy grammars are never evicted, so the */
+/* cache may stay above its limits until they are released.                 */
+/*****************************************************************************/
+{
+  marpaESLIF_hash_t               *lexemeGrammarHashp = marpaESLIFGrammarp->lexemeGrammarHashp;
+  marpaESLIF_lexemeGrammarEntry_t *entryp;
+  marpaESLIF_lexemeGrammarEntry_t *prevp;
+
+  if (lexemeGrammarHashp == NULL) {
+    return;
+  }
+
+  for (entryp = marpaESLIFGrammarp->lexemeGrammarTailp; entryp != marpaESLIFGrammarp->lexemeGrammarHeadp; entryp = prevp) {
+    if (((marpaESLIFGrammarp->lexemeGrammarMaxEntriesl <= 0) || (lexemeGrammarHashp->usedl <= marpaESLIFGrammarp->lexemeGrammarMaxEntriesl)) &&
+        ((marpaESLIFGrammarp->lexemeGrammarMaxBytesl   <= 0) || (marpaESLIFGrammarp->lexemeGrammarBytesl <= marpaESLIFGrammarp->lexemeGrammarMaxBytesl))) {
+      break;
+    }
+    prevp = entryp->prevp;
+    if (_marpaESLIFGrammar_lexemeGrammar_busyb(entryp->marpaESLIFGrammarp)) {
+      continue;
+    }
+    _marpaESLIFGrammar_lexemeGrammar_unlinkv(marpaESLIFGrammarp, entryp);
+    marpaESLIFGrammarp->lexemeGrammarBytesl -= entryp->utf8p->bytel;
+    marpaESLIFGrammarp->lexemeGrammarEvictionl++;
+    /* This frees the key, the entry and the grammar */
+    _marpaESLIF_hash_removeb(lexemeGrammarHashp, entryp->utf8p);
+  }
+}
+
 /*****************************************************************************/
 static inline char *_marpaESLIF_action2asciis(marpaESLIF_action_t *actionp)
 /*****************************************************************************/
@@ -22765,7 +25424,7 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
 {
   marpaESLIF_action_t *dup;
 
-  dup = (marpaESLIF_action_t *) malloc(sizeof(marpaESLIF_action_t));
+  dup = (marpaESLIF_action_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_action_t));
   if (MARPAESLIF_UNLIKELY(dup == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -22775,7 +25434,7 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
 
   switch (dup->type) {
   case MARPAESLIF_ACTION_TYPE_NAME:
-    dup->u.names = strdup(actionp->u.names);
+    dup->u.names = MARPAESLIF_STRDUP(marpaESLIFp, actionp->u.names);
     if (MARPAESLIF_UNLIKELY(dup->u.names == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -22788,7 +25447,7 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
     }
     break;
   case MARPAESLIF_ACTION_TYPE_LUA:
-    dup->u.luas = strdup(actionp->u.luas);
+    dup->u.luas = MARPAESLIF_STRDUP(marpaESLIFp, actionp->u.luas);
     if (MARPAESLIF_UNLIKELY(dup->u.luas == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
@@ -22803,18 +25462,18 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
     dup->u.luaFunction.luacstripp = NULL;
     dup->u.luaFunction.luacstripl = 0;
 
-    dup->u.luaFunction.luas = strdup(actionp->u.luaFunction.luas);
+    dup->u.luaFunction.luas = MARPAESLIF_STRDUP(marpaESLIFp, actionp->u.luaFunction.luas);
     if (MARPAESLIF_UNLIKELY(dup->u.luaFunction.luas == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
     }
-    dup->u.luaFunction.actions = strdup(actionp->u.luaFunction.actions);
+    dup->u.luaFunction.actions = MARPAESLIF_STRDUP(marpaESLIFp, actionp->u.luaFunction.actions);
     if (MARPAESLIF_UNLIKELY(dup->u.luaFunction.actions == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
       goto err;
     }
     if (actionp->u.luaFunction.luacp != NULL) {
-      dup->u.luaFunction.luacp = (char *) malloc(actionp->u.luaFunction.luacl);
+      dup->u.luaFunction.luacp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, actionp->u.luaFunction.luacl);
       if (MARPAESLIF_UNLIKELY(dup->u.luaFunction.luacp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -22822,7 +25481,7 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
       memcpy(dup->u.luaFunction.luacp, actionp->u.luaFunction.luacp, actionp->u.luaFunction.luacl);
     }
     if (actionp->u.luaFunction.luacstripp != NULL) {
-      dup->u.luaFunction.luacstripp = (char *) malloc(actionp->u.luaFunction.luacstripl);
+      dup->u.luaFunction.luacstripp = (char *) MARPAESLIF_MALLOC(marpaESLIFp, actionp->u.luaFunction.luacstripl);
       if (MARPAESLIF_UNLIKELY(dup->u.luaFunction.luacstripp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -22838,7 +25497,7 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
   goto done;
 
  err:
-  _marpaESLIF_action_freev(dup);
+  _marpaESLIF_action_freev(marpaESLIFp, dup);
   dup = NULL;
 
  done:
@@ -22846,54 +25505,56 @@ static inline marpaESLIF_action_t *_marpaESLIF_action_clonep(marpaESLIF_t *marpa
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_action_freev(marpaESLIF_action_t *actionp)
+static inline void _marpaESLIF_action_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_action_t *actionp)
 /*****************************************************************************/
 {
   if (actionp != NULL) {
     switch (actionp->type) {
     case MARPAESLIF_ACTION_TYPE_NAME:
       if (actionp->u.names != NULL) {
-        free(actionp->u.names);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.names);
       }
       break;
     case MARPAESLIF_ACTION_TYPE_STRING:
-      _marpaESLIF_string_freev(actionp->u.stringp, 0 /* onStackb */);
+      _marpaESLIF_string_freev(marpaESLIFp, actionp->u.stringp, 0 /* onStackb */);
       break;
     case MARPAESLIF_ACTION_TYPE_LUA:
       if (actionp->u.luas != NULL) {
-        free(actionp->u.luas);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.luas);
       }
       break;
     case MARPAESLIF_ACTION_TYPE_LUA_FUNCTION:
       if (actionp->u.luaFunction.luas != NULL) {
-        free(actionp->u.luaFunction.luas);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.luaFunction.luas);
       }
       if (actionp->u.luaFunction.actions != NULL) {
-        free(actionp->u.luaFunction.actions);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.luaFunction.actions);
       }
       if (actionp->u.luaFunction.luacp != NULL) {
-        free(actionp->u.luaFunction.luacp);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.luaFunction.luacp);
       }
       if (actionp->u.luaFunction.luacstripp != NULL) {
-        free(actionp->u.luaFunction.luacstripp);
+        MARPAESLIF_FREE(marpaESLIFp, actionp->u.luaFunction.luacstripp);
       }
       break;
     default:
       break;
     }
-    free(actionp);
+    MARPAESLIF_FREE(marpaESLIFp, actionp);
   }
 }
 
 /*****************************************************************************/
-static inline short _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueRuleCallback_t *ruleCallbackpp, char *asciishows, marpaESLIF_action_t *actionp, marpaESLIF_internal_rule_action_t rule_actione)
+static inline short _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueRuleCallback_t *ruleCallbackpp, char *asciishows, marpaESLIF_action_t *actionp, marpaESLIF_internal_rule_action_t rule_actione, short nullableb, int idi)
 /*****************************************************************************/
+/* idi is the rule id, or the symbol id when this is the nullable action of a symbol */
 {
   static const char                   *funcs                 = "_marpaESLIFValue_ruleActionCallbackb";
   marpaESLIFValueRuleActionResolver_t  ruleActionResolverp   = marpaESLIFValuep->marpaESLIFValueOption.ruleActionResolverp;
   marpaESLIFRecognizer_t              *marpaESLIFRecognizerp = marpaESLIFValuep->marpaESLIFRecognizerp;
   marpaESLIF_grammar_t                *grammarp              = marpaESLIFRecognizerp->grammarp;
   marpaESLIFValueRuleCallback_t        ruleCallbackp;
+  marpaESLIFValueRuleCallback_t       *resolvedCallbackpp;
   short                                rcb;
 
   if (MARPAESLIF_UNLIKELY(actionp == NULL)) {
@@ -22960,12 +25621,26 @@ static inline short _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marp
         ruleCallbackp = _marpaESLIF_rule_action___astb;
         break;
       default:
-        /* Not a built-in: ask to the resolver */
+        /* Not a built-in: ask to the resolver, once per valuation object if the action cache is on */
         if (MARPAESLIF_UNLIKELY(ruleActionResolverp == NULL)) {
           MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "Cannot execute action \"%s\": no rule action resolver", names);
           goto err;
         }
-        ruleCallbackp = ruleActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+        if (! marpaESLIFValuep->actionCacheb) {
+          ruleCallbackp = ruleActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+          break;
+        }
+        if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->ruleCallbackpp == NULL)) {
+          if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_resolvedCallbacks_newb(marpaESLIFValuep))) {
+            goto err;
+          }
+        }
+        resolvedCallbackpp = nullableb ? &(marpaESLIFValuep->nullableCallbackpp[idi]) : &(marpaESLIFValuep->ruleCallbackpp[idi]);
+        ruleCallbackp = *resolvedCallbackpp;
+        if (ruleCallbackp == NULL) {
+          ruleCallbackp = ruleActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+          *resolvedCallbackpp = ruleCallbackp;
+        }
         break;
       }
 
@@ -23020,6 +25695,56 @@ static inline short _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValue_t *marp
   return rcb;
 }
 
+/*****************************************************************************/
+static inline short _marpaESLIFValue_resolvedCallbacks_newb(marpaESLIFValue_t *marpaESLIFValuep)
+/*****************************************************************************/
+/* Resolvers are called once per valuation object: their results are kept in */
+/* arrays indexed by rule or symbol id, that are all created at the first    */
+/* call to a resolver, whatever it is.                                       */
+/*****************************************************************************/
+{
+  marpaESLIF_t         *marpaESLIFp = marpaESLIFValuep->marpaESLIFp;
+  marpaESLIF_grammar_t *grammarp    = marpaESLIFValuep->marpaESLIFRecognizerp->grammarp;
+  size_t                nrulel      = (size_t) GENERICSTACK_USED(grammarp->ruleStackp);
+  size_t                nsymboll    = (size_t) GENERICSTACK_USED(grammarp->symbolStackp);
+  short                 rcb;
+
+  /* nrulel or nsymboll can be zero, when this is the case we allocate one element so that calloc() never returns NULL on success */
+  marpaESLIFValuep->ruleCallbackpp = (marpaESLIFValueRuleCallback_t *) MARPAESLIF_CALLOC(marpaESLIFp, (nrulel > 0) ? nrulel : 1, sizeof(marpaESLIFValueRuleCallback_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->ruleCallbackpp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
+    goto err;
+  }
+  marpaESLIFValuep->nullableCallbackpp = (marpaESLIFValueRuleCallback_t *) MARPAESLIF_CALLOC(marpaESLIFp, (nsymboll > 0) ? nsymboll : 1, sizeof(marpaESLIFValueRuleCallback_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->nullableCallbackpp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
+    goto err;
+  }
+  marpaESLIFValuep->symbolCallbackpp = (marpaESLIFValueSymbolCallback_t *) MARPAESLIF_CALLOC(marpaESLIFp, (nsymboll > 0) ? nsymboll : 1, sizeof(marpaESLIFValueSymbolCallback_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->symbolCallbackpp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "calloc failure, %s", strerror(errno));
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  /* They are all or nothing */
+  if (marpaESLIFValuep->ruleCallbackpp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValuep->ruleCallbackpp);
+    marpaESLIFValuep->ruleCallbackpp = NULL;
+  }
+  if (marpaESLIFValuep->nullableCallbackpp != NULL) {
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValuep->nullableCallbackpp);
+    marpaESLIFValuep->nullableCallbackpp = NULL;
+  }
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
 /*****************************************************************************/
 static inline short _marpaESLIFValue_symbolActionCallbackb(marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueSymbolCallback_t *symbolCallbackpp, short nullableb, marpaESLIFValueRuleCallback_t *ruleCallbackpp, marpaESLIF_symbol_t *symbolp)
 /*****************************************************************************/
@@ -23035,7 +25760,7 @@ static inline short _marpaESLIFValue_symbolActionCallbackb(marpaESLIFValue_t *ma
   if (nullableb) {
     /* This will be in reality a rule callback */
     symbolCallbackp = NULL;
-    if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValuep, &ruleCallbackp, symbolp->descp->asciis, symbolp->effectiveNullableActionp, symbolp->effectiveNullableActione))) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_ruleActionCallbackb(marpaESLIFValuep, &ruleCallbackp, symbolp->descp->asciis, symbolp->effectiveNullableActionp, symbolp->effectiveNullableActione, 1 /* nullableb */, symbolp->idi))) {
       goto err;
     }
   } else {
@@ -23094,13 +25819,26 @@ static inline short _marpaESLIFValue_symbolActionCallbackb(marpaESLIFValue_t *ma
           symbolCallbackp = _marpaESLIF_symbol_action___jsonfb;
           break;
         default:
-          /* Not a built-in: ask to the resolver */
+          /* Not a built-in: ask to the resolver, once per valuation object if the action cache is on */
           symbolActionResolverp = marpaESLIFValuep->marpaESLIFValueOption.symbolActionResolverp;
           if (MARPAESLIF_UNLIKELY(symbolActionResolverp == NULL)) {
             MARPAESLIF_ERRORF(marpaESLIFValuep->marpaESLIFp, "Cannot execute symbol action \"%s\": no symbol action resolver", names);
             goto err;
           }
-          symbolCallbackp = symbolActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+          if (! marpaESLIFValuep->actionCacheb) {
+            symbolCallbackp = symbolActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+            break;
+          }
+          if (MARPAESLIF_UNLIKELY(marpaESLIFValuep->symbolCallbackpp == NULL)) {
+            if (MARPAESLIF_UNLIKELY(! _marpaESLIFValue_resolvedCallbacks_newb(marpaESLIFValuep))) {
+              goto err;
+            }
+          }
+          symbolCallbackp = marpaESLIFValuep->symbolCallbackpp[symbolp->idi];
+          if (symbolCallbackp == NULL) {
+            symbolCallbackp = symbolActionResolverp(marpaESLIFValuep->marpaESLIFValueOption.userDatavp, marpaESLIFValuep, names);
+            marpaESLIFValuep->symbolCallbackpp[symbolp->idi] = symbolCallbackp;
+          }
           break;
         }
 
@@ -23389,7 +26127,7 @@ static inline short _marpaESLIFRecognizer_recognizerEventActionCallbackb(marpaES
 char *marpaESLIF_charconvp(marpaESLIF_t *marpaESLIFp, char *toEncodings, char *fromEncodings, char *srcs, size_t srcl, size_t *dstlp)
 /*****************************************************************************/
 {
-  return _marpaESLIF_charconvb(marpaESLIFp, toEncodings, fromEncodings, srcs, srcl, dstlp, NULL /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */);
+  return _marpaESLIF_charconvb(marpaESLIFp, toEncodings, fromEncodings, srcs, srcl, dstlp, NULL /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, NULL /* outbufsp */, NULL /* outbufalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */);
 }
 
 /*****************************************************************************/
@@ -23418,7 +26156,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string2utf8p(marpaESLIF_t *marpaE
   if (stringp->encodingasciis == (char *) MARPAESLIF_UTF8_STRING) {
     rcp = stringp;
   } else {
-    rcp = (marpaESLIF_string_t *) malloc(sizeof(marpaESLIF_string_t));
+    rcp = (marpaESLIF_string_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_string_t));
     if (MARPAESLIF_UNLIKELY(rcp == NULL)) {
       MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
       goto err;
@@ -23458,7 +26196,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string2utf8p(marpaESLIF_t *marpaE
       }
 
       /* No need of rcp->asciis, this is why we do not use _marpaESLIF_string_newp() */
-      if (MARPAESLIF_UNLIKELY((rcp->bytep = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, fromencodingasciis, stringp->bytep, stringp->bytel, &(rcp->bytel), &(rcp->encodingasciis), NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, tconvsilentb, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((rcp->bytep = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING, fromencodingasciis, stringp->bytep, stringp->bytel, &(rcp->bytel), &(rcp->encodingasciis), NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, NULL /* outbufsp */, NULL /* outbufalloclp */, tconvsilentb, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
         goto err;
       }
 
@@ -23473,7 +26211,7 @@ static inline marpaESLIF_string_t *_marpaESLIF_string2utf8p(marpaESLIF_t *marpaE
 
  err:
   if ((rcp != NULL) && (rcp != stringp)) {
-    _marpaESLIF_string_freev(rcp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, rcp, 0 /* onStackb */);
     rcp = NULL;
   }
 
@@ -23498,12 +26236,12 @@ static inline short _marpaESLIF_string_removebomb(marpaESLIF_t *marpaESLIFp, cha
   if ((bytep != NULL) && (bytel > 0)) {
     if (encodingasciis == NULL) {
       /* Guess the encoding by converting to UTF-8 */
-      if (MARPAESLIF_UNLIKELY((tmpp = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING /* toEncodings */, NULL /* fromEncodings */, bytep, bytel, NULL /* bytelp */, &(encodingasciitofrees) /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
+      if (MARPAESLIF_UNLIKELY((tmpp = _marpaESLIF_charconvb(marpaESLIFp, (char *) MARPAESLIF_UTF8_STRING /* toEncodings */, NULL /* fromEncodings */, bytep, bytel, NULL /* bytelp */, &(encodingasciitofrees) /* fromEncodingsp */, NULL /* tconvpp */, 1 /* eofb */, NULL /* byteleftsp */, NULL /* byteleftlp */, NULL /* byteleftalloclp */, NULL /* outbufsp */, NULL /* outbufalloclp */, 0 /* tconvsilentb */, NULL /* defaultEncodings */, NULL /* fallbackEncodings */)) == NULL)) {
 	goto err;
       }
       /* Per def here encodingasciitofrees is != NULL */
       encodingasciis = encodingasciitofrees;
-      free(tmpp);
+      MARPAESLIF_FREE(marpaESLIFp, tmpp);
     }
 
     encodingasciil = strlen(encodingasciis);
@@ -23575,7 +26313,7 @@ static inline short _marpaESLIF_string_removebomb(marpaESLIF_t *marpaESLIFp, cha
 
  done:
   if (encodingasciitofrees != NULL) {
-    free(encodingasciitofrees);
+    MARPAESLIF_FREE(marpaESLIFp, encodingasciitofrees);
   }
   return rcb;
 }
@@ -23604,7 +26342,7 @@ char *marpaESLIF_encodings(marpaESLIF_t *marpaESLIFp, char *bytep, size_t bytel)
     goto err;
   }
 
-  encodings = strdup(utf8p->encodingasciis);
+  encodings = MARPAESLIF_STRDUP(marpaESLIFp, utf8p->encodingasciis);
   if (MARPAESLIF_UNLIKELY(encodings == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -23614,15 +26352,44 @@ char *marpaESLIF_encodings(marpaESLIF_t *marpaESLIFp, char *bytep, size_t bytel)
 
  err:
   if (encodings != NULL) {
-    free(encodings);
+    MARPAESLIF_FREE(marpaESLIFp, encodings);
     encodings = NULL;
   }
 
  done:
-  _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
   return encodings;
 }
 
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_valueResultStacksb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp)
+/*****************************************************************************/
+/* The work, original and new stacks are created together, on first use.    */
+/*****************************************************************************/
+{
+  genericStack_t *stacksp;
+
+  if (MARPAESLIF_LIKELY(marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp != NULL)) {
+    return 1;
+  }
+
+  stacksp = (genericStack_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, 3 * sizeof(genericStack_t));
+  if (MARPAESLIF_UNLIKELY(stacksp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
+    return 0;
+  }
+
+  GENERICSTACK_INIT(&(stacksp[0]));
+  GENERICSTACK_INIT(&(stacksp[1]));
+  GENERICSTACK_INIT(&(stacksp[2]));
+
+  marpaESLIFRecognizerp->marpaESLIFValueResultWorkStackp = &(stacksp[0]);
+  marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp = &(stacksp[1]);
+  marpaESLIFRecognizerp->marpaESLIFValueResultStackNewp  = &(stacksp[2]);
+
+  return 1;
+}
+
 /*****************************************************************************/
 static inline int _marpaESLIFRecognizer_pointers_tracki(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFValueResultp, genericStack_t *marpaESLIFValueResultStackp)
 /*****************************************************************************/
@@ -23755,7 +26522,7 @@ static inline short _marpaESLIFRecognizer_pointers_cleanupb(marpaESLIFRecognizer
 /*****************************************************************************/
 {
   static const char       *funcs                           = "_marpaESLIFRecognizer_pointers_cleanupb";
-  genericStack_t          *marpaESLIFValueResultStackOrigp = marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp;
+  genericStack_t          *marpaESLIFValueResultStackOrigp;
   genericStack_t          *marpaESLIFValueResultStackNewp;
   marpaESLIFValueResult_t *marpaESLIFValueResultOrigTmpp;
   marpaESLIFValueResult_t *marpaESLIFValueResultNewTmpp;
@@ -23784,6 +26551,11 @@ static inline short _marpaESLIFRecognizer_pointers_cleanupb(marpaESLIFRecognizer
     goto done;
   }
 
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_valueResultStacksb(marpaESLIFRecognizerp))) {
+    goto err;
+  }
+  marpaESLIFValueResultStackOrigp = marpaESLIFRecognizerp->marpaESLIFValueResultStackOrigp;
+
   /* Track non-shallowed old marpaESLIFValueResult */
 #ifdef MARPAESLIF_NOTICE_ACTION
   MARPAESLIF_NOTICEF(marpaESLIFRecognizerp->marpaESLIFp, "%s: Tracking original non-shallowed pointers", funcs);
@@ -24031,6 +26803,278 @@ short marpaESLIFValueResult_is_negative_nanb(marpaESLIF_t *marpaESLIFp, marpaESL
   return _marpaESLIFValueResult_is_signed_nanb(marpaESLIFp, marpaESLIFValueResultp, 1 /* negativeb */, confidencebp);
 }
 
+/*****************************************************************************/
+static inline short _marpaESLIFValueResult_table_index_keyb(marpaESLIFValueResult_t *keyp, unsigned long *hashlp)
+/*****************************************************************************/
+/* Only keys that are compared byte per byte can be indexed: strings, arrays */
+/* and all the integer types. String encoding is not part of the key.        */
+/*****************************************************************************/
+{
+  unsigned char *bytep;
+  size_t         bytel;
+
+  switch (keyp->type) {
+  case MARPAESLIF_VALUE_TYPE_UNDEF:
+    bytep = NULL;
+    bytel = 0;
+    break;
+  case MARPAESLIF_VALUE_TYPE_CHAR:
+    bytep = (unsigned char *) &(keyp->u.c);
+    bytel = sizeof(keyp->u.c);
+    break;
+  case MARPAESLIF_VALUE_TYPE_SHORT:
+    bytep = (unsigned char *) &(keyp->u.b);
+    bytel = sizeof(keyp->u.b);
+    break;
+  case MARPAESLIF_VALUE_TYPE_INT:
+    bytep = (unsigned char *) &(keyp->u.i);
+    bytel = sizeof(keyp->u.i);
+    break;
+  case MARPAESLIF_VALUE_TYPE_LONG:
+    bytep = (unsigned char *) &(keyp->u.l);
+    bytel = sizeof(keyp->u.l);
+    break;
+  case MARPAESLIF_VALUE_TYPE_BOOL:
+    bytep = (unsigned char *) &(keyp->u.y);
+    bytel = sizeof(keyp->u.y);
+    break;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+  case MARPAESLIF_VALUE_TYPE_LONG_LONG:
+    bytep = (unsigned char *) &(keyp->u.ll);
+    bytel = sizeof(keyp->u.ll);
+    break;
+#endif
+  case MARPAESLIF_VALUE_TYPE_ARRAY:
+    bytep = (unsigned char *) keyp->u.a.p;
+    bytel = keyp->u.a.sizel;
+    break;
+  case MARPAESLIF_VALUE_TYPE_STRING:
+    bytep = keyp->u.s.p;
+    bytel = keyp->u.s.sizel;
+    break;
+  default:
+    return 0;
+  }
+
+  *hashlp = _marpaESLIF_hash_mixl(_marpaESLIF_djb2_s(bytep, bytel) ^ (unsigned long) keyp->type);
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValueResult_table_index_eqb(marpaESLIFValueResult_t *key1p, marpaESLIFValueResult_t *key2p)
+/*****************************************************************************/
+{
+  if (key1p->type != key2p->type) {
+    return 0;
+  }
+
+  switch (key1p->type) {
+  case MARPAESLIF_VALUE_TYPE_UNDEF:
+    return 1;
+  case MARPAESLIF_VALUE_TYPE_CHAR:
+    return (key1p->u.c == key2p->u.c) ? 1 : 0;
+  case MARPAESLIF_VALUE_TYPE_SHORT:
+    return (key1p->u.b == key2p->u.b) ? 1 : 0;
+  case MARPAESLIF_VALUE_TYPE_INT:
+    return (key1p->u.i == key2p->u.i) ? 1 : 0;
+  case MARPAESLIF_VALUE_TYPE_LONG:
+    return (key1p->u.l == key2p->u.l) ? 1 : 0;
+  case MARPAESLIF_VALUE_TYPE_BOOL:
+    return (key1p->u.y == key2p->u.y) ? 1 : 0;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+  case MARPAESLIF_VALUE_TYPE_LONG_LONG:
+    return (key1p->u.ll == key2p->u.ll) ? 1 : 0;
+#endif
+  case MARPAESLIF_VALUE_TYPE_ARRAY:
+    return ((key1p->u.a.sizel == key2p->u.a.sizel) && ((key1p->u.a.sizel <= 0) || (memcmp(key1p->u.a.p, key2p->u.a.p, key1p->u.a.sizel) == 0))) ? 1 : 0;
+  case MARPAESLIF_VALUE_TYPE_STRING:
+    return ((key1p->u.s.sizel == key2p->u.s.sizel) && ((key1p->u.s.sizel <= 0) || (memcmp(key1p->u.s.p, key2p->u.s.p, key1p->u.s.sizel) == 0))) ? 1 : 0;
+  default:
+    return 0;
+  }
+}
+
+/*****************************************************************************/
+static inline marpaESLIFValueResult_t *_marpaESLIFValueResult_table_index_resolvep(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, void *keyp)
+/*****************************************************************************/
+/* Keys in the hash are pair indices plus one, because the pairs may move,   */
+/* except the key being looked up that is given as is.                       */
+/*****************************************************************************/
+{
+  if (keyp == (void *) marpaESLIFValueResultTableIndexp->probep) {
+    return marpaESLIFValueResultTableIndexp->probep;
+  }
+
+  return &(marpaESLIFValueResultTableIndexp->marpaESLIFValueResultp->u.t.p[((size_t) keyp) - 1].key);
+}
+
+/*****************************************************************************/
+static unsigned long _marpaESLIFValueResult_table_index_hashl(void *userDatavp, void *keyp)
+/*****************************************************************************/
+{
+  unsigned long hashl = 0;
+
+  /* Callers have already checked that the key can be indexed */
+  _marpaESLIFValueResult_table_index_keyb(_marpaESLIFValueResult_table_index_resolvep((marpaESLIFValueResultTableIndex_t *) userDatavp, keyp), &hashl);
+
+  return hashl;
+}
+
+/*****************************************************************************/
+static short _marpaESLIFValueResult_table_index_cmpb(void *userDatavp, void *key1p, void *key2p)
+/*****************************************************************************/
+{
+  marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp = (marpaESLIFValueResultTableIndex_t *) userDatavp;
+
+  return _marpaESLIFValueResult_table_index_eqb(_marpaESLIFValueResult_table_index_resolvep(marpaESLIFValueResultTableIndexp, key1p),
+                                                _marpaESLIFValueResult_table_index_resolvep(marpaESLIFValueResultTableIndexp, key2p));
+}
+
+/*****************************************************************************/
+static inline marpaESLIFValueResultTableIndex_t *_marpaESLIFValueResult_table_index_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp = NULL;
+  size_t                             pairl;
+
+  marpaESLIFValueResultTableIndexp = (marpaESLIFValueResultTableIndex_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFValueResultTableIndex_t));
+  if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultTableIndexp == NULL)) {
+    MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+
+  marpaESLIFValueResultTableIndexp->marpaESLIFp            = marpaESLIFp;
+  marpaESLIFValueResultTableIndexp->marpaESLIFValueResultp = marpaESLIFValueResultp;
+  marpaESLIFValueResultTableIndexp->probep                 = NULL;
+  _marpaESLIF_hash_initv(marpaESLIFp, &(marpaESLIFValueResultTableIndexp->hash),
+                         marpaESLIFValueResultTableIndexp, /* userDatavp */
+                         _marpaESLIFValueResult_table_index_hashl,
+                         _marpaESLIFValueResult_table_index_cmpb,
+                         NULL, /* keyFreeFunctionp - key is a pair indice */
+                         NULL  /* valFreeFunctionp - value is the same pair indice */);
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIF_hash_reserveb(marpaESLIFp, &(marpaESLIFValueResultTableIndexp->hash), marpaESLIFValueResultp->u.t.sizel))) {
+    goto err;
+  }
+
+  for (pairl = 0; pairl < marpaESLIFValueResultp->u.t.sizel; pairl++) {
+    if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_addb(marpaESLIFValueResultTableIndexp, pairl))) {
+      goto err;
+    }
+  }
+
+  goto done;
+
+ err:
+  _marpaESLIFValueResult_table_index_freev(marpaESLIFp, marpaESLIFValueResultTableIndexp);
+  marpaESLIFValueResultTableIndexp = NULL;
+
+ done:
+  return marpaESLIFValueResultTableIndexp;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValueResult_table_index_lookupb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResultPair_t **pairpp)
+/*****************************************************************************/
+/* *pairpp is the pair of the key, or NULL.                                  */
+/*****************************************************************************/
+{
+  marpaESLIF_hashSlot_t *slotp;
+  unsigned long          hashl;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_keyb(keyp, &hashl))) {
+    MARPAESLIF_ERRORF(marpaESLIFValueResultTableIndexp->marpaESLIFp, "A key of type %s cannot be indexed", _marpaESLIF_value_types(keyp->type));
+    errno = EINVAL;
+    return 0;
+  }
+
+  if (marpaESLIFValueResultTableIndexp->hash.usedl <= 0) {
+    *pairpp = NULL;
+    return 1;
+  }
+
+  /* The hash is already known: the slot is searched directly */
+  marpaESLIFValueResultTableIndexp->probep = keyp;
+  slotp = _marpaESLIF_hash_slotp(&(marpaESLIFValueResultTableIndexp->hash), keyp, hashl);
+  marpaESLIFValueResultTableIndexp->probep = NULL;
+
+  *pairpp = (slotp->keyp != NULL) ? &(marpaESLIFValueResultTableIndexp->marpaESLIFValueResultp->u.t.p[((size_t) slotp->valp) - 1]) : NULL;
+  return 1;
+}
+
+/*****************************************************************************/
+static inline short _marpaESLIFValueResult_table_index_addb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, size_t pairl)
+/*****************************************************************************/
+/* When the key is already indexed, the new pair replaces the old one.       */
+/*****************************************************************************/
+{
+  marpaESLIFValueResult_t *keyp = &(marpaESLIFValueResultTableIndexp->marpaESLIFValueResultp->u.t.p[pairl].key);
+  unsigned long            hashl;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_keyb(keyp, &hashl))) {
+    MARPAESLIF_ERRORF(marpaESLIFValueResultTableIndexp->marpaESLIFp, "A key of type %s cannot be indexed", _marpaESLIF_value_types(keyp->type));
+    errno = EINVAL;
+    return 0;
+  }
+
+  return _marpaESLIF_hash_setb(marpaESLIFValueResultTableIndexp->marpaESLIFp, &(marpaESLIFValueResultTableIndexp->hash), (void *) (pairl + 1), (void *) (pairl + 1));
+}
+
+/*****************************************************************************/
+static inline void _marpaESLIFValueResult_table_index_freev(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp)
+/*****************************************************************************/
+{
+  if (marpaESLIFValueResultTableIndexp != NULL) {
+    _marpaESLIF_hash_resetv(marpaESLIFp, &(marpaESLIFValueResultTableIndexp->hash));
+    MARPAESLIF_FREE(marpaESLIFp, marpaESLIFValueResultTableIndexp);
+  }
+}
+
+/*****************************************************************************/
+marpaESLIFValueResultTableIndex_t *marpaESLIFValueResult_table_index_newp(marpaESLIF_t *marpaESLIFp, marpaESLIFValueResult_t *marpaESLIFValueResultp)
+/*****************************************************************************/
+{
+  if (MARPAESLIF_UNLIKELY((marpaESLIFp == NULL) || (marpaESLIFValueResultp == NULL) || (marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_TABLE))) {
+    errno = EINVAL;
+    return NULL;
+  }
+
+  return _marpaESLIFValueResult_table_index_newp(marpaESLIFp, marpaESLIFValueResultp);
+}
+
+/*****************************************************************************/
+short marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t **valuepp)
+/*****************************************************************************/
+{
+  marpaESLIFValueResultPair_t *pairp;
+  unsigned long                hashl;
+
+  if (MARPAESLIF_UNLIKELY((marpaESLIFValueResultTableIndexp == NULL) || (keyp == NULL) || (valuepp == NULL))) {
+    errno = EINVAL;
+    return 0;
+  }
+
+  /* A key that cannot be indexed cannot be in the index */
+  if (! _marpaESLIFValueResult_table_index_keyb(keyp, &hashl)) {
+    *valuepp = NULL;
+    return 1;
+  }
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFValueResult_table_index_lookupb(marpaESLIFValueResultTableIndexp, keyp, &pairp))) {
+    return 0;
+  }
+
+  *valuepp = (pairp != NULL) ? &(pairp->value) : NULL;
+  return 1;
+}
+
+/*****************************************************************************/
+void marpaESLIFValueResult_table_index_freev(marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp)
+/*****************************************************************************/
+{
+  _marpaESLIFValueResult_table_index_freev((marpaESLIFValueResultTableIndexp != NULL) ? marpaESLIFValueResultTableIndexp->marpaESLIFp : NULL, marpaESLIFValueResultTableIndexp);
+}
+
 /*****************************************************************************/
 static int _marpaESLIF_pcre2_callouti(pcre2_callout_block *blockp, void *userDatavp)
 /*****************************************************************************/
@@ -24070,14 +27114,14 @@ static int _marpaESLIF_pcre2_callouti(pcre2_callout_block *blockp, void *userDat
     /* Note that by definition offset_vectorl is > 0 here */
     if (marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.type == MARPAESLIF_VALUE_TYPE_UNDEF) {
       /* Creation */
-      marpaESLIFValueResultOvectorp = (marpaESLIFValueResult_t *) malloc(offset_vectorl * sizeof(marpaESLIFValueResult_t));
+      marpaESLIFValueResultOvectorp = (marpaESLIFValueResult_t *) MARPAESLIF_MALLOC(marpaESLIFRecognizerp->marpaESLIFp, offset_vectorl * sizeof(marpaESLIFValueResult_t));
       if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultOvectorp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
       }
     } else {
       /* Extension */
-      marpaESLIFValueResultOvectorp = (marpaESLIFValueResult_t *) realloc(marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.u.r.p, offset_vectorl * sizeof(marpaESLIFValueResult_t));
+      marpaESLIFValueResultOvectorp = (marpaESLIFValueResult_t *) MARPAESLIF_REALLOC(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.u.r.p, offset_vectorl * sizeof(marpaESLIFValueResult_t));
       if (MARPAESLIF_UNLIKELY(marpaESLIFValueResultOvectorp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFRecognizerp->marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -24173,7 +27217,7 @@ static int _marpaESLIF_pcre2_callout_enumeratei(pcre2_callout_enumerate_block *b
       MARPAESLIF_STRING_CREATESHOW(contextp->asciishowl, contextp->asciishows, "#  Str callout: ");
       asciis = _marpaESLIF_utf82printableascii_newp(contextp->marpaESLIFp, (char *) blockp->callout_string, (size_t) blockp->callout_string_length);
       MARPAESLIF_STRING_CREATESHOW(contextp->asciishowl, contextp->asciishows, asciis);
-      _marpaESLIF_utf82printableascii_freev(asciis);
+      _marpaESLIF_utf82printableascii_freev(contextp->marpaESLIFp, asciis);
     }
     MARPAESLIF_STRING_CREATESHOW(contextp->asciishowl, contextp->asciishows, "\n");
   }
@@ -24224,7 +27268,7 @@ static inline void  _marpaESLIFCalloutBlock_disposev(marpaESLIFRecognizer_t *mar
     if (marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.type == MARPAESLIF_VALUE_TYPE_ROW) {
       if (marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.u.r.p != NULL) {
         /* This is an array of marpaESLIFValueResult's, all of type LONG */
-        free(marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.u.r.p);
+        MARPAESLIF_FREE(marpaESLIFRecognizerp->marpaESLIFp, marpaESLIFValuePairsp[MARPAESLIFCALLOUTBLOCK_OFFSET_VECTOR].value.u.r.p);
       }
     }
   }
@@ -24303,7 +27347,7 @@ static inline marpaESLIFSymbol_t *_marpaESLIFSymbol_terminal_newp(marpaESLIF_t *
       goto err;
     }
     /* Replace description */
-    _marpaESLIF_string_freev(terminalp->descp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, terminalp->descp, 0 /* onStackb */);
     terminalp->descp = descp;
     descp = NULL; /* descp is now in terminalp */
   }
@@ -24323,14 +27367,14 @@ static inline marpaESLIFSymbol_t *_marpaESLIFSymbol_terminal_newp(marpaESLIF_t *
 
  done:
   if (utf8p != stringp) {
-    _marpaESLIF_string_freev(utf8p, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, utf8p, 0 /* onStackb */);
   }
   if (utf8Substitutionp != stringp) {
-    _marpaESLIF_string_freev(utf8Substitutionp, 0 /* onStackb */);
+    _marpaESLIF_string_freev(marpaESLIFp, utf8Substitutionp, 0 /* onStackb */);
   }
-  _marpaESLIF_terminal_freev(terminalp);
-  _marpaESLIF_terminal_freev(substitutionTerminalp);
-  _marpaESLIF_string_freev(descp, 0 /* onStackb */);
+  _marpaESLIF_terminal_freev(marpaESLIFp, terminalp);
+  _marpaESLIF_terminal_freev(marpaESLIFp, substitutionTerminalp);
+  _marpaESLIF_string_freev(marpaESLIFp, descp, 0 /* onStackb */);
 
   return symbolp;
 }
@@ -24362,8 +27406,8 @@ static inline marpaESLIFSymbol_t *__marpaESLIFSymbol_meta_newp(marpaESLIF_t *mar
     goto err;
   }
 
-  /* We just duplicate symbol and mark it as a duplicate of another - this is used in _marpaESLIF_symbol_freev() */
-  symbolp = (marpaESLIF_symbol_t *) malloc(sizeof(marpaESLIF_symbol_t));
+  /* We just duplicate symbol and mark it as a duplicate of another - this is used in _marpaESLIF_symbol_freev(marpaESLIFp, ) */
+  symbolp = (marpaESLIF_symbol_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_symbol_t));
   if (MARPAESLIF_UNLIKELY(symbolp == NULL)) {
     goto err;
   }
@@ -24533,7 +27577,7 @@ static inline short _marpaESLIFSymbol_tryb(marpaESLIFSymbol_t *marpaESLIFSymbolp
   marpaESLIF_streamp->inputl = inputl;
   marpaESLIF_streamp->eofb   = 1;
 
-  rcb = __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, marpaESLIFSymbolp, matchbp);
+  rcb = __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, marpaESLIFSymbolp, matchbp, NULL /* matchedLengthlp */);
   goto done;
 
  err:
@@ -24579,14 +27623,14 @@ short marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecogni
 static inline short _marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp)
 /*****************************************************************************/
 {
-  return __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, marpaESLIFSymbolp, matchbp);
+  return __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizerp, marpaESLIFSymbolp, matchbp, NULL /* matchedLengthlp */);
 }
 
 /*****************************************************************************/
 void marpaESLIFSymbol_freev(marpaESLIFSymbol_t *marpaESLIFSymbolp)
 /*****************************************************************************/
 {
-  _marpaESLIF_symbol_freev(marpaESLIFSymbolp);
+  _marpaESLIF_symbol_freev((marpaESLIFSymbolp != NULL) ? marpaESLIFSymbolp->marpaESLIFp : NULL, marpaESLIFSymbolp);
 }
 
 #ifdef MARPAESLIF_NAN
@@ -24655,7 +27699,7 @@ short marpaESLIFRecognizer_progressb(marpaESLIFRecognizer_t *marpaESLIFRecognize
   if (marpaESLIFRecognizerProgressl > 0) {
     /* Make sure we have enough storage */
     if (marpaESLIFRecognizerp->progressallocl == 0) {
-      marpaESLIFRecognizerProgressp = (marpaESLIFRecognizerProgress_t *) malloc(sizeof(marpaESLIFRecognizerProgress_t) * marpaESLIFRecognizerProgressl);
+      marpaESLIFRecognizerProgressp = (marpaESLIFRecognizerProgress_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIFRecognizerProgress_t) * marpaESLIFRecognizerProgressl);
       if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerProgressp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -24663,7 +27707,7 @@ short marpaESLIFRecognizer_progressb(marpaESLIFRecognizer_t *marpaESLIFRecognize
       marpaESLIFRecognizerp->progressallocl = marpaESLIFRecognizerProgressl;
       marpaESLIFRecognizerp->progressp      = marpaESLIFRecognizerProgressp;
     } else if (marpaESLIFRecognizerProgressl > marpaESLIFRecognizerp->progressallocl) {
-      marpaESLIFRecognizerProgressp = (marpaESLIFRecognizerProgress_t *) realloc(marpaESLIFRecognizerp->progressp, sizeof(marpaESLIFRecognizerProgress_t) * marpaESLIFRecognizerProgressl);
+      marpaESLIFRecognizerProgressp = (marpaESLIFRecognizerProgress_t *) MARPAESLIF_REALLOC(marpaESLIFp, marpaESLIFRecognizerp->progressp, sizeof(marpaESLIFRecognizerProgress_t) * marpaESLIFRecognizerProgressl);
       if (MARPAESLIF_UNLIKELY(marpaESLIFRecognizerProgressp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -24769,6 +27813,8 @@ static inline void _marpaESLIFRecognizer_errorv(marpaESLIFRecognizer_t *marpaESL
   char                 *dumps;
   size_t                dumpl;
   
+  _marpaESLIF_stream_locationv(marpaESLIF_streamp);
+
   MARPAESLIF_ERROR(marpaESLIFp, "");
   MARPAESLIF_ERROR(marpaESLIFp, "--------------------------------------------");
   MARPAESLIF_ERRORF(marpaESLIFp, "Recognizer progress (grammar level %d (%s)):", grammarp->leveli, grammarp->descp->asciis);
@@ -24887,7 +27933,7 @@ static inline marpaESLIF_lua_functiondecl_t *_marpaESLIF_lua_functiondecl_newp(m
 {
   marpaESLIF_lua_functiondecl_t *declp;
 
-  declp = (marpaESLIF_lua_functiondecl_t *) malloc(sizeof(marpaESLIF_lua_functiondecl_t));
+  declp = (marpaESLIF_lua_functiondecl_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_lua_functiondecl_t));
   if (MARPAESLIF_UNLIKELY(declp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -24900,7 +27946,7 @@ static inline marpaESLIF_lua_functiondecl_t *_marpaESLIF_lua_functiondecl_newp(m
   goto done;
 
  err:
-  _marpaESLIF_lua_functiondecl_freev(declp);
+  _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, declp);
   declp = NULL;
 
  done:
@@ -24913,7 +27959,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_newp(m
 {
   marpaESLIF_lua_functioncall_t *callp;
 
-  callp = (marpaESLIF_lua_functioncall_t *) malloc(sizeof(marpaESLIF_lua_functioncall_t));
+  callp = (marpaESLIF_lua_functioncall_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_lua_functioncall_t));
   if (MARPAESLIF_UNLIKELY(callp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -24926,7 +27972,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_newp(m
   goto done;
 
  err:
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFp, callp);
   callp = NULL;
 
  done:
@@ -24939,13 +27985,13 @@ static inline marpaESLIF_lua_functiondecl_t *_marpaESLIF_lua_functiondecl_clonep
 {
   marpaESLIF_lua_functiondecl_t *clonep;
 
-  clonep = (marpaESLIF_lua_functiondecl_t *) malloc(sizeof(marpaESLIF_lua_functiondecl_t));
+  clonep = (marpaESLIF_lua_functiondecl_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_lua_functiondecl_t));
   if (MARPAESLIF_UNLIKELY(clonep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
 
-  clonep->luaparlists = strdup(declp->luaparlists);
+  clonep->luaparlists = MARPAESLIF_STRDUP(marpaESLIFp, declp->luaparlists);
   if (MARPAESLIF_UNLIKELY(clonep->luaparlists == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -24956,7 +28002,7 @@ static inline marpaESLIF_lua_functiondecl_t *_marpaESLIF_lua_functiondecl_clonep
   goto done;
 
  err:
-  _marpaESLIF_lua_functiondecl_freev(clonep);
+  _marpaESLIF_lua_functiondecl_freev(marpaESLIFp, clonep);
   clonep = NULL;
 
  done:
@@ -24969,13 +28015,13 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_clonep
 {
   marpaESLIF_lua_functioncall_t *clonep;
 
-  clonep = (marpaESLIF_lua_functioncall_t *) malloc(sizeof(marpaESLIF_lua_functioncall_t));
+  clonep = (marpaESLIF_lua_functioncall_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_lua_functioncall_t));
   if (MARPAESLIF_UNLIKELY(clonep == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
   }
 
-  clonep->luaexplists = strdup(callp->luaexplists);
+  clonep->luaexplists = MARPAESLIF_STRDUP(marpaESLIFp, callp->luaexplists);
   if (MARPAESLIF_UNLIKELY(clonep->luaexplists == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -24986,7 +28032,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functioncall_clonep
   goto done;
 
  err:
-  _marpaESLIF_lua_functioncall_freev(clonep);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFp, clonep);
   clonep = NULL;
 
  done:
@@ -24999,7 +28045,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functiondecl2callp(
 {
   marpaESLIF_lua_functioncall_t *callp;
 
-  callp = (marpaESLIF_lua_functioncall_t *) malloc(sizeof(marpaESLIF_lua_functioncall_t));
+  callp = (marpaESLIF_lua_functioncall_t *) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(marpaESLIF_lua_functioncall_t));
   if (MARPAESLIF_UNLIKELY(callp == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -25009,7 +28055,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functiondecl2callp(
   callp->luaexplistcb = declp->luaparlistcb;
   callp->sizei        = declp->sizei;
 
-  callp->luaexplists  = strdup(declp->luaparlists);
+  callp->luaexplists  = MARPAESLIF_STRDUP(marpaESLIFp, declp->luaparlists);
   if (MARPAESLIF_UNLIKELY(callp->luaexplists == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "strdup failure, %s", strerror(errno));
     goto err;
@@ -25018,7 +28064,7 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functiondecl2callp(
   goto done;
 
  err:
-  _marpaESLIF_lua_functioncall_freev(callp);
+  _marpaESLIF_lua_functioncall_freev(marpaESLIFp, callp);
   callp = NULL;
 
  done:
@@ -25026,26 +28072,26 @@ static inline marpaESLIF_lua_functioncall_t *_marpaESLIF_lua_functiondecl2callp(
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_lua_functiondecl_freev(marpaESLIF_lua_functiondecl_t *declp)
+static inline void _marpaESLIF_lua_functiondecl_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functiondecl_t *declp)
 /*****************************************************************************/
 {
   if (declp != NULL) {
     if (declp->luaparlists != NULL) {
-      free(declp->luaparlists);
+      MARPAESLIF_FREE(marpaESLIFp, declp->luaparlists);
     }
-    free(declp);
+    MARPAESLIF_FREE(marpaESLIFp, declp);
   }
 }
 
 /*****************************************************************************/
-static inline void _marpaESLIF_lua_functioncall_freev(marpaESLIF_lua_functioncall_t *callp)
+static inline void _marpaESLIF_lua_functioncall_freev(marpaESLIF_t *marpaESLIFp, marpaESLIF_lua_functioncall_t *callp)
 /*****************************************************************************/
 {
   if (callp != NULL) {
     if (callp->luaexplists != NULL) {
-      free(callp->luaexplists);
+      MARPAESLIF_FREE(marpaESLIFp, callp->luaexplists);
     }
-    free(callp);
+    MARPAESLIF_FREE(marpaESLIFp, callp);
   }
 }
 
@@ -25114,10 +28160,10 @@ static inline short _marpaESLIFRecognizer_eventb(marpaESLIFRecognizer_t *marpaES
 }
 
 /*****************************************************************************/
-static inline short _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, char **pausesp, size_t *pauselp)
+static inline short _marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *names, int symboli, char **pausesp, size_t *pauselp)
 /*****************************************************************************/
 {
-  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, names, pausesp, pauselp, marpaESLIFRecognizerp->lastPausepp, 1 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_NA, 0 /* onlyLhsb */, 1 /* onlyRhsb */);
+  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, names, symboli, pausesp, pauselp, marpaESLIFRecognizerp->lastPausepp, 1 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_NA, 0 /* onlyLhsb */, 1 /* onlyRhsb */);
 }
 
 /*****************************************************************************/
@@ -25198,7 +28244,7 @@ static inline short _marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t
 
     /* Prepare/use internal buffer */
     if (namesArrayAllocl <= 0) {
-      tmpsp = (char **) malloc(sizeof(char **) * nNamel);
+      tmpsp = (char **) MARPAESLIF_MALLOC(marpaESLIFp, sizeof(char **) * nNamel);
       if (MARPAESLIF_UNLIKELY(tmpsp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
         goto err;
@@ -25207,7 +28253,7 @@ static inline short _marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t
       namesArrayp      = marpaESLIFRecognizerp->namesArrayp      = tmpsp;
     } else if (nNamel > namesArrayAllocl) {
       tmpl  = namesArrayAllocl * 2;
-      tmpsp = (char **) realloc(namesArrayp, sizeof(char **) * tmpl);
+      tmpsp = (char **) MARPAESLIF_REALLOC(marpaESLIFp, namesArrayp, sizeof(char **) * tmpl);
       if (MARPAESLIF_UNLIKELY(tmpsp == NULL)) {
         MARPAESLIF_ERRORF(marpaESLIFp, "realloc failure, %s", strerror(errno));
         goto err;
@@ -25242,11 +28288,46 @@ static inline short _marpaESLIFRecognizer_name_expectedb(marpaESLIFRecognizer_t
   return rcb;
 }
 
+/*****************************************************************************/
+static inline short _marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, size_t *nSymbollp, int *symbolArrayip, size_t symbolArrayAllocl, size_t *generationlp)
+/*****************************************************************************/
+{
+  size_t                nTerminall;
+  int                  *symbolIdArrayp;
+  marpaESLIF_symbol_t **symbolArraypp;
+  short                 rcb;
+
+  if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_expectedTerminalsb(marpaESLIFRecognizerp, &nTerminall, &symbolIdArrayp, &symbolArraypp))) {
+    goto err;
+  }
+
+  /* The ids are copied: symbolIdArrayp is a buffer shared by all the recognizers on this grammar */
+  if (symbolArrayAllocl > 0) {
+    memcpy(symbolArrayip, symbolIdArrayp, sizeof(int) * ((nTerminall < symbolArrayAllocl) ? nTerminall : symbolArrayAllocl));
+  }
+
+  if (nSymbollp != NULL) {
+    *nSymbollp = nTerminall;
+  }
+  if (generationlp != NULL) {
+    *generationlp = marpaESLIFRecognizerp->expectedGenerationl;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  return rcb;
+}
+
 /*****************************************************************************/
 static inline short _marpaESLIFRecognizer_discard_last_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char **trysp, size_t *trylp)
 /*****************************************************************************/
 {
-  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, ":discard", trysp, trylp, marpaESLIFRecognizerp->lastTrypp, 0 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_META, 1 /* onlyLhsb */, 0 /* onlyRhsb */);
+  return _marpaESLIFRecognizer_last_symbolDatab(marpaESLIFRecognizerp, ":discard", -1 /* symboli */, trysp, trylp, marpaESLIFRecognizerp->lastTrypp, 0 /* forPauseb */, MARPAESLIF_SYMBOL_TYPE_META, 1 /* onlyLhsb */, 0 /* onlyRhsb */);
 }
 
 /*****************************************************************************/
@@ -25293,7 +28374,7 @@ static inline short _marpaESLIFRecognizer_alternativeb(marpaESLIFRecognizer_t *m
 }
 
 /*****************************************************************************/
-static inline short __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp)
+static inline short __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFSymbol_t *marpaESLIFSymbolp, short *matchbp, size_t *matchedLengthlp)
 /*****************************************************************************/
 {
   static const char          *funcs = "__marpaESLIFRecognizer_symbol_tryb";
@@ -25322,7 +28403,7 @@ static inline short __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *m
                                                        0, /* maxStartCompletionsi */
                                                        NULL, /* lastSizeBeforeCompletionlp */
                                                        NULL, /* numberOfStartCompletionsip */
-                                                       NULL /* matchedLengthl */);
+                                                       matchedLengthlp);
     if (MARPAESLIF_UNLIKELY(! _marpaESLIFRecognizer_shareb(marpaESLIFRecognizerTmpp, NULL))) {
       goto err;
     }
@@ -25336,7 +28417,7 @@ static inline short __marpaESLIFRecognizer_symbol_tryb(marpaESLIFRecognizer_t *m
                                                        0, /* maxStartCompletionsi */
                                                        NULL, /* lastSizeBeforeCompletionlp */
                                                        NULL, /* numberOfStartCompletionsip */
-                                                       NULL /* matchedLengthlp */);
+                                                       matchedLengthlp);
   }
 
   if (rcMatcherb < 0) {
@@ -25427,6 +28508,25 @@ static short _marpaESLIFRecognizerSymbolProxyImportb(marpaESLIFRecognizer_t *mar
     1;
 }
 
+/*****************************************************************************/
+static inline size_t _marpaESLIF_substitution_refl(char *patterns, size_t patternl)
+/*****************************************************************************/
+/* Every reference to a match in a replacement starts with '$': the number   */
+/* of '$' is an upper bound of the number of references.                     */
+/*****************************************************************************/
+{
+  size_t refl = 0;
+  size_t i;
+
+  for (i = 0; i < patternl; i++) {
+    if (patterns[i] == '$') {
+      refl++;
+    }
+  }
+
+  return refl;
+}
+
 /*****************************************************************************/
 static marpaESLIF_string_t *_marpaESLIF_terminal_add_substitution_desc_to_terminal_descp(marpaESLIF_t *marpaESLIFp, marpaESLIF_terminal_t *terminalp, marpaESLIF_terminal_t *substitutionTerminalp)
 /*****************************************************************************/
@@ -25443,6 +28543,7 @@ static marpaESLIF_string_t *_marpaESLIF_terminal_add_substitution_desc_to_termin
   terminalp->substitutionPatterns  = substitutionTerminalp->patterns;
   terminalp->substitutionPatternl  = substitutionTerminalp->patternl;
   terminalp->substitutionPatterni  = substitutionTerminalp->patterni;
+  terminalp->substitutionRefl      = _marpaESLIF_substitution_refl(substitutionTerminalp->patterns, substitutionTerminalp->patternl);
 
   substitutionTerminalp->utf8s     = NULL; /* it is now in terminalp */
   substitutionTerminalp->modifiers = NULL; /* it is now in terminalp */
@@ -25451,7 +28552,7 @@ static marpaESLIF_string_t *_marpaESLIF_terminal_add_substitution_desc_to_termin
   /* We also want to overwrite the terminal description to include the substitution */
   /* We revisit the ASCII version of the description */
   asciil = strlen(terminalp->descp->asciis) + 4 /* " -> " */ + strlen(substitutionTerminalp->descp->asciis);
-  asciis = (char *) malloc(asciil + 1); /* + 1 for NUL byte */
+  asciis = (char *) MARPAESLIF_MALLOC(marpaESLIFp, asciil + 1); /* + 1 for NUL byte */
   if (MARPAESLIF_UNLIKELY(asciis == NULL)) {
     MARPAESLIF_ERRORF(marpaESLIFp, "malloc failure, %s", strerror(errno));
     goto err;
@@ -25476,12 +28577,12 @@ static marpaESLIF_string_t *_marpaESLIF_terminal_add_substitution_desc_to_termin
   goto done;
 
  err:
-  _marpaESLIF_string_freev(rcp, 0 /* onStackb */);
+  _marpaESLIF_string_freev(marpaESLIFp, rcp, 0 /* onStackb */);
   rcp = NULL;
 
  done:
   if (asciis != NULL) {
-    free(asciis);
+    MARPAESLIF_FREE(marpaESLIFp, asciis);
   }
   return rcp;
 }
@@ -25490,4 +28591,5 @@ static marpaESLIF_string_t *_marpaESLIF_terminal_add_substitution_desc_to_termin
 #include "lua.c"
 #include "json.c"
 #include "floattos.c"
+#include "cbor.c"
 
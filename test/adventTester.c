@@ -116,6 +116,7 @@ int main() {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -174,6 +175,7 @@ int main() {
       marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
       marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
       marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+      marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
       marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
       if (marpaESLIFRecognizerp == NULL) {
@@ -448,6 +450,9 @@ static short manage_eventsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, gener
   char   *cards = NULL;
   char   *pauses;
   size_t  pausel;
+  char   *byIdPauses;
+  size_t  byIdPausel;
+  int     cardSymboli;
   int     cardi;
   short   isWSb;
   short   rcb;
@@ -457,6 +462,19 @@ static short manage_eventsb(marpaESLIFRecognizer_t *marpaESLIFRecognizerp, gener
     goto err;
   }
 
+  /* The same information must be available using the symbol id */
+  if (! marpaESLIFGrammar_symbolid_currentb(marpaESLIFRecognizer_grammarp(marpaESLIFRecognizerp), "card", &cardSymboli)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "Failed to get <card> symbol id");
+    goto err;
+  }
+  if (! marpaESLIFRecognizer_name_last_pause_by_idb(marpaESLIFRecognizerp, cardSymboli, &byIdPauses, &byIdPausel)) {
+    goto err;
+  }
+  if ((byIdPauses != pauses) || (byIdPausel != pausel)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Pause for <card> by id %d differs from pause by name", cardSymboli);
+    goto err;
+  }
+
   /* We arbitrarily transform card data into a number to uniquely identify it */
   cardi = card2inti(pauses, pausel);
   cards = int2cards(genericLoggerp, cardi);
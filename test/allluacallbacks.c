@@ -100,6 +100,7 @@ int main() {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -148,6 +149,7 @@ int main() {
     marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
     marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
     marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+    marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
     marpaESLIFValueOption.userDatavp            = genericLoggerp; /* User specific context */
     marpaESLIFValueOption.ruleActionResolverp   = NULL; /* Will return the function doing the wanted rule action */
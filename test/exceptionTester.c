@@ -71,6 +71,7 @@ int main() {
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_DEBUG);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -99,6 +100,7 @@ int main() {
   marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   for (i = 0; i < sizeof(testdata)/sizeof(testdata[0]); i++) {
     marpaESLIFTester_context.genericLoggerp = genericLoggerp;
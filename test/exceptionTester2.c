@@ -36,6 +36,7 @@ int main() {
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_DEBUG);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -65,6 +66,7 @@ int main() {
   marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   /*
    * /\d+/ - '23'
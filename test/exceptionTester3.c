@@ -34,6 +34,7 @@ int main() {
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_DEBUG);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -63,6 +64,7 @@ int main() {
   marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   /*
    * /\w/* - ( 'A':i | 'ABC':i)
@@ -0,0 +1,152 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <genericLogger.h>
+#include <marpaESLIF.h>
+
+/* Microbenchmark of the internal hash, through the table index that uses it, */
+/* against a linear scan of the table. The core caches use the same hash but  */
+/* are not reachable from the API, so they are not timed directly. It is      */
+/* built with the testers but not run by the test suite: run it by hand.      */
+
+#define HASHBENCHMARK_MAXPAIR  262144
+#define HASHBENCHMARK_LOOKUPL  2000000
+#define HASHBENCHMARK_SCANMAXL 200000000 /* Maximum number of key comparisons for the linear scan */
+
+static short hashBenchmarkb(genericLogger_t *genericLoggerp, marpaESLIF_t *marpaESLIFp, marpaESLIFValueResultPair_t *pairs, size_t pairl);
+
+int main() {
+  genericLogger_t             *genericLoggerp;
+  marpaESLIF_t                *marpaESLIFp = NULL;
+  marpaESLIFOption_t           marpaESLIFOption;
+  marpaESLIFValueResultPair_t *pairs       = NULL;
+  char                        *keys        = NULL;
+  size_t                       pairl;
+  size_t                       i;
+  int                          exiti;
+
+  genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_INFO);
+
+  memset(&marpaESLIFOption, 0, sizeof(marpaESLIFOption));
+  marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
+  marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
+  if (marpaESLIFp == NULL) {
+    goto err;
+  }
+
+  pairs = (marpaESLIFValueResultPair_t *) calloc(HASHBENCHMARK_MAXPAIR, sizeof(marpaESLIFValueResultPair_t));
+  keys  = (char *) malloc(HASHBENCHMARK_MAXPAIR * 8);
+  if ((pairs == NULL) || (keys == NULL)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  for (i = 0; i < HASHBENCHMARK_MAXPAIR; i++) {
+    sprintf(&(keys[i * 8]), "k%d", (int) i);
+    pairs[i].key.type         = MARPAESLIF_VALUE_TYPE_STRING;
+    pairs[i].key.u.s.p        = (unsigned char *) &(keys[i * 8]);
+    pairs[i].key.u.s.sizel    = strlen(&(keys[i * 8]));
+    pairs[i].key.u.s.shallowb = 1;
+    pairs[i].value.type       = MARPAESLIF_VALUE_TYPE_INT;
+    pairs[i].value.u.i        = (int) i;
+  }
+
+  GENERICLOGGER_INFO(genericLoggerp, " entries     index    linear scan");
+  for (pairl = 8; pairl <= HASHBENCHMARK_MAXPAIR; pairl *= 8) {
+    if (! hashBenchmarkb(genericLoggerp, marpaESLIFp, pairs, pairl)) {
+      goto err;
+    }
+  }
+
+  exiti = 0;
+  goto done;
+
+ err:
+  exiti = 1;
+
+ done:
+  if (keys != NULL) {
+    free(keys);
+  }
+  if (pairs != NULL) {
+    free(pairs);
+  }
+  marpaESLIF_freev(marpaESLIFp);
+  GENERICLOGGER_FREE(genericLoggerp);
+  exit(exiti);
+}
+
+/****************************************************************************/
+static short hashBenchmarkb(genericLogger_t *genericLoggerp, marpaESLIF_t *marpaESLIFp, marpaESLIFValueResultPair_t *pairs, size_t pairl)
+/****************************************************************************/
+{
+  marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp = NULL;
+  marpaESLIFValueResult_t            table;
+  marpaESLIFValueResult_t           *keyp;
+  marpaESLIFValueResult_t           *valuep;
+  size_t                             lookupl;
+  size_t                             scanl;
+  size_t                             i;
+  size_t                             j;
+  long                               checksuml = 0;
+  clock_t                            startc;
+  double                             indexd;
+  double                             scand;
+  short                              rcb;
+
+  memset(&table, 0, sizeof(table));
+  table.type         = MARPAESLIF_VALUE_TYPE_TABLE;
+  table.u.t.p        = pairs;
+  table.u.t.sizel    = pairl;
+  table.u.t.shallowb = 1;
+
+  marpaESLIFValueResultTableIndexp = marpaESLIFValueResult_table_index_newp(marpaESLIFp, &table);
+  if (marpaESLIFValueResultTableIndexp == NULL) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_table_index_newp failure");
+    goto err;
+  }
+
+  /* Keys are looked up in a scattered order */
+  lookupl = HASHBENCHMARK_LOOKUPL;
+  startc  = clock();
+  for (i = 0; i < lookupl; i++) {
+    keyp = &(pairs[(i * 7919) % pairl].key);
+    if (! marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndexp, keyp, &valuep) || (valuep == NULL)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_table_index_getb failure");
+      goto err;
+    }
+    checksuml += valuep->u.i;
+  }
+  indexd = ((double) (clock() - startc) * 1000000000.) / ((double) CLOCKS_PER_SEC * (double) lookupl);
+
+  /* The linear scan gets fewer lookups so that it stays bounded */
+  scanl  = HASHBENCHMARK_SCANMAXL / pairl;
+  if (scanl > lookupl) {
+    scanl = lookupl;
+  }
+  startc = clock();
+  for (i = 0; i < scanl; i++) {
+    keyp = &(pairs[(i * 7919) % pairl].key);
+    for (j = 0; j < pairl; j++) {
+      if ((pairs[j].key.u.s.sizel == keyp->u.s.sizel) && (memcmp(pairs[j].key.u.s.p, keyp->u.s.p, keyp->u.s.sizel) == 0)) {
+        checksuml += pairs[j].value.u.i;
+        break;
+      }
+    }
+  }
+  scand = ((double) (clock() - startc) * 1000000000.) / ((double) CLOCKS_PER_SEC * (double) scanl);
+
+  GENERICLOGGER_INFOF(genericLoggerp, "%8lu %8.1f ns %11.1f ns (checksum %ld)", (unsigned long) pairl, indexd, scand, checksuml);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFValueResult_table_index_freev(marpaESLIFValueResultTableIndexp);
+  return rcb;
+}
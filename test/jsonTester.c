@@ -54,6 +54,7 @@ int main(int argc, char **argv) {
   }
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -97,6 +98,11 @@ int main(int argc, char **argv) {
   marpaESLIFJSONDecodeOption.positiveNanActionp              = NULL; /* +Nan action */
   marpaESLIFJSONDecodeOption.negativeNanActionp              = NULL; /* -Nan action */
   marpaESLIFJSONDecodeOption.numberActionp                   = NULL; /* Number action */
+  marpaESLIFJSONDecodeOption.valueCallbackp                  = NULL; /* Value callback */
+  marpaESLIFJSONDecodeOption.valueDepthl                     = 0; /* Value callback depth */
+  marpaESLIFJSONDecodeOption.multipleb                       = 0; /* Sequence of documents */
+  marpaESLIFJSONDecodeOption.pathsp                          = NULL; /* Paths of the values to keep */
+  marpaESLIFJSONDecodeOption.pathl                           = 0; /* Number of paths */
 #endif
 
   test_elementp = &(tests[0]);
@@ -199,6 +205,7 @@ int main(int argc, char **argv) {
     marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
     marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
     marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+    marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
     marpaESLIFValueOption.userDatavp            = NULL; /* User specific context */
     marpaESLIFValueOption.ruleActionResolverp   = NULL; /* Will return the function doing the wanted rule action */
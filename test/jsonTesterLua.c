@@ -454,6 +454,7 @@ int main() {
   valueContext.genericLoggerp = genericLoggerp;
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -498,6 +499,7 @@ int main() {
     marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
     marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
     marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+    marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
     /* Free previous round */
     if (marpaESLIFValuep != NULL) {
@@ -182,6 +182,7 @@ int main() {
     goto err;
   }
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -225,6 +226,7 @@ int main() {
     marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
     marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
     marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+    marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
     marpaESLIFRecognizerJsonp = marpaESLIFRecognizer_newp(marpaESLIFGrammarArrayp[JSON], &marpaESLIFRecognizerOption);
     if (marpaESLIFRecognizerJsonp == NULL) {
@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
+#include <limits.h>
+#include <locale.h>
 #include <genericLogger.h>
 #include <marpaESLIF.h>
 
@@ -13,6 +15,49 @@ static short                           inputReaderb(void *userDatavp, char **inp
 static short                           eventManagerb(int *eventCountip, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, genericLogger_t *genericLoggerp);
 static void                            genericLoggerCallback(void *userDatavp, genericLoggerLevel_t logLeveli, const char *msgs);
 static short                           alternativeRepresentation(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, char **inputcpp, size_t *inputlp, char **encodingasciisp, marpaESLIFRepresentationDispose_t *disposeCallbackpp, short *stringbp);
+static short                           walkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp);
+static short                           flatastImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
+static short                           cborb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           partitionb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           valueStackCacheb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           partitionWalkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp);
+static short                           tableIndexb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           jsonStreamb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           jsonStreamImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
+static short                           jsonStreamWriterb(void *userDatavp, char *bytep, size_t bytel);
+static short                           jsonEventb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           jsonEventCallbackb(void *userDatavp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t *valuep);
+static short                           jsonProjectb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           jsonProjectCallbackb(void *userDatavp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t *valuep);
+static short                           recoverb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           recoverImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
+static short                           recoverErrorb(void *userDatavp, marpaESLIFRecoveryError_t *marpaESLIFRecoveryErrorp);
+static short                           recoverReaderb(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp);
+static short                           allocatorb(genericLogger_t *genericLoggerp);
+static short                           allocatorRunb(genericLogger_t *genericLoggerp, void *allocator_contextvp);
+static void                            allocatorReleasev(void *allocator_contextvp);
+static short                           memoryb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           resolverb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           numberb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           numberLongb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           regexPrefilterb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           substitutionb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           substitutionImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
+static short                           lineColumnb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           lineColumnCheckb(genericLogger_t *genericLoggerp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp);
+static void                            lineColumnEagerv(const char *inputs, size_t inputl, size_t *linelp, size_t *columnlp);
+static short                           utf8Passthroughb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           eventMaskb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+static short                           eventMaskRunb(genericLogger_t *genericLoggerp, marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFEventType_t eventSeti, void *recordsp, size_t *recordlp);
+static short                           chunkReaderb(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp);
+static marpaESLIFRecognizerRegexCallback_t regexPrefilterCalloutResolverp(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *actions);
+static short                           regexPrefilterCalloutb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFCalloutBlockp, marpaESLIFValueResultInt_t *marpaESLIFValueResultOutp);
+static marpaESLIFValueRuleCallback_t   resolverRuleActionResolverp(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, char *actions);
+static short                           resolverRuleActionb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, int arg0i, int argni, int resulti, short nullableb);
+static void                           *allocatorMallocp(void *userDatavp, size_t sizel);
+static void                           *allocatorReallocp(void *userDatavp, void *p, size_t sizel);
+static void                            allocatorFreev(void *userDatavp, void *p);
+static void                            outputFreev(marpaESLIF_t *marpaESLIFp, void *p);
 short                                  importb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb);
 
 typedef struct marpaESLIFTester_context {
@@ -21,6 +66,8 @@ typedef struct marpaESLIFTester_context {
   size_t           inputl;
   char            *values;
   size_t           valuel;
+  int              nodei;
+  int              nbNodei;
 } marpaESLIFTester_context_t;
 
 const static char *myContexts;
@@ -88,6 +135,10 @@ int main() {
   const static char            *inputs = "    abc! 123de@:@f\r\nX";
   short                         rcValueb;
   int                           eventCounti = 0;
+  marpaESLIFEventType_t         eventSeti;
+  size_t                        nSymbolIdl;
+  int                           symbolIdArrayi[64];
+  size_t                        generationl;
   size_t                        nSymboll;
   size_t                        symboll;
   char                        **symbolsArrayp;
@@ -108,6 +159,7 @@ int main() {
   genericLoggerp = genericLogger_newp(genericLoggerCallback, NULL /* userDatavp */, GENERICLOGGER_LOGLEVEL_INFO);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -319,6 +371,7 @@ int main() {
   marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
   if (marpaESLIFRecognizerp == NULL) {
@@ -344,12 +397,24 @@ int main() {
       (marpaESLIFRecognizerOption.buftriggerperci          != marpaESLIFRecognizerOption.buftriggerperci) ||
       (marpaESLIFRecognizerOption.bufaddperci              != marpaESLIFRecognizerOption.bufaddperci) ||
       (marpaESLIFRecognizerOption.ifActionResolverp        != marpaESLIFRecognizerOption.ifActionResolverp) ||
-      (marpaESLIFRecognizerOption.generatorActionResolverp != marpaESLIFRecognizerOption.generatorActionResolverp)
+      (marpaESLIFRecognizerOption.generatorActionResolverp != marpaESLIFRecognizerOption.generatorActionResolverp) ||
+      (marpaESLIFRecognizerOption.maxMemoryl               != marpaESLIFRecognizerOption.maxMemoryl)
       ) {
     GENERICLOGGER_ERROR(marpaESLIFOption.genericLoggerp, "marpaESLIFRecognizer_optionp does have the correct content");
     goto err;
   }
 
+  /* By default a recognizer is subscribed to all event types */
+  if (! marpaESLIFRecognizer_event_maskb(marpaESLIFRecognizerp,
+                                         MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_BEFORE|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD,
+                                         &eventSeti)) {
+    goto err;
+  }
+  if (eventSeti != (MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_BEFORE|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIFRecognizer_event_maskb returned default event set 0x%x", (unsigned int) eventSeti);
+    goto err;
+  }
+
   genericLogger_logLevel_seti(genericLoggerp, GENERICLOGGER_LOGLEVEL_TRACE);
   if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
     goto err;
@@ -414,6 +479,24 @@ int main() {
     for (symboll = 0; symboll < nSymboll; symboll++) {
       GENERICLOGGER_INFOF(marpaESLIFOption.genericLoggerp, "Symbol name expected: %s", symbolsArrayp[symboll]);
     }
+    /* Same thing using symbol ids */
+    if (! marpaESLIFRecognizer_name_expected_by_idb(marpaESLIFRecognizerp, &nSymbolIdl, symbolIdArrayi, sizeof(symbolIdArrayi) / sizeof(symbolIdArrayi[0]), &generationl)) {
+      goto err;
+    }
+    if (nSymbolIdl != nSymboll) {
+      GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "%ld symbol ids expected but %ld symbol names", (unsigned long) nSymbolIdl, (unsigned long) nSymboll);
+      goto err;
+    }
+    for (symboll = 0; (symboll < nSymbolIdl) && (symboll < sizeof(symbolIdArrayi) / sizeof(symbolIdArrayi[0])); symboll++) {
+      if (! marpaESLIFGrammar_symbolproperty_currentb(marpaESLIFGrammarp, symbolIdArrayi[symboll], &symbolProperty)) {
+        goto err;
+      }
+      if (strcmp(symbolProperty.descp->asciis, symbolsArrayp[symboll]) != 0) {
+        GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "Symbol id %d expected is %s, not %s", symbolIdArrayi[symboll], symbolProperty.descp->asciis, symbolsArrayp[symboll]);
+        goto err;
+      }
+    }
+    GENERICLOGGER_INFOF(marpaESLIFOption.genericLoggerp, "Expected symbols generation: %ld", (unsigned long) generationl);
     
     if (! eventManagerb(&eventCounti, marpaESLIFRecognizerp, genericLoggerp)) {
       goto err;
@@ -475,6 +558,103 @@ int main() {
     }
   }
 
+  /* Walk the same parse tree: every rule reduces its children to one node, so exactly one node must remain */
+  marpaESLIFValue_freev(marpaESLIFValuep);
+  marpaESLIFValuep = marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption);
+  if (marpaESLIFValuep == NULL) {
+    goto err;
+  }
+  marpaESLIFTester_context.nodei   = 0;
+  marpaESLIFTester_context.nbNodei = 0;
+  if (marpaESLIFValue_walkb(marpaESLIFValuep, walkb) <= 0) {
+    GENERICLOGGER_ERROR(marpaESLIFOption.genericLoggerp, "marpaESLIFValue_walkb failure");
+    goto err;
+  }
+  if (marpaESLIFTester_context.nodei != 1) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIFValue_walkb left %d nodes instead of 1", marpaESLIFTester_context.nodei);
+    goto err;
+  }
+
+  /* Same tree as a flat AST */
+  marpaESLIFValue_freev(marpaESLIFValuep);
+  marpaESLIFValueOption.importerp = flatastImportb;
+  marpaESLIFValuep = marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption);
+  if (marpaESLIFValuep == NULL) {
+    goto err;
+  }
+  if (marpaESLIFValue_flatastb(marpaESLIFValuep, 1 /* poolb */) <= 0) {
+    GENERICLOGGER_ERROR(marpaESLIFOption.genericLoggerp, "marpaESLIFValue_flatastb failure");
+    goto err;
+  }
+
+  if (! cborb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! partitionb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! valueStackCacheb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! tableIndexb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! jsonStreamb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! jsonEventb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! jsonProjectb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! recoverb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! allocatorb(marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! memoryb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! resolverb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! numberb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! regexPrefilterb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! substitutionb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! lineColumnb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! utf8Passthroughb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
+  if (! eventMaskb(marpaESLIFp, marpaESLIFOption.genericLoggerp)) {
+    goto err;
+  }
+
   exiti = 0;
   goto done;
 
@@ -563,6 +743,86 @@ static marpaESLIFValueSymbolCallback_t symbolActionResolverp(void *userDatavp, m
   return marpaESLIFValueSymbolCallbackp;
 }
 
+/****************************************************************************/
+static short walkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp)
+/****************************************************************************/
+{
+  marpaESLIFTester_context_t *marpaESLIFTester_contextp = (marpaESLIFTester_context_t *) userDatavp;
+
+  switch (marpaESLIFValueWalkp->type) {
+  case MARPAESLIF_VALUE_WALK_LEXEME:
+    if (marpaESLIFValueWalkp->lexemep == NULL) {
+      return 0;
+    }
+    marpaESLIFTester_contextp->nodei++;
+    break;
+  case MARPAESLIF_VALUE_WALK_NULLED:
+    marpaESLIFTester_contextp->nodei++;
+    break;
+  case MARPAESLIF_VALUE_WALK_RULE:
+    if (marpaESLIFValueWalkp->nbChildreni > marpaESLIFTester_contextp->nodei) {
+      return 0;
+    }
+    marpaESLIFTester_contextp->nodei -= marpaESLIFValueWalkp->nbChildreni - 1;
+    break;
+  default:
+    return 0;
+  }
+
+  marpaESLIFTester_contextp->nbNodei++;
+  return 1;
+}
+
+/****************************************************************************/
+static short flatastImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/****************************************************************************/
+{
+  marpaESLIFTester_context_t   *marpaESLIFTester_contextp = (marpaESLIFTester_context_t *) userDatavp;
+  marpaESLIFValueFlatAst_t     *flatastp;
+  marpaESLIFValueFlatAstNode_t *nodep;
+  size_t                        nodel;
+  size_t                        childl;
+  size_t                        sizel;
+  size_t                        pooll;
+  int                           i;
+
+  if (marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_ARRAY) {
+    GENERICLOGGER_ERRORF(marpaESLIFTester_contextp->genericLoggerp, "flat AST type is %d instead of ARRAY", marpaESLIFValueResultp->type);
+    return 0;
+  }
+
+  flatastp = (marpaESLIFValueFlatAst_t *) marpaESLIFValueResultp->u.a.p;
+  nodep    = (marpaESLIFValueFlatAstNode_t *) (flatastp + 1);
+  if ((flatastp->nbNodel != (size_t) marpaESLIFTester_contextp->nbNodei) || (nodep[0].sizel != flatastp->nbNodel)) {
+    GENERICLOGGER_ERRORF(marpaESLIFTester_contextp->genericLoggerp, "flat AST has %ld nodes, root size %ld, walk had %d nodes", (unsigned long) flatastp->nbNodel, (unsigned long) nodep[0].sizel, marpaESLIFTester_contextp->nbNodei);
+    return 0;
+  }
+
+  /* In preorder, children follow their parent and are contiguous */
+  pooll = 0;
+  for (nodel = 0; nodel < flatastp->nbNodel; nodel++) {
+    sizel  = 1;
+    childl = nodel + 1;
+    for (i = 0; i < nodep[nodel].nbChildreni; i++) {
+      sizel  += nodep[childl].sizel;
+      childl += nodep[childl].sizel;
+    }
+    if (sizel != nodep[nodel].sizel) {
+      GENERICLOGGER_ERRORF(marpaESLIFTester_contextp->genericLoggerp, "flat AST node %ld has size %ld, its children say %ld", (unsigned long) nodel, (unsigned long) nodep[nodel].sizel, (unsigned long) sizel);
+      return 0;
+    }
+    pooll += nodep[nodel].poolLengthl;
+  }
+  if (pooll != flatastp->poolLengthl) {
+    GENERICLOGGER_ERRORF(marpaESLIFTester_contextp->genericLoggerp, "flat AST string pool has %ld bytes, nodes say %ld", (unsigned long) flatastp->poolLengthl, (unsigned long) pooll);
+    return 0;
+  }
+
+  GENERICLOGGER_INFOF(marpaESLIFTester_contextp->genericLoggerp, "Flat AST import: %ld nodes, %ld bytes in string pool", (unsigned long) flatastp->nbNodel, (unsigned long) flatastp->poolLengthl);
+
+  return 1;
+}
+
 /****************************************************************************/
 static short default_meta_actionb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, int arg0i, int argni, int resulti, short nullableb)
 /****************************************************************************/
@@ -845,3 +1105,2860 @@ short importb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFV
 
   return 1;
 }
+
+/****************************************************************************/
+#define CBOR_DEPTH 100000
+static short cborb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* { "s": "caf\xc3\xa9", "l": <ISO-8859-1 string>, "r": [ -1, 0.1L, 1.5, true, undef, 4294967296, { 12, 3 } ] } */
+  static const struct {
+    const char    *descs;
+    unsigned char  bytes[16];
+    size_t         bytel;
+  } hostiles[] = {
+    { "map of 2^63+1 pairs",             { 0xBB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01 }, 11 },
+    { "array of 2^64-1 items",           { 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 }, 10 },
+    { "map of 2^32 pairs",               { 0xBB, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01 }, 11 },
+    { "truncated 8-byte length",         { 0x9B, 0x00, 0x00, 0x00 }, 4 },
+    { "truncated 8-byte string length",  { 0x7B, 0xFF, 0xFF }, 3 },
+    { "string longer than the input",    { 0x7B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41 }, 10 }
+  };
+  marpaESLIFValueResult_t      row[7];
+  marpaESLIFValueResultPair_t  pairs[3];
+  marpaESLIFValueResult_t      table;
+  marpaESLIFValueResult_t     *decodedp = NULL;
+  char                        *bytes    = NULL;
+  char                        *deeps    = NULL;
+  size_t                       bytel;
+  char                        *keys     = "slr";
+  marpaESLIFValueResult_t     *valuep;
+  size_t                       i;
+  short                        rcb;
+
+  memset(row, 0, sizeof(row));
+  memset(pairs, 0, sizeof(pairs));
+  memset(&table, 0, sizeof(table));
+
+  row[0].type = MARPAESLIF_VALUE_TYPE_INT;
+  row[0].u.i  = -1;
+  row[1].type = MARPAESLIF_VALUE_TYPE_LONG_DOUBLE;
+  row[1].u.ld = 0.1L;
+  row[2].type = MARPAESLIF_VALUE_TYPE_DOUBLE;
+  row[2].u.d  = 1.5;
+  row[3].type = MARPAESLIF_VALUE_TYPE_BOOL;
+  row[3].u.y  = MARPAESLIFVALUERESULTBOOL_TRUE;
+  row[4].type = MARPAESLIF_VALUE_TYPE_UNDEF;
+  row[5].type = MARPAESLIF_VALUE_TYPE_DOUBLE;
+  row[5].u.d  = 4294967296.;
+  row[6].type = MARPAESLIF_VALUE_TYPE_OFFSET_AND_LENGTH;
+  row[6].u.o.p     = 12;
+  row[6].u.o.sizel = 3;
+
+  for (i = 0; i < 3; i++) {
+    pairs[i].key.type             = MARPAESLIF_VALUE_TYPE_STRING;
+    pairs[i].key.u.s.p            = (unsigned char *) &(keys[i]);
+    pairs[i].key.u.s.sizel        = 1;
+    pairs[i].key.u.s.shallowb     = 1;
+  }
+  pairs[0].value.type                 = MARPAESLIF_VALUE_TYPE_STRING;
+  pairs[0].value.u.s.p                = (unsigned char *) "caf\xc3\xa9";
+  pairs[0].value.u.s.sizel            = 5;
+  pairs[0].value.u.s.shallowb         = 1;
+  pairs[0].value.u.s.encodingasciis   = "UTF-8";
+  pairs[1].value.type                 = MARPAESLIF_VALUE_TYPE_STRING;
+  pairs[1].value.u.s.p                = (unsigned char *) "caf\xe9";
+  pairs[1].value.u.s.sizel            = 4;
+  pairs[1].value.u.s.shallowb         = 1;
+  pairs[1].value.u.s.encodingasciis   = "ISO-8859-1";
+  pairs[2].value.type                 = MARPAESLIF_VALUE_TYPE_ROW;
+  pairs[2].value.u.r.p                = row;
+  pairs[2].value.u.r.sizel            = 7;
+  pairs[2].value.u.r.shallowb         = 1;
+
+  table.type       = MARPAESLIF_VALUE_TYPE_TABLE;
+  table.u.t.p      = pairs;
+  table.u.t.sizel  = 3;
+  table.u.t.shallowb = 1;
+
+  if (! marpaESLIFValueResult_cbor_encodeb(marpaESLIFp, &table, &bytes, &bytel)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_cbor_encodeb failure");
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "CBOR encoding is %ld bytes", (unsigned long) bytel);
+
+  if (! marpaESLIFValueResult_cbor_decodeb(marpaESLIFp, bytes, bytel, &decodedp)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_cbor_decodeb failure");
+    goto err;
+  }
+
+  if ((decodedp->type != MARPAESLIF_VALUE_TYPE_TABLE) || (decodedp->u.t.sizel != 3)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: root is not a table of 3 pairs");
+    goto err;
+  }
+  for (i = 0; i < 3; i++) {
+    if ((decodedp->u.t.p[i].key.type != MARPAESLIF_VALUE_TYPE_STRING) || (decodedp->u.t.p[i].key.u.s.sizel != 1) || (decodedp->u.t.p[i].key.u.s.p[0] != (unsigned char) keys[i])) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "CBOR round-trip: bad key No %ld", (unsigned long) i);
+      goto err;
+    }
+  }
+  if ((decodedp->u.t.p[0].value.type != MARPAESLIF_VALUE_TYPE_STRING) || (strcmp((char *) decodedp->u.t.p[0].value.u.s.p, "caf\xc3\xa9") != 0) || (strcmp(decodedp->u.t.p[0].value.u.s.encodingasciis, "UTF-8") != 0)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad UTF-8 string");
+    goto err;
+  }
+  if ((decodedp->u.t.p[1].value.type != MARPAESLIF_VALUE_TYPE_STRING) || (strcmp((char *) decodedp->u.t.p[1].value.u.s.p, "caf\xe9") != 0) || (strcmp(decodedp->u.t.p[1].value.u.s.encodingasciis, "ISO-8859-1") != 0)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad ISO-8859-1 string");
+    goto err;
+  }
+  if ((decodedp->u.t.p[2].value.type != MARPAESLIF_VALUE_TYPE_ROW) || (decodedp->u.t.p[2].value.u.r.sizel != 7)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad row");
+    goto err;
+  }
+  /* Integers come back with the smallest type */
+  if ((decodedp->u.t.p[2].value.u.r.p[0].type != MARPAESLIF_VALUE_TYPE_SHORT) || (decodedp->u.t.p[2].value.u.r.p[0].u.b != -1)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad integer");
+    goto err;
+  }
+  /* Long doubles are exact */
+  if ((decodedp->u.t.p[2].value.u.r.p[1].type != MARPAESLIF_VALUE_TYPE_LONG_DOUBLE) || (decodedp->u.t.p[2].value.u.r.p[1].u.ld != 0.1L)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad long double");
+    goto err;
+  }
+  if ((decodedp->u.t.p[2].value.u.r.p[2].type != MARPAESLIF_VALUE_TYPE_DOUBLE) || (decodedp->u.t.p[2].value.u.r.p[2].u.d != 1.5)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad double");
+    goto err;
+  }
+  if ((decodedp->u.t.p[2].value.u.r.p[3].type != MARPAESLIF_VALUE_TYPE_BOOL) || (decodedp->u.t.p[2].value.u.r.p[3].u.y != MARPAESLIFVALUERESULTBOOL_TRUE)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad boolean");
+    goto err;
+  }
+  if (decodedp->u.t.p[2].value.u.r.p[4].type != MARPAESLIF_VALUE_TYPE_UNDEF) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad undef");
+    goto err;
+  }
+  if ((decodedp->u.t.p[2].value.u.r.p[5].type != MARPAESLIF_VALUE_TYPE_DOUBLE) || (decodedp->u.t.p[2].value.u.r.p[5].u.d != 4294967296.)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad large double");
+    goto err;
+  }
+  if ((decodedp->u.t.p[2].value.u.r.p[6].type != MARPAESLIF_VALUE_TYPE_OFFSET_AND_LENGTH) || (decodedp->u.t.p[2].value.u.r.p[6].u.o.p != 12) || (decodedp->u.t.p[2].value.u.r.p[6].u.o.sizel != 3)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR round-trip: bad offset and length");
+    goto err;
+  }
+
+  /* Truncated input must be rejected */
+  outputFreev(marpaESLIFp, decodedp);
+  decodedp = NULL;
+  if (marpaESLIFValueResult_cbor_decodeb(marpaESLIFp, bytes, bytel - 1, &decodedp)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR decoding of a truncated input succeeded");
+    goto err;
+  }
+
+  /* Hostile headers must be rejected */
+  for (i = 0; i < sizeof(hostiles) / sizeof(hostiles[0]); i++) {
+    if (marpaESLIFValueResult_cbor_decodeb(marpaESLIFp, (char *) hostiles[i].bytes, hostiles[i].bytel, &decodedp)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "CBOR decoding of a %s succeeded", hostiles[i].descs);
+      goto err;
+    }
+  }
+
+  /* Deep nesting: N arrays of one item around a 0 decode, N arrays of two items are truncated */
+  deeps = (char *) malloc(CBOR_DEPTH + 1);
+  if (deeps == NULL) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  memset(deeps, 0x81, CBOR_DEPTH);
+  deeps[CBOR_DEPTH] = 0x00;
+  if (! marpaESLIFValueResult_cbor_decodeb(marpaESLIFp, deeps, CBOR_DEPTH + 1, &decodedp)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR decoding of deeply nested arrays failure");
+    goto err;
+  }
+  for (i = 0, valuep = decodedp; i < CBOR_DEPTH; i++, valuep = valuep->u.r.p) {
+    if ((valuep->type != MARPAESLIF_VALUE_TYPE_ROW) || (valuep->u.r.sizel != 1)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "CBOR decoding of deeply nested arrays: bad level %ld", (unsigned long) i);
+      goto err;
+    }
+  }
+  outputFreev(marpaESLIFp, decodedp);
+  decodedp = NULL;
+  memset(deeps, 0x82, CBOR_DEPTH);
+  if (marpaESLIFValueResult_cbor_decodeb(marpaESLIFp, deeps, CBOR_DEPTH + 1, &decodedp)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "CBOR decoding of a nested bomb succeeded");
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (decodedp != NULL) {
+    outputFreev(marpaESLIFp, decodedp);
+  }
+  if (bytes != NULL) {
+    outputFreev(marpaESLIFp, bytes);
+  }
+  if (deeps != NULL) {
+    free(deeps);
+  }
+  return rcb;
+}
+
+#define PARTITION_NTREE 14 /* Number of binary trees with 5 leaves */
+typedef struct partition_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context;
+  char                       signatures[128]; /* Parse tree shape: start and length of every rule */
+  size_t                     signaturel;
+} partition_context_t;
+
+/****************************************************************************/
+static short partitionb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Highly ambiguous grammar: parse trees are walked sequentially, then by partitions of 3 */
+  static const char            *dsls = "S ::= S S | 'a'\n";
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp    = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFValue_t            *marpaESLIFValuep      = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  partition_context_t           partition_context;
+  char                          signatures[PARTITION_NTREE][128];
+  short                         continueb;
+  short                         exhaustedb;
+  short                         rcWalkb;
+  int                           nparti;
+  int                           parti;
+  int                           treei;
+  int                           ntreei;
+  short                         rcb;
+
+  memset(&partition_context, 0, sizeof(partition_context));
+  partition_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  partition_context.marpaESLIFTester_context.inputs         = "aaaaa";
+  partition_context.marpaESLIFTester_context.inputl         = 5;
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  /* Many values in sequence on the same grammar */
+  if (! marpaESLIFGrammar_value_stack_cacheb(marpaESLIFGrammarp, 1)) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &(partition_context.marpaESLIFTester_context);
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  marpaESLIFValueOption.userDatavp    = &partition_context;
+  marpaESLIFValueOption.highRankOnlyb = 1;
+  marpaESLIFValueOption.orderByRankb  = 1;
+  marpaESLIFValueOption.ambiguousb    = 1;
+
+  /* nparti == 1 is the sequential reference */
+  for (nparti = 1; nparti <= 3; nparti += 2) {
+    ntreei = 0;
+    for (parti = 0; parti < nparti; parti++) {
+      /* Independent instances, as if each partition was in its own thread */
+      marpaESLIFValue_freev(marpaESLIFValuep);
+      marpaESLIFValuep = NULL;
+      marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+      marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+      if (marpaESLIFRecognizerp == NULL) {
+        goto err;
+      }
+      if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+        goto err;
+      }
+      while (continueb) {
+        if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+          goto err;
+        }
+      }
+      marpaESLIFValuep = marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption);
+      if (marpaESLIFValuep == NULL) {
+        goto err;
+      }
+      if (! marpaESLIFValue_partitionb(marpaESLIFValuep, parti, nparti)) {
+        goto err;
+      }
+
+      for (treei = parti; ; treei += nparti) {
+        partition_context.signatures[0] = '\0';
+        partition_context.signaturel    = 0;
+        rcWalkb = marpaESLIFValue_walkb(marpaESLIFValuep, partitionWalkb);
+        if (rcWalkb < 0) {
+          goto err;
+        }
+        if (rcWalkb == 0) {
+          break;
+        }
+        if (treei >= PARTITION_NTREE) {
+          GENERICLOGGER_ERRORF(genericLoggerp, "More than %d parse trees", PARTITION_NTREE);
+          goto err;
+        }
+        if (nparti == 1) {
+          strcpy(signatures[treei], partition_context.signatures);
+        } else if (strcmp(signatures[treei], partition_context.signatures) != 0) {
+          GENERICLOGGER_ERRORF(genericLoggerp, "Partition %d/%d: parse tree No %d is %s instead of %s", parti, nparti, treei, partition_context.signatures, signatures[treei]);
+          goto err;
+        }
+        ntreei++;
+      }
+    }
+    if (ntreei != PARTITION_NTREE) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "%d partition(s): %d parse trees instead of %d", nparti, ntreei, PARTITION_NTREE);
+      goto err;
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "%d partition(s): %d parse trees", nparti, ntreei);
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFValue_freev(marpaESLIFValuep);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+#define VALUESTACKCACHE_MAXL 400
+/****************************************************************************/
+static short valueStackCacheb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Values in sequence on the same grammar, with a value stack larger than */
+  /* its inline storage: the cached buffer is kept, replaced, then adopted. */
+  static const char            *dsls      = "S ::= A+\nA ::= 'a'\n";
+  static const size_t           inputls[] = { 200, VALUESTACKCACHE_MAXL, 100 };
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp    = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFValue_t            *marpaESLIFValuep      = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  marpaESLIFTester_context_t    marpaESLIFTester_context;
+  char                          inputs[VALUESTACKCACHE_MAXL];
+  size_t                        i;
+  short                         rcb;
+
+  memset(inputs, 'a', sizeof(inputs));
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  if (! marpaESLIFGrammar_value_stack_cacheb(marpaESLIFGrammarp, 1)) {
+    goto err;
+  }
+
+  memset(&marpaESLIFTester_context, 0, sizeof(marpaESLIFTester_context));
+  marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  marpaESLIFTester_context.inputs         = inputs;
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &marpaESLIFTester_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  marpaESLIFValueOption.highRankOnlyb = 1;
+  marpaESLIFValueOption.orderByRankb  = 1;
+
+  for (i = 0; i < sizeof(inputls) / sizeof(inputls[0]); i++) {
+    marpaESLIFTester_context.inputl = inputls[i];
+    marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+    if (marpaESLIFRecognizerp == NULL) {
+      goto err;
+    }
+    if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 0 /* initialEventsb */, NULL /* continuebp */, NULL /* exhaustedbp */)) {
+      goto err;
+    }
+    marpaESLIFValuep = marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption);
+    if (marpaESLIFValuep == NULL) {
+      goto err;
+    }
+    if (marpaESLIFValue_valueb(marpaESLIFValuep) <= 0) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Value stack cache: valuation failure on %lu bytes", (unsigned long) inputls[i]);
+      goto err;
+    }
+    marpaESLIFValue_freev(marpaESLIFValuep);
+    marpaESLIFValuep = NULL;
+    marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+    marpaESLIFRecognizerp = NULL;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFValue_freev(marpaESLIFValuep);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short partitionWalkb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, marpaESLIFValueWalk_t *marpaESLIFValueWalkp)
+/****************************************************************************/
+{
+  partition_context_t *partition_contextp = (partition_context_t *) userDatavp;
+  int                  lengthi;
+
+  if (marpaESLIFValueWalkp->type == MARPAESLIF_VALUE_WALK_RULE) {
+    lengthi = snprintf(partition_contextp->signatures + partition_contextp->signaturel, sizeof(partition_contextp->signatures) - partition_contextp->signaturel, "%d.%d ", marpaESLIFValueWalkp->starti, marpaESLIFValueWalkp->lengthi);
+    if ((lengthi < 0) || ((size_t) lengthi >= sizeof(partition_contextp->signatures) - partition_contextp->signaturel)) {
+      return 0;
+    }
+    partition_contextp->signaturel += (size_t) lengthi;
+  }
+
+  return 1;
+}
+
+#define TABLEINDEX_NPAIR 1000
+/****************************************************************************/
+static short tableIndexb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Keys "0" to "999", then "7" again: the last occurence wins */
+  static const char                 *dupjsons              = "{\"a\": 1, \"b\": 2, \"a\": 3}";
+  marpaESLIFValueResultPair_t       *pairs                 = NULL;
+  char                              *keys                  = NULL;
+  marpaESLIFValueResultTableIndex_t *marpaESLIFValueResultTableIndexp = NULL;
+  marpaESLIFGrammar_t               *marpaESLIFJSONp       = NULL;
+  marpaESLIFValueResult_t            table;
+  marpaESLIFValueResult_t            key;
+  marpaESLIFValueResult_t           *valuep;
+  marpaESLIFJSONDecodeOption_t       marpaESLIFJSONDecodeOption;
+  marpaESLIFRecognizerOption_t       marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t            marpaESLIFValueOption;
+  marpaESLIFTester_context_t         marpaESLIFTester_context;
+  char                              *bigjsons              = NULL;
+  size_t                             bigjsonl;
+  char                               unknowns[16];
+  short                              dupb;
+  size_t                             i;
+  short                              rcb;
+
+  pairs = (marpaESLIFValueResultPair_t *) calloc(TABLEINDEX_NPAIR + 1, sizeof(marpaESLIFValueResultPair_t));
+  keys  = (char *) malloc((TABLEINDEX_NPAIR + 1) * 4);
+  if ((pairs == NULL) || (keys == NULL)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  for (i = 0; i <= TABLEINDEX_NPAIR; i++) {
+    sprintf(&(keys[i * 4]), "%d", (int) ((i < TABLEINDEX_NPAIR) ? i : 7));
+    pairs[i].key.type         = MARPAESLIF_VALUE_TYPE_STRING;
+    pairs[i].key.u.s.p        = (unsigned char *) &(keys[i * 4]);
+    pairs[i].key.u.s.sizel    = strlen(&(keys[i * 4]));
+    pairs[i].key.u.s.shallowb = 1;
+    pairs[i].value.type       = MARPAESLIF_VALUE_TYPE_INT;
+    pairs[i].value.u.i        = (int) i;
+  }
+
+  memset(&table, 0, sizeof(table));
+  table.type         = MARPAESLIF_VALUE_TYPE_TABLE;
+  table.u.t.p        = pairs;
+  table.u.t.sizel    = TABLEINDEX_NPAIR + 1;
+  table.u.t.shallowb = 1;
+
+  marpaESLIFValueResultTableIndexp = marpaESLIFValueResult_table_index_newp(marpaESLIFp, &table);
+  if (marpaESLIFValueResultTableIndexp == NULL) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_table_index_newp failure");
+    goto err;
+  }
+
+  for (i = 0; i < TABLEINDEX_NPAIR; i++) {
+    if (! marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndexp, &(pairs[i].key), &valuep)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_table_index_getb failure");
+      goto err;
+    }
+    if ((valuep == NULL) || (valuep->u.i != ((i == 7) ? TABLEINDEX_NPAIR : (int) i))) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Table index: bad value for key \"%s\"", &(keys[i * 4]));
+      goto err;
+    }
+  }
+
+  /* Same bytes but another type, then unknown bytes */
+  key = pairs[1].key;
+  key.type = MARPAESLIF_VALUE_TYPE_ARRAY;
+  key.u.a.p = (char *) pairs[1].key.u.s.p;
+  key.u.a.sizel = pairs[1].key.u.s.sizel;
+  if ((! marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndexp, &key, &valuep)) || (valuep != NULL)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "Table index: an ARRAY key matches a STRING key");
+    goto err;
+  }
+  /* Unknown keys: with a load factor up to one half, most of them go through collision chains */
+  for (i = TABLEINDEX_NPAIR; i < (TABLEINDEX_NPAIR * 10); i++) {
+    sprintf(unknowns, "%d", (int) i);
+    key = pairs[1].key;
+    key.u.s.p = (unsigned char *) unknowns;
+    key.u.s.sizel = strlen(unknowns);
+    if ((! marpaESLIFValueResult_table_index_getb(marpaESLIFValueResultTableIndexp, &key, &valuep)) || (valuep != NULL)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Table index: unknown key \"%s\" is found", unknowns);
+      goto err;
+    }
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Table index: %d keys found, %d unknown keys not found", TABLEINDEX_NPAIR, TABLEINDEX_NPAIR * 9);
+
+  /* JSON decoder relies on the same index for duplicate keys */
+  marpaESLIFJSONp = marpaESLIFJSON_decode_newp(marpaESLIFp, 1 /* strictb */);
+  if (marpaESLIFJSONp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFTester_context, 0, sizeof(marpaESLIFTester_context));
+  marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  marpaESLIFTester_context.inputs         = (char *) dupjsons;
+  marpaESLIFTester_context.inputl         = strlen(dupjsons);
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &marpaESLIFTester_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  memset(&marpaESLIFJSONDecodeOption, 0, sizeof(marpaESLIFJSONDecodeOption));
+
+  if (! marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder failure with duplicate keys allowed");
+    goto err;
+  }
+  marpaESLIFJSONDecodeOption.disallowDupkeysb = 1;
+  if (marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder success with duplicate keys disallowed");
+    goto err;
+  }
+  GENERICLOGGER_INFO(genericLoggerp, "JSON decoder: duplicate key is rejected");
+
+  /* The decoder index starts empty and grows with the object: all keys distinct, then the first one repeated at the end */
+  bigjsons = (char *) malloc(TABLEINDEX_NPAIR * 16 + 16);
+  if (bigjsons == NULL) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  for (dupb = 0; dupb <= 1; dupb++) {
+    strcpy(bigjsons, "{");
+    bigjsonl = 1;
+    for (i = 0; i <= TABLEINDEX_NPAIR; i++) {
+      if ((i == TABLEINDEX_NPAIR) && (! dupb)) {
+        break;
+      }
+      bigjsonl += (size_t) sprintf(bigjsons + bigjsonl, "%s\"%d\":%d", (i > 0) ? "," : "", (int) ((i < TABLEINDEX_NPAIR) ? i : 0), (int) i);
+    }
+    strcpy(bigjsons + bigjsonl, "}");
+    bigjsonl++;
+    marpaESLIFTester_context.inputs = bigjsons;
+    marpaESLIFTester_context.inputl = bigjsonl;
+    if (marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption) == dupb) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "JSON decoder: object of %d keys %s", TABLEINDEX_NPAIR, dupb ? "with a duplicate key is accepted" : "is rejected");
+      goto err;
+    }
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "JSON decoder: object of %d keys is accepted, duplicate key at the end is rejected", TABLEINDEX_NPAIR);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (bigjsons != NULL) {
+    free(bigjsons);
+  }
+  marpaESLIFGrammar_freev(marpaESLIFJSONp);
+  marpaESLIFValueResult_table_index_freev(marpaESLIFValueResultTableIndexp);
+  if (keys != NULL) {
+    free(keys);
+  }
+  if (pairs != NULL) {
+    free(pairs);
+  }
+  return rcb;
+}
+
+#define JSONSTREAM_MAXL 1024
+typedef struct jsonStream_context {
+  char   s[JSONSTREAM_MAXL];
+  size_t l;
+  size_t chunkl; /* Largest chunk given to the writer */
+} jsonStream_context_t;
+
+/****************************************************************************/
+static short jsonStreamb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* { "s": "a\"b\n\xc3\xa9\xf0\x9f\x98\x80", "r": [ -12, 1.5, +Infinity, true, undef, { 3: "x" } ] } */
+  static const char            *expecteds[2] = { /* Indexed by strictb */
+    "{\"s\":\"a\\\"b\\n\\u00e9\\ud83d\\ude00\",\"r\":[-12,1.5,+Infinity,true,null,{\"3\":\"x\"}]}",
+    "{\"s\":\"a\\\"b\\n\\u00e9\\ud83d\\ude00\",\"r\":[-12,1.5,null,true,null,{\"3\":\"x\"}]}"
+  };
+  marpaESLIFValueResult_t       row[6];
+  marpaESLIFValueResultPair_t   pairs[2];
+  marpaESLIFValueResultPair_t   subpair;
+  marpaESLIFValueResult_t       subtable;
+  marpaESLIFValueResult_t       table;
+  marpaESLIFGrammar_t          *marpaESLIFJSONp = NULL;
+  char                         *bytes           = NULL;
+  size_t                        bytel;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  marpaESLIFJSONEncodeOption_t  marpaESLIFJSONEncodeOption;
+  jsonStream_context_t          jsonStream_context;
+  int                           strictb;
+  short                         rcb;
+
+  memset(row, 0, sizeof(row));
+  memset(pairs, 0, sizeof(pairs));
+  memset(&subpair, 0, sizeof(subpair));
+  memset(&subtable, 0, sizeof(subtable));
+  memset(&table, 0, sizeof(table));
+
+  subpair.key.type           = MARPAESLIF_VALUE_TYPE_INT;
+  subpair.key.u.i            = 3;
+  subpair.value.type         = MARPAESLIF_VALUE_TYPE_STRING;
+  subpair.value.u.s.p        = (unsigned char *) "x";
+  subpair.value.u.s.sizel    = 1;
+  subpair.value.u.s.shallowb = 1;
+  subpair.value.u.s.encodingasciis = "UTF-8";
+  subtable.type              = MARPAESLIF_VALUE_TYPE_TABLE;
+  subtable.u.t.p             = &subpair;
+  subtable.u.t.sizel         = 1;
+  subtable.u.t.shallowb      = 1;
+
+  row[0].type = MARPAESLIF_VALUE_TYPE_INT;
+  row[0].u.i  = -12;
+  row[1].type = MARPAESLIF_VALUE_TYPE_DOUBLE;
+  row[1].u.d  = 1.5;
+  row[2].type = MARPAESLIF_VALUE_TYPE_DOUBLE;
+  row[2].u.d  = 1e308 * 10.;
+  row[3].type = MARPAESLIF_VALUE_TYPE_BOOL;
+  row[3].u.y  = MARPAESLIFVALUERESULTBOOL_TRUE;
+  row[4].type = MARPAESLIF_VALUE_TYPE_UNDEF;
+  row[5]      = subtable;
+
+  pairs[0].key.type                = MARPAESLIF_VALUE_TYPE_STRING;
+  pairs[0].key.u.s.p               = (unsigned char *) "s";
+  pairs[0].key.u.s.sizel           = 1;
+  pairs[0].key.u.s.shallowb        = 1;
+  pairs[0].key.u.s.encodingasciis  = "UTF-8";
+  pairs[0].value.type              = MARPAESLIF_VALUE_TYPE_STRING;
+  pairs[0].value.u.s.p             = (unsigned char *) "a\"b\n\xc3\xa9\xf0\x9f\x98\x80";
+  pairs[0].value.u.s.sizel         = 10;
+  pairs[0].value.u.s.shallowb      = 1;
+  pairs[0].value.u.s.encodingasciis = "UTF-8";
+  pairs[1].key.type                = MARPAESLIF_VALUE_TYPE_STRING;
+  pairs[1].key.u.s.p               = (unsigned char *) "r";
+  pairs[1].key.u.s.sizel           = 1;
+  pairs[1].key.u.s.shallowb        = 1;
+  pairs[1].key.u.s.encodingasciis  = "UTF-8";
+  pairs[1].value.type              = MARPAESLIF_VALUE_TYPE_ROW;
+  pairs[1].value.u.r.p             = row;
+  pairs[1].value.u.r.sizel         = 6;
+  pairs[1].value.u.r.shallowb      = 1;
+
+  table.type         = MARPAESLIF_VALUE_TYPE_TABLE;
+  table.u.t.p        = pairs;
+  table.u.t.sizel    = 2;
+  table.u.t.shallowb = 1;
+
+  for (strictb = 1; strictb >= 0; strictb--) {
+    /* The grammar based encoder is the reference */
+    marpaESLIFJSONp = marpaESLIFJSON_encode_newp(marpaESLIFp, (short) strictb);
+    if (marpaESLIFJSONp == NULL) {
+      goto err;
+    }
+    memset(&jsonStream_context, 0, sizeof(jsonStream_context));
+    memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+    marpaESLIFValueOption.userDatavp = &jsonStream_context;
+    marpaESLIFValueOption.importerp  = jsonStreamImportb;
+    if (! marpaESLIFJSON_encodeb(marpaESLIFJSONp, &table, &marpaESLIFValueOption)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFJSON_encodeb failure");
+      goto err;
+    }
+    marpaESLIFGrammar_freev(marpaESLIFJSONp);
+    marpaESLIFJSONp = NULL;
+    if ((jsonStream_context.l != strlen(expecteds[strictb])) || (memcmp(jsonStream_context.s, expecteds[strictb], jsonStream_context.l) != 0)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "marpaESLIFJSON_encodeb: got %.*s", (int) jsonStream_context.l, jsonStream_context.s);
+      goto err;
+    }
+
+    /* Direct encoder, single buffer */
+    memset(&marpaESLIFJSONEncodeOption, 0, sizeof(marpaESLIFJSONEncodeOption));
+    marpaESLIFJSONEncodeOption.strictb = (short) strictb;
+    if (! marpaESLIFJSON_encode_streamb(marpaESLIFp, &table, &marpaESLIFJSONEncodeOption, &bytes, &bytel)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFJSON_encode_streamb failure");
+      goto err;
+    }
+    if ((bytel != jsonStream_context.l) || (memcmp(bytes, jsonStream_context.s, bytel) != 0) || (bytes[bytel] != '\0')) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "marpaESLIFJSON_encode_streamb: got %s", bytes);
+      goto err;
+    }
+    outputFreev(marpaESLIFp, bytes);
+    bytes = NULL;
+
+    /* Direct encoder, writer with small chunks */
+    memset(&jsonStream_context, 0, sizeof(jsonStream_context));
+    marpaESLIFJSONEncodeOption.writerp    = jsonStreamWriterb;
+    marpaESLIFJSONEncodeOption.userDatavp = &jsonStream_context;
+    marpaESLIFJSONEncodeOption.chunkl     = 8;
+    if (! marpaESLIFJSON_encode_streamb(marpaESLIFp, &table, &marpaESLIFJSONEncodeOption, NULL, NULL)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFJSON_encode_streamb failure with a writer");
+      goto err;
+    }
+    if ((jsonStream_context.l != strlen(expecteds[strictb])) || (memcmp(jsonStream_context.s, expecteds[strictb], jsonStream_context.l) != 0)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "marpaESLIFJSON_encode_streamb with a writer: got %.*s", (int) jsonStream_context.l, jsonStream_context.s);
+      goto err;
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "JSON direct encoder (strictb=%d, largest chunk %ld): %s", strictb, (unsigned long) jsonStream_context.chunkl, expecteds[strictb]);
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFGrammar_freev(marpaESLIFJSONp);
+  if (bytes != NULL) {
+    outputFreev(marpaESLIFp, bytes);
+  }
+  return rcb;
+}
+
+/****************************************************************************/
+static short jsonStreamImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/****************************************************************************/
+{
+  switch (marpaESLIFValueResultp->type) {
+  case MARPAESLIF_VALUE_TYPE_STRING:
+    return jsonStreamWriterb(userDatavp, (char *) marpaESLIFValueResultp->u.s.p, marpaESLIFValueResultp->u.s.sizel);
+  case MARPAESLIF_VALUE_TYPE_ARRAY:
+    return jsonStreamWriterb(userDatavp, marpaESLIFValueResultp->u.a.p, marpaESLIFValueResultp->u.a.sizel);
+  default:
+    return 0;
+  }
+}
+
+/****************************************************************************/
+static short jsonStreamWriterb(void *userDatavp, char *bytep, size_t bytel)
+/****************************************************************************/
+{
+  jsonStream_context_t *jsonStream_contextp = (jsonStream_context_t *) userDatavp;
+
+  if (bytel > (JSONSTREAM_MAXL - jsonStream_contextp->l)) {
+    return 0;
+  }
+  memcpy(jsonStream_contextp->s + jsonStream_contextp->l, bytep, bytel);
+  jsonStream_contextp->l += bytel;
+  if (bytel > jsonStream_contextp->chunkl) {
+    jsonStream_contextp->chunkl = bytel;
+  }
+
+  return 1;
+}
+
+/****************************************************************************/
+static short jsonEventb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Three documents: members of the first one and items of the second one go to the callback */
+  static const char            *ndjsons        = "{\"a\": [1, 2, 3], \"b\": {\"x\": 4}}\n[5, 6]\n\"s\"\n";
+  static const char            *truncateds     = "[1]\n[2";
+  marpaESLIFGrammar_t          *marpaESLIFJSONp = NULL;
+  marpaESLIFJSONDecodeOption_t  marpaESLIFJSONDecodeOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  marpaESLIFTester_context_t    marpaESLIFTester_context;
+  short                         rcb;
+
+  marpaESLIFJSONp = marpaESLIFJSON_decode_newp(marpaESLIFp, 1 /* strictb */);
+  if (marpaESLIFJSONp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFTester_context, 0, sizeof(marpaESLIFTester_context));
+  marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  marpaESLIFTester_context.inputs         = (char *) ndjsons;
+  marpaESLIFTester_context.inputl         = strlen(ndjsons);
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &marpaESLIFTester_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  memset(&marpaESLIFJSONDecodeOption, 0, sizeof(marpaESLIFJSONDecodeOption));
+
+  /* Without multiple documents mode this is not valid JSON */
+  if (marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder success on several documents");
+    goto err;
+  }
+
+  marpaESLIFJSONDecodeOption.valueCallbackp = jsonEventCallbackb;
+  marpaESLIFJSONDecodeOption.valueDepthl    = 1;
+  marpaESLIFJSONDecodeOption.multipleb      = 1;
+  if (! marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder failure on several documents");
+    goto err;
+  }
+  if ((marpaESLIFTester_context.nodei != 4) || (marpaESLIFTester_context.nbNodei != 2)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "JSON decoder: %d values and %d members given to the callback instead of 4 and 2", marpaESLIFTester_context.nodei, marpaESLIFTester_context.nbNodei);
+    goto err;
+  }
+
+  /* A truncated last document is an error */
+  marpaESLIFTester_context.inputs = (char *) truncateds;
+  marpaESLIFTester_context.inputl = strlen(truncateds);
+  if (marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder success on a truncated document");
+    goto err;
+  }
+  GENERICLOGGER_INFO(genericLoggerp, "JSON decoder: value callback and multiple documents are ok");
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFGrammar_freev(marpaESLIFJSONp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short jsonEventCallbackb(void *userDatavp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t *valuep)
+/****************************************************************************/
+{
+  marpaESLIFTester_context_t *marpaESLIFTester_contextp = (marpaESLIFTester_context_t *) userDatavp;
+  marpaESLIFValueType_t       expectedType;
+
+  marpaESLIFTester_contextp->nodei++;
+  if (keyp != NULL) {
+    if ((keyp->type != MARPAESLIF_VALUE_TYPE_STRING) || (keyp->u.s.sizel != 1)) {
+      return 0;
+    }
+    /* "a" is an array, "b" is an object */
+    expectedType = (keyp->u.s.p[0] == 'a') ? MARPAESLIF_VALUE_TYPE_ROW : MARPAESLIF_VALUE_TYPE_TABLE;
+    if (valuep->type != expectedType) {
+      return 0;
+    }
+    marpaESLIFTester_contextp->nbNodei++;
+  }
+
+  return 1;
+}
+
+typedef struct jsonProject_context {
+  marpaESLIFTester_context_t  marpaESLIFTester_context; /* Must be first: this is what the reader sees */
+  marpaESLIF_t               *marpaESLIFp;
+  char                       *bytes;
+  size_t                      bytel;
+} jsonProject_context_t;
+
+/****************************************************************************/
+static short jsonProjectb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  static const char            *inputs    = "{\"meta\": {\"id\": 7, \"name\": \"x\"}, \"items\": [{\"price\": 1, \"qty\": 2}, {\"qty\": 3}, {\"price\": 4.5}], \"other\": [1, {\"a\": \"b\"}], \"a/b\": true}";
+  static const char            *expecteds = "{\"meta\":{\"id\":7},\"items\":[{\"price\":1},{\"qty\":3},{\"price\":4.5}],\"other\":[{}],\"a/b\":true}";
+  static char                  *paths[]   = { "/meta/id", "/items/*/price", "/items/1/qty", "/other/1/a/deep", "/a~1b" };
+  static char                  *badpaths[] = { "meta" };
+  marpaESLIFGrammar_t          *marpaESLIFJSONp = NULL;
+  marpaESLIFJSONDecodeOption_t  marpaESLIFJSONDecodeOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  jsonProject_context_t         jsonProject_context;
+  short                         rcb;
+
+  memset(&jsonProject_context, 0, sizeof(jsonProject_context));
+  jsonProject_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  jsonProject_context.marpaESLIFTester_context.inputs         = (char *) inputs;
+  jsonProject_context.marpaESLIFTester_context.inputl         = strlen(inputs);
+  jsonProject_context.marpaESLIFp                             = marpaESLIFp;
+
+  marpaESLIFJSONp = marpaESLIFJSON_decode_newp(marpaESLIFp, 1 /* strictb */);
+  if (marpaESLIFJSONp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &jsonProject_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+
+  /* The top-level value goes to the callback, that encodes it */
+  memset(&marpaESLIFJSONDecodeOption, 0, sizeof(marpaESLIFJSONDecodeOption));
+  marpaESLIFJSONDecodeOption.valueCallbackp = jsonProjectCallbackb;
+  marpaESLIFJSONDecodeOption.pathsp         = paths;
+  marpaESLIFJSONDecodeOption.pathl          = sizeof(paths) / sizeof(paths[0]);
+
+  if (! marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder failure with paths");
+    goto err;
+  }
+  if ((jsonProject_context.bytes == NULL) || (strcmp(jsonProject_context.bytes, expecteds) != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "JSON decoder with paths: got %s instead of %s", (jsonProject_context.bytes != NULL) ? jsonProject_context.bytes : "nothing", expecteds);
+    goto err;
+  }
+
+  marpaESLIFJSONDecodeOption.pathsp = badpaths;
+  marpaESLIFJSONDecodeOption.pathl  = sizeof(badpaths) / sizeof(badpaths[0]);
+  if (marpaESLIFJSON_decodeb(marpaESLIFJSONp, &marpaESLIFJSONDecodeOption, &marpaESLIFRecognizerOption, &marpaESLIFValueOption)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "JSON decoder success with an invalid path");
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "JSON decoder with paths: %s", jsonProject_context.bytes);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (jsonProject_context.bytes != NULL) {
+    outputFreev(marpaESLIFp, jsonProject_context.bytes);
+  }
+  marpaESLIFGrammar_freev(marpaESLIFJSONp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short jsonProjectCallbackb(void *userDatavp, marpaESLIFValueResult_t *keyp, marpaESLIFValueResult_t *valuep)
+/****************************************************************************/
+{
+  jsonProject_context_t *jsonProject_contextp = (jsonProject_context_t *) userDatavp;
+
+  if (jsonProject_contextp->bytes != NULL) {
+    outputFreev(jsonProject_contextp->marpaESLIFp, jsonProject_contextp->bytes);
+    jsonProject_contextp->bytes = NULL;
+  }
+
+  return marpaESLIFJSON_encode_streamb(jsonProject_contextp->marpaESLIFp, valuep, NULL /* marpaESLIFJSONEncodeOptionp */, &(jsonProject_contextp->bytes), &(jsonProject_contextp->bytel));
+}
+
+#define RECOVER_MAXERROR    4
+#define RECOVER_LONGL       20000    /* Number of values in the long record */
+#define RECOVER_MAXMEMORYL  1048576
+typedef struct recover_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context; /* Must be first: this is what inputReaderb() sees */
+  char                       records[64];
+  size_t                     recordl;
+  marpaESLIFRecoveryError_t  errors[RECOVER_MAXERROR];
+  size_t                     errorl;
+  int                        readi;    /* Number of calls to recoverReaderb() */
+} recover_context_t;
+
+/****************************************************************************/
+static short recoverb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* One record per grammar: bad records are skipped up to the next ';' */
+  static const char            *dsls      = ":discard ::= /[\\s]+/\nrecord ::= KEY '=' VALUE ';'\nKEY ~ /[a-z]+/\nVALUE ~ /[0-9]+/\n";
+  static const char            *inputs    = "a=1; b=x; c=3; =4; d=5;";
+  static const char            *expecteds = "a=1;c=3;d=5;";
+  static const size_t           expectedErrors[2][3] = { { 5, 7, 9 }, { 15, 15, 18 } }; /* startl, offsetl, endl */
+  /* A record as long as wanted, that grows the Earley sets */
+  static const char            *longdsls  = ":discard ::= /[\\s]+/\nrecord ::= KEY '=' values ';'\nvalues ::= VALUE+\nKEY ~ /[a-z]+/\nVALUE ~ /[0-9]+/\n";
+  char                         *longinputs = NULL;
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp = NULL;
+  marpaESLIFSymbol_t           *marpaESLIFSymbolp  = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  marpaESLIFRecoveryOption_t    marpaESLIFRecoveryOption;
+  marpaESLIFString_t            marpaESLIFString;
+  recover_context_t             recover_context;
+  size_t                        errorl;
+  size_t                        longl;
+  size_t                        i;
+  short                         rcb;
+
+  memset(&recover_context, 0, sizeof(recover_context));
+  recover_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  recover_context.marpaESLIFTester_context.inputs         = (char *) inputs;
+  recover_context.marpaESLIFTester_context.inputl         = strlen(inputs);
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  marpaESLIFString.bytep          = "';'";
+  marpaESLIFString.bytel          = 3;
+  marpaESLIFString.encodingasciis = "ASCII";
+  marpaESLIFString.asciis         = NULL;
+  marpaESLIFSymbolp = marpaESLIFSymbol_string_newp(marpaESLIFp, &marpaESLIFString, NULL /* modifiers */, NULL /* marpaESLIFSymbolOptionp */);
+  if (marpaESLIFSymbolp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &recover_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  marpaESLIFValueOption.userDatavp = &recover_context;
+  marpaESLIFValueOption.importerp  = recoverImportb;
+
+  memset(&marpaESLIFRecoveryOption, 0, sizeof(marpaESLIFRecoveryOption));
+  marpaESLIFRecoveryOption.syncSymbolpp   = &marpaESLIFSymbolp;
+  marpaESLIFRecoveryOption.syncSymboll    = 1;
+  marpaESLIFRecoveryOption.errorCallbackp = recoverErrorb;
+
+  if (! marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, &marpaESLIFValueOption, &marpaESLIFRecoveryOption, &errorl)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "Parse with recovery failure");
+    goto err;
+  }
+  if ((strcmp(recover_context.records, expecteds) != 0) || (errorl != 2) || (recover_context.errorl != 2)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Parse with recovery: got records %s and %ld errors instead of %s and 2 errors", recover_context.records, (unsigned long) errorl, expecteds);
+    goto err;
+  }
+  for (i = 0; i < 2; i++) {
+    if ((recover_context.errors[i].startl != expectedErrors[i][0]) || (recover_context.errors[i].offsetl != expectedErrors[i][1]) || (recover_context.errors[i].endl != expectedErrors[i][2])) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Parse with recovery: error %ld is at {%ld, %ld, %ld} instead of {%ld, %ld, %ld}",
+                           (unsigned long) i,
+                           (unsigned long) recover_context.errors[i].startl, (unsigned long) recover_context.errors[i].offsetl, (unsigned long) recover_context.errors[i].endl,
+                           (unsigned long) expectedErrors[i][0], (unsigned long) expectedErrors[i][1], (unsigned long) expectedErrors[i][2]);
+      goto err;
+    }
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Parse with recovery: records %s, %ld errors", recover_context.records, (unsigned long) errorl);
+
+  /* Too many errors */
+  memset(recover_context.records, 0, sizeof(recover_context.records));
+  recover_context.recordl       = 0;
+  recover_context.errorl        = 0;
+  marpaESLIFRecoveryOption.maxErrorl = 1;
+  if (marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, &marpaESLIFValueOption, &marpaESLIFRecoveryOption, &errorl) || (errorl != 1)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "Parse with recovery: maximum number of errors not honoured");
+    goto err;
+  }
+  marpaESLIFRecoveryOption.maxErrorl = 0;
+
+  /* A read failure is not skipped, even if the reader would succeed after it */
+  memset(recover_context.records, 0, sizeof(recover_context.records));
+  recover_context.recordl                    = 0;
+  recover_context.errorl                     = 0;
+  marpaESLIFRecognizerOption.readerCallbackp = recoverReaderb;
+  if (marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, &marpaESLIFValueOption, &marpaESLIFRecoveryOption, &errorl) || (errorl != 0) || (strcmp(recover_context.records, "a=1;") != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Parse with recovery: read failure was skipped, got records %s and %ld errors", recover_context.records, (unsigned long) errorl);
+    goto err;
+  }
+  GENERICLOGGER_INFO(genericLoggerp, "Parse with recovery: read failure stopped the parsing");
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  /* Reaching the memory limit in a record is not skipped either */
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  marpaESLIFGrammarOption.bytep = (void *) longdsls;
+  marpaESLIFGrammarOption.bytel = strlen(longdsls);
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  longinputs = (char *) malloc(RECOVER_LONGL * 2 + 32);
+  if (longinputs == NULL) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  strcpy(longinputs, "a=1; b=");
+  longl = strlen(longinputs);
+  for (i = 0; i < RECOVER_LONGL; i++) {
+    longinputs[longl++] = '1';
+    longinputs[longl++] = ' ';
+  }
+  strcpy(longinputs + longl, "; c=3;");
+  memset(recover_context.records, 0, sizeof(recover_context.records));
+  recover_context.recordl                        = 0;
+  recover_context.errorl                         = 0;
+  recover_context.marpaESLIFTester_context.inputs = longinputs;
+  recover_context.marpaESLIFTester_context.inputl = strlen(longinputs);
+  marpaESLIFRecognizerOption.bufsizl             = 1024;
+  marpaESLIFRecognizerOption.maxMemoryl          = RECOVER_MAXMEMORYL;
+  errno = 0;
+  if (marpaESLIFGrammar_parse_recoverb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, &marpaESLIFValueOption, &marpaESLIFRecoveryOption, &errorl) || (errno != ENOMEM) || (errorl != 0) || (strcmp(recover_context.records, "a=1;") != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Parse with recovery: memory limit was skipped, got records %s and %ld errors", recover_context.records, (unsigned long) errorl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Parse with recovery: memory limit of %ld bytes stopped the parsing", (unsigned long) RECOVER_MAXMEMORYL);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFSymbol_freev(marpaESLIFSymbolp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  if (longinputs != NULL) {
+    free(longinputs);
+  }
+  return rcb;
+}
+
+/****************************************************************************/
+static short recoverReaderb(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp)
+/****************************************************************************/
+{
+  /* The second read fails, the third one would give the rest of the input */
+  static char       *chunks[3] = { "a=1; b=", NULL, "2; c=3;" };
+  recover_context_t *recover_contextp = (recover_context_t *) userDatavp;
+  int                readi            = recover_contextp->readi++;
+
+  if ((readi >= 3) || (chunks[readi] == NULL)) {
+    return 0;
+  }
+
+  *inputsp           = chunks[readi];
+  *inputlp           = strlen(chunks[readi]);
+  *eofbp             = (readi == 2) ? 1 : 0;
+  *characterStreambp = 0;
+  *encodingsp        = NULL;
+  *encodinglp        = 0;
+  *disposeCallbackpp = NULL;
+
+  return 1;
+}
+
+/****************************************************************************/
+static short recoverImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/****************************************************************************/
+{
+  recover_context_t *recover_contextp = (recover_context_t *) userDatavp;
+
+  /* Default action is ::concat */
+  if ((marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_ARRAY) || (recover_contextp->recordl + marpaESLIFValueResultp->u.a.sizel >= sizeof(recover_contextp->records))) {
+    return 0;
+  }
+
+  memcpy(recover_contextp->records + recover_contextp->recordl, marpaESLIFValueResultp->u.a.p, marpaESLIFValueResultp->u.a.sizel);
+  recover_contextp->recordl += marpaESLIFValueResultp->u.a.sizel;
+
+  return 1;
+}
+
+/****************************************************************************/
+static short recoverErrorb(void *userDatavp, marpaESLIFRecoveryError_t *marpaESLIFRecoveryErrorp)
+/****************************************************************************/
+{
+  recover_context_t *recover_contextp = (recover_context_t *) userDatavp;
+
+  if (recover_contextp->errorl >= RECOVER_MAXERROR) {
+    return 0;
+  }
+  recover_contextp->errors[recover_contextp->errorl++] = *marpaESLIFRecoveryErrorp;
+
+  return 1;
+}
+
+#define ALLOCATOR_MAGIC  0x45534c46 /* Marks a live block */
+#define ALLOCATOR_CHUNKL 65536      /* Default size of an arena chunk */
+
+/* Every block is preceded by a header, so that a block that does not come */
+/* from the allocator is detected when it is resized or released.          */
+typedef union allocator_header {
+  struct {
+    size_t       sizel;   /* Usable size */
+    unsigned int magici;  /* ALLOCATOR_MAGIC while the block is live */
+  } block;
+  long double    alignmentld;
+  void          *alignmentp;
+} allocator_header_t;
+
+/* Arena chunk: blocks are carved out of it and it is released at once */
+typedef union allocator_chunk {
+  struct {
+    union allocator_chunk *previousp;
+    size_t                 usedl;   /* Bytes used after this header */
+    size_t                 sizel;   /* Bytes available after this header */
+    allocator_header_t    *lastp;   /* Last block carved, that can grow in place */
+  } chunk;
+  allocator_header_t       alignment;
+  char                     padding[2 * sizeof(allocator_header_t)];
+} allocator_chunk_t;
+
+typedef struct allocator_context {
+  short              arenab;   /* Blocks come from arena chunks instead of the C library */
+  allocator_chunk_t *chunkp;   /* Current arena chunk */
+  size_t             mallocl;  /* Number of blocks obtained */
+  size_t             reallocl; /* Number of blocks resized */
+  size_t             freel;    /* Number of blocks released */
+  size_t             systeml;  /* Number of calls to the C library */
+  size_t             foreignl; /* Number of blocks resized or released that do not come from the allocator */
+} allocator_context_t;
+
+typedef struct allocator_tester {
+  char   *names;
+  short (*testerb)(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp);
+} allocator_tester_t;
+
+/* The existing testers that only need an ESLIF instance */
+static allocator_tester_t allocator_testers[] = {
+  { "cbor",            cborb },
+  { "partition",       partitionb },
+  { "valueStackCache", valueStackCacheb },
+  { "tableIndex",      tableIndexb },
+  { "jsonStream",      jsonStreamb },
+  { "jsonEvent",       jsonEventb },
+  { "jsonProject",     jsonProjectb },
+  { "recover",         recoverb },
+  { "resolver",        resolverb },
+  { "number",          numberb },
+  { "regexPrefilter",  regexPrefilterb },
+  { "substitution",    substitutionb },
+  { "lineColumn",      lineColumnb },
+  { "utf8Passthrough", utf8Passthroughb },
+  { "eventMask",       eventMaskb }
+};
+
+/****************************************************************************/
+static short allocatorb(genericLogger_t *genericLoggerp)
+/****************************************************************************/
+/* Runs the existing testers under a counting allocator, then under an arena */
+/* whose chunks are released at once: the number of calls to the C library  */
+/* must drop. In both cases every block must be released through the        */
+/* allocator, and nothing that the allocator did not give may come back.    */
+/****************************************************************************/
+{
+  marpaESLIF_t          *marpaESLIFp = NULL;
+  marpaESLIFOption_t     marpaESLIFOption;
+  marpaESLIFAllocator_t  marpaESLIFAllocator;
+  allocator_context_t    counting_context;
+  allocator_context_t    arena_context;
+  short                  rcb;
+
+  memset(&counting_context, 0, sizeof(counting_context));
+  memset(&arena_context, 0, sizeof(arena_context));
+  arena_context.arenab = 1;
+
+  /* All the functions are mandatory */
+  memset(&marpaESLIFOption, 0, sizeof(marpaESLIFOption));
+  marpaESLIFAllocator.userDatavp  = &counting_context;
+  marpaESLIFAllocator.mallocp     = allocatorMallocp;
+  marpaESLIFAllocator.reallocp    = allocatorReallocp;
+  marpaESLIFAllocator.freep       = NULL;
+  marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = &marpaESLIFAllocator;
+  marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
+  if ((marpaESLIFp != NULL) || (errno != EINVAL)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIF_newp accepts an allocator without a free function");
+    goto err;
+  }
+
+  if (! allocatorRunb(genericLoggerp, &counting_context)) {
+    goto err;
+  }
+  if (! allocatorRunb(genericLoggerp, &arena_context)) {
+    goto err;
+  }
+
+  GENERICLOGGER_INFOF(genericLoggerp, "Allocator: %lu blocks obtained, %lu resized, %lu calls to the C library", (unsigned long) counting_context.mallocl, (unsigned long) counting_context.reallocl, (unsigned long) counting_context.systeml);
+  GENERICLOGGER_INFOF(genericLoggerp, "Arena    : %lu blocks obtained, %lu resized, %lu calls to the C library", (unsigned long) arena_context.mallocl, (unsigned long) arena_context.reallocl, (unsigned long) arena_context.systeml);
+  if (arena_context.systeml >= counting_context.systeml) {
+    GENERICLOGGER_ERROR(genericLoggerp, "The arena does not reduce the number of calls to the C library");
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIF_freev(marpaESLIFp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short allocatorRunb(genericLogger_t *genericLoggerp, void *allocator_contextvp)
+/****************************************************************************/
+{
+  allocator_context_t     *allocator_contextp = (allocator_context_t *) allocator_contextvp;
+  marpaESLIF_t            *marpaESLIFp = NULL;
+  marpaESLIFOption_t       marpaESLIFOption;
+  marpaESLIFAllocator_t    marpaESLIFAllocator;
+  marpaESLIFValueResult_t  marpaESLIFValueResult;
+  char                    *bytes = NULL;
+  size_t                   bytel;
+  size_t                   i;
+  short                    rcb;
+
+  memset(&marpaESLIFOption, 0, sizeof(marpaESLIFOption));
+  marpaESLIFAllocator.userDatavp  = allocator_contextp;
+  marpaESLIFAllocator.mallocp     = allocatorMallocp;
+  marpaESLIFAllocator.reallocp    = allocatorReallocp;
+  marpaESLIFAllocator.freep       = allocatorFreev;
+  marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = &marpaESLIFAllocator;
+
+  marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
+  if (marpaESLIFp == NULL) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIF_newp failure with an allocator");
+    goto err;
+  }
+
+  /* Grammars, recognizers, values, JSON, CBOR and Lua all run on top of it */
+  for (i = 0; i < sizeof(allocator_testers) / sizeof(allocator_testers[0]); i++) {
+    if (! allocator_testers[i].testerb(marpaESLIFp, genericLoggerp)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "%s tester failure with %s allocator", allocator_testers[i].names, allocator_contextp->arenab ? "an arena" : "a counting");
+      goto err;
+    }
+  }
+
+  /* An output buffer belongs to the allocator */
+  memset(&marpaESLIFValueResult, 0, sizeof(marpaESLIFValueResult));
+  marpaESLIFValueResult.type = MARPAESLIF_VALUE_TYPE_INT;
+  marpaESLIFValueResult.u.i  = 1000;
+  if (! marpaESLIFValueResult_cbor_encodeb(marpaESLIFp, &marpaESLIFValueResult, &bytes, &bytel)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "marpaESLIFValueResult_cbor_encodeb failure with an allocator");
+    goto err;
+  }
+  allocatorFreev(allocator_contextp, bytes);
+  bytes = NULL;
+
+  marpaESLIF_freev(marpaESLIFp);
+  marpaESLIFp = NULL;
+
+  if (allocator_contextp->foreignl > 0) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Allocator: %lu blocks resized or released that it did not give", (unsigned long) allocator_contextp->foreignl);
+    goto err;
+  }
+  if ((allocator_contextp->mallocl == 0) || (allocator_contextp->mallocl != allocator_contextp->freel)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Allocator: %lu blocks obtained but %lu released", (unsigned long) allocator_contextp->mallocl, (unsigned long) allocator_contextp->freel);
+    goto err;
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  if (bytes != NULL) {
+    allocatorFreev(allocator_contextp, bytes);
+  }
+  marpaESLIF_freev(marpaESLIFp);
+  /* The arena is freed wholesale, whatever the blocks still in use */
+  allocatorReleasev(allocator_contextp);
+  return rcb;
+}
+
+/****************************************************************************/
+static void allocatorReleasev(void *allocator_contextvp)
+/****************************************************************************/
+{
+  allocator_context_t *allocator_contextp = (allocator_context_t *) allocator_contextvp;
+  allocator_chunk_t *chunkp;
+
+  while ((chunkp = allocator_contextp->chunkp) != NULL) {
+    allocator_contextp->chunkp = chunkp->chunk.previousp;
+    allocator_contextp->systeml++;
+    free(chunkp);
+  }
+}
+
+/****************************************************************************/
+static void outputFreev(marpaESLIF_t *marpaESLIFp, void *p)
+/****************************************************************************/
+/* Releases a buffer that ESLIF gave to the caller: it comes from its       */
+/* allocator when there is one.                                             */
+/****************************************************************************/
+{
+  marpaESLIFOption_t *marpaESLIFOptionp = marpaESLIF_optionp(marpaESLIFp);
+
+  if ((marpaESLIFOptionp != NULL) && (marpaESLIFOptionp->allocatorp != NULL)) {
+    marpaESLIFOptionp->allocatorp->freep(marpaESLIFOptionp->allocatorp->userDatavp, p);
+  } else {
+    free(p);
+  }
+}
+
+/****************************************************************************/
+static void *allocatorMallocp(void *userDatavp, size_t sizel)
+/****************************************************************************/
+{
+  allocator_context_t *allocator_contextp = (allocator_context_t *) userDatavp;
+  allocator_chunk_t   *chunkp             = allocator_contextp->chunkp;
+  allocator_header_t  *headerp;
+  size_t               needl;
+  size_t               chunkl;
+
+  /* Keep the blocks aligned as the header */
+  needl = sizeof(allocator_header_t) + ((sizel + sizeof(allocator_header_t) - 1) / sizeof(allocator_header_t)) * sizeof(allocator_header_t);
+
+  if (allocator_contextp->arenab) {
+    if ((chunkp == NULL) || (chunkp->chunk.sizel - chunkp->chunk.usedl < needl)) {
+      chunkl = (needl > ALLOCATOR_CHUNKL) ? needl : ALLOCATOR_CHUNKL;
+      allocator_contextp->systeml++;
+      chunkp = (allocator_chunk_t *) malloc(sizeof(allocator_chunk_t) + chunkl);
+      if (chunkp == NULL) {
+        return NULL;
+      }
+      chunkp->chunk.previousp    = allocator_contextp->chunkp;
+      chunkp->chunk.usedl        = 0;
+      chunkp->chunk.sizel        = chunkl;
+      chunkp->chunk.lastp        = NULL;
+      allocator_contextp->chunkp = chunkp;
+    }
+    headerp = (allocator_header_t *) (((char *) (chunkp + 1)) + chunkp->chunk.usedl);
+    chunkp->chunk.usedl += needl;
+    chunkp->chunk.lastp  = headerp;
+  } else {
+    allocator_contextp->systeml++;
+    headerp = (allocator_header_t *) malloc(needl);
+    if (headerp == NULL) {
+      return NULL;
+    }
+  }
+
+  headerp->block.sizel  = needl - sizeof(allocator_header_t);
+  headerp->block.magici = ALLOCATOR_MAGIC;
+  allocator_contextp->mallocl++;
+
+  return (void *) (headerp + 1);
+}
+
+/****************************************************************************/
+static void *allocatorReallocp(void *userDatavp, void *p, size_t sizel)
+/****************************************************************************/
+{
+  allocator_context_t *allocator_contextp = (allocator_context_t *) userDatavp;
+  allocator_chunk_t   *chunkp             = allocator_contextp->chunkp;
+  allocator_header_t  *headerp            = ((allocator_header_t *) p) - 1;
+  allocator_header_t  *newheaderp;
+  size_t               needl;
+  void                *q;
+
+  if (headerp->block.magici != ALLOCATOR_MAGIC) {
+    allocator_contextp->foreignl++;
+    return NULL;
+  }
+
+  needl = sizeof(allocator_header_t) + ((sizel + sizeof(allocator_header_t) - 1) / sizeof(allocator_header_t)) * sizeof(allocator_header_t);
+
+  if (allocator_contextp->arenab) {
+    if (sizel <= headerp->block.sizel) {
+      q = p;
+    } else if ((chunkp != NULL) && (chunkp->chunk.lastp == headerp) && (chunkp->chunk.sizel - chunkp->chunk.usedl >= needl - sizeof(allocator_header_t) - headerp->block.sizel)) {
+      /* Last block of the current chunk: it grows in place */
+      chunkp->chunk.usedl   += needl - sizeof(allocator_header_t) - headerp->block.sizel;
+      headerp->block.sizel   = needl - sizeof(allocator_header_t);
+      q = p;
+    } else {
+      q = allocatorMallocp(userDatavp, sizel);
+      if (q == NULL) {
+        return NULL;
+      }
+      memcpy(q, p, headerp->block.sizel);
+      /* The old block is dead, and the new one is not an additional block */
+      headerp->block.magici = 0;
+      allocator_contextp->mallocl--;
+    }
+  } else {
+    allocator_contextp->systeml++;
+    newheaderp = (allocator_header_t *) realloc(headerp, needl);
+    if (newheaderp == NULL) {
+      return NULL;
+    }
+    newheaderp->block.sizel = needl - sizeof(allocator_header_t);
+    q = (void *) (newheaderp + 1);
+  }
+
+  allocator_contextp->reallocl++;
+  return q;
+}
+
+/****************************************************************************/
+static void allocatorFreev(void *userDatavp, void *p)
+/****************************************************************************/
+{
+  allocator_context_t *allocator_contextp = (allocator_context_t *) userDatavp;
+  allocator_header_t  *headerp            = ((allocator_header_t *) p) - 1;
+
+  if (headerp->block.magici != ALLOCATOR_MAGIC) {
+    allocator_contextp->foreignl++;
+    return;
+  }
+  headerp->block.magici = 0;
+  allocator_contextp->freel++;
+
+  /* Arena blocks stay in their chunk until the arena is released */
+  if (! allocator_contextp->arenab) {
+    allocator_contextp->systeml++;
+    free(headerp);
+  }
+}
+
+#define MEMORY_INPUTL 4096
+#define MEMORY_EARLEYL 100
+/****************************************************************************/
+static short memoryb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* The same input is parsed without limit, then with half of the memory it needed */
+  static const char                 *dsls          = "S ::= 'a'+\n";
+  /* Earley sets of an ambiguous grammar grow quadratically, whatever the stream size */
+  static const char                 *ambiguousdsls = "S ::= S S\n    | 'a'\n";
+  char                              *inputs                      = NULL;
+  marpaESLIFGrammar_t               *marpaESLIFGrammarp          = NULL;
+  marpaESLIFRecognizer_t            *marpaESLIFRecognizerp       = NULL;
+  marpaESLIFRecognizer_t            *marpaESLIFRecognizerFromp   = NULL;
+  marpaESLIFGrammarOption_t          marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t       marpaESLIFRecognizerOption;
+  marpaESLIFRecognizerMemoryStats_t  marpaESLIFRecognizerMemoryStats;
+  marpaESLIFRecognizerMemoryStats_t  marpaESLIFRecognizerMemoryStatsFrom;
+  marpaESLIFTester_context_t         marpaESLIFTester_context;
+  size_t                             currentl;
+  short                              continueb;
+  short                              exhaustedb;
+  short                              parseb;
+  short                              rcb;
+
+  inputs = (char *) malloc(MEMORY_INPUTL);
+  if (inputs == NULL) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  memset(inputs, 'a', MEMORY_INPUTL);
+
+  memset(&marpaESLIFTester_context, 0, sizeof(marpaESLIFTester_context));
+  marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  marpaESLIFTester_context.inputs         = inputs;
+  marpaESLIFTester_context.inputl         = MEMORY_INPUTL;
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &marpaESLIFTester_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+  if (marpaESLIFRecognizerp == NULL) {
+    goto err;
+  }
+  if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+    goto err;
+  }
+  while (continueb) {
+    if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+      goto err;
+    }
+  }
+  if (! marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizerp, &marpaESLIFRecognizerMemoryStats)) {
+    goto err;
+  }
+  if ((marpaESLIFRecognizerMemoryStats.limitl != 0) ||
+      (marpaESLIFRecognizerMemoryStats.currentl == 0) ||
+      (marpaESLIFRecognizerMemoryStats.peakl < marpaESLIFRecognizerMemoryStats.currentl) ||
+      (marpaESLIFRecognizerMemoryStats.peakl < MEMORY_INPUTL)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: unexpected statistics: current %ld, peak %ld, limit %ld", (unsigned long) marpaESLIFRecognizerMemoryStats.currentl, (unsigned long) marpaESLIFRecognizerMemoryStats.peakl, (unsigned long) marpaESLIFRecognizerMemoryStats.limitl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Memory: %ld bytes in use, peak at %ld bytes", (unsigned long) marpaESLIFRecognizerMemoryStats.currentl, (unsigned long) marpaESLIFRecognizerMemoryStats.peakl);
+
+  /* A recognizer sharing the stream is charged to the same recognizer */
+  currentl = marpaESLIFRecognizerMemoryStats.currentl;
+  marpaESLIFRecognizerFromp = marpaESLIFRecognizer_newFromp(marpaESLIFGrammarp, marpaESLIFRecognizerp);
+  if (marpaESLIFRecognizerFromp == NULL) {
+    goto err;
+  }
+  if ((! marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizerp, &marpaESLIFRecognizerMemoryStats)) ||
+      (! marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizerFromp, &marpaESLIFRecognizerMemoryStatsFrom))) {
+    goto err;
+  }
+  if ((marpaESLIFRecognizerMemoryStats.currentl <= currentl) ||
+      (marpaESLIFRecognizerMemoryStatsFrom.currentl != marpaESLIFRecognizerMemoryStats.currentl)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: newFromp recognizer not charged to the shared one: %ld bytes before, %ld bytes after, %ld bytes seen from it", (unsigned long) currentl, (unsigned long) marpaESLIFRecognizerMemoryStats.currentl, (unsigned long) marpaESLIFRecognizerMemoryStatsFrom.currentl);
+    goto err;
+  }
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerFromp);
+  marpaESLIFRecognizerFromp = NULL;
+  if (! marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizerp, &marpaESLIFRecognizerMemoryStats)) {
+    goto err;
+  }
+  if (marpaESLIFRecognizerMemoryStats.currentl != currentl) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: %ld bytes in use after the newFromp recognizer is freed, expected %ld", (unsigned long) marpaESLIFRecognizerMemoryStats.currentl, (unsigned long) currentl);
+    goto err;
+  }
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFRecognizerp = NULL;
+
+  /* Half of the peak cannot hold the input */
+  marpaESLIFRecognizerOption.maxMemoryl = marpaESLIFRecognizerMemoryStats.peakl / 2;
+  errno = 0;
+  parseb = 0;
+  marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+  if (marpaESLIFRecognizerp != NULL) {
+    if (marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+      parseb = 1;
+      while (continueb) {
+        if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+          parseb = 0;
+          break;
+        }
+      }
+    }
+  }
+  if (parseb || (errno != ENOMEM)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: parse with a limit of %ld bytes did not fail with ENOMEM", (unsigned long) marpaESLIFRecognizerOption.maxMemoryl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Memory: parse with a limit of %ld bytes failed as expected", (unsigned long) marpaESLIFRecognizerOption.maxMemoryl);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFRecognizerp = NULL;
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  marpaESLIFGrammarp = NULL;
+
+  /* A short input, far below the limit for the stream, with an ambiguous grammar */
+  marpaESLIFTester_context.inputl = MEMORY_EARLEYL;
+  marpaESLIFGrammarOption.bytep   = (void *) ambiguousdsls;
+  marpaESLIFGrammarOption.bytel   = strlen(ambiguousdsls);
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  marpaESLIFRecognizerOption.bufsizl    = MEMORY_EARLEYL;
+  marpaESLIFRecognizerOption.maxMemoryl = 0;
+  marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+  if (marpaESLIFRecognizerp == NULL) {
+    goto err;
+  }
+  if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+    goto err;
+  }
+  while (continueb) {
+    if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+      goto err;
+    }
+  }
+  if (! marpaESLIFRecognizer_memory_statsb(marpaESLIFRecognizerp, &marpaESLIFRecognizerMemoryStats)) {
+    goto err;
+  }
+  /* At least one Earley item per pair of positions */
+  if (marpaESLIFRecognizerMemoryStats.peakl < ((MEMORY_EARLEYL * MEMORY_EARLEYL) / 2) * sizeof(void *)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: Earley sets of an ambiguous grammar not accounted: peak at %ld bytes", (unsigned long) marpaESLIFRecognizerMemoryStats.peakl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Memory: ambiguous grammar on %d bytes peaks at %ld bytes", MEMORY_EARLEYL, (unsigned long) marpaESLIFRecognizerMemoryStats.peakl);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFRecognizerp = NULL;
+
+  marpaESLIFRecognizerOption.maxMemoryl = marpaESLIFRecognizerMemoryStats.peakl / 2;
+  errno = 0;
+  parseb = 0;
+  marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+  if (marpaESLIFRecognizerp != NULL) {
+    if (marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+      parseb = 1;
+      while (continueb) {
+        if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+          parseb = 0;
+          break;
+        }
+      }
+    }
+  }
+  if (parseb || (errno != ENOMEM)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Memory: ambiguous parse with a limit of %ld bytes did not fail with ENOMEM", (unsigned long) marpaESLIFRecognizerOption.maxMemoryl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Memory: ambiguous parse with a limit of %ld bytes failed as expected", (unsigned long) marpaESLIFRecognizerOption.maxMemoryl);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerFromp);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  if (inputs != NULL) {
+    free(inputs);
+  }
+  return rcb;
+}
+
+#define RESOLVER_INPUTS "xyxy"
+typedef struct resolver_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context;
+  char                       actions[16];  /* Set by the resolver, read by the callback, as in the bindings */
+  char                       traces[16];   /* One character per action callback */
+  size_t                     tracel;
+  int                        resolveri;    /* Number of resolver calls */
+} resolver_context_t;
+
+/****************************************************************************/
+static short resolverb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* A stateful resolver alternating between two rules: the action cache must be off by default */
+  static const char            *dsls = "S ::= P+ action => ::undef\n"
+                                       "P ::= X Y action => ::undef\n"
+                                       "X ::= 'x' action => x_action\n"
+                                       "Y ::= 'y' action => y_action\n";
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp    = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFValue_t            *marpaESLIFValuep      = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  resolver_context_t            resolver_context;
+  short                         continueb;
+  short                         exhaustedb;
+  short                         cacheb;
+  short                         rcb;
+
+  memset(&resolver_context, 0, sizeof(resolver_context));
+  resolver_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  resolver_context.marpaESLIFTester_context.inputs         = RESOLVER_INPUTS;
+  resolver_context.marpaESLIFTester_context.inputl         = strlen(RESOLVER_INPUTS);
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &(resolver_context.marpaESLIFTester_context);
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  marpaESLIFValueOption.userDatavp          = &resolver_context;
+  marpaESLIFValueOption.ruleActionResolverp = resolverRuleActionResolverp;
+  marpaESLIFValueOption.highRankOnlyb       = 1;
+  marpaESLIFValueOption.orderByRankb        = 1;
+
+  for (cacheb = 0; cacheb <= 1; cacheb++) {
+    resolver_context.actions[0] = '\0';
+    resolver_context.traces[0]  = '\0';
+    resolver_context.tracel     = 0;
+    resolver_context.resolveri  = 0;
+
+    marpaESLIFValue_freev(marpaESLIFValuep);
+    marpaESLIFValuep = NULL;
+    marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+    marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+    if (marpaESLIFRecognizerp == NULL) {
+      goto err;
+    }
+    if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+      goto err;
+    }
+    while (continueb) {
+      if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+        goto err;
+      }
+    }
+    marpaESLIFValuep = marpaESLIFValue_newp(marpaESLIFRecognizerp, &marpaESLIFValueOption);
+    if (marpaESLIFValuep == NULL) {
+      goto err;
+    }
+    if (cacheb && (! marpaESLIFValue_action_cacheb(marpaESLIFValuep, 1))) {
+      goto err;
+    }
+    if (marpaESLIFValue_valueb(marpaESLIFValuep) <= 0) {
+      goto err;
+    }
+
+    if (cacheb) {
+      /* Once per rule: the callbacks then see whatever the last resolver call left */
+      if (resolver_context.resolveri != 2) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Action cache on: %d resolver calls instead of 2", resolver_context.resolveri);
+        goto err;
+      }
+    } else {
+      /* Once per node, each callback sees the state of its own resolver call */
+      if (resolver_context.resolveri != 4) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Action cache off: %d resolver calls instead of 4", resolver_context.resolveri);
+        goto err;
+      }
+      if (strcmp(resolver_context.traces, RESOLVER_INPUTS) != 0) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Action cache off: actions trace is \"%s\" instead of \"%s\"", resolver_context.traces, RESOLVER_INPUTS);
+        goto err;
+      }
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "Action cache %s: %d resolver calls, actions trace \"%s\"", cacheb ? "on" : "off", resolver_context.resolveri, resolver_context.traces);
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFValue_freev(marpaESLIFValuep);
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static marpaESLIFValueRuleCallback_t resolverRuleActionResolverp(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, char *actions)
+/****************************************************************************/
+{
+  resolver_context_t *resolver_contextp = (resolver_context_t *) userDatavp;
+
+  /* Like the bindings: remember the action name, and return one generic callback */
+  if (strlen(actions) >= sizeof(resolver_contextp->actions)) {
+    return NULL;
+  }
+  strcpy(resolver_contextp->actions, actions);
+  resolver_contextp->resolveri++;
+
+  return resolverRuleActionb;
+}
+
+/****************************************************************************/
+static short resolverRuleActionb(void *userDatavp, marpaESLIFValue_t *marpaESLIFValuep, int arg0i, int argni, int resulti, short nullableb)
+/****************************************************************************/
+{
+  resolver_context_t      *resolver_contextp = (resolver_context_t *) userDatavp;
+  marpaESLIFValueResult_t  marpaESLIFValueResult;
+
+  if (resolver_contextp->tracel >= sizeof(resolver_contextp->traces) - 1) {
+    return 0;
+  }
+  resolver_contextp->traces[resolver_contextp->tracel++] = resolver_contextp->actions[0];
+  resolver_contextp->traces[resolver_contextp->tracel]   = '\0';
+
+  memset(&marpaESLIFValueResult, 0, sizeof(marpaESLIFValueResult));
+  marpaESLIFValueResult.type     = MARPAESLIF_VALUE_TYPE_UNDEF;
+  marpaESLIFValueResult.contextp = resolver_contextp;
+
+  return marpaESLIFValue_stack_setb(marpaESLIFValuep, resulti, &marpaESLIFValueResult);
+}
+
+typedef struct number_test {
+  const char  *inputs;
+  const char  *integers;     /* Expected integer, as printed, or NULL for a floating point number */
+  long double  valueld;      /* Expected value when the result is a LONG_DOUBLE */
+  double       valued;       /* Expected value when the result is a DOUBLE */
+  short        confidenceb;
+} number_test_t;
+
+/****************************************************************************/
+static short numberb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  static const number_test_t  number_tests[] = {
+    { "-0",                     NULL,                   -0.L,                     -0.,                     1 },
+    { "-0.5e1",                 "-5",                   0.L,                      0.,                      1 },
+    { "12.50e1",                "125",                  0.L,                      0.,                      1 },
+    { "+0001",                  "1",                    0.L,                      0.,                      1 },
+    { "32767",                  "32767",                0.L,                      0.,                      1 },
+    { "32768",                  "32768",                0.L,                      0.,                      1 },
+    { "-32768",                 "-32768",               0.L,                      0.,                      1 },
+    { "-32769",                 "-32769",               0.L,                      0.,                      1 },
+    { "2147483647",             "2147483647",           0.L,                      0.,                      1 },
+    { "2147483648",             "2147483648",           0.L,                      0.,                      1 },
+    { "-2147483648",            "-2147483648",          0.L,                      0.,                      1 },
+    { "-2147483649",            "-2147483649",          0.L,                      0.,                      1 },
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+    { "1234567890123456789",    "1234567890123456789",  0.L,                      0.,                      1 },
+    { "9223372036854775807",    "9223372036854775807",  0.L,                      0.,                      1 },
+    { "-9223372036854775808",   "-9223372036854775808", 0.L,                      0.,                      1 },
+    { "9223372036854775808",    NULL,                   9223372036854775808.L,    9223372036854775808.,    0 },
+    { "-9223372036854775809",   NULL,                   -9223372036854775809.L,   -9223372036854775809.,   0 },
+#endif
+    { "12345678901234567890",   NULL,                   12345678901234567890.L,   12345678901234567890.,   0 },
+    { "1e27",                   NULL,                   1e27L,                    1e27,                    0 },
+    { "0.1234567890123456789",  NULL,                   0.1234567890123456789L,   0.1234567890123456789,   0 },
+    { "-1.5",                   NULL,                   -1.5L,                    -1.5,                    0 },
+    { "1e-5",                   NULL,                   1e-5L,                    1e-5,                    0 }
+  };
+  const number_test_t     *number_testp;
+  marpaESLIFValueResult_t  marpaESLIFValueResult;
+  short                    confidenceb;
+  char                     integers[64];
+  short                    integerb;
+  short                    smallestb;
+  short                    valueb;
+  size_t                   i;
+
+  for (i = 0; i < sizeof(number_tests) / sizeof(number_tests[0]); i++) {
+    number_testp = &(number_tests[i]);
+    if (! marpaESLIF_numberb(marpaESLIFp, (char *) number_testp->inputs, strlen(number_testp->inputs), &marpaESLIFValueResult, &confidenceb)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "%s: marpaESLIF_numberb failure", number_testp->inputs);
+      return 0;
+    }
+    /* Integers must be in the smallest type that can hold them */
+    integerb  = 1;
+    smallestb = 1;
+    valueb    = 0;
+    switch (marpaESLIFValueResult.type) {
+    case MARPAESLIF_VALUE_TYPE_SHORT:
+      sprintf(integers, "%d", (int) marpaESLIFValueResult.u.b);
+      break;
+    case MARPAESLIF_VALUE_TYPE_INT:
+      sprintf(integers, "%d", marpaESLIFValueResult.u.i);
+      smallestb = ((marpaESLIFValueResult.u.i < SHRT_MIN) || (marpaESLIFValueResult.u.i > SHRT_MAX)) ? 1 : 0;
+      break;
+    case MARPAESLIF_VALUE_TYPE_LONG:
+      sprintf(integers, "%ld", marpaESLIFValueResult.u.l);
+      smallestb = ((marpaESLIFValueResult.u.l < INT_MIN) || (marpaESLIFValueResult.u.l > INT_MAX)) ? 1 : 0;
+      break;
+#ifdef MARPAESLIF_HAVE_LONG_LONG
+    case MARPAESLIF_VALUE_TYPE_LONG_LONG:
+      sprintf(integers, MARPAESLIF_LONG_LONG_FMT, marpaESLIFValueResult.u.ll);
+      smallestb = ((marpaESLIFValueResult.u.ll < LONG_MIN) || (marpaESLIFValueResult.u.ll > LONG_MAX)) ? 1 : 0;
+      break;
+#endif
+    case MARPAESLIF_VALUE_TYPE_DOUBLE:
+      integerb = 0;
+      valueb   = ((marpaESLIFValueResult.u.d == number_testp->valued) && ((1. / marpaESLIFValueResult.u.d < 0.) == (1. / number_testp->valued < 0.))) ? 1 : 0;
+      break;
+    case MARPAESLIF_VALUE_TYPE_LONG_DOUBLE:
+      integerb = 0;
+      valueb   = ((marpaESLIFValueResult.u.ld == number_testp->valueld) && ((1.L / marpaESLIFValueResult.u.ld < 0.L) == (1.L / number_testp->valueld < 0.L))) ? 1 : 0;
+      break;
+    default:
+      GENERICLOGGER_ERRORF(genericLoggerp, "%s: unexpected type %d", number_testp->inputs, (int) marpaESLIFValueResult.type);
+      return 0;
+    }
+    if (number_testp->integers != NULL) {
+      if ((! integerb) || (strcmp(integers, number_testp->integers) != 0) || (! smallestb)) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "%s: type %d, expected the integer %s in its smallest type", number_testp->inputs, (int) marpaESLIFValueResult.type, number_testp->integers);
+        return 0;
+      }
+    } else if (integerb || (! valueb)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "%s: type %d, expected a floating point number equal to %.21Lg", number_testp->inputs, (int) marpaESLIFValueResult.type, number_testp->valueld);
+      return 0;
+    }
+    if (confidenceb != number_testp->confidenceb) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "%s: confidence %d instead of %d", number_testp->inputs, (int) confidenceb, (int) number_testp->confidenceb);
+      return 0;
+    }
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Number: %ld numbers ok", (unsigned long) i);
+
+  return numberLongb(marpaESLIFp, genericLoggerp);
+}
+
+#define NUMBER_LONG_DIGITS 200
+/****************************************************************************/
+static short numberLongb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* A number longer than the internal buffer goes to the C library: the input must stay untouched, */
+  /* also when the locale decimal point is not a dot.                                               */
+  static const char       *localess[] = { NULL, "fr_FR.UTF-8", "fr_FR", "de_DE.UTF-8", "de_DE" };
+  char                     inputs[NUMBER_LONG_DIGITS + 8];
+  char                     copys[NUMBER_LONG_DIGITS + 8];
+  marpaESLIFValueResult_t  marpaESLIFValueResult;
+  short                    confidenceb;
+  long double              valueld;
+  size_t                   numberl;
+  size_t                   i;
+  short                    rcb;
+
+  /* "0.123456789012..." followed by a non-number suffix that is outside of the given size */
+  inputs[0] = '0';
+  inputs[1] = '.';
+  for (i = 2; i < NUMBER_LONG_DIGITS; i++) {
+    inputs[i] = (char) ('0' + ((i - 1) % 10));
+  }
+  numberl = i;
+  strcpy(inputs + numberl, "]");
+  memcpy(copys, inputs, sizeof(inputs));
+
+  for (i = 0; i < sizeof(localess) / sizeof(localess[0]); i++) {
+    if ((localess[i] != NULL) && (setlocale(LC_NUMERIC, localess[i]) == NULL)) {
+      continue;
+    }
+    if (! marpaESLIF_numberb(marpaESLIFp, inputs, numberl, &marpaESLIFValueResult, &confidenceb)) {
+      GENERICLOGGER_ERROR(genericLoggerp, "Long number: marpaESLIF_numberb failure");
+      goto err;
+    }
+    if (memcmp(inputs, copys, sizeof(inputs)) != 0) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Long number: input modified with locale %s", (localess[i] != NULL) ? localess[i] : "C");
+      goto err;
+    }
+    switch (marpaESLIFValueResult.type) {
+    case MARPAESLIF_VALUE_TYPE_DOUBLE:
+      valueld = (long double) marpaESLIFValueResult.u.d;
+      break;
+    case MARPAESLIF_VALUE_TYPE_LONG_DOUBLE:
+      valueld = marpaESLIFValueResult.u.ld;
+      break;
+    default:
+      GENERICLOGGER_ERRORF(genericLoggerp, "Long number: unexpected type %d with locale %s", (int) marpaESLIFValueResult.type, (localess[i] != NULL) ? localess[i] : "C");
+      goto err;
+    }
+    if ((valueld < 0.12345678L) || (valueld > 0.12345679L) || confidenceb) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Long number: %.21Lg, confidence %d with locale %s", valueld, (int) confidenceb, (localess[i] != NULL) ? localess[i] : "C");
+      goto err;
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "Long number: %ld bytes parsed without modification with locale %s", (unsigned long) numberl, (localess[i] != NULL) ? localess[i] : "C");
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  setlocale(LC_NUMERIC, "C");
+  return rcb;
+}
+
+typedef struct regex_test {
+  const char *regexs;
+  const char *modifiers;
+  const char *inputs;
+  short       matchb;
+} regex_test_t;
+
+typedef struct regexPrefilter_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context;
+  int                        callouti;     /* Number of callouts */
+} regexPrefilter_context_t;
+
+/****************************************************************************/
+static short regexPrefilterb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Regexes are anchored: the literal first and required code units may reject the input before PCRE2 */
+  static const regex_test_t     regex_tests[] = {
+    { "abc",                    NULL, "abc",                    1 },
+    { "abc",                    NULL, "xbc",                    0 },
+    { "abc",                    NULL, "ab",                     0 },
+    { "a?bc",                   NULL, "bc",                     1 }, /* No first code unit: "a" is optional */
+    { "(?:a|b)c",               NULL, "bc",                     1 },
+    { "x*abc",                  NULL, "abc",                    1 },
+    { "x*abc",                  NULL, "xxabc",                  1 },
+    { "abc",                    "i",  "ABC",                    1 }, /* Caseless first code unit */
+    { "abc",                    "i",  "aBc",                    1 },
+    { "abc",                    "i",  "xbc",                    0 },
+    { "a.*z",                   "i",  "A--Z",                   1 }, /* Caseless required code unit */
+    { "a.*z",                   "i",  "A--Y",                   0 },
+    { "(?i)abc",                NULL, "ABC",                    1 },
+    { "\xC3\xA9t\xC3\xA9",       "u",  "\xC3\xA9t\xC3\xA9",       1 }, /* UTF-8 lead byte */
+    { "\xC3\xA9t\xC3\xA9",       "u",  "et\xC3\xA9",              0 },
+    { "(*NO_START_OPT)abc",     NULL, "abc",                    1 },
+    { "(*NO_START_OPT)abc",     NULL, "xbc",                    0 },
+    { "(*NO_START_OPT)abc",     "i",  "ABC",                    1 }
+  };
+  /* Callouts must fire when the start optimizations are disabled in the pattern itself */
+  static const char            *calloutDsls = ":default ::= regex-action => callout\n"
+                                              "top ::= /(*NO_START_OPT)(?C1)abc/\n";
+  static const char            *dsls        = ":default ::= regex-action => callout\n"
+                                              "top ::= /(?C1)abc/\n";
+  marpaESLIFSymbol_t           *marpaESLIFSymbolp  = NULL;
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp = NULL;
+  marpaESLIFString_t            string;
+  marpaESLIFSymbolOption_t      marpaESLIFSymbolOption;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  regexPrefilter_context_t      regexPrefilter_context;
+  short                         matchb;
+  short                         parseb;
+  size_t                        i;
+  short                         rcb;
+
+  memset(&marpaESLIFSymbolOption, 0, sizeof(marpaESLIFSymbolOption));
+  for (i = 0; i < sizeof(regex_tests) / sizeof(regex_tests[0]); i++) {
+    string.bytep          = (char *) regex_tests[i].regexs;
+    string.bytel          = strlen(regex_tests[i].regexs);
+    string.encodingasciis = "UTF-8";
+    string.asciis         = NULL;
+    marpaESLIFSymbolp = marpaESLIFSymbol_regex_newp(marpaESLIFp, &string, (char *) regex_tests[i].modifiers, NULL /* substitutionStringp */, NULL /* substitutionModifiers */, &marpaESLIFSymbolOption);
+    if (marpaESLIFSymbolp == NULL) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Regex /%s/%s: marpaESLIFSymbol_regex_newp failure", regex_tests[i].regexs, (regex_tests[i].modifiers != NULL) ? regex_tests[i].modifiers : "");
+      goto err;
+    }
+    if (! marpaESLIFSymbol_tryb(marpaESLIFSymbolp, (char *) regex_tests[i].inputs, strlen(regex_tests[i].inputs), &matchb)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Regex /%s/%s: marpaESLIFSymbol_tryb failure", regex_tests[i].regexs, (regex_tests[i].modifiers != NULL) ? regex_tests[i].modifiers : "");
+      goto err;
+    }
+    if (matchb != regex_tests[i].matchb) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Regex /%s/%s on \"%s\": match is %d instead of %d", regex_tests[i].regexs, (regex_tests[i].modifiers != NULL) ? regex_tests[i].modifiers : "", regex_tests[i].inputs, (int) matchb, (int) regex_tests[i].matchb);
+      goto err;
+    }
+    marpaESLIFSymbol_freev(marpaESLIFSymbolp);
+    marpaESLIFSymbolp = NULL;
+  }
+
+  memset(&regexPrefilter_context, 0, sizeof(regexPrefilter_context));
+  regexPrefilter_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  regexPrefilter_context.marpaESLIFTester_context.inputs         = "xbc";
+  regexPrefilter_context.marpaESLIFTester_context.inputl         = 3;
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp           = &regexPrefilter_context;
+  marpaESLIFRecognizerOption.readerCallbackp      = inputReaderb;
+  marpaESLIFRecognizerOption.buftriggerperci      = 50;
+  marpaESLIFRecognizerOption.bufaddperci          = 50;
+  marpaESLIFRecognizerOption.regexActionResolverp = regexPrefilterCalloutResolverp;
+
+  marpaESLIFGrammarOption.bytep     = (void *) calloutDsls;
+  marpaESLIFGrammarOption.bytel     = strlen(calloutDsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  parseb = marpaESLIFGrammar_parseb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, NULL /* marpaESLIFValueOptionp */, NULL /* exhaustedbp */);
+  if (parseb || (regexPrefilter_context.callouti <= 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "(*NO_START_OPT): parse is %d and %d callouts, expected a failure after at least one callout", (int) parseb, regexPrefilter_context.callouti);
+    goto err;
+  }
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  marpaESLIFGrammarp = NULL;
+
+  /* Without it, PCRE2 itself would not reach the callout either */
+  regexPrefilter_context.callouti  = 0;
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  parseb = marpaESLIFGrammar_parseb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, NULL /* marpaESLIFValueOptionp */, NULL /* exhaustedbp */);
+  if (parseb || (regexPrefilter_context.callouti != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Start optimizations: parse is %d and %d callouts, expected a failure without callout", (int) parseb, regexPrefilter_context.callouti);
+    goto err;
+  }
+
+  GENERICLOGGER_INFOF(genericLoggerp, "Regex prefilter: %ld patterns checked", (unsigned long) (sizeof(regex_tests) / sizeof(regex_tests[0])));
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFSymbol_freev(marpaESLIFSymbolp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static marpaESLIFRecognizerRegexCallback_t regexPrefilterCalloutResolverp(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *actions)
+/****************************************************************************/
+{
+  return (strcmp(actions, "callout") == 0) ? regexPrefilterCalloutb : NULL;
+}
+
+/****************************************************************************/
+static short regexPrefilterCalloutb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *marpaESLIFCalloutBlockp, marpaESLIFValueResultInt_t *marpaESLIFValueResultOutp)
+/****************************************************************************/
+{
+  regexPrefilter_context_t *regexPrefilter_contextp = (regexPrefilter_context_t *) userDatavp;
+
+  regexPrefilter_contextp->callouti++;
+  *marpaESLIFValueResultOutp = 0; /* Continue the match */
+
+  return 1;
+}
+
+#define SUBSTITUTION_LONGL 300 /* Longer than any previous substitution: the recognizer's scratch area has to grow */
+#define SUBSTITUTION_MAXL  1024
+typedef struct substitution_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context;
+  char                       outputs[SUBSTITUTION_MAXL];
+  size_t                     outputl;
+} substitution_context_t;
+
+/****************************************************************************/
+static short substitutionb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Every word is substituted, numbers are substituted by nothing. Default action is ::concat */
+  static const char            *dsls = ":discard ::= /[\\s]+/\n"
+                                       "words ::= word+\n"
+                                       "word ::= /[a-z]+/ -> '<$0>'\n"
+                                       "       | /[0-9]+/ -> ''\n"
+                                       "       | /[A-Z]+/ -> '[$0|$0]'\n"
+                                       "       | /_+([a-z])/ -> '$1'\n";
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  marpaESLIFValueOption_t       marpaESLIFValueOption;
+  substitution_context_t        substitution_context;
+  char                          inputs[SUBSTITUTION_LONGL + 64];
+  char                          expecteds[2 * SUBSTITUTION_LONGL + 64];
+  char                         *p;
+  char                         *q;
+  size_t                        i;
+  short                         rcb;
+
+  /* "a 12 bb XY <long word> 3 dd ____________q": the last output is much shorter than its bound */
+  p = inputs;
+  q = expecteds;
+  strcpy(p, "a 12 bb XY ");
+  p += strlen(p);
+  strcpy(q, "<a><bb>[XY|XY]<");
+  q += strlen(q);
+  for (i = 0; i < SUBSTITUTION_LONGL; i++) {
+    *p++ = *q++ = (char) ('a' + (i % 26));
+  }
+  strcpy(p, " 3 dd ____________q");
+  strcpy(q, "><dd>q");
+
+  memset(&substitution_context, 0, sizeof(substitution_context));
+  substitution_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  substitution_context.marpaESLIFTester_context.inputs         = inputs;
+  substitution_context.marpaESLIFTester_context.inputl         = strlen(inputs);
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &substitution_context;
+  marpaESLIFRecognizerOption.readerCallbackp = inputReaderb;
+
+  memset(&marpaESLIFValueOption, 0, sizeof(marpaESLIFValueOption));
+  marpaESLIFValueOption.userDatavp = &substitution_context;
+  marpaESLIFValueOption.importerp  = substitutionImportb;
+
+  if (! marpaESLIFGrammar_parseb(marpaESLIFGrammarp, &marpaESLIFRecognizerOption, &marpaESLIFValueOption, NULL /* exhaustedbp */)) {
+    GENERICLOGGER_ERROR(genericLoggerp, "Substitution: parse failure");
+    goto err;
+  }
+  if ((substitution_context.outputl != strlen(expecteds)) || (memcmp(substitution_context.outputs, expecteds, substitution_context.outputl) != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Substitution: got \"%.*s\" instead of \"%s\"", (int) substitution_context.outputl, substitution_context.outputs, expecteds);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Substitution: %ld bytes of output", (unsigned long) substitution_context.outputl);
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short substitutionImportb(marpaESLIFValue_t *marpaESLIFValuep, void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp, short haveUndefb)
+/****************************************************************************/
+{
+  substitution_context_t *substitution_contextp = (substitution_context_t *) userDatavp;
+
+  /* Default action is ::concat */
+  if ((marpaESLIFValueResultp->type != MARPAESLIF_VALUE_TYPE_ARRAY) || (substitution_contextp->outputl + marpaESLIFValueResultp->u.a.sizel > sizeof(substitution_contextp->outputs))) {
+    return 0;
+  }
+
+  memcpy(substitution_contextp->outputs + substitution_contextp->outputl, marpaESLIFValueResultp->u.a.p, marpaESLIFValueResultp->u.a.sizel);
+  substitution_contextp->outputl += marpaESLIFValueResultp->u.a.sizel;
+
+  return 1;
+}
+
+/* A reader that gives the input chunkl bytes at a time, as a character stream */
+typedef struct chunk_context {
+  marpaESLIFTester_context_t marpaESLIFTester_context;
+  size_t                     chunkl;
+  size_t                     readl;     /* Number of bytes given so far */
+  char                      *encodings; /* NULL to let the encoding be guessed */
+} chunk_context_t;
+
+/****************************************************************************/
+static short lineColumnb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Every newline sequence, with CR and LF always given as separate lexemes, multibyte */
+  /* characters, and words that must be at the start of a line: :sol is checked by the   */
+  /* sub-recognizer of SOLWORD on the stream it shares with its parent.                  */
+  static const char            *dsls = ":discard ::= /[ \\t]+/\n"
+                                       "items ::= item+\n"
+                                       "item ::= WORD | SOLWORD | CR | LF | NL\n"
+                                       "event item$ = completed item\n"
+                                       "WORD ~ /[^\\s#\\x{85}\\x{2028}\\x{2029}]+/u\n"
+                                       "SOLWORD ~ :sol '#' WORD\n"
+                                       "CR ~ [\\r]\n"
+                                       "LF ~ [\\n]\n"
+                                       "NL ~ /[\\x{0B}\\x{0C}\\x{85}\\x{2028}\\x{2029}]/u\n";
+  static const char            *inputs = "#a b\r\n"                   /* CRLF */
+                                         "#c \xC3\xA9\xE6\x97\xA5 d\r"   /* Two and three bytes characters, lone CR */
+                                         "#e\n"                        /* LF */
+                                         "f\x0Bg\x0C"                  /* VT, FF */
+                                         "#h\xC2\x85"                  /* NEL */
+                                         "i\xE2\x80\xA8"              /* LINE SEPARATOR */
+                                         "#j\xE2\x80\xA9"             /* PARAGRAPH SEPARATOR */
+                                         "\xF0\x9F\x98\x80k\r\n\r\n"   /* Four bytes character, empty line */
+                                         "#l\r\r"                     /* Two lone CRs */
+                                         "#m \xC3\xA9";
+  static const size_t           chunkls[] = { 1, 2, 3, 5, 7, 4096 };
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp    = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  chunk_context_t               chunk_context;
+  short                         continueb;
+  short                         exhaustedb;
+  size_t                        eventArrayl;
+  marpaESLIFEvent_t            *eventArrayp;
+  size_t                        eventl;
+  size_t                        i;
+  size_t                        j;
+  char                         *remainings;
+  size_t                        remainingl;
+  short                         rcb;
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &chunk_context;
+  marpaESLIFRecognizerOption.readerCallbackp = chunkReaderb;
+  marpaESLIFRecognizerOption.newlineb        = 1;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  for (i = 0; i < sizeof(chunkls) / sizeof(chunkls[0]); i++) {
+    memset(&chunk_context, 0, sizeof(chunk_context));
+    chunk_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+    chunk_context.marpaESLIFTester_context.inputs         = (char *) inputs;
+    chunk_context.marpaESLIFTester_context.inputl         = strlen(inputs);
+    chunk_context.chunkl                                  = chunkls[i];
+    chunk_context.encodings                               = "UTF-8";
+
+    marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+    marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+    if (marpaESLIFRecognizerp == NULL) {
+      goto err;
+    }
+    eventl = 0;
+    if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: scan failure", (unsigned long) chunkls[i]);
+      goto err;
+    }
+    while (1) {
+      if (! marpaESLIFRecognizer_eventb(marpaESLIFRecognizerp, &eventArrayl, &eventArrayp)) {
+        goto err;
+      }
+      for (j = 0; j < eventArrayl; j++) {
+        if ((eventArrayp[j].events != NULL) && (strcmp(eventArrayp[j].events, "item$") == 0)) {
+          eventl++;
+        }
+      }
+      if (! lineColumnCheckb(genericLoggerp, marpaESLIFRecognizerp, &chunk_context)) {
+        goto err;
+      }
+      if (! continueb) {
+        break;
+      }
+      if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: resume failure", (unsigned long) chunkls[i]);
+        goto err;
+      }
+    }
+    /* At least one event per item, and everything was consumed */
+    if (eventl < 30) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: %ld item events instead of at least 30", (unsigned long) chunkls[i], (unsigned long) eventl);
+      goto err;
+    }
+    if ((! marpaESLIFRecognizer_inputb(marpaESLIFRecognizerp, &remainings, &remainingl)) || (remainingl > 0) || (chunk_context.readl != chunk_context.marpaESLIFTester_context.inputl)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: input not fully consumed", (unsigned long) chunkls[i]);
+      goto err;
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "Line/column with chunks of %ld bytes: %ld item events checked", (unsigned long) chunkls[i], (unsigned long) eventl);
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short lineColumnCheckb(genericLogger_t *genericLoggerp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, void *userDatavp)
+/****************************************************************************/
+{
+  chunk_context_t *chunk_contextp = (chunk_context_t *) userDatavp;
+  char            *inputs;
+  size_t           inputl;
+  size_t           consumedl;
+  size_t           endl;
+  size_t           leadl;
+  unsigned char    c;
+  size_t           linel;
+  size_t           columnl;
+  size_t           eagerLinel;
+  size_t           eagerColumnl;
+
+  /* What is left in the recognizer is the end of what the reader gave */
+  if ((! marpaESLIFRecognizer_inputb(marpaESLIFRecognizerp, &inputs, &inputl)) || (! marpaESLIFRecognizer_locationb(marpaESLIFRecognizerp, &linel, &columnl))) {
+    return 0;
+  }
+  /* An incomplete UTF-8 character at the end of what was read is kept until the next read */
+  endl = chunk_contextp->readl;
+  if (endl < chunk_contextp->marpaESLIFTester_context.inputl) {
+    leadl = endl;
+    while ((leadl > 0) && ((((unsigned char) chunk_contextp->marpaESLIFTester_context.inputs[leadl - 1]) & 0xC0) == 0x80)) {
+      leadl--;
+    }
+    if (leadl > 0) {
+      c = (unsigned char) chunk_contextp->marpaESLIFTester_context.inputs[--leadl];
+      if ((c >= 0xC0) && ((leadl + ((c < 0xE0) ? 2 : (c < 0xF0) ? 3 : 4)) > endl)) {
+        endl = leadl;
+      }
+    }
+  }
+  if ((inputl > endl) || (memcmp(inputs, chunk_contextp->marpaESLIFTester_context.inputs + endl - inputl, inputl) != 0)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: unexpected remaining input", (unsigned long) chunk_contextp->chunkl);
+    return 0;
+  }
+  consumedl = endl - inputl;
+  lineColumnEagerv(chunk_contextp->marpaESLIFTester_context.inputs, consumedl, &eagerLinel, &eagerColumnl);
+  if ((linel != eagerLinel) || (columnl != eagerColumnl)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Line/column with chunks of %ld bytes: after %ld bytes got line %ld column %ld instead of line %ld column %ld", (unsigned long) chunk_contextp->chunkl, (unsigned long) consumedl, (unsigned long) linel, (unsigned long) columnl, (unsigned long) eagerLinel, (unsigned long) eagerColumnl);
+    return 0;
+  }
+
+  return 1;
+}
+
+/****************************************************************************/
+static void lineColumnEagerv(const char *inputs, size_t inputl, size_t *linelp, size_t *columnlp)
+/****************************************************************************/
+{
+  /* Reference count, one UTF-8 character at a time: \r\n, \n, \x0b, \f, \r, \x85, \x{2028} and \x{2029} are newlines */
+  const unsigned char *p    = (const unsigned char *) inputs;
+  const unsigned char *maxp = p + inputl;
+  size_t               linel   = 1;
+  size_t               columnl = 1;
+
+  while (p < maxp) {
+    if ((*p == '\r') && ((p + 1) < maxp) && (p[1] == '\n')) {
+      p += 2;
+    } else if ((*p == '\r') || (*p == '\n') || (*p == 0x0B) || (*p == 0x0C)) {
+      p++;
+    } else if (((p + 1) < maxp) && (p[0] == 0xC2) && (p[1] == 0x85)) {
+      p += 2;
+    } else if (((p + 2) < maxp) && (p[0] == 0xE2) && (p[1] == 0x80) && ((p[2] == 0xA8) || (p[2] == 0xA9))) {
+      p += 3;
+    } else {
+      p += (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+      columnl++;
+      continue;
+    }
+    linel++;
+    columnl = 1;
+  }
+
+  *linelp   = linel;
+  *columnlp = columnl;
+}
+
+/* UTF-8 character streams are validated in place: characters split across reads, */
+/* invalid sequences and BOM, with a declared and with a guessed encoding.        */
+typedef struct utf8Passthrough_test {
+  char *descs;
+  char *inputs;
+  char *encodings;
+  char *expecteds; /* Lexeme without BOM, NULL when input must be rejected */
+} utf8Passthrough_test_t;
+
+/****************************************************************************/
+static short utf8Passthroughb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* The lexeme takes any character: only an invalid input can fail */
+  static const char            *dsls = "text ::= CHARS\n"
+                                       ":symbol ::= CHARS pause => after event => CHARS$\n"
+                                       "CHARS ~ /.+/su\n";
+  static utf8Passthrough_test_t tests[] = {
+    { "multibyte characters",                   "x\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y",              "UTF-8", "x\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y" },
+    { "multibyte characters, guessed",          "x\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y",              NULL,    "x\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y" },
+    { "BOM",                                    "\xEF\xBB\xBF\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y",     "UTF-8", "\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y" },
+    { "BOM, guessed",                           "\xEF\xBB\xBF\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y",     NULL,    "\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80y" },
+    { "bad continuation byte",                  "x\xC3(y",                                        "UTF-8", NULL },
+    { "lone continuation byte",                 "x\xA9y",                                         "UTF-8", NULL },
+    { "overlong form",                          "x\xE0\x80\xAFy",                                 "UTF-8", NULL },
+    { "surrogate",                              "x\xED\xA0\x80y",                                 "UTF-8", NULL },
+    { "above U+10FFFF",                         "x\xF4\x90\x80\x80y",                             "UTF-8", NULL },
+    { "incomplete character at eof",            "x\xE6\x97",                                      "UTF-8", NULL }
+  };
+  static const size_t           chunkls[] = { 1, 2, 3, 4096 };
+  marpaESLIFGrammar_t          *marpaESLIFGrammarp    = NULL;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFGrammarOption_t     marpaESLIFGrammarOption;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  chunk_context_t               chunk_context;
+  short                         continueb;
+  short                         exhaustedb;
+  short                         okb;
+  char                         *pauses;
+  size_t                        pausel;
+  char                          lexemes[64];
+  size_t                        lexemel;
+  size_t                        eventArrayl;
+  marpaESLIFEvent_t            *eventArrayp;
+  size_t                        i;
+  size_t                        j;
+  size_t                        k;
+  short                         rcb;
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &chunk_context;
+  marpaESLIFRecognizerOption.readerCallbackp = chunkReaderb;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    for (j = 0; j < sizeof(chunkls) / sizeof(chunkls[0]); j++) {
+      memset(&chunk_context, 0, sizeof(chunk_context));
+      chunk_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+      chunk_context.marpaESLIFTester_context.inputs         = tests[i].inputs;
+      chunk_context.marpaESLIFTester_context.inputl         = strlen(tests[i].inputs);
+      chunk_context.chunkl                                  = chunkls[j];
+      chunk_context.encodings                               = tests[i].encodings;
+
+      marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+      marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+      if (marpaESLIFRecognizerp == NULL) {
+        goto err;
+      }
+
+      lexemel = 0;
+      okb = marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 0 /* initialEventsb */, &continueb, &exhaustedb);
+      while (okb) {
+        if (! marpaESLIFRecognizer_eventb(marpaESLIFRecognizerp, &eventArrayl, &eventArrayp)) {
+          goto err;
+        }
+        for (k = 0; k < eventArrayl; k++) {
+          if ((eventArrayp[k].events != NULL) && (strcmp(eventArrayp[k].events, "CHARS$") == 0)) {
+            if ((! marpaESLIFRecognizer_name_last_pauseb(marpaESLIFRecognizerp, "CHARS", &pauses, &pausel)) || (pausel > sizeof(lexemes))) {
+              goto err;
+            }
+            memcpy(lexemes, pauses, pausel);
+            lexemel = pausel;
+          }
+        }
+        if (! continueb) {
+          break;
+        }
+        okb = marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb);
+      }
+
+      if (tests[i].expecteds == NULL) {
+        if (okb) {
+          GENERICLOGGER_ERRORF(genericLoggerp, "UTF-8 passthrough, %s, chunks of %ld bytes: input is not rejected", tests[i].descs, (unsigned long) chunkls[j]);
+          goto err;
+        }
+      } else if ((! okb) || (lexemel != strlen(tests[i].expecteds)) || (memcmp(lexemes, tests[i].expecteds, lexemel) != 0)) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "UTF-8 passthrough, %s, chunks of %ld bytes: unexpected %s", tests[i].descs, (unsigned long) chunkls[j], okb ? "lexeme" : "failure");
+        goto err;
+      }
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "UTF-8 passthrough, %s: %s", tests[i].descs, (tests[i].expecteds != NULL) ? "ok" : "rejected as expected");
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/* An event as delivered by marpaESLIFRecognizer_eventb(). Grammar events are */
+/* delivered again at every pause until the next earley set, so a run keeps */
+/* the first occurrence of each event only: this is the generation order.    */
+#define EVENTMASK_MAXRECORD 64
+typedef struct eventMask_record {
+  marpaESLIFEventType_t type;
+  char                  names[32]; /* Empty for exhaustion */
+} eventMask_record_t;
+
+/****************************************************************************/
+static short eventMaskb(marpaESLIF_t *marpaESLIFp, genericLogger_t *genericLoggerp)
+/****************************************************************************/
+{
+  /* Several event types, and several events of the same type, at the same place. */
+  /* A before pause would need the lexeme to be pushed by hand, so there is none.   */
+  static const char         *dsls = ":discard ::= /[\\s]+/ event => ws$\n"
+                                    "top ::= head opt B tail\n"
+                                    "head ::= inner\n"
+                                    "inner ::= A\n"
+                                    "opt ::=\n"
+                                    "tail ::= C\n"
+                                    "event ^head = predicted head\n"
+                                    "event ^inner = predicted inner\n"
+                                    "event inner$ = completed inner\n"
+                                    "event head$ = completed head\n"
+                                    "event opt[] = nulled opt\n"
+                                    "event ^tail = predicted tail\n"
+                                    "event tail$ = completed tail\n"
+                                    ":symbol ::= B pause => after event => B$\n"
+                                    "A ~ 'a'\n"
+                                    "B ~ 'b'\n"
+                                    "C ~ 'c'\n";
+  static marpaESLIFEventType_t eventSets[] = {
+    MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD,
+    MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD,
+    MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_EXHAUSTED,
+    MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_DISCARD,
+    MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_DISCARD,
+    MARPAESLIF_EVENTTYPE_NONE
+  };
+  marpaESLIFGrammar_t         *marpaESLIFGrammarp = NULL;
+  marpaESLIFGrammarOption_t    marpaESLIFGrammarOption;
+  eventMask_record_t           allRecords[EVENTMASK_MAXRECORD];
+  eventMask_record_t           records[EVENTMASK_MAXRECORD];
+  size_t                       allRecordl;
+  size_t                       recordl;
+  size_t                       expectedl;
+  marpaESLIFEventType_t        allEventSeti;
+  size_t                       i;
+  size_t                       j;
+  short                        rcb;
+
+  marpaESLIFGrammarOption.bytep     = (void *) dsls;
+  marpaESLIFGrammarOption.bytel     = strlen(dsls);
+  marpaESLIFGrammarOption.encodings = NULL;
+  marpaESLIFGrammarOption.encodingl = 0;
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+
+  /* Reference: all event types */
+  if (! eventMaskRunb(genericLoggerp, marpaESLIFGrammarp, MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_BEFORE|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD, allRecords, &allRecordl)) {
+    goto err;
+  }
+  allEventSeti = MARPAESLIF_EVENTTYPE_NONE;
+  for (i = 0; i < allRecordl; i++) {
+    allEventSeti |= allRecords[i].type;
+  }
+  if (allEventSeti != (MARPAESLIF_EVENTTYPE_COMPLETED|MARPAESLIF_EVENTTYPE_NULLED|MARPAESLIF_EVENTTYPE_PREDICTED|MARPAESLIF_EVENTTYPE_AFTER|MARPAESLIF_EVENTTYPE_EXHAUSTED|MARPAESLIF_EVENTTYPE_DISCARD)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Event mask: reference run generated event types 0x%x only", (unsigned int) allEventSeti);
+    goto err;
+  }
+
+  /* With a mask, what is delivered is exactly the reference without the masked types, in the same order */
+  for (i = 0; i < sizeof(eventSets) / sizeof(eventSets[0]); i++) {
+    if (! eventMaskRunb(genericLoggerp, marpaESLIFGrammarp, eventSets[i], records, &recordl)) {
+      goto err;
+    }
+    expectedl = 0;
+    for (j = 0; j < allRecordl; j++) {
+      if ((allRecords[j].type & eventSets[i]) == 0) {
+        continue;
+      }
+      if ((expectedl >= recordl) || (records[expectedl].type != allRecords[j].type) || (strcmp(records[expectedl].names, allRecords[j].names) != 0)) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Event mask 0x%x: event No %ld should be %s", (unsigned int) eventSets[i], (unsigned long) expectedl, allRecords[j].names);
+        goto err;
+      }
+      expectedl++;
+    }
+    if (expectedl != recordl) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Event mask 0x%x: %ld events instead of %ld", (unsigned int) eventSets[i], (unsigned long) recordl, (unsigned long) expectedl);
+      goto err;
+    }
+    GENERICLOGGER_INFOF(genericLoggerp, "Event mask 0x%x: %ld of %ld events delivered", (unsigned int) eventSets[i], (unsigned long) recordl, (unsigned long) allRecordl);
+  }
+
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  return rcb;
+}
+
+/****************************************************************************/
+static short eventMaskRunb(genericLogger_t *genericLoggerp, marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFEventType_t eventSeti, void *recordsp, size_t *recordlp)
+/****************************************************************************/
+{
+  static const char            *inputs             = "a bc";
+  eventMask_record_t           *records            = (eventMask_record_t *) recordsp;
+  size_t                        recordl            = 0;
+  marpaESLIFRecognizer_t       *marpaESLIFRecognizerp = NULL;
+  marpaESLIFRecognizerOption_t  marpaESLIFRecognizerOption;
+  chunk_context_t               chunk_context;
+  short                         continueb;
+  short                         exhaustedb;
+  size_t                        eventArrayl;
+  marpaESLIFEvent_t            *eventArrayp;
+  size_t                        i;
+  size_t                        j;
+  short                         rcb;
+
+  memset(&chunk_context, 0, sizeof(chunk_context));
+  chunk_context.marpaESLIFTester_context.genericLoggerp = genericLoggerp;
+  chunk_context.marpaESLIFTester_context.inputs         = (char *) inputs;
+  chunk_context.marpaESLIFTester_context.inputl         = strlen(inputs);
+  chunk_context.chunkl                                  = strlen(inputs);
+
+  memset(&marpaESLIFRecognizerOption, 0, sizeof(marpaESLIFRecognizerOption));
+  marpaESLIFRecognizerOption.userDatavp      = &chunk_context;
+  marpaESLIFRecognizerOption.readerCallbackp = chunkReaderb;
+  marpaESLIFRecognizerOption.exhaustedb      = 1;
+  marpaESLIFRecognizerOption.buftriggerperci = 50;
+  marpaESLIFRecognizerOption.bufaddperci     = 50;
+
+  marpaESLIFRecognizerp = marpaESLIFRecognizer_newp(marpaESLIFGrammarp, &marpaESLIFRecognizerOption);
+  if (marpaESLIFRecognizerp == NULL) {
+    goto err;
+  }
+  if (! marpaESLIFRecognizer_event_maskb(marpaESLIFRecognizerp, eventSeti, NULL)) {
+    goto err;
+  }
+
+  if (! marpaESLIFRecognizer_scanb(marpaESLIFRecognizerp, 1 /* initialEventsb */, &continueb, &exhaustedb)) {
+    goto err;
+  }
+  while (1) {
+    if (! marpaESLIFRecognizer_eventb(marpaESLIFRecognizerp, &eventArrayl, &eventArrayp)) {
+      goto err;
+    }
+    for (i = 0; i < eventArrayl; i++) {
+      if ((eventArrayp[i].type & eventSeti) == 0) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Event mask 0x%x: got masked event %s", (unsigned int) eventSeti, (eventArrayp[i].events != NULL) ? eventArrayp[i].events : "of exhaustion");
+        goto err;
+      }
+      for (j = 0; j < recordl; j++) {
+        if ((records[j].type == eventArrayp[i].type) && (strcmp(records[j].names, (eventArrayp[i].events != NULL) ? eventArrayp[i].events : "") == 0)) {
+          break;
+        }
+      }
+      if (j < recordl) {
+        continue;
+      }
+      if (recordl >= EVENTMASK_MAXRECORD) {
+        GENERICLOGGER_ERROR(genericLoggerp, "Event mask: too many events");
+        goto err;
+      }
+      records[recordl].type = eventArrayp[i].type;
+      strncpy(records[recordl].names, (eventArrayp[i].events != NULL) ? eventArrayp[i].events : "", sizeof(records[recordl].names) - 1);
+      records[recordl].names[sizeof(records[recordl].names) - 1] = '\0';
+      recordl++;
+    }
+    if (! continueb) {
+      break;
+    }
+    if (! marpaESLIFRecognizer_resumeb(marpaESLIFRecognizerp, 0, &continueb, &exhaustedb)) {
+      goto err;
+    }
+  }
+
+  *recordlp = recordl;
+  rcb = 1;
+  goto done;
+
+ err:
+  rcb = 0;
+
+ done:
+  marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
+  return rcb;
+}
+
+/*****************************************************************************/
+static short chunkReaderb(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp)
+/*****************************************************************************/
+{
+  chunk_context_t *chunk_contextp = (chunk_context_t *) userDatavp;
+  size_t           chunkl         = chunk_contextp->marpaESLIFTester_context.inputl - chunk_contextp->readl;
+
+  if (chunkl > chunk_contextp->chunkl) {
+    chunkl = chunk_contextp->chunkl;
+  }
+
+  *inputsp              = chunk_contextp->marpaESLIFTester_context.inputs + chunk_contextp->readl;
+  *inputlp              = chunkl;
+  *eofbp                = ((chunk_contextp->readl + chunkl) >= chunk_contextp->marpaESLIFTester_context.inputl) ? 1 : 0;
+  *characterStreambp    = 1;
+  *encodingsp           = chunk_contextp->encodings;
+  *encodinglp           = (chunk_contextp->encodings != NULL) ? strlen(chunk_contextp->encodings) : 0;
+  *disposeCallbackpp    = NULL;
+
+  chunk_contextp->readl += chunkl;
+
+  return 1;
+}
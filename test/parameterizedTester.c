@@ -9,6 +9,8 @@ static const char *ASCIIs = "ASCII";
 
 static short inputReaderb(void *userDatavp, char **inputsp, size_t *inputlp, short *eofbp, short *characterStreambp, char **encodingsp, size_t *encodinglp, marpaESLIFReaderDispose_t *disposeCallbackpp);
 static short rhsb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *contextp, marpaESLIFValueResultString_t *marpaESLIFValueResultOutp);
+static short roundb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *contextp, marpaESLIFValueResultString_t *marpaESLIFValueResultOutp);
+static short roundParseb(genericLogger_t *genericLoggerp, marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, int roundi, marpaESLIFGrammarGeneratorCacheStats_t *generatorCacheStatsp);
 static marpaESLIFRecognizerGeneratorCallback_t generatorActionResolverp(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *actions);
 static void  stringFreeCallbackv(void *userDatavp, marpaESLIFValueResult_t *marpaESLIFValueResultp);
 
@@ -16,8 +18,10 @@ typedef struct marpaESLIF_context {
   genericLogger_t *genericLoggerp;
   char            *inputs;
   size_t           inputl;
+  char             roundinputs[16];
   short            parsemodeb; /* Mark the test case using marpaESLIFGrammar_parseb */
   int              parsemodei; /* To avoid ambiguity in the marpaESLIFGrammar_parseb case */
+  int              roundi;     /* Value generated by roundb */
 } marpaESLIF_context_t;
 
 const static char *grammars = "# Parameterized grammar\n"
@@ -40,6 +44,36 @@ const static char *grammars = "# Parameterized grammar\n"
 
 const static char *inputs = "5";
 
+/* Each parse generates the grammar '<round>': the generator cache sees as many */
+/* distinct grammars as there are distinct rounds.                              */
+const static char *roundGrammars = "# Generator cache eviction\n"
+  "top ::= . => round-->()\n"
+  ;
+
+/* Rounds and the expected generator cache statistics after each of them, with */
+/* at most two cached grammars: 1, 2 and 3 do not fit together.                 */
+#define ROUND_WINDOW_STARTI 100
+#define ROUND_WINDOWL       40
+
+typedef struct marpaESLIF_round {
+  int           roundi;
+  unsigned long entriesl;
+  unsigned long hitl;
+  unsigned long missl;
+  unsigned long evictionl;
+} marpaESLIF_round_t;
+
+const static marpaESLIF_round_t rounds[] = {
+  { 1, 1, 0, 1, 0 }, /* [1]   */
+  { 2, 2, 0, 2, 0 }, /* [2 1] */
+  { 1, 2, 1, 2, 0 }, /* [1 2] */
+  { 3, 2, 1, 3, 1 }, /* [3 1] - 2 is the least recently used */
+  { 2, 2, 1, 4, 2 }, /* [2 3] */
+  { 1, 2, 1, 5, 3 }, /* [1 2] */
+  { 1, 2, 2, 5, 3 }, /* [1 2] */
+  { 2, 2, 3, 5, 3 }  /* [2 1] */
+};
+
 int main() {
   marpaESLIF_t                *marpaESLIFp        = NULL;
   marpaESLIFGrammar_t         *marpaESLIFGrammarp = NULL;
@@ -60,10 +94,20 @@ int main() {
   marpaESLIFRecognizer_t      *marpaESLIFRecognizerp = NULL;
   short                        continueb;
   short                        exhaustedb;
+  marpaESLIFGrammarGeneratorCacheStats_t generatorCacheStats;
+  marpaESLIFGrammar_t         *roundGrammarp = NULL;
+  size_t                       roundl;
+  int                          roundi;
+  int                          windowi;
+  unsigned long                entriesl;
+  unsigned long                hitl;
+  unsigned long                missl;
+  unsigned long                evictionl;
 
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_INFO);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -97,6 +141,7 @@ int main() {
   marpaESLIF_context.inputl         = strlen(inputs);
   marpaESLIF_context.parsemodeb     = 0;
   marpaESLIF_context.parsemodei     = 0;
+  marpaESLIF_context.roundi         = 0;
 
   marpaESLIFRecognizerOption.userDatavp        = &marpaESLIF_context; /* User specific context */
   marpaESLIFRecognizerOption.readerCallbackp   = inputReaderb; /* Reader */
@@ -112,6 +157,7 @@ int main() {
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = generatorActionResolverp;
   marpaESLIFRecognizerOption.importerp                = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl        = 0;
 
   GENERICLOGGER_LEVEL_SET(genericLoggerp, GENERICLOGGER_LOGLEVEL_TRACE);
   GENERICLOGGER_NOTICE(genericLoggerp, "Testing interactive recognizer");
@@ -132,6 +178,16 @@ int main() {
   marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
   marpaESLIFRecognizerp = NULL;
 
+  if (! marpaESLIFGrammar_generator_cache_statsb(marpaESLIFGrammarp, &generatorCacheStats)) {
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Generator cache: entries=%lu, bytes=%lu, hits=%lu, misses=%lu, evictions=%lu", (unsigned long) generatorCacheStats.entriesl, (unsigned long) generatorCacheStats.bytesl, (unsigned long) generatorCacheStats.hitl, (unsigned long) generatorCacheStats.missl, (unsigned long) generatorCacheStats.evictionl);
+
+  /* Keep at most one generated grammar from now on */
+  if (! marpaESLIFGrammar_generator_cache_limitb(marpaESLIFGrammarp, 1 /* maxEntriesl */, 0 /* maxBytesl */)) {
+    goto err;
+  }
+
   GENERICLOGGER_NOTICE(genericLoggerp, "Testing parse");
   marpaESLIF_context.inputs         = (char *) inputs;
   marpaESLIF_context.inputl         = strlen(inputs);
@@ -140,6 +196,83 @@ int main() {
     goto err;
   }
 
+  if (! marpaESLIFGrammar_generator_cache_statsb(marpaESLIFGrammarp, &generatorCacheStats)) {
+    goto err;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Generator cache: entries=%lu, bytes=%lu, hits=%lu, misses=%lu, evictions=%lu", (unsigned long) generatorCacheStats.entriesl, (unsigned long) generatorCacheStats.bytesl, (unsigned long) generatorCacheStats.hitl, (unsigned long) generatorCacheStats.missl, (unsigned long) generatorCacheStats.evictionl);
+  if (generatorCacheStats.entriesl > 1) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Generator cache has %lu entries, expected at most 1", (unsigned long) generatorCacheStats.entriesl);
+    goto err;
+  }
+
+  GENERICLOGGER_NOTICE(genericLoggerp, "Testing generator cache eviction");
+  marpaESLIFGrammarOption.bytep               = (void *) roundGrammars;
+  marpaESLIFGrammarOption.bytel               = strlen(roundGrammars);
+  marpaESLIFGrammarOption.encodings           = NULL;
+  marpaESLIFGrammarOption.encodingl           = 0;
+  roundGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (roundGrammarp == NULL) {
+    goto err;
+  }
+  if (! marpaESLIFGrammar_generator_cache_limitb(roundGrammarp, 2 /* maxEntriesl */, 0 /* maxBytesl */)) {
+    goto err;
+  }
+  for (roundl = 0; roundl < sizeof(rounds) / sizeof(rounds[0]); roundl++) {
+    if (! roundParseb(genericLoggerp, roundGrammarp, &marpaESLIFRecognizerOption, rounds[roundl].roundi, &generatorCacheStats)) {
+      goto err;
+    }
+    if ((generatorCacheStats.entriesl   != rounds[roundl].entriesl) ||
+        (generatorCacheStats.hitl       != rounds[roundl].hitl)     ||
+        (generatorCacheStats.missl      != rounds[roundl].missl)    ||
+        (generatorCacheStats.evictionl  != rounds[roundl].evictionl)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Round %d: expected entries=%ld, hits=%ld, misses=%ld, evictions=%ld", rounds[roundl].roundi, rounds[roundl].entriesl, rounds[roundl].hitl, rounds[roundl].missl, rounds[roundl].evictionl);
+      goto err;
+    }
+  }
+  entriesl  = generatorCacheStats.entriesl;
+  hitl      = generatorCacheStats.hitl;
+  missl     = generatorCacheStats.missl;
+  evictionl = generatorCacheStats.evictionl;
+
+  /* Sliding window over ROUND_WINDOWL grammars: rounds i-3, i-2 and i-1 are hits, */
+  /* round i is a miss that evicts the least recently used grammar once the cache  */
+  /* is full. Survivors are looked up again after every removal from the hash.     */
+  if (! marpaESLIFGrammar_generator_cache_limitb(roundGrammarp, 4 /* maxEntriesl */, 0 /* maxBytesl */)) {
+    goto err;
+  }
+  for (roundi = ROUND_WINDOW_STARTI; roundi < ROUND_WINDOW_STARTI + ROUND_WINDOWL; roundi++) {
+    for (windowi = 3; windowi >= 0; windowi--) {
+      if ((roundi - windowi) < ROUND_WINDOW_STARTI) {
+        continue;
+      }
+      if (! roundParseb(genericLoggerp, roundGrammarp, &marpaESLIFRecognizerOption, roundi - windowi, &generatorCacheStats)) {
+        goto err;
+      }
+      if (windowi > 0) {
+        hitl++;
+      } else {
+        missl++;
+        if (entriesl >= 4) {
+          evictionl++;
+        } else {
+          entriesl++;
+        }
+      }
+      if (generatorCacheStats.entriesl > 4) {
+        GENERICLOGGER_ERRORF(genericLoggerp, "Round %d: generator cache has %lu entries, expected at most 4", roundi - windowi, (unsigned long) generatorCacheStats.entriesl);
+        goto err;
+      }
+    }
+    if ((generatorCacheStats.entriesl != entriesl) || (generatorCacheStats.hitl != hitl) || (generatorCacheStats.missl != missl) || (generatorCacheStats.evictionl != evictionl)) {
+      GENERICLOGGER_ERRORF(genericLoggerp, "Round %d: expected entries=%ld, hits=%ld, misses=%ld, evictions=%ld", roundi, entriesl, hitl, missl, evictionl);
+      goto err;
+    }
+  }
+  if (generatorCacheStats.entriesl != 4) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Generator cache has %lu entries, expected 4", (unsigned long) generatorCacheStats.entriesl);
+    goto err;
+  }
+
   exiti = 0;
   goto done;
 
@@ -150,6 +283,7 @@ int main() {
   if (marpaESLIFRecognizerp != NULL) {
     marpaESLIFRecognizer_freev(marpaESLIFRecognizerp);
   }
+  marpaESLIFGrammar_freev(roundGrammarp);
   marpaESLIFGrammar_freev(marpaESLIFGrammarp);
   marpaESLIF_freev(marpaESLIFp);
   GENERICLOGGER_LEVEL_SET(marpaESLIFOption.genericLoggerp, GENERICLOGGER_LOGLEVEL_INFO);
@@ -259,12 +393,60 @@ static short rhsb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizer
   return 1;
 }
 
+/*****************************************************************************/
+static short roundb(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, marpaESLIFValueResult_t *contextp, marpaESLIFValueResultString_t *marpaESLIFValueResultOutp)
+/*****************************************************************************/
+{
+  marpaESLIF_context_t *marpaESLIF_contextp = (marpaESLIF_context_t *) userDatavp;
+  char                 *outputs;
+
+  outputs = (char *) malloc(16);
+  if (outputs == NULL) {
+    fprintf(stderr, "malloc failure, %s\n", strerror(errno));
+    return 0;
+  }
+  sprintf(outputs, "'%d'", marpaESLIF_contextp->roundi);
+
+  marpaESLIFValueResultOutp->p              = (unsigned char *) outputs;
+  marpaESLIFValueResultOutp->freeUserDatavp = (void *) marpaESLIF_contextp;
+  marpaESLIFValueResultOutp->freeCallbackp  = stringFreeCallbackv;
+  marpaESLIFValueResultOutp->shallowb       = 0;
+  marpaESLIFValueResultOutp->sizel          = strlen(outputs);
+  marpaESLIFValueResultOutp->encodingasciis = (char *) ASCIIs;
+
+  return 1;
+}
+
+/*****************************************************************************/
+static short roundParseb(genericLogger_t *genericLoggerp, marpaESLIFGrammar_t *marpaESLIFGrammarp, marpaESLIFRecognizerOption_t *marpaESLIFRecognizerOptionp, int roundi, marpaESLIFGrammarGeneratorCacheStats_t *generatorCacheStatsp)
+/*****************************************************************************/
+{
+  marpaESLIF_context_t *marpaESLIF_contextp = (marpaESLIF_context_t *) marpaESLIFRecognizerOptionp->userDatavp;
+
+  sprintf(marpaESLIF_contextp->roundinputs, "%d", roundi);
+  marpaESLIF_contextp->inputs = marpaESLIF_contextp->roundinputs;
+  marpaESLIF_contextp->inputl = strlen(marpaESLIF_contextp->roundinputs);
+  marpaESLIF_contextp->roundi = roundi;
+  if (! marpaESLIFGrammar_parseb(marpaESLIFGrammarp, marpaESLIFRecognizerOptionp, NULL /* marpaESLIFValueOptionp */, NULL /* exhaustedbp */)) {
+    GENERICLOGGER_ERRORF(genericLoggerp, "Round %d: parse failure", roundi);
+    return 0;
+  }
+  if (! marpaESLIFGrammar_generator_cache_statsb(marpaESLIFGrammarp, generatorCacheStatsp)) {
+    return 0;
+  }
+  GENERICLOGGER_INFOF(genericLoggerp, "Round %d: generator cache: entries=%lu, bytes=%lu, hits=%lu, misses=%lu, evictions=%lu", roundi, (unsigned long) generatorCacheStatsp->entriesl, (unsigned long) generatorCacheStatsp->bytesl, (unsigned long) generatorCacheStatsp->hitl, (unsigned long) generatorCacheStatsp->missl, (unsigned long) generatorCacheStatsp->evictionl);
+
+  return 1;
+}
+
 /*****************************************************************************/
 static marpaESLIFRecognizerGeneratorCallback_t generatorActionResolverp(void *userDatavp, marpaESLIFRecognizer_t *marpaESLIFRecognizerp, char *actions)
 /*****************************************************************************/
 {
   if (strcmp(actions, "rhs") == 0) {
     return rhsb;
+  } else if (strcmp(actions, "round") == 0) {
+    return roundb;
   } else {
     fprintf(stderr, "Unsupported generator action \"%s\"\n", actions);
     return NULL;
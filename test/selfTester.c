@@ -717,10 +717,22 @@ int main() {
   size_t                       discardLastl;
   short                        continueb;
   short                        exhaustedb;
+  char                        *regexCaches;
+  size_t                       regexCachel;
+  char                        *regexCacheCopys = NULL;
+  char                        *regexCacheBads  = NULL;
+  size_t                       regexCacheKeyl;
+  size_t                       regexCacheEntryl;
+  size_t                       regexCacheShortl;
+  size_t                       regexCacheOffsetl;
+  int                          regexCacheBadi;
+  marpaESLIFRegexCacheStats_t  regexCacheStats;
+  marpaESLIFRegexCacheStats_t  regexCacheImportStats;
 
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_INFO);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -781,12 +793,108 @@ int main() {
   marpaESLIFGrammarOption.bytel               = strlen(selfs);
   marpaESLIFGrammarOption.encodings           = UTF_8_STRING;
   marpaESLIFGrammarOption.encodingl           = strlen(UTF_8_STRING);
+
+  /* Populate the compiled regex cache with a first grammar, export it, and start again from an empty */
+  /* cache filled by the import only: every regex of the test grammar must then come from the import. */
+  if (! marpaESLIF_regex_cacheb(marpaESLIFp, 1)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cacheb failure, %s", strerror(errno));
+    goto err;
+  }
+  marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
+  if (marpaESLIFGrammarp == NULL) {
+    goto err;
+  }
+  marpaESLIFGrammar_freev(marpaESLIFGrammarp);
+  marpaESLIFGrammarp = NULL;
+  if (! marpaESLIF_regex_cache_statsb(marpaESLIFp, &regexCacheStats)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_statsb failure, %s", strerror(errno));
+    goto err;
+  }
+  if ((regexCacheStats.entriesl <= 0) || (regexCacheStats.missl < regexCacheStats.entriesl)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "Regex cache has %lu entries after %lu misses", (unsigned long) regexCacheStats.entriesl, (unsigned long) regexCacheStats.missl);
+    goto err;
+  }
+  if (! marpaESLIF_regex_cache_exportb(marpaESLIFp, &regexCaches, &regexCachel)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_exportb failure, %s", strerror(errno));
+    goto err;
+  }
+  GENERICLOGGER_INFOF(marpaESLIFOption.genericLoggerp, "Regex cache export is %lu bytes", (unsigned long) regexCachel);
+  /* The export area belongs to ESLIF, and disabling the cache frees it */
+  regexCacheCopys = (char *) malloc(regexCachel);
+  if (regexCacheCopys == NULL) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  memcpy(regexCacheCopys, regexCaches, regexCachel);
+  if (! marpaESLIF_regex_cacheb(marpaESLIFp, 0)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cacheb failure, %s", strerror(errno));
+    goto err;
+  }
+
+  /* A truncated area is rejected */
+  if (marpaESLIF_regex_cache_importb(marpaESLIFp, regexCacheCopys, regexCachel - 1) || (errno != EINVAL)) {
+    GENERICLOGGER_ERROR(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_importb accepted a truncated area");
+    goto err;
+  }
+  if (! marpaESLIF_regex_cacheb(marpaESLIFp, 0)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cacheb failure, %s", strerror(errno));
+    goto err;
+  }
+
+  /* The first entry alone, with a shortened serialized pattern: empty, then one byte short. */
+  /* It fits in the area, but PCRE2 would read past it: it must be rejected.                  */
+  memcpy(&regexCacheKeyl, regexCacheCopys + 8 /* magic */, sizeof(size_t));
+  regexCacheOffsetl = 8 + sizeof(size_t) + regexCacheKeyl;
+  memcpy(&regexCacheEntryl, regexCacheCopys + regexCacheOffsetl, sizeof(size_t));
+  regexCacheBads = (char *) malloc(regexCacheOffsetl + sizeof(size_t) + regexCacheEntryl);
+  if (regexCacheBads == NULL) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "malloc failure, %s", strerror(errno));
+    goto err;
+  }
+  memcpy(regexCacheBads, regexCacheCopys, regexCacheOffsetl + sizeof(size_t) + regexCacheEntryl);
+  for (regexCacheBadi = 0; regexCacheBadi < 2; regexCacheBadi++) {
+    regexCacheShortl = (regexCacheBadi == 0) ? 0 : regexCacheEntryl - 1;
+    memcpy(regexCacheBads + regexCacheOffsetl, &regexCacheShortl, sizeof(size_t));
+    if (marpaESLIF_regex_cache_importb(marpaESLIFp, regexCacheBads, regexCacheOffsetl + sizeof(size_t) + regexCacheShortl) || (errno != EINVAL)) {
+      GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_importb accepted a serialized pattern of %lu bytes instead of %lu", (unsigned long) regexCacheShortl, (unsigned long) regexCacheEntryl);
+      goto err;
+    }
+    if (! marpaESLIF_regex_cacheb(marpaESLIFp, 0)) {
+      GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cacheb failure, %s", strerror(errno));
+      goto err;
+    }
+  }
+
+  if (! marpaESLIF_regex_cache_importb(marpaESLIFp, regexCacheCopys, regexCachel)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_importb failure, %s", strerror(errno));
+    goto err;
+  }
+  if (! marpaESLIF_regex_cache_statsb(marpaESLIFp, &regexCacheImportStats)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_statsb failure, %s", strerror(errno));
+    goto err;
+  }
+  if (regexCacheImportStats.entriesl != regexCacheStats.entriesl) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "Regex cache import gave %lu entries instead of %lu", (unsigned long) regexCacheImportStats.entriesl, (unsigned long) regexCacheStats.entriesl);
+    goto err;
+  }
+
   marpaESLIFGrammarp = marpaESLIFGrammar_newp(marpaESLIFp, &marpaESLIFGrammarOption);
 
   if (marpaESLIFGrammarp == NULL) {
     goto err;
   }
 
+  /* The same lookups as with the first grammar, all of them restoring an imported regex */
+  if (! marpaESLIF_regex_cache_statsb(marpaESLIFp, &regexCacheImportStats)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "marpaESLIF_regex_cache_statsb failure, %s", strerror(errno));
+    goto err;
+  }
+  if ((regexCacheImportStats.missl != regexCacheStats.missl) || (regexCacheImportStats.hitl != (regexCacheStats.hitl * 2) + regexCacheStats.missl)) {
+    GENERICLOGGER_ERRORF(marpaESLIFOption.genericLoggerp, "Regex cache after import: %lu hits and %lu misses instead of %lu and %lu", (unsigned long) regexCacheImportStats.hitl, (unsigned long) regexCacheImportStats.missl, (unsigned long) ((regexCacheStats.hitl * 2) + regexCacheStats.missl), (unsigned long) regexCacheStats.missl);
+    goto err;
+  }
+  GENERICLOGGER_INFOF(marpaESLIFOption.genericLoggerp, "Regex cache: %lu entries imported, %lu hits", (unsigned long) regexCacheImportStats.entriesl, (unsigned long) (regexCacheImportStats.hitl - regexCacheStats.hitl));
+
   /* Dump grammar */
   if (! marpaESLIFGrammar_ngrammarib(marpaESLIFGrammarp, &ngrammari)) {
     goto err;
@@ -828,6 +936,7 @@ int main() {
   marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
   marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
   marpaESLIFRecognizerOption.importerp                = NULL;
+  marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
   /* Test with events */
   GENERICLOGGER_LEVEL_SET(genericLoggerp, GENERICLOGGER_LOGLEVEL_TRACE);
@@ -993,6 +1102,12 @@ int main() {
   if (regexSymbolp != NULL) {
     marpaESLIFSymbol_freev(regexSymbolp);
   }
+  if (regexCacheCopys != NULL) {
+    free(regexCacheCopys);
+  }
+  if (regexCacheBads != NULL) {
+    free(regexCacheBads);
+  }
   GENERICLOGGER_LEVEL_SET(marpaESLIFOption.genericLoggerp, GENERICLOGGER_LOGLEVEL_INFO);
   marpaESLIFGrammar_freev(marpaESLIFGrammarp);
   marpaESLIF_freev(marpaESLIFp);
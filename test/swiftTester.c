@@ -133,6 +133,7 @@ int main(int argc, char **argv) {
   genericLoggerp = GENERICLOGGER_NEW(GENERICLOGGER_LOGLEVEL_INFO);
 
   marpaESLIFOption.genericLoggerp = genericLoggerp;
+  marpaESLIFOption.allocatorp     = NULL;
   marpaESLIFp = marpaESLIF_newp(&marpaESLIFOption);
   if (marpaESLIFp == NULL) {
     goto err;
@@ -256,6 +257,7 @@ int main(int argc, char **argv) {
       marpaESLIFRecognizerOption.eventActionResolverp     = NULL;
       marpaESLIFRecognizerOption.regexActionResolverp     = NULL;
       marpaESLIFRecognizerOption.generatorActionResolverp = NULL;
+      marpaESLIFRecognizerOption.maxMemoryl               = 0;
 
       if (marpaESLIFValuep != NULL) {
         marpaESLIFValue_freev(marpaESLIFValuep);